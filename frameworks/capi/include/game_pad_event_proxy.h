@@ -54,6 +54,12 @@ public:
     GameController_ErrorCode GetActionTimeFromButtonEvent(const struct GamePad_ButtonEvent* buttonEvent,
                                                           int64_t* actionTime);
 
+    GameController_ErrorCode GetOriginalTimeFromButtonEvent(const struct GamePad_ButtonEvent* buttonEvent,
+                                                            int64_t* originalTime);
+
+    GameController_ErrorCode GetDeliveryTimeFromButtonEvent(const struct GamePad_ButtonEvent* buttonEvent,
+                                                            int64_t* deliveryTime);
+
     GameController_ErrorCode GetDeviceIdFromAxisEvent(const struct GamePad_AxisEvent* axisEvent,
                                                       char** deviceId);
 
@@ -86,6 +92,12 @@ public:
 
     GameController_ErrorCode GetActionTimeFromAxisEvent(const struct GamePad_AxisEvent* axisEvent,
                                                         int64_t* actionTime);
+
+    GameController_ErrorCode GetOriginalTimeFromAxisEvent(const struct GamePad_AxisEvent* axisEvent,
+                                                          int64_t* originalTime);
+
+    GameController_ErrorCode GetDeliveryTimeFromAxisEvent(const struct GamePad_AxisEvent* axisEvent,
+                                                          int64_t* deliveryTime);
 };
 }
 }
@@ -166,6 +166,28 @@ GameController_ErrorCode GamePadEventProxy::GetActionTimeFromButtonEvent(
     return GameController_ErrorCode::GAME_CONTROLLER_SUCCESS;
 }
 
+GameController_ErrorCode GamePadEventProxy::GetOriginalTimeFromButtonEvent(
+    const struct GamePad_ButtonEvent* buttonEvent, int64_t* originalTime)
+{
+    if (buttonEvent == nullptr || originalTime == nullptr) {
+        HILOGE("[CAPI][GetOriginalTimeFromButtonEvent]buttonEvent or originalTime is nullptr");
+        return GameController_ErrorCode::GAME_CONTROLLER_PARAM_ERROR;
+    }
+    *originalTime = ((GamePadButtonEvent*)buttonEvent)->originalTime;
+    return GameController_ErrorCode::GAME_CONTROLLER_SUCCESS;
+}
+
+GameController_ErrorCode GamePadEventProxy::GetDeliveryTimeFromButtonEvent(
+    const struct GamePad_ButtonEvent* buttonEvent, int64_t* deliveryTime)
+{
+    if (buttonEvent == nullptr || deliveryTime == nullptr) {
+        HILOGE("[CAPI][GetDeliveryTimeFromButtonEvent]buttonEvent or deliveryTime is nullptr");
+        return GameController_ErrorCode::GAME_CONTROLLER_PARAM_ERROR;
+    }
+    *deliveryTime = ((GamePadButtonEvent*)buttonEvent)->deliveryTime;
+    return GameController_ErrorCode::GAME_CONTROLLER_SUCCESS;
+}
+
 GameController_ErrorCode GamePadEventProxy::GetDeviceIdFromAxisEvent(
     const struct GamePad_AxisEvent* axisEvent, char** deviceId)
 {
@@ -292,5 +314,27 @@ GameController_ErrorCode GamePadEventProxy::GetActionTimeFromAxisEvent(
     return GameController_ErrorCode::GAME_CONTROLLER_SUCCESS;
 }
 
+GameController_ErrorCode GamePadEventProxy::GetOriginalTimeFromAxisEvent(
+    const struct GamePad_AxisEvent* axisEvent, int64_t* originalTime)
+{
+    if (axisEvent == nullptr || originalTime == nullptr) {
+        HILOGE("[CAPI][GetOriginalTimeFromAxisEvent]axisEvent or originalTime is nullptr");
+        return GameController_ErrorCode::GAME_CONTROLLER_PARAM_ERROR;
+    }
+    *originalTime = ((GamePadAxisEvent*)axisEvent)->originalTime;
+    return GameController_ErrorCode::GAME_CONTROLLER_SUCCESS;
+}
+
+GameController_ErrorCode GamePadEventProxy::GetDeliveryTimeFromAxisEvent(
+    const struct GamePad_AxisEvent* axisEvent, int64_t* deliveryTime)
+{
+    if (axisEvent == nullptr || deliveryTime == nullptr) {
+        HILOGE("[CAPI][GetDeliveryTimeFromAxisEvent]axisEvent or deliveryTime is nullptr");
+        return GameController_ErrorCode::GAME_CONTROLLER_PARAM_ERROR;
+    }
+    *deliveryTime = ((GamePadAxisEvent*)axisEvent)->deliveryTime;
+    return GameController_ErrorCode::GAME_CONTROLLER_SUCCESS;
+}
+
 }
 }
\ No newline at end of file
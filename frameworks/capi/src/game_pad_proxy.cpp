@@ -329,6 +329,8 @@ int32_t GamePadButtonEventCallback::OnButtonEventCallback(const GamePadButtonEve
     gamePadButtonEvent->keyCode = event.keyCode;
     gamePadButtonEvent->keyCodeName = event.keyCodeName;
     gamePadButtonEvent->actionTime = event.actionTime;
+    gamePadButtonEvent->originalTime = event.originalTime;
+    gamePadButtonEvent->deliveryTime = event.deliveryTime;
     gamePadButtonEvent->keys = event.keys;
     gamePadButtonEvent->keyAction = event.keyAction;
     GamePad_ButtonEvent* temp = (GamePad_ButtonEvent*)gamePadButtonEvent;
@@ -365,6 +367,8 @@ int32_t GamePadAxisEventCallback::OnAxisEventCallback(const GamePadAxisEvent &ev
     gamePadAxisEvent->hatxValue = event.hatxValue;
     gamePadAxisEvent->hatyValue = event.hatyValue;
     gamePadAxisEvent->actionTime = event.actionTime;
+    gamePadAxisEvent->originalTime = event.originalTime;
+    gamePadAxisEvent->deliveryTime = event.deliveryTime;
     GamePad_AxisEvent* temp = (GamePad_AxisEvent*)gamePadAxisEvent;
     callback_(temp);
     if (gamePadAxisEvent != nullptr) {
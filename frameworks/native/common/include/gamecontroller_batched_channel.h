@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_BATCHED_CHANNEL_H
+#define GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_BATCHED_CHANNEL_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "gamecontroller_log.h"
+#include "gamecontroller_queue_registry.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * The buckets of the batch sizes: 1, 2, 3-4, 5-8, 9-16, 17-32, 33-64 and more than 64.
+ */
+const size_t BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT = 8;
+
+/**
+ * A drain task handles all the pending events.
+ */
+const size_t BATCHED_CHANNEL_UNLIMITED_BATCH_SIZE = std::numeric_limits<size_t>::max();
+
+/**
+ * The events handled by the drain tasks of a channel.
+ */
+struct BatchedChannelStats {
+    uint64_t eventCount = 0;
+    uint64_t batchCount = 0;
+
+    /**
+     * The events which waited in the overflow list because the ring was full.
+     */
+    uint64_t overflowCount = 0;
+    size_t maxBatchSize = 0;
+
+    /**
+     * The number of the drain tasks by their batch sizes. See BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT.
+     */
+    std::array<uint64_t, BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT> batchSizeHistogram{};
+
+    static size_t GetBucket(size_t batchSize)
+    {
+        size_t bucket = 0;
+        while (bucket < BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT - 1 && (static_cast<size_t>(1) << bucket) < batchSize) {
+            bucket++;
+        }
+        return bucket;
+    }
+};
+
+/**
+ * Queues the events of several senders in front of a queue, and handles them in order on it.
+ * The events are written into a ring of pre-sized slots, and a single drain task on the queue handles
+ * the pending ones, at most the max batch size per task. So a burst of events costs one task instead of one task
+ * per event. When more events are pending after a batch, the drain task submits itself again behind the tasks
+ * which are due.
+ * The senders are serialized by a short lock before writing a slot. When the ring is full, the events wait in
+ * an overflow list and are still handled in order.
+ * Event must be default-constructible and movable, and have a Release method which drops the references held by
+ * the event once it's handled. The slot is reused, so Release can keep its buffers for the next event.
+ */
+template <typename Event>
+class BatchedChannel {
+public:
+    using Handler = std::function<void(const Event &)>;
+
+    /**
+     * @param handleQueue the queue which runs the drain tasks. It must outlive the tasks of the channel.
+     * @param capacity the number of the slots, rounded up to a power of 2
+     * @param handler called on the queue for every event
+     * @param defaultMaxBatchSize the max number of the events handled by one drain task
+     */
+    BatchedChannel(GameControllerQueue* handleQueue, size_t capacity, const Handler &handler,
+                   size_t defaultMaxBatchSize = BATCHED_CHANNEL_UNLIMITED_BATCH_SIZE)
+        : handleQueue_(handleQueue), handler_(handler), defaultMaxBatchSize_(defaultMaxBatchSize),
+          maxBatchSize_(defaultMaxBatchSize)
+    {
+        size_t slotCount = 1;
+        while (slotCount < capacity) {
+            slotCount <<= 1;
+        }
+        slots_.resize(slotCount);
+        mask_ = static_cast<uint64_t>(slotCount - 1);
+    }
+
+    ~BatchedChannel() = default;
+
+    void Send(Event &&event)
+    {
+        Emplace([&event](Event &slot) {
+            slot = std::move(event);
+        });
+    }
+
+    /**
+     * Send an event written in place, so the buffers of the slot can be reused.
+     * @param writer called with the lock held, void(Event &slot). It writes every field of the event.
+     */
+    template <typename Writer>
+    void Emplace(const Writer &writer)
+    {
+        {
+            std::lock_guard<ffrt::mutex> lock(producerMutex_);
+            uint64_t tail = tail_.load(std::memory_order_relaxed);
+            if (!overflowEvents_.empty() || tail - head_.load(std::memory_order_acquire) >= slots_.size()) {
+                if (overflowEvents_.empty()) {
+                    HILOGW_LIMIT("the event channel is full, capacity is [%{public}zu]", slots_.size());
+                }
+                overflowEvents_.emplace_back();
+                writer(overflowEvents_.back());
+                overflowCount_.fetch_add(1, std::memory_order_relaxed);
+                hasOverflowEvents_.store(true);
+            } else {
+                writer(slots_[tail & mask_]);
+                // seq_cst, paired with Drain, so either the pending drain task sees this slot or a new one is submitted
+                tail_.store(tail + 1);
+            }
+        }
+        ScheduleDrain();
+    }
+
+    /**
+     * Set the max number of the events handled by one drain task. 0 means the default one.
+     */
+    void SetMaxBatchSize(size_t maxBatchSize)
+    {
+        maxBatchSize_.store(maxBatchSize == 0 ? defaultMaxBatchSize_ : maxBatchSize);
+    }
+
+    size_t GetMaxBatchSize() const
+    {
+        return maxBatchSize_.load();
+    }
+
+    /**
+     * Wait until the events sent before are handled. It must not be called on the queue.
+     */
+    void WaitIdle()
+    {
+        if (handleQueue_ == nullptr) {
+            return;
+        }
+        // A drain task which stops at the max batch size submits another one behind this task, so it's waited again.
+        do {
+            ffrt::task_handle handle = handleQueue_->submit_h([] {});
+            handleQueue_->wait(handle);
+        } while (isDrainScheduled_.load());
+    }
+
+    /**
+     * Stop submitting the drain tasks and wait for the one submitted before, so the channel can be destroyed
+     * before its queue. The events sent from now on are dropped. It must not be called on the queue.
+     */
+    void Stop()
+    {
+        {
+            std::lock_guard<ffrt::mutex> lock(scheduleMutex_);
+            if (handleQueue_ == nullptr || isStopped_) {
+                return;
+            }
+            isStopped_ = true;
+        }
+        // The drain task submitted before runs ahead of this one, and it can't submit another one.
+        ffrt::task_handle handle = handleQueue_->submit_h([] {});
+        handleQueue_->wait(handle);
+    }
+
+    size_t GetCapacity() const
+    {
+        return slots_.size();
+    }
+
+    BatchedChannelStats GetStats() const
+    {
+        BatchedChannelStats stats;
+        stats.eventCount = eventCount_.load(std::memory_order_relaxed);
+        stats.batchCount = batchCount_.load(std::memory_order_relaxed);
+        stats.overflowCount = overflowCount_.load(std::memory_order_relaxed);
+        stats.maxBatchSize = maxBatchSize_.load(std::memory_order_relaxed);
+        for (size_t bucket = 0; bucket < BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT; bucket++) {
+            stats.batchSizeHistogram[bucket] = batchSizeHistogram_[bucket].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+private:
+    void ScheduleDrain()
+    {
+        if (handleQueue_ == nullptr || isDrainScheduled_.exchange(true)) {
+            return;
+        }
+        std::lock_guard<ffrt::mutex> lock(scheduleMutex_);
+        if (isStopped_) {
+            return;
+        }
+        handleQueue_->submit([this] {
+            Drain();
+        });
+    }
+
+    void Drain()
+    {
+        // Cleared before reading, so the events sent from now on schedule another drain task.
+        isDrainScheduled_.store(false);
+        size_t maxBatchSize = maxBatchSize_.load(std::memory_order_relaxed);
+        size_t batchSize = 0;
+        Event* event = nullptr;
+        while (batchSize < maxBatchSize && (event = Front()) != nullptr) {
+            handler_(*event);
+            PopFront();
+            batchSize++;
+        }
+        RecordBatch(batchSize);
+        if (HasPendingEvents()) {
+            ScheduleDrain();
+        }
+    }
+
+    /**
+     * The next event to handle, nullptr means none. Only called by the drain task.
+     */
+    Event* Front()
+    {
+        if (drainingEvents_.empty() && hasOverflowEvents_.load()) {
+            std::lock_guard<ffrt::mutex> lock(producerMutex_);
+            drainingEvents_.swap(overflowEvents_);
+            hasOverflowEvents_.store(false, std::memory_order_relaxed);
+            // The slots written before the overflow events are handled first.
+            drainingStart_ = tail_.load(std::memory_order_relaxed);
+        }
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (!drainingEvents_.empty() && head == drainingStart_) {
+            return &drainingEvents_.front();
+        }
+        if (head != tail_.load()) {
+            return &slots_[head & mask_];
+        }
+        return nullptr;
+    }
+
+    /**
+     * Release the event returned by Front. Only called by the drain task.
+     */
+    void PopFront()
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (!drainingEvents_.empty() && head == drainingStart_) {
+            drainingEvents_.pop_front();
+            return;
+        }
+        // release the event now, the slot keeps it until it's overwritten by a later one
+        slots_[head & mask_].Release();
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    bool HasPendingEvents()
+    {
+        return !drainingEvents_.empty() || hasOverflowEvents_.load()
+            || head_.load(std::memory_order_relaxed) != tail_.load();
+    }
+
+    void RecordBatch(size_t batchSize)
+    {
+        // The drain task which finds the events handled by the one before it isn't counted.
+        if (batchSize == 0) {
+            return;
+        }
+        eventCount_.fetch_add(batchSize, std::memory_order_relaxed);
+        batchCount_.fetch_add(1, std::memory_order_relaxed);
+        batchSizeHistogram_[BatchedChannelStats::GetBucket(batchSize)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    GameControllerQueue* handleQueue_{nullptr};
+    Handler handler_;
+    std::vector<Event> slots_;
+    uint64_t mask_{0};
+    size_t defaultMaxBatchSize_;
+    std::atomic<size_t> maxBatchSize_;
+
+    /**
+     * The next slot to read, only written by the drain task.
+     */
+    std::atomic<uint64_t> head_{0};
+
+    /**
+     * The next slot to write, only written under producerMutex_.
+     */
+    std::atomic<uint64_t> tail_{0};
+    std::atomic<bool> isDrainScheduled_{false};
+
+    /**
+     * Guards isStopped_, so no drain task is submitted after Stop returns.
+     */
+    ffrt::mutex scheduleMutex_;
+    bool isStopped_{false};
+    ffrt::mutex producerMutex_;
+
+    /**
+     * The events sent when the ring is full. Guarded by producerMutex_.
+     * While it's not empty, the new events are also appended here to keep the order.
+     */
+    std::deque<Event> overflowEvents_;
+
+    /**
+     * Whether overflowEvents_ is not empty, so the drain task doesn't take producerMutex_ in the usual case.
+     */
+    std::atomic<bool> hasOverflowEvents_{false};
+
+    /**
+     * The overflow events taken by the drain task, and the slot they are handled before.
+     * Only accessed by the drain task.
+     */
+    std::deque<Event> drainingEvents_;
+    uint64_t drainingStart_{0};
+
+    std::atomic<uint64_t> eventCount_{0};
+    std::atomic<uint64_t> batchCount_{0};
+    std::atomic<uint64_t> overflowCount_{0};
+    std::array<std::atomic<uint64_t>, BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT> batchSizeHistogram_{};
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_BATCHED_CHANNEL_H
@@ -21,6 +21,7 @@
 #include <unordered_set>
 #include <parcel.h>
 #include <unordered_map>
+#include "gamecontroller_packed_codec.h"
 
 namespace OHOS {
 namespace GameController {
@@ -239,63 +240,7 @@ struct DeviceInfo : public Parcelable {
 
     bool Marshalling(Parcel &parcel) const
     {
-        if (!parcel.WriteString(uniq)) {
-            return false;
-        }
-        if (!parcel.WriteString(name)) {
-            return false;
-        }
-        if (!parcel.WriteInt32(product)) {
-            return false;
-        }
-        if (!parcel.WriteInt32(vendor)) {
-            return false;
-        }
-        if (!parcel.WriteInt32(version)) {
-            return false;
-        }
-        if (!parcel.WriteString(phys)) {
-            return false;
-        }
-        if (!parcel.WriteInt32(deviceType)) {
-            return false;
-        }
-        if (!parcel.WriteInt32(status)) {
-            return false;
-        }
-        if (this->WriteArrayObject(parcel)) {
-            return true;
-        }
-        return false;
-    }
-
-    bool WriteArrayObject(Parcel &parcel) const
-    {
-        if (!parcel.WriteInt32(ids.size())) {
-            return false;
-        }
-        for (auto id: ids) {
-            if (!parcel.WriteInt32(id)) {
-                return false;
-            }
-        }
-        if (!parcel.WriteInt32(names.size())) {
-            return false;
-        }
-        for (auto &name: names) {
-            if (!parcel.WriteString(name)) {
-                return false;
-            }
-        }
-        if (!parcel.WriteInt32(sourceTypeSet.size())) {
-            return false;
-        }
-        for (auto sourceType: sourceTypeSet) {
-            if (!parcel.WriteInt32(sourceType)) {
-                return false;
-            }
-        }
-        return true;
+        return PackedParcelCodec::WriteDeviceInfo(parcel, *this);
     }
 
     static DeviceInfo* Unmarshalling(Parcel &parcel)
@@ -304,72 +249,12 @@ struct DeviceInfo : public Parcelable {
         if (ret == nullptr) {
             return nullptr;
         }
-        int32_t size;
-        if (!Read(parcel, ret)) {
-            goto error;
-        }
-
-        size = parcel.ReadInt32();
-        if (size > MAX_SIZE) {
-            goto error;
-        }
-        for (int i = 0; i < size; i++) {
-            ret->ids.insert(parcel.ReadInt32());
-        }
-        size = parcel.ReadInt32();
-        if (size > MAX_SIZE) {
-            goto error;
-        }
-        for (int i = 0; i < size; i++) {
-            ret->names.insert(parcel.ReadString());
-        }
-
-        size = parcel.ReadInt32();
-        if (size > MAX_SIZE) {
-            goto error;
-        }
-        for (int i = 0; i < size; i++) {
-            ret->sourceTypeSet.insert(static_cast<InputSourceTypeEnum>(parcel.ReadInt32()));
+        if (!PackedParcelCodec::ReadDeviceInfo(parcel, *ret)) {
+            delete ret;
+            ret = nullptr;
+            return nullptr;
         }
         return ret;
-        error:
-        delete ret;
-        ret = nullptr;
-        return nullptr;
-    }
-
-    static bool Read(Parcel &parcel, DeviceInfo* ret)
-    {
-        if (!parcel.ReadString(ret->uniq)) {
-            return false;
-        }
-        if (!parcel.ReadString(ret->name)) {
-            return false;
-        }
-        if (!parcel.ReadInt32(ret->product)) {
-            return false;
-        }
-
-        if (!parcel.ReadInt32(ret->vendor)) {
-            return false;
-        }
-
-        if (!parcel.ReadInt32(ret->version)) {
-            return false;
-        }
-
-        if (!parcel.ReadString(ret->phys)) {
-            return false;
-        }
-        int32_t deviceType;
-        if (!parcel.ReadInt32(deviceType)) {
-            return false;
-        }
-        ret->deviceType = static_cast<DeviceTypeEnum>(deviceType);
-        if (!parcel.ReadInt32(ret->status)) {
-            return false;
-        }
-        return true;
     }
 
     /**
@@ -467,6 +352,16 @@ struct AxisEvent {
     std::string uniq;
     GamePadAxisSourceTypeEnum axisSourceType;
     int64_t actionTime = 0;
+
+    /**
+     * Time when the event was generated, in μs since startup (CLOCK_MONOTONIC).
+     */
+    int64_t originalTime = 0;
+
+    /**
+     * Time when the event was delivered to the callback, in μs since startup (CLOCK_MONOTONIC).
+     */
+    int64_t deliveryTime = 0;
 };
 
 struct GamePadAxisEvent : AxisEvent {
@@ -503,6 +398,16 @@ struct ButtonEvent {
     std::string keyCodeName;
     std::vector<KeyInfo> keys;
     int64_t actionTime = 0;
+
+    /**
+     * Time when the event was generated, in μs since startup (CLOCK_MONOTONIC).
+     */
+    int64_t originalTime = 0;
+
+    /**
+     * Time when the event was delivered to the callback, in μs since startup (CLOCK_MONOTONIC).
+     */
+    int64_t deliveryTime = 0;
 };
 
 struct GamePadButtonEvent : ButtonEvent {
@@ -0,0 +1,316 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef GAME_CONTROLLER_GAMECONTROLLER_INPUT_TRACE_H
+#define GAME_CONTROLLER_GAMECONTROLLER_INPUT_TRACE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "gamecontroller_packed_codec.h"
+
+namespace OHOS {
+namespace GameController {
+struct KeyToTouchMappingInfo;
+
+const uint32_t INPUT_TRACE_MAGIC = 0x52544347; // "GCTR"
+const uint16_t INPUT_TRACE_VERSION = 1;
+const uint32_t INPUT_TRACE_MAX_KEY_ITEMS = 8;
+const uint32_t INPUT_TRACE_MAX_AXES = 16;
+const uint32_t INPUT_TRACE_MAX_TOUCH_ITEMS = 10;
+const uint32_t INPUT_TRACE_MAX_NAME_LENGTH = 256;
+
+/**
+ * Upper bound of one record's payload accepted by the reader.
+ */
+const uint32_t MAX_INPUT_TRACE_PAYLOAD_SIZE = 64 * 1024;
+
+/**
+ * The input event was taken over by KeyToTouchManager instead of being passed to the window.
+ */
+const uint16_t INPUT_TRACE_FLAG_DISPATCHED = 0x1;
+
+enum InputTraceKindEnum {
+    /**
+     * Key event reached the window input intercept consumer
+     */
+    INPUT_TRACE_KEY = 1,
+
+    /**
+     * Pointer event (mouse or gamepad axis) reached the window input intercept consumer
+     */
+    INPUT_TRACE_POINTER = 2,
+
+    /**
+     * Touch event injected by the key mapping
+     */
+    INPUT_TRACE_TOUCH = 3,
+
+    /**
+     * Template that became active
+     */
+    INPUT_TRACE_TEMPLATE = 4,
+
+    /**
+     * Window information that became active
+     */
+    INPUT_TRACE_WINDOW = 5
+};
+
+/**
+ * Header at the beginning of a trace file
+ */
+struct InputTraceFileHeader {
+    uint32_t magic = INPUT_TRACE_MAGIC;
+    uint16_t version = INPUT_TRACE_VERSION;
+    uint16_t headerSize = sizeof(InputTraceFileHeader);
+
+    /**
+     * Realtime of the capture start, in us.
+     */
+    int64_t startRealTime = 0;
+};
+
+/**
+ * Header of each record. It's followed by payloadSize bytes.
+ */
+struct InputTraceRecordHeader {
+    uint16_t kind = 0;
+    uint16_t flags = 0;
+    uint32_t payloadSize = 0;
+
+    /**
+     * Time elapsed since the capture start, in us.
+     */
+    int64_t elapsedTime = 0;
+};
+
+struct InputTraceKeyItem {
+    int64_t downTime = 0;
+    int32_t keyCode = 0;
+    int32_t deviceId = 0;
+    int32_t pressed = 0;
+    int32_t reserved = 0;
+};
+
+/**
+ * Payload of INPUT_TRACE_KEY
+ */
+struct InputTraceKeyRecord {
+    int64_t actionTime = 0;
+    int64_t deviceOnlineTime = 0;
+    int32_t deviceId = 0;
+    int32_t deviceType = 0;
+    int32_t keyCode = 0;
+    int32_t keyAction = 0;
+    uint32_t keyItemCount = 0;
+    int32_t reserved = 0;
+    InputTraceKeyItem keyItems[INPUT_TRACE_MAX_KEY_ITEMS];
+};
+
+/**
+ * Payload of INPUT_TRACE_POINTER. The axis values are indexed by MMI::PointerEvent::AxisType.
+ */
+struct InputTracePointerRecord {
+    int64_t actionTime = 0;
+    int32_t deviceId = 0;
+    int32_t sourceType = 0;
+    int32_t pointerAction = 0;
+    int32_t pointerId = 0;
+    int32_t buttonId = 0;
+    int32_t windowX = 0;
+    int32_t windowY = 0;
+    int32_t displayX = 0;
+    int32_t displayY = 0;
+    uint32_t axisMask = 0;
+    double axisValues[INPUT_TRACE_MAX_AXES] = {0};
+};
+
+struct InputTraceTouchItem {
+    int32_t pointerId = 0;
+    int32_t windowX = 0;
+    int32_t windowY = 0;
+};
+
+/**
+ * Payload of INPUT_TRACE_TOUCH. It only keeps the fields which must be the same between two runs,
+ * the send time is kept in the record header.
+ */
+struct InputTraceTouchRecord {
+    int32_t pointerAction = 0;
+    int32_t pointerId = 0;
+    int32_t sourceType = 0;
+    int32_t windowId = 0;
+    int32_t displayId = 0;
+    uint32_t touchItemCount = 0;
+    InputTraceTouchItem touchItems[INPUT_TRACE_MAX_TOUCH_ITEMS];
+};
+
+/**
+ * Payload of INPUT_TRACE_TEMPLATE. It's followed by mappingCount PackedKeyMappingRecord.
+ */
+struct InputTraceTemplateRecord {
+    int32_t deviceType = 0;
+    uint32_t mappingCount = 0;
+};
+
+/**
+ * Payload of INPUT_TRACE_WINDOW. It's followed by bundleNameLength bytes of the bundleName.
+ */
+struct InputTraceWindowRecord {
+    int32_t windowId = 0;
+    int32_t maxWidth = 0;
+    int32_t maxHeight = 0;
+    int32_t currentWidth = 0;
+    int32_t currentHeight = 0;
+    int32_t xPosition = 0;
+    int32_t yPosition = 0;
+    int32_t xCenter = 0;
+    int32_t yCenter = 0;
+    int32_t displayId = 0;
+    int32_t isFullScreen = 0;
+    int32_t isPluginMode = 0;
+    uint32_t bundleNameLength = 0;
+};
+
+/**
+ * One decoded record
+ */
+struct InputTraceRecord {
+    InputTraceRecordHeader header;
+    std::vector<uint8_t> payload;
+};
+
+/**
+ * Result of comparing the injected touch streams of two runs
+ */
+struct InputTraceCompareResult {
+    bool isSame = false;
+    size_t expectedCount = 0;
+    size_t actualCount = 0;
+
+    /**
+     * Index in the compared touch stream of the first different touch. It equals the shorter count when
+     * one stream is the prefix of the other.
+     */
+    size_t firstMismatchIndex = 0;
+};
+
+/**
+ * Binary encoding of the input trace
+ */
+class InputTraceCodec {
+public:
+    /**
+     * Append one record to the buffer.
+     * @param buffer buffer
+     * @param header record header. The payloadSize is set by this function.
+     * @param payload payload
+     * @param payloadSize payload size
+     */
+    static void AppendRecord(std::vector<uint8_t> &buffer, InputTraceRecordHeader &header,
+                             const void* payload, uint32_t payloadSize);
+
+    /**
+     * Encode the template payload.
+     * @param deviceType device type of the template
+     * @param mappingInfos key mappings of the template
+     * @param payload payload
+     * @return false means too many key mappings
+     */
+    static bool BuildTemplatePayload(int32_t deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                     std::vector<uint8_t> &payload);
+
+    /**
+     * Decode the template payload.
+     * @param payload payload
+     * @param deviceType device type of the template
+     * @param mappingInfos key mappings of the template
+     * @return false means the payload is malformed
+     */
+    static bool ParseTemplatePayload(const std::vector<uint8_t> &payload, int32_t &deviceType,
+                                     std::vector<KeyToTouchMappingInfo> &mappingInfos);
+
+    /**
+     * Decode a whole trace.
+     * @param data trace data
+     * @param size trace size
+     * @param fileHeader file header
+     * @param records records
+     * @return false means the trace is malformed. The records decoded before the error are kept.
+     */
+    static bool Parse(const uint8_t* data, size_t size, InputTraceFileHeader &fileHeader,
+                      std::vector<InputTraceRecord> &records);
+
+    /**
+     * Read and decode a trace file.
+     * @param path file path
+     * @param fileHeader file header
+     * @param records records
+     * @return false means the file cannot be read or is malformed
+     */
+    static bool ReadFile(const std::string &path, InputTraceFileHeader &fileHeader,
+                         std::vector<InputTraceRecord> &records);
+
+    /**
+     * Compare the INPUT_TRACE_TOUCH records of two runs byte-for-byte.
+     * A move which repeats the previous touch is the keep-alive resend of the held touches, it depends on the
+     * wall clock and is skipped on both sides.
+     * @param expected records of the capture
+     * @param actual records of the replay
+     * @return compare result
+     */
+    static InputTraceCompareResult CompareTouchStream(const std::vector<InputTraceRecord> &expected,
+                                                      const std::vector<InputTraceRecord> &actual);
+};
+
+/**
+ * Writer of the trace file
+ */
+class InputTraceWriter {
+public:
+    InputTraceWriter() = default;
+
+    ~InputTraceWriter();
+
+    InputTraceWriter(const InputTraceWriter &) = delete;
+
+    InputTraceWriter &operator=(const InputTraceWriter &) = delete;
+
+    /**
+     * Create the trace file and write the file header.
+     * @param path file path
+     * @param fileHeader file header
+     * @return true means success
+     */
+    bool Open(const std::string &path, const InputTraceFileHeader &fileHeader);
+
+    /**
+     * Write encoded records to the file.
+     * @param buffer encoded records
+     * @return true means success
+     */
+    bool Write(const std::vector<uint8_t> &buffer);
+
+    void Close();
+
+    bool IsOpen() const;
+
+private:
+    FILE* file_{nullptr};
+};
+}
+}
+#endif //GAME_CONTROLLER_GAMECONTROLLER_INPUT_TRACE_H
@@ -22,6 +22,7 @@
 #include <parcel.h>
 #include <memory>
 #include "gamecontroller_client_model.h"
+#include "gamecontroller_packed_codec.h"
 
 namespace OHOS {
 namespace GameController {
@@ -31,14 +32,35 @@ const size_t COMBINATION_LAST_KEYCODE_IDX = 1;
 const int32_t MAX_KEY_MAPPING_SIZE = 100;
 const size_t MAX_BUNDLE_NAME_LENGTH = 256;
 const size_t MAX_VERSION_LENGTH = 50;
-const size_t SUM_OF_MAPPING_TYPE = 11;
-const int32_t MAX_SUPPORT_DEVICE_TYPES = 2;
+const size_t SUM_OF_MAPPING_TYPE = 14;
+const int32_t MAX_SUPPORT_DEVICE_TYPES = 3;
+const int32_t MAX_BATCH_KEY_MAPPING_SIZE = 5;
+const int32_t MAX_TEMPLATE_RESOLUTION = 16384;
+const int32_t MAX_RESPONSE_CURVE_POINTS = 16;
+const double MIN_RESPONSE_CURVE_EXPONENT = 0.2;
+const double MAX_RESPONSE_CURVE_EXPONENT = 5.0;
+const double MAX_RESPONSE_CURVE_OUTPUT = 4.0;
+const int32_t RESPONSE_CURVE_MAX_SPEED = 128;
+const int64_t RESPONSE_CURVE_SPEED_INTERVAL = 8000;
+const int32_t MIN_TAP_INTERVAL = 20;
+const int32_t MAX_TAP_INTERVAL = 1000;
+const int32_t MIN_TAP_DUTY_CYCLE = 10;
+const int32_t MAX_TAP_DUTY_CYCLE = 90;
+const int32_t DEFAULT_TAP_DUTY_CYCLE = 50;
+const int32_t MAX_AXIS_DEAD_ZONE = 90;
+const int32_t DEFAULT_AXIS_DEAD_ZONE = 10;
 
 struct ParameterByCheck {
     std::vector<size_t> keyMappingNumber = std::vector<size_t>(SUM_OF_MAPPING_TYPE, 0);
     std::unordered_map<int32_t, int32_t> uniqKeyCodeMap;
     std::unordered_map<int32_t, int32_t> combinationKeysMap;
     int32_t uniqRightButtonMappingType = -1;
+
+    /**
+     * The axes of the game pad which are used. A thumbstick or a trigger can be used by one key mapping.
+     */
+    std::unordered_set<int32_t> uniqAxisSet;
+    bool isGamePad = false;
 };
 
 enum MappingTypeEnum {
@@ -73,7 +95,16 @@ enum MappingTypeEnum {
     MOUSE_LEFT_FIRE_TO_TOUCH = 9,
 
     // Right-button of mouse switch to touch clicking
-    MOUSE_RIGHT_KEY_CLICK_TO_TOUCH = 10
+    MOUSE_RIGHT_KEY_CLICK_TO_TOUCH = 10,
+
+    // Thumbstick of game pad switch to touch moving in a virtual joystick
+    GAMEPAD_STICK_TO_TOUCH = 11,
+
+    // Use the thumbstick of game pad for observation
+    GAMEPAD_STICK_OBSERVATION_TO_TOUCH = 12,
+
+    // Trigger of game pad switch to touch clicking
+    GAMEPAD_TRIGGER_TO_TOUCH = 13
 };
 
 /**
@@ -160,6 +191,24 @@ struct KeyToTouchMappingInfo : public Parcelable {
 
     int32_t delayTime = 0;
 
+    /**
+     * The interval of the repeated taps in milliseconds while the mouse button is held.
+     * 0 means the touch is pressed until the button is released.
+     * It's used by MOUSE_LEFT_FIRE_TO_TOUCH and MOUSE_RIGHT_KEY_CLICK_TO_TOUCH.
+     */
+    int32_t tapInterval = 0;
+
+    /**
+     * The percentage of the tap interval in which the touch is pressed. 0 means DEFAULT_TAP_DUTY_CYCLE.
+     */
+    int32_t tapDutyCycle = 0;
+
+    /**
+     * The percentage of the axis travel around the rest position which is ignored. 0 means DEFAULT_AXIS_DEAD_ZONE.
+     * It's used by the game pad mappings, whose keyCode is a GamePadAxisSourceTypeEnum.
+     */
+    int32_t deadZone = 0;
+
     bool Marshalling(Parcel &parcel) const
     {
         if (!parcel.WriteInt32(keyCode)) {
@@ -189,6 +238,15 @@ struct KeyToTouchMappingInfo : public Parcelable {
         if (!parcel.WriteInt32(delayTime)) {
             return false;
         }
+        if (!parcel.WriteInt32(tapInterval)) {
+            return false;
+        }
+        if (!parcel.WriteInt32(tapDutyCycle)) {
+            return false;
+        }
+        if (!parcel.WriteInt32(deadZone)) {
+            return false;
+        }
         if (!parcel.WriteParcelable(&dpadKeyCodeEntity)) {
             return false;
         }
@@ -247,6 +305,15 @@ struct KeyToTouchMappingInfo : public Parcelable {
         if (!parcel.ReadInt32(ret->delayTime)) {
             goto error;
         }
+        if (!parcel.ReadInt32(ret->tapInterval)) {
+            goto error;
+        }
+        if (!parcel.ReadInt32(ret->tapDutyCycle)) {
+            goto error;
+        }
+        if (!parcel.ReadInt32(ret->deadZone)) {
+            goto error;
+        }
         if (!ReadDpadInfo(parcel, ret)) {
             goto error;
         }
@@ -268,7 +335,7 @@ struct KeyToTouchMappingInfo : public Parcelable {
         }
 
         if (mappingType < static_cast<int32_t>(SINGE_KEY_TO_TOUCH) ||
-            mappingType > static_cast<int32_t>(MOUSE_RIGHT_KEY_CLICK_TO_TOUCH)) {
+            mappingType > static_cast<int32_t>(GAMEPAD_TRIGGER_TO_TOUCH)) {
             return false;
         }
         ret->mappingType = static_cast<MappingTypeEnum>(mappingType);
@@ -314,6 +381,9 @@ struct KeyToTouchMappingInfo : public Parcelable {
         tmp.append(", xStep:" + std::to_string(xStep));
         tmp.append(", yStep:" + std::to_string(yStep));
         tmp.append(", delayTime:" + std::to_string(delayTime));
+        tmp.append(", tapInterval:" + std::to_string(tapInterval));
+        tmp.append(", tapDutyCycle:" + std::to_string(tapDutyCycle));
+        tmp.append(", deadZone:" + std::to_string(deadZone));
         tmp.append(", combinationKeys:");
         for (auto combinationKey: combinationKeys) {
             tmp.append(std::to_string(combinationKey) + "|");
@@ -344,6 +414,17 @@ struct KeyToTouchMappingInfo : public Parcelable {
         xStep = 0;
         yStep = 0;
     }
+
+    void SetTapToDefault()
+    {
+        tapInterval = 0;
+        tapDutyCycle = 0;
+    }
+
+    void SetDeadZoneToDefault()
+    {
+        deadZone = 0;
+    }
 };
 
 /**
@@ -484,7 +565,8 @@ struct GameInfo : public Parcelable {
             }
             deviceTypeEnum = static_cast<DeviceTypeEnum>(deviceType);
             if (deviceTypeEnum != DeviceTypeEnum::GAME_KEY_BOARD
-                && deviceTypeEnum != DeviceTypeEnum::HOVER_TOUCH_PAD) {
+                && deviceTypeEnum != DeviceTypeEnum::HOVER_TOUCH_PAD
+                && deviceTypeEnum != DeviceTypeEnum::GAME_PAD) {
                 return false;
             }
             ret->supportedDeviceTypes.push_back(deviceType);
@@ -508,6 +590,152 @@ struct GameInfo : public Parcelable {
     }
 };
 
+/**
+ * The reference resolution of a key mapping template.
+ * When it's valid, the coordinates, radius, skill range and steps of the template are based on it
+ * and are scaled to the current window. Otherwise they are window pixels as they are.
+ */
+struct TemplateResolution {
+    int32_t width = 0;
+    int32_t height = 0;
+
+    bool IsValid() const
+    {
+        return width > 0 && height > 0;
+    }
+
+    bool CheckParamValid() const
+    {
+        if (width == 0 && height == 0) {
+            return true;
+        }
+        return IsValid() && width <= MAX_TEMPLATE_RESOLUTION && height <= MAX_TEMPLATE_RESOLUTION;
+    }
+
+    bool Marshalling(Parcel &parcel) const
+    {
+        return parcel.WriteInt32(width) && parcel.WriteInt32(height);
+    }
+
+    bool ReadFromParcel(Parcel &parcel)
+    {
+        return parcel.ReadInt32(width) && parcel.ReadInt32(height);
+    }
+
+    bool operator==(const TemplateResolution &other) const
+    {
+        return width == other.width && height == other.height;
+    }
+};
+
+enum ResponseCurveTypeEnum {
+    // The touch moves as the mouse moves.
+    RESPONSE_CURVE_LINEAR = 0,
+
+    // output = input ^ exponent
+    RESPONSE_CURVE_POWER = 1,
+
+    // The points are linked by lines.
+    RESPONSE_CURVE_TABLE = 2,
+};
+
+struct ResponseCurvePoint {
+    double input = 0.0;
+    double output = 0.0;
+
+    bool operator==(const ResponseCurvePoint &other) const
+    {
+        return input == other.input && output == other.output;
+    }
+};
+
+/**
+ * The response curve of a key mapping template for the mouse moves.
+ * The input is the mouse speed in counts per RESPONSE_CURVE_SPEED_INTERVAL (8 ms), divided by
+ * RESPONSE_CURVE_MAX_SPEED. It's from 0 to 1, and the inputs over 1 are taken as 1.
+ * The output is the scaled input, from 0 to MAX_RESPONSE_CURVE_OUTPUT.
+ */
+struct ResponseCurve {
+    ResponseCurveTypeEnum type = RESPONSE_CURVE_LINEAR;
+
+    /**
+     * It's used by RESPONSE_CURVE_POWER. Over 1 means the slow moves are slower.
+     */
+    double exponent = 1.0;
+
+    /**
+     * It's used by RESPONSE_CURVE_TABLE. The inputs are ascending in (0, 1], and (0, 0) is the first point.
+     */
+    std::vector<ResponseCurvePoint> points;
+
+    bool IsLinear() const
+    {
+        return type == RESPONSE_CURVE_LINEAR || (type == RESPONSE_CURVE_POWER && exponent == 1.0);
+    }
+
+    bool CheckParamValid() const
+    {
+        if (type == RESPONSE_CURVE_LINEAR) {
+            return true;
+        }
+        if (type == RESPONSE_CURVE_POWER) {
+            return exponent >= MIN_RESPONSE_CURVE_EXPONENT && exponent <= MAX_RESPONSE_CURVE_EXPONENT;
+        }
+        if (type != RESPONSE_CURVE_TABLE || points.empty() ||
+            points.size() > static_cast<size_t>(MAX_RESPONSE_CURVE_POINTS)) {
+            return false;
+        }
+        double lastInput = 0.0;
+        for (const auto &point: points) {
+            if (!(point.input > lastInput) || point.input > 1.0 ||
+                !(point.output >= 0.0) || point.output > MAX_RESPONSE_CURVE_OUTPUT) {
+                return false;
+            }
+            lastInput = point.input;
+        }
+        return true;
+    }
+
+    bool Marshalling(Parcel &parcel) const
+    {
+        if (!parcel.WriteInt32(type) || !parcel.WriteDouble(exponent) ||
+            !parcel.WriteInt32(static_cast<int32_t>(points.size()))) {
+            return false;
+        }
+        for (const auto &point: points) {
+            if (!parcel.WriteDouble(point.input) || !parcel.WriteDouble(point.output)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadFromParcel(Parcel &parcel)
+    {
+        int32_t curveType = 0;
+        int32_t pointCount = 0;
+        if (!parcel.ReadInt32(curveType) || !parcel.ReadDouble(exponent) || !parcel.ReadInt32(pointCount)) {
+            return false;
+        }
+        if (pointCount < 0 || pointCount > MAX_RESPONSE_CURVE_POINTS) {
+            return false;
+        }
+        type = static_cast<ResponseCurveTypeEnum>(curveType);
+        points.resize(pointCount);
+        for (auto &point: points) {
+            if (!parcel.ReadDouble(point.input) || !parcel.ReadDouble(point.output)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator==(const ResponseCurve &other) const
+    {
+        return type == other.type && exponent == other.exponent && points == other.points;
+    }
+};
+
 /**
  * Key mapping information of the game
  * if call SetCustomGameKeyMappingConfig interface,
@@ -532,6 +760,26 @@ struct GameKeyMappingInfo : public Parcelable {
 
     std::vector<KeyToTouchMappingInfo> defaultKeyToTouchMappings;
 
+    /**
+     * The reference resolution of customKeyToTouchMappings. Zero means the mappings are window pixels.
+     */
+    TemplateResolution customResolution;
+
+    /**
+     * The reference resolution of defaultKeyToTouchMappings. Zero means the mappings are window pixels.
+     */
+    TemplateResolution defaultResolution;
+
+    /**
+     * The response curve of the mouse moves of customKeyToTouchMappings.
+     */
+    ResponseCurve customResponseCurve;
+
+    /**
+     * The response curve of the mouse moves of defaultKeyToTouchMappings.
+     */
+    ResponseCurve defaultResponseCurve;
+
     bool Marshalling(Parcel &parcel) const
     {
         if (!parcel.WriteString(bundleName)) {
@@ -546,23 +794,15 @@ struct GameKeyMappingInfo : public Parcelable {
             return false;
         }
 
-        if (!parcel.WriteInt32(customKeyToTouchMappings.size())) {
+        if (!customResolution.Marshalling(parcel) || !defaultResolution.Marshalling(parcel)) {
             return false;
         }
-        for (KeyToTouchMappingInfo keyMapping: customKeyToTouchMappings) {
-            if (!parcel.WriteParcelable(&keyMapping)) {
-                return false;
-            }
-        }
-        if (!parcel.WriteInt32(defaultKeyToTouchMappings.size())) {
+
+        if (!customResponseCurve.Marshalling(parcel) || !defaultResponseCurve.Marshalling(parcel)) {
             return false;
         }
-        for (KeyToTouchMappingInfo keyMapping: defaultKeyToTouchMappings) {
-            if (!parcel.WriteParcelable(&keyMapping)) {
-                return false;
-            }
-        }
-        return true;
+
+        return PackedParcelCodec::WriteKeyMappings(parcel, customKeyToTouchMappings, defaultKeyToTouchMappings);
     }
 
     static GameKeyMappingInfo* Unmarshalling(Parcel &parcel)
@@ -583,10 +823,14 @@ struct GameKeyMappingInfo : public Parcelable {
             goto error;
         }
         ret->deviceType = static_cast<DeviceTypeEnum>(deviceType);
-        if (!ReadCustomKeyMapping(parcel, ret)) {
+        if (!ret->customResolution.ReadFromParcel(parcel) || !ret->defaultResolution.ReadFromParcel(parcel)) {
             goto error;
         }
-        if (!ReadDefaultKeyMapping(parcel, ret)) {
+        if (!ret->customResponseCurve.ReadFromParcel(parcel) || !ret->defaultResponseCurve.ReadFromParcel(parcel)) {
+            goto error;
+        }
+        if (!PackedParcelCodec::ReadKeyMappings(parcel, ret->customKeyToTouchMappings,
+                                                ret->defaultKeyToTouchMappings)) {
             goto error;
         }
         return ret;
@@ -596,40 +840,6 @@ struct GameKeyMappingInfo : public Parcelable {
         return nullptr;
     }
 
-    static bool ReadCustomKeyMapping(Parcel &parcel, GameKeyMappingInfo* ret)
-    {
-        int32_t size = parcel.ReadInt32();
-        if (size > MAX_KEY_MAPPING_SIZE) {
-            return false;
-        }
-        for (int i = 0; i < size; i++) {
-            std::unique_ptr<KeyToTouchMappingInfo> keyMapping(parcel.ReadParcelable<KeyToTouchMappingInfo>());
-            if (!keyMapping) {
-                return false;
-            }
-
-            ret->customKeyToTouchMappings.push_back(std::move(*keyMapping));
-        }
-        return true;
-    }
-
-    static bool ReadDefaultKeyMapping(Parcel &parcel, GameKeyMappingInfo* ret)
-    {
-        int32_t size = parcel.ReadInt32();
-        if (size > MAX_KEY_MAPPING_SIZE) {
-            return false;
-        }
-        for (int i = 0; i < size; i++) {
-            std::unique_ptr<KeyToTouchMappingInfo> keyMapping(parcel.ReadParcelable<KeyToTouchMappingInfo>());
-            if (!keyMapping) {
-                return false;
-            }
-
-            ret->defaultKeyToTouchMappings.push_back(std::move(*keyMapping));
-        }
-        return true;
-    }
-
     /**
      * Validates parameters of the SetCustomGameKeyMappingConfig interface.
      * @return true means valid
@@ -657,18 +867,29 @@ struct GameKeyMappingInfo : public Parcelable {
         if (defaultKeyToTouchMappings.size() > static_cast<size_t>(MAX_KEY_MAPPING_SIZE)) {
             return false;
         }
+        if (!customResolution.CheckParamValid() || !defaultResolution.CheckParamValid()) {
+            return false;
+        }
+        if (!customResponseCurve.CheckParamValid() || !defaultResponseCurve.CheckParamValid()) {
+            return false;
+        }
         if (deviceType == DeviceTypeEnum::HOVER_TOUCH_PAD) {
             return CheckKeyMappingForHoverTouchPad(defaultKeyToTouchMappings) &&
                 CheckKeyMappingForHoverTouchPad(customKeyToTouchMappings);
         }
+        if (deviceType == DeviceTypeEnum::GAME_PAD) {
+            return CheckKeyMapping(defaultKeyToTouchMappings, true) && CheckKeyMapping(customKeyToTouchMappings, true);
+        }
         return CheckKeyMapping(defaultKeyToTouchMappings) && CheckKeyMapping(customKeyToTouchMappings);
     }
 
     /**
      * Validates a GameKeyMappingConfig.
+     * @param isGamePad true means the template of GAME_PAD. It accepts all the key mappings of the other templates,
+     * and the axes can't be used by the other templates.
      * @return true means valid
      */
-    bool CheckKeyMapping(std::vector<KeyToTouchMappingInfo> &KeyToTouchMappings);
+    bool CheckKeyMapping(std::vector<KeyToTouchMappingInfo> &KeyToTouchMappings, bool isGamePad = false);
 
     bool CheckSingleKey(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
 
@@ -692,12 +913,24 @@ struct GameKeyMappingInfo : public Parcelable {
 
     bool CheckMouseRightKeyClick(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
 
+    bool CheckGamePadStick(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
+
+    bool CheckGamePadStickObservation(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
+
+    bool CheckGamePadTrigger(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
+
+    bool IsGamePadAxisUniq(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
+
     bool IsDpadKeyCodeUniq(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter);
 
     bool CheckKeyMappingForHoverTouchPad(std::vector<KeyToTouchMappingInfo> &KeyToTouchMappings);
 
     bool IsStepValid(const KeyToTouchMappingInfo &currentKeyMapping);
 
+    bool IsTapValid(const KeyToTouchMappingInfo &currentKeyMapping);
+
+    bool IsDeadZoneValid(const KeyToTouchMappingInfo &currentKeyMapping);
+
     /**
      * Indicates whether to delete the default configuration based on the bundle name.
      * @return true means delete the default configuration based on the bundle name.
@@ -16,6 +16,9 @@
 #ifndef GAME_CONTROLLER_GAMECONTROLLER_LOG_H
 #define GAME_CONTROLLER_GAMECONTROLLER_LOG_H
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include "hilog/log.h"
 
 namespace OHOS {
@@ -59,6 +62,94 @@ namespace GameController {
     HILOG_INFO(LOG_CORE, "[%{public}s(%{public}s:%{public}d)]" fmt, FILE_NAME, __FUNCTION__, __LINE__, ##__VA_ARGS__)
 #define HILOGD(fmt, ...) \
     HILOG_DEBUG(LOG_CORE, "[%{public}s(%{public}s:%{public}d)]" fmt, FILE_NAME, __FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+#define HILOG_IS_LOGGABLE(level) HiLogIsLoggable(LOG_DOMAIN, LOG_TAG, level)
+
+/**
+ * Default number of the lines one call site of HILOGx_LIMIT prints in LOG_LIMIT_INTERVAL_MS.
+ */
+const uint32_t LOG_LIMIT_BURST = 20;
+const int64_t LOG_LIMIT_INTERVAL_MS = 1000;
+
+/**
+ * Limits the lines of one call site, and counts the suppressed ones.
+ */
+class LogRateLimiter {
+public:
+    explicit LogRateLimiter(uint32_t burst = LOG_LIMIT_BURST, int64_t intervalMs = LOG_LIMIT_INTERVAL_MS)
+        : burst_(burst), intervalMs_(intervalMs)
+    {
+    }
+
+    /**
+     * Whether the line can be printed. The count is approximate when several threads log at the window boundary.
+     * @param suppressedCount the number of the lines suppressed since the last printed one, set when it returns true
+     * @return true means the line can be printed
+     */
+    bool TryAcquire(uint32_t &suppressedCount)
+    {
+        int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t windowStart = windowStart_.load(std::memory_order_relaxed);
+        if (now - windowStart >= intervalMs_ &&
+            windowStart_.compare_exchange_strong(windowStart, now, std::memory_order_relaxed)) {
+            count_.store(0, std::memory_order_relaxed);
+        }
+        if (count_.fetch_add(1, std::memory_order_relaxed) < burst_) {
+            suppressedCount = suppressedCount_.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        suppressedCount_.fetch_add(1, std::memory_order_relaxed);
+        GetTotalSuppressedCounter().fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @return the number of the lines suppressed by all the call sites
+     */
+    static uint64_t GetTotalSuppressedCount()
+    {
+        return GetTotalSuppressedCounter().load(std::memory_order_relaxed);
+    }
+
+private:
+    static std::atomic<uint64_t> &GetTotalSuppressedCounter()
+    {
+        static std::atomic<uint64_t> totalSuppressedCount{0};
+        return totalSuppressedCount;
+    }
+
+private:
+    uint32_t burst_;
+    int64_t intervalMs_;
+    std::atomic<int64_t> windowStart_{INT64_MIN / 2};
+    std::atomic<uint32_t> count_{0};
+    std::atomic<uint32_t> suppressedCount_{0};
+};
+
+#define HILOG_LIMIT_IMPL(level, logMacro, fmt, ...) \
+    do { \
+        static OHOS::GameController::LogRateLimiter logRateLimiter; \
+        uint32_t suppressedCount = 0; \
+        if (!HILOG_IS_LOGGABLE(level) || !logRateLimiter.TryAcquire(suppressedCount)) { \
+            break; \
+        } \
+        if (suppressedCount == 0) { \
+            logMacro(LOG_CORE, "[%{public}s(%{public}s:%{public}d)]" fmt, \
+                FILE_NAME, __FUNCTION__, __LINE__, ##__VA_ARGS__); \
+        } else { \
+            logMacro(LOG_CORE, "[%{public}s(%{public}s:%{public}d)][%{public}u suppressed]" fmt, \
+                FILE_NAME, __FUNCTION__, __LINE__, suppressedCount, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+/**
+ * The logs of the input hot paths. The arguments are only evaluated when the level is enabled,
+ * and every call site prints at most LOG_LIMIT_BURST lines in LOG_LIMIT_INTERVAL_MS.
+ */
+#define HILOGW_LIMIT(fmt, ...) HILOG_LIMIT_IMPL(LOG_WARN, HILOG_WARN, fmt, ##__VA_ARGS__)
+#define HILOGI_LIMIT(fmt, ...) HILOG_LIMIT_IMPL(LOG_INFO, HILOG_INFO, fmt, ##__VA_ARGS__)
+#define HILOGD_LIMIT(fmt, ...) HILOG_LIMIT_IMPL(LOG_DEBUG, HILOG_DEBUG, fmt, ##__VA_ARGS__)
 }
 }
 #endif //GAME_CONTROLLER_GAMECONTROLLER_LOG_H
@@ -0,0 +1,198 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef GAME_CONTROLLER_GAMECONTROLLER_PACKED_CODEC_H
+#define GAME_CONTROLLER_GAMECONTROLLER_PACKED_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <parcel.h>
+
+namespace OHOS {
+namespace GameController {
+struct KeyToTouchMappingInfo;
+struct DeviceInfo;
+
+const uint32_t PACKED_MAGIC = 0x4B504347; // "GCPK"
+const uint16_t PACKED_VERSION = 1;
+const uint32_t PACKED_MAX_COMBINATION_KEYS = 2;
+const uint32_t PACKED_MAX_DEVICE_ITEMS = 10;
+
+/**
+ * The payload is sent through MessageParcel::WriteRawData (ashmem when large) instead of inline.
+ */
+const uint32_t PACKED_FLAG_RAW_DATA = 0x1;
+
+/**
+ * Payloads larger than this are moved out of the parcel buffer when the parcel is a MessageParcel.
+ */
+const size_t PACKED_RAW_DATA_THRESHOLD = 16 * 1024;
+
+/**
+ * Upper bound of a packed payload accepted by the decoder.
+ */
+const uint32_t MAX_PACKED_PAYLOAD_SIZE = 256 * 1024;
+
+enum PackedKindEnum {
+    PACKED_KIND_KEY_MAPPING = 1,
+    PACKED_KIND_DEVICE_INFO = 2
+};
+
+/**
+ * Header of a packed block. It's followed by recordCount records of recordSize bytes and a string table.
+ */
+struct PackedBlockHeader {
+    uint32_t magic = PACKED_MAGIC;
+    uint16_t version = PACKED_VERSION;
+    uint16_t kind = 0;
+    uint32_t flags = 0;
+    uint32_t recordSize = 0;
+    uint32_t recordCount = 0;
+
+    /**
+     * Number of leading records belonging to the first group. For key mapping it's the custom mappings.
+     */
+    uint32_t firstGroupCount = 0;
+    uint32_t stringTableSize = 0;
+};
+
+/**
+ * Location of a string in the string table
+ */
+struct PackedStringRef {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+};
+
+/**
+ * Fixed-size record of KeyToTouchMappingInfo
+ */
+struct PackedKeyMappingRecord {
+    int32_t keyCode = 0;
+    int32_t xValue = 0;
+    int32_t yValue = 0;
+    int32_t mappingType = 0;
+    int32_t radius = 0;
+    int32_t skillRange = 0;
+    int32_t xStep = 0;
+    int32_t yStep = 0;
+    int32_t delayTime = 0;
+    int32_t dpadUp = 0;
+    int32_t dpadDown = 0;
+    int32_t dpadLeft = 0;
+    int32_t dpadRight = 0;
+    int32_t combinationKeyCount = 0;
+    int32_t combinationKeys[PACKED_MAX_COMBINATION_KEYS] = {0};
+
+    /**
+     * The fields below are appended to the first layout. They keep the default values in the shorter records.
+     */
+    int32_t tapInterval = 0;
+    int32_t tapDutyCycle = 0;
+    int32_t deadZone = 0;
+};
+
+/**
+ * Size of the first layout of PackedKeyMappingRecord. The shorter records are still accepted.
+ */
+const uint32_t PACKED_KEY_MAPPING_RECORD_MIN_SIZE = offsetof(PackedKeyMappingRecord, tapInterval);
+
+/**
+ * Fixed-size record of DeviceInfo. The strings are kept in the string table.
+ */
+struct PackedDeviceRecord {
+    int32_t product = 0;
+    int32_t vendor = 0;
+    int32_t version = 0;
+    int32_t deviceType = 0;
+    int32_t status = 0;
+    uint32_t idCount = 0;
+    uint32_t sourceTypeCount = 0;
+    uint32_t nameCount = 0;
+    int32_t ids[PACKED_MAX_DEVICE_ITEMS] = {0};
+    int32_t sourceTypes[PACKED_MAX_DEVICE_ITEMS] = {0};
+    PackedStringRef uniq;
+    PackedStringRef name;
+    PackedStringRef phys;
+    PackedStringRef names[PACKED_MAX_DEVICE_ITEMS];
+};
+
+/**
+ * Packed parcel encoding: a header, a fixed-size POD record array and a string table
+ * written as one buffer instead of one parcel call per field.
+ */
+class PackedParcelCodec {
+public:
+    /**
+     * Write the custom and default key mappings as one packed block.
+     * @param parcel parcel
+     * @param customMappings custom key mappings
+     * @param defaultMappings default key mappings
+     * @return true means success
+     */
+    static bool WriteKeyMappings(Parcel &parcel, const std::vector<KeyToTouchMappingInfo> &customMappings,
+                                 const std::vector<KeyToTouchMappingInfo> &defaultMappings);
+
+    /**
+     * Read the custom and default key mappings from one packed block.
+     * @param parcel parcel
+     * @param customMappings custom key mappings
+     * @param defaultMappings default key mappings
+     * @return false means the block is malformed or over the limits
+     */
+    static bool ReadKeyMappings(Parcel &parcel, std::vector<KeyToTouchMappingInfo> &customMappings,
+                                std::vector<KeyToTouchMappingInfo> &defaultMappings);
+
+    /**
+     * Write the device information as one packed block.
+     * @param parcel parcel
+     * @param deviceInfo device information
+     * @return true means success
+     */
+    static bool WriteDeviceInfo(Parcel &parcel, const DeviceInfo &deviceInfo);
+
+    /**
+     * Read the device information from one packed block.
+     * @param parcel parcel
+     * @param deviceInfo device information
+     * @return false means the block is malformed or over the limits
+     */
+    static bool ReadDeviceInfo(Parcel &parcel, DeviceInfo &deviceInfo);
+
+    /**
+     * Convert the key mapping to its fixed-size record.
+     * @param info key mapping
+     * @return record. The caller must make sure combinationKeys is within PACKED_MAX_COMBINATION_KEYS
+     */
+    static PackedKeyMappingRecord ToKeyMappingRecord(const KeyToTouchMappingInfo &info);
+
+    /**
+     * Convert the fixed-size record to the key mapping.
+     * @param record record
+     * @param info key mapping
+     * @return false means the record is invalid
+     */
+    static bool FromKeyMappingRecord(const PackedKeyMappingRecord &record, KeyToTouchMappingInfo &info);
+
+private:
+    static bool WriteBlock(Parcel &parcel, PackedBlockHeader &header, const std::vector<uint8_t> &payload);
+
+    static bool ReadBlock(Parcel &parcel, PackedBlockHeader &header, uint16_t kind, uint32_t recordSize,
+                          uint32_t maxRecordCount, const uint8_t* &payload);
+};
+}
+}
+#endif //GAME_CONTROLLER_GAMECONTROLLER_PACKED_CODEC_H
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_QUEUE_REGISTRY_H
+#define GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_QUEUE_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <singleton.h>
+#include "ffrt.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * The queue of the key mapping. The input of each device class runs on its own queue,
+ * which is named by GameControllerQueueRegistry::GetDeviceQueueName.
+ */
+constexpr const char* KEY_TO_TOUCH_HANDLE_QUEUE_NAME = "KeyToTouchHandleQueue";
+
+/**
+ * The QoS class declared for a queue name.
+ */
+struct QueueQosConfig {
+    const char* name;
+    int32_t qos;
+};
+
+/**
+ * The tasks of the queues with the same name.
+ */
+struct QueueStats {
+    std::string name;
+    int32_t qos = 0;
+
+    /**
+     * The tasks submitted but not run or cancelled yet, and the most of them at once.
+     */
+    int64_t depth = 0;
+    int64_t maxDepth = 0;
+    uint64_t taskCount = 0;
+
+    /**
+     * The time from when a task is due, which is its delay after it's submitted, until it runs, in microseconds.
+     */
+    int64_t totalWaitTime = 0;
+    int64_t maxWaitTime = 0;
+
+    int64_t GetMeanWaitTime() const
+    {
+        return taskCount == 0 ? 0 : totalWaitTime / static_cast<int64_t>(taskCount);
+    }
+};
+
+/**
+ * Counts the tasks of the queues with the same name. It's thread-safe.
+ */
+class QueueStatsRecorder {
+public:
+    QueueStatsRecorder(const std::string &name, int32_t qos);
+
+    ~QueueStatsRecorder() = default;
+
+    void OnSubmitted();
+
+    void OnStarted(int64_t waitTime);
+
+    /**
+     * @param count the tasks which are cancelled, or dropped with their queue
+     */
+    void OnCancelled(int64_t count);
+
+    QueueStats GetStats() const;
+
+private:
+    static void UpdateMax(std::atomic<int64_t> &maxValue, int64_t value);
+
+private:
+    std::string name_;
+    int32_t qos_;
+    std::atomic<int64_t> depth_{0};
+    std::atomic<int64_t> maxDepth_{0};
+    std::atomic<uint64_t> taskCount_{0};
+    std::atomic<int64_t> totalWaitTime_{0};
+    std::atomic<int64_t> maxWaitTime_{0};
+};
+
+/**
+ * An ffrt queue whose tasks are counted by the registry.
+ * It has the same methods as ffrt::queue, so the tasks are submitted the same way.
+ */
+class GameControllerQueue {
+public:
+    GameControllerQueue(const std::string &name, int32_t qos, const std::shared_ptr<QueueStatsRecorder> &recorder);
+
+    ~GameControllerQueue();
+
+    void submit(const std::function<void()> &task, const ffrt::task_attr &attr = ffrt::task_attr());
+
+    ffrt::task_handle submit_h(const std::function<void()> &task, const ffrt::task_attr &attr = ffrt::task_attr());
+
+    /**
+     * @return 0 means the task is cancelled before it runs
+     */
+    int cancel(const ffrt::task_handle &handle);
+
+    void wait(const ffrt::task_handle &handle);
+
+    int32_t GetQos() const
+    {
+        return qos_;
+    }
+
+private:
+    std::function<void()> WrapTask(const std::function<void()> &task, const ffrt::task_attr &attr);
+
+private:
+    int32_t qos_;
+    std::shared_ptr<QueueStatsRecorder> recorder_;
+
+    /**
+     * The tasks of this queue which are not run or cancelled yet.
+     * They're not pending any more when the queue is destroyed.
+     */
+    std::atomic<int64_t> pendingCount_{0};
+
+    /**
+     * Declared last, so it's destroyed before the counters which its tasks use.
+     */
+    std::unique_ptr<ffrt::queue> queue_{nullptr};
+};
+
+/**
+ * Creates the queues of the framework with the QoS classes declared in one table,
+ * so the input queues run at the user-interactive priority and the configuration work runs in the background.
+ * The tasks of every queue name are counted, so the effect of a QoS class can be measured.
+ */
+class GameControllerQueueRegistry : public DelayedSingleton<GameControllerQueueRegistry> {
+DECLARE_DELAYED_SINGLETON(GameControllerQueueRegistry)
+
+public:
+    /**
+     * Create a queue with the QoS class declared for its name.
+     * @param name the name of the queue
+     * @return the queue
+     */
+    std::unique_ptr<GameControllerQueue> CreateQueue(const std::string &name);
+
+    /**
+     * Get the QoS class declared for the name.
+     * @param name the name of the queue
+     * @return the QoS class. It's ffrt::qos_default if the name isn't declared.
+     */
+    static int32_t GetQos(const std::string &name);
+
+    /**
+     * Get the name of the queue of a device class, which has the QoS class declared for the queues of every device.
+     * @param name the name of the queue shared by the device classes
+     * @param deviceType DeviceTypeEnum
+     * @return the name of the queue of the device class
+     */
+    static std::string GetDeviceQueueName(const std::string &name, int32_t deviceType);
+
+    /**
+     * Get the stats of every queue name created.
+     * @return the stats ordered by the name
+     */
+    std::vector<QueueStats> GetAllStats();
+
+    /**
+     * Get the stats of the queue name.
+     * @param name the name of the queue
+     * @param stats the stats
+     * @return false means no queue of the name is created
+     */
+    bool GetStats(const std::string &name, QueueStats &stats);
+
+private:
+    ffrt::mutex mutex_;
+
+    /**
+     * key is the name of the queue. The recorders are kept after their queues are destroyed.
+     */
+    std::map<std::string, std::shared_ptr<QueueStatsRecorder>> recorders_;
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_QUEUE_REGISTRY_H
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <fstream>
+#include <securec.h>
+#include "gamecontroller_input_trace.h"
+#include "gamecontroller_keymapping_model.h"
+#include "gamecontroller_log.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t POINTER_ACTION_MOVE = 3; // the same as MMI::PointerEvent::POINTER_ACTION_MOVE
+
+/**
+ * Upper bound of a trace file accepted by the reader.
+ */
+const size_t MAX_INPUT_TRACE_FILE_SIZE = 256 * 1024 * 1024;
+
+std::vector<const InputTraceRecord*> CollectTouchRecords(const std::vector<InputTraceRecord> &records)
+{
+    std::vector<const InputTraceRecord*> touches;
+    const InputTraceRecord* last = nullptr;
+    for (const auto &record: records) {
+        if (record.header.kind != INPUT_TRACE_TOUCH || record.payload.size() != sizeof(InputTraceTouchRecord)) {
+            continue;
+        }
+        const InputTraceTouchRecord* touch = reinterpret_cast<const InputTraceTouchRecord*>(record.payload.data());
+        if (touch->pointerAction == POINTER_ACTION_MOVE && last != nullptr && last->payload == record.payload) {
+            continue;
+        }
+        touches.push_back(&record);
+        last = &record;
+    }
+    return touches;
+}
+}
+
+void InputTraceCodec::AppendRecord(std::vector<uint8_t> &buffer, InputTraceRecordHeader &header,
+                                   const void* payload, uint32_t payloadSize)
+{
+    header.payloadSize = payloadSize;
+    const uint8_t* headerBegin = reinterpret_cast<const uint8_t*>(&header);
+    buffer.insert(buffer.end(), headerBegin, headerBegin + sizeof(InputTraceRecordHeader));
+    if (payload != nullptr && payloadSize > 0) {
+        const uint8_t* payloadBegin = reinterpret_cast<const uint8_t*>(payload);
+        buffer.insert(buffer.end(), payloadBegin, payloadBegin + payloadSize);
+    }
+}
+
+bool InputTraceCodec::BuildTemplatePayload(int32_t deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                           std::vector<uint8_t> &payload)
+{
+    size_t payloadSize = sizeof(InputTraceTemplateRecord) + mappingInfos.size() * sizeof(PackedKeyMappingRecord);
+    if (payloadSize > MAX_INPUT_TRACE_PAYLOAD_SIZE) {
+        HILOGE("too many key mappings to trace [%{public}zu]", mappingInfos.size());
+        return false;
+    }
+    InputTraceTemplateRecord templateRecord;
+    templateRecord.deviceType = deviceType;
+    templateRecord.mappingCount = static_cast<uint32_t>(mappingInfos.size());
+    payload.clear();
+    payload.reserve(payloadSize);
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(&templateRecord);
+    payload.insert(payload.end(), begin, begin + sizeof(InputTraceTemplateRecord));
+    for (const auto &mappingInfo: mappingInfos) {
+        if (mappingInfo.combinationKeys.size() > PACKED_MAX_COMBINATION_KEYS) {
+            return false;
+        }
+        PackedKeyMappingRecord record = PackedParcelCodec::ToKeyMappingRecord(mappingInfo);
+        begin = reinterpret_cast<const uint8_t*>(&record);
+        payload.insert(payload.end(), begin, begin + sizeof(PackedKeyMappingRecord));
+    }
+    return true;
+}
+
+bool InputTraceCodec::ParseTemplatePayload(const std::vector<uint8_t> &payload, int32_t &deviceType,
+                                           std::vector<KeyToTouchMappingInfo> &mappingInfos)
+{
+    if (payload.size() < sizeof(InputTraceTemplateRecord)) {
+        return false;
+    }
+    InputTraceTemplateRecord templateRecord;
+    if (memcpy_s(&templateRecord, sizeof(templateRecord), payload.data(), sizeof(templateRecord)) != EOK) {
+        return false;
+    }
+    // The traces captured before the fields were appended have shorter records.
+    size_t recordsSize = payload.size() - sizeof(InputTraceTemplateRecord);
+    size_t recordSize = templateRecord.mappingCount == 0 ? sizeof(PackedKeyMappingRecord) :
+        recordsSize / templateRecord.mappingCount;
+    if (recordsSize != recordSize * templateRecord.mappingCount || recordSize % sizeof(int32_t) != 0 ||
+        recordSize < PACKED_KEY_MAPPING_RECORD_MIN_SIZE || recordSize > sizeof(PackedKeyMappingRecord)) {
+        return false;
+    }
+    deviceType = templateRecord.deviceType;
+    mappingInfos.clear();
+    mappingInfos.reserve(templateRecord.mappingCount);
+    const uint8_t* cursor = payload.data() + sizeof(InputTraceTemplateRecord);
+    for (uint32_t idx = 0; idx < templateRecord.mappingCount; idx++) {
+        PackedKeyMappingRecord record;
+        if (memcpy_s(&record, sizeof(record), cursor, recordSize) != EOK) {
+            return false;
+        }
+        KeyToTouchMappingInfo mappingInfo;
+        if (!PackedParcelCodec::FromKeyMappingRecord(record, mappingInfo)) {
+            return false;
+        }
+        mappingInfos.push_back(mappingInfo);
+        cursor += recordSize;
+    }
+    return true;
+}
+
+bool InputTraceCodec::Parse(const uint8_t* data, size_t size, InputTraceFileHeader &fileHeader,
+                            std::vector<InputTraceRecord> &records)
+{
+    if (data == nullptr || size < sizeof(InputTraceFileHeader)) {
+        return false;
+    }
+    if (memcpy_s(&fileHeader, sizeof(fileHeader), data, sizeof(fileHeader)) != EOK) {
+        return false;
+    }
+    if (fileHeader.magic != INPUT_TRACE_MAGIC || fileHeader.version != INPUT_TRACE_VERSION ||
+        fileHeader.headerSize != sizeof(InputTraceFileHeader)) {
+        HILOGE("invalid input trace header. version is [%{public}d]", fileHeader.version);
+        return false;
+    }
+    size_t offset = sizeof(InputTraceFileHeader);
+    while (offset < size) {
+        if (size - offset < sizeof(InputTraceRecordHeader)) {
+            HILOGE("truncated input trace record at [%{public}zu]", offset);
+            return false;
+        }
+        InputTraceRecord record;
+        if (memcpy_s(&record.header, sizeof(record.header), data + offset, sizeof(record.header)) != EOK) {
+            return false;
+        }
+        offset += sizeof(InputTraceRecordHeader);
+        if (record.header.payloadSize > MAX_INPUT_TRACE_PAYLOAD_SIZE || record.header.payloadSize > size - offset) {
+            HILOGE("invalid input trace payload size [%{public}u]", record.header.payloadSize);
+            return false;
+        }
+        record.payload.assign(data + offset, data + offset + record.header.payloadSize);
+        offset += record.header.payloadSize;
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+bool InputTraceCodec::ReadFile(const std::string &path, InputTraceFileHeader &fileHeader,
+                               std::vector<InputTraceRecord> &records)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        HILOGE("open input trace failed");
+        return false;
+    }
+    std::vector<uint8_t> data;
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    if (fileSize < 0 || static_cast<size_t>(fileSize) > MAX_INPUT_TRACE_FILE_SIZE) {
+        HILOGE("invalid input trace size");
+        return false;
+    }
+    file.seekg(0, std::ios::beg);
+    data.resize(static_cast<size_t>(fileSize));
+    if (!data.empty() && !file.read(reinterpret_cast<char*>(data.data()), fileSize)) {
+        return false;
+    }
+    return Parse(data.data(), data.size(), fileHeader, records);
+}
+
+InputTraceCompareResult InputTraceCodec::CompareTouchStream(const std::vector<InputTraceRecord> &expected,
+                                                            const std::vector<InputTraceRecord> &actual)
+{
+    std::vector<const InputTraceRecord*> expectedTouches = CollectTouchRecords(expected);
+    std::vector<const InputTraceRecord*> actualTouches = CollectTouchRecords(actual);
+    InputTraceCompareResult result;
+    result.expectedCount = expectedTouches.size();
+    result.actualCount = actualTouches.size();
+    size_t count = std::min(expectedTouches.size(), actualTouches.size());
+    size_t idx = 0;
+    while (idx < count && expectedTouches[idx]->payload == actualTouches[idx]->payload) {
+        idx++;
+    }
+    result.firstMismatchIndex = idx;
+    result.isSame = idx == count && expectedTouches.size() == actualTouches.size();
+    return result;
+}
+
+InputTraceWriter::~InputTraceWriter()
+{
+    Close();
+}
+
+bool InputTraceWriter::Open(const std::string &path, const InputTraceFileHeader &fileHeader)
+{
+    Close();
+    file_ = fopen(path.c_str(), "wb");
+    if (file_ == nullptr) {
+        HILOGE("create input trace failed");
+        return false;
+    }
+    if (fwrite(&fileHeader, sizeof(fileHeader), 1, file_) != 1) {
+        HILOGE("write input trace header failed");
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool InputTraceWriter::Write(const std::vector<uint8_t> &buffer)
+{
+    if (file_ == nullptr) {
+        return false;
+    }
+    if (buffer.empty()) {
+        return true;
+    }
+    if (fwrite(buffer.data(), 1, buffer.size(), file_) != buffer.size()) {
+        HILOGE("write input trace failed");
+        return false;
+    }
+    return fflush(file_) == 0;
+}
+
+void InputTraceWriter::Close()
+{
+    if (file_ != nullptr) {
+        (void)fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool InputTraceWriter::IsOpen() const
+{
+    return file_ != nullptr;
+}
+}
+}
@@ -39,7 +39,10 @@ std::unordered_map<MappingTypeEnum, CheckHandler> checkKeyMappingHandlerMap = {
     {MappingTypeEnum::KEY_BOARD_OBSERVATION_TO_TOUCH,   &GameKeyMappingInfo::CheckKeyBoardObservation},
     {MappingTypeEnum::CROSSHAIR_KEY_TO_TOUCH,           &GameKeyMappingInfo::CheckCrosshairKey},
     {MappingTypeEnum::MOUSE_LEFT_FIRE_TO_TOUCH,         &GameKeyMappingInfo::CheckMouseLeftFire},
-    {MappingTypeEnum::MOUSE_RIGHT_KEY_CLICK_TO_TOUCH,   &GameKeyMappingInfo::CheckMouseRightKeyClick}
+    {MappingTypeEnum::MOUSE_RIGHT_KEY_CLICK_TO_TOUCH,   &GameKeyMappingInfo::CheckMouseRightKeyClick},
+    {MappingTypeEnum::GAMEPAD_STICK_TO_TOUCH,           &GameKeyMappingInfo::CheckGamePadStick},
+    {MappingTypeEnum::GAMEPAD_STICK_OBSERVATION_TO_TOUCH, &GameKeyMappingInfo::CheckGamePadStickObservation},
+    {MappingTypeEnum::GAMEPAD_TRIGGER_TO_TOUCH,         &GameKeyMappingInfo::CheckGamePadTrigger}
 };
 }
 
@@ -60,6 +63,8 @@ bool GameKeyMappingInfo::CheckSingleKey(KeyToTouchMappingInfo &currentKeyMapping
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -96,6 +101,8 @@ bool GameKeyMappingInfo::CheckCombinationKey(KeyToTouchMappingInfo &currentKeyMa
     currentKeyMapping.SetDpadInfoToDefault();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -113,6 +120,8 @@ bool GameKeyMappingInfo::CheckDpadKey(KeyToTouchMappingInfo &currentKeyMapping,
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.skillRange = 0;
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -138,6 +147,8 @@ bool GameKeyMappingInfo::CheckMouseRightKeyWalking(KeyToTouchMappingInfo &curren
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.skillRange = 0;
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -161,6 +172,8 @@ bool GameKeyMappingInfo::CheckSkillKey(KeyToTouchMappingInfo &currentKeyMapping,
     currentKeyMapping.SetDpadInfoToDefault();
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -182,6 +195,8 @@ bool GameKeyMappingInfo::CheckObservationKey(KeyToTouchMappingInfo &currentKeyMa
     currentKeyMapping.SetDpadInfoToDefault();
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -205,6 +220,8 @@ bool GameKeyMappingInfo::CheckMouseObservation(KeyToTouchMappingInfo &currentKey
     currentKeyMapping.SetDpadInfoToDefault();
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -224,6 +241,8 @@ bool GameKeyMappingInfo::CheckKeyBoardObservation(KeyToTouchMappingInfo &current
     currentKeyMapping.keyCode = 0;
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
@@ -245,11 +264,16 @@ bool GameKeyMappingInfo::CheckCrosshairKey(KeyToTouchMappingInfo &currentKeyMapp
     currentKeyMapping.SetDpadInfoToDefault();
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
+    currentKeyMapping.SetTapToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
 bool GameKeyMappingInfo::CheckMouseLeftFire(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter)
 {
+    if (!IsTapValid(currentKeyMapping)) {
+        return false;
+    }
     if (++parameter.keyMappingNumber[MappingTypeEnum::MOUSE_LEFT_FIRE_TO_TOUCH] > 1) {
         HILOGE("numbers of MOUSE_LEFT_FIRE_TO_TOUCH have exceeded its limit[1]");
         return false;
@@ -260,11 +284,15 @@ bool GameKeyMappingInfo::CheckMouseLeftFire(KeyToTouchMappingInfo &currentKeyMap
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
     return true;
 }
 
 bool GameKeyMappingInfo::CheckMouseRightKeyClick(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter)
 {
+    if (!IsTapValid(currentKeyMapping)) {
+        return false;
+    }
     if (++parameter.keyMappingNumber[MappingTypeEnum::MOUSE_RIGHT_KEY_CLICK_TO_TOUCH] > 1) {
         HILOGE("numbers of MOUSE_RIGHT_KEY_CLICK_TO_TOUCH have exceeded its limit[1]");
         return false;
@@ -279,12 +307,89 @@ bool GameKeyMappingInfo::CheckMouseRightKeyClick(KeyToTouchMappingInfo &currentK
     currentKeyMapping.combinationKeys.clear();
     currentKeyMapping.SetSkillRangeRadiusToDefault();
     currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetDeadZoneToDefault();
+    return true;
+}
+
+bool GameKeyMappingInfo::CheckGamePadStick(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter)
+{
+    if (currentKeyMapping.keyCode != GamePadAxisSourceTypeEnum::LeftThumbstick &&
+        currentKeyMapping.keyCode != GamePadAxisSourceTypeEnum::RightThumbstick) {
+        HILOGE("the keyCode of GAMEPAD_STICK_TO_TOUCH must be a thumbstick");
+        return false;
+    }
+    if (currentKeyMapping.radius <= 0) {
+        HILOGE("radius must be greater than 0");
+        return false;
+    }
+    if (!IsDeadZoneValid(currentKeyMapping) || !IsGamePadAxisUniq(currentKeyMapping, parameter)) {
+        return false;
+    }
+
+    currentKeyMapping.SetDpadInfoToDefault();
+    currentKeyMapping.combinationKeys.clear();
+    currentKeyMapping.skillRange = 0;
+    currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
+    return true;
+}
+
+bool GameKeyMappingInfo::CheckGamePadStickObservation(KeyToTouchMappingInfo &currentKeyMapping,
+                                                      ParameterByCheck &parameter)
+{
+    if (currentKeyMapping.keyCode != GamePadAxisSourceTypeEnum::LeftThumbstick &&
+        currentKeyMapping.keyCode != GamePadAxisSourceTypeEnum::RightThumbstick) {
+        HILOGE("the keyCode of GAMEPAD_STICK_OBSERVATION_TO_TOUCH must be a thumbstick");
+        return false;
+    }
+    if (!IsStepValid(currentKeyMapping) || !IsDeadZoneValid(currentKeyMapping) ||
+        !IsGamePadAxisUniq(currentKeyMapping, parameter)) {
+        return false;
+    }
+
+    currentKeyMapping.SetDpadInfoToDefault();
+    currentKeyMapping.combinationKeys.clear();
+    currentKeyMapping.SetSkillRangeRadiusToDefault();
+    currentKeyMapping.SetTapToDefault();
+    return true;
+}
+
+bool GameKeyMappingInfo::CheckGamePadTrigger(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter)
+{
+    if (currentKeyMapping.keyCode != GamePadAxisSourceTypeEnum::LeftTriggerAxis &&
+        currentKeyMapping.keyCode != GamePadAxisSourceTypeEnum::RightTriggerAxis) {
+        HILOGE("the keyCode of GAMEPAD_TRIGGER_TO_TOUCH must be a trigger");
+        return false;
+    }
+    if (!IsDeadZoneValid(currentKeyMapping) || !IsGamePadAxisUniq(currentKeyMapping, parameter)) {
+        return false;
+    }
+
+    currentKeyMapping.SetDpadInfoToDefault();
+    currentKeyMapping.combinationKeys.clear();
+    currentKeyMapping.SetSkillRangeRadiusToDefault();
+    currentKeyMapping.SetStepToDefault();
+    currentKeyMapping.SetTapToDefault();
     return true;
 }
 
-bool GameKeyMappingInfo::CheckKeyMapping(std::vector<KeyToTouchMappingInfo> &KeyToTouchMappings)
+bool GameKeyMappingInfo::IsGamePadAxisUniq(KeyToTouchMappingInfo &currentKeyMapping, ParameterByCheck &parameter)
+{
+    if (!parameter.isGamePad) {
+        HILOGE("MappingTypeEnum [%{public}d] is only supported by GAME_PAD", currentKeyMapping.mappingType);
+        return false;
+    }
+    if (!parameter.uniqAxisSet.insert(currentKeyMapping.keyCode).second) {
+        HILOGE("axis [%{public}d] has been used", currentKeyMapping.keyCode);
+        return false;
+    }
+    return true;
+}
+
+bool GameKeyMappingInfo::CheckKeyMapping(std::vector<KeyToTouchMappingInfo> &KeyToTouchMappings, bool isGamePad)
 {
     ParameterByCheck parameter;
+    parameter.isGamePad = isGamePad;
     for (size_t i = 0; i < KeyToTouchMappings.size(); ++i) {
         MappingTypeEnum currentMappingType = KeyToTouchMappings[i].mappingType;
         if (checkKeyMappingHandlerMap.find(currentMappingType) != checkKeyMappingHandlerMap.end()) {
@@ -336,6 +441,31 @@ bool GameKeyMappingInfo::IsStepValid(const KeyToTouchMappingInfo &currentKeyMapp
     return true;
 }
 
+bool GameKeyMappingInfo::IsTapValid(const KeyToTouchMappingInfo &currentKeyMapping)
+{
+    if (currentKeyMapping.tapInterval != 0 &&
+        (currentKeyMapping.tapInterval < MIN_TAP_INTERVAL || currentKeyMapping.tapInterval > MAX_TAP_INTERVAL)) {
+        HILOGE("tapInterval must be 0 or between %{public}d and %{public}d", MIN_TAP_INTERVAL, MAX_TAP_INTERVAL);
+        return false;
+    }
+    if (currentKeyMapping.tapDutyCycle != 0 && (currentKeyMapping.tapDutyCycle < MIN_TAP_DUTY_CYCLE
+        || currentKeyMapping.tapDutyCycle > MAX_TAP_DUTY_CYCLE)) {
+        HILOGE("tapDutyCycle must be 0 or between %{public}d and %{public}d",
+               MIN_TAP_DUTY_CYCLE, MAX_TAP_DUTY_CYCLE);
+        return false;
+    }
+    return true;
+}
+
+bool GameKeyMappingInfo::IsDeadZoneValid(const KeyToTouchMappingInfo &currentKeyMapping)
+{
+    if (currentKeyMapping.deadZone < 0 || currentKeyMapping.deadZone > MAX_AXIS_DEAD_ZONE) {
+        HILOGE("deadZone must be between 0 and %{public}d", MAX_AXIS_DEAD_ZONE);
+        return false;
+    }
+    return true;
+}
+
 bool GameKeyMappingInfo::CheckKeyMappingForHoverTouchPad(std::vector<KeyToTouchMappingInfo> &KeyToTouchMappings)
 {
     std::unordered_set<int32_t> uniqKeycodeSet;
@@ -360,6 +490,8 @@ bool GameKeyMappingInfo::CheckKeyMappingForHoverTouchPad(std::vector<KeyToTouchM
         currentKeyMapping.combinationKeys.clear();
         currentKeyMapping.SetSkillRangeRadiusToDefault();
         currentKeyMapping.SetStepToDefault();
+        currentKeyMapping.SetTapToDefault();
+        currentKeyMapping.SetDeadZoneToDefault();
     }
     return true;
 }
@@ -0,0 +1,333 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <algorithm>
+#include <securec.h>
+#include <message_parcel.h>
+#include "gamecontroller_packed_codec.h"
+#include "gamecontroller_keymapping_model.h"
+#include "gamecontroller_log.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+static_assert(PACKED_MAX_COMBINATION_KEYS == MAX_COMBINATION_KEYS, "combination keys of the record mismatch");
+static_assert(PACKED_MAX_DEVICE_ITEMS == static_cast<uint32_t>(MAX_SIZE), "device items of the record mismatch");
+
+const uint32_t MAX_PACKED_KEY_MAPPING_RECORDS = static_cast<uint32_t>(MAX_KEY_MAPPING_SIZE) * 2;
+const uint32_t MAX_PACKED_DEVICE_RECORDS = 1;
+
+PackedKeyMappingRecord BuildKeyMappingRecord(const KeyToTouchMappingInfo &info)
+{
+    PackedKeyMappingRecord record;
+    record.keyCode = info.keyCode;
+    record.xValue = info.xValue;
+    record.yValue = info.yValue;
+    record.mappingType = static_cast<int32_t>(info.mappingType);
+    record.radius = info.radius;
+    record.skillRange = info.skillRange;
+    record.xStep = info.xStep;
+    record.yStep = info.yStep;
+    record.delayTime = info.delayTime;
+    record.tapInterval = info.tapInterval;
+    record.tapDutyCycle = info.tapDutyCycle;
+    record.deadZone = info.deadZone;
+    record.dpadUp = info.dpadKeyCodeEntity.up;
+    record.dpadDown = info.dpadKeyCodeEntity.down;
+    record.dpadLeft = info.dpadKeyCodeEntity.left;
+    record.dpadRight = info.dpadKeyCodeEntity.right;
+    record.combinationKeyCount = static_cast<int32_t>(info.combinationKeys.size());
+    for (size_t idx = 0; idx < info.combinationKeys.size(); idx++) {
+        record.combinationKeys[idx] = info.combinationKeys[idx];
+    }
+    return record;
+}
+
+bool ParseKeyMappingRecord(const PackedKeyMappingRecord &record, KeyToTouchMappingInfo &info)
+{
+    if (record.mappingType < static_cast<int32_t>(SINGE_KEY_TO_TOUCH) ||
+        record.mappingType > static_cast<int32_t>(GAMEPAD_TRIGGER_TO_TOUCH)) {
+        return false;
+    }
+    if (record.combinationKeyCount < 0 ||
+        record.combinationKeyCount > static_cast<int32_t>(PACKED_MAX_COMBINATION_KEYS)) {
+        return false;
+    }
+    info.keyCode = record.keyCode;
+    info.xValue = record.xValue;
+    info.yValue = record.yValue;
+    info.mappingType = static_cast<MappingTypeEnum>(record.mappingType);
+    info.radius = record.radius;
+    info.skillRange = record.skillRange;
+    info.xStep = record.xStep;
+    info.yStep = record.yStep;
+    info.delayTime = record.delayTime;
+    info.tapInterval = record.tapInterval;
+    info.tapDutyCycle = record.tapDutyCycle;
+    info.deadZone = record.deadZone;
+    info.dpadKeyCodeEntity.up = record.dpadUp;
+    info.dpadKeyCodeEntity.down = record.dpadDown;
+    info.dpadKeyCodeEntity.left = record.dpadLeft;
+    info.dpadKeyCodeEntity.right = record.dpadRight;
+    info.combinationKeys.assign(record.combinationKeys, record.combinationKeys + record.combinationKeyCount);
+    return true;
+}
+
+PackedStringRef AppendString(std::vector<uint8_t> &stringTable, const std::string &value)
+{
+    PackedStringRef ref;
+    ref.offset = static_cast<uint32_t>(stringTable.size());
+    ref.length = static_cast<uint32_t>(value.size());
+    stringTable.insert(stringTable.end(), value.begin(), value.end());
+    return ref;
+}
+
+bool ParseString(const uint8_t* stringTable, uint32_t stringTableSize, const PackedStringRef &ref,
+                 std::string &value)
+{
+    if (ref.offset > stringTableSize || ref.length > stringTableSize - ref.offset) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(stringTable + ref.offset), ref.length);
+    return true;
+}
+
+template<typename T>
+void AppendRecord(std::vector<uint8_t> &payload, const T &record)
+{
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(&record);
+    payload.insert(payload.end(), begin, begin + sizeof(T));
+}
+}
+
+bool PackedParcelCodec::WriteKeyMappings(Parcel &parcel, const std::vector<KeyToTouchMappingInfo> &customMappings,
+                                         const std::vector<KeyToTouchMappingInfo> &defaultMappings)
+{
+    size_t recordCount = customMappings.size() + defaultMappings.size();
+    if (recordCount > MAX_PACKED_KEY_MAPPING_RECORDS) {
+        HILOGE("too many key mappings to pack [%{public}zu]", recordCount);
+        return false;
+    }
+    std::vector<uint8_t> payload;
+    payload.reserve(recordCount * sizeof(PackedKeyMappingRecord));
+    for (const auto &info: customMappings) {
+        if (info.combinationKeys.size() > PACKED_MAX_COMBINATION_KEYS) {
+            return false;
+        }
+        AppendRecord(payload, BuildKeyMappingRecord(info));
+    }
+    for (const auto &info: defaultMappings) {
+        if (info.combinationKeys.size() > PACKED_MAX_COMBINATION_KEYS) {
+            return false;
+        }
+        AppendRecord(payload, BuildKeyMappingRecord(info));
+    }
+
+    PackedBlockHeader header;
+    header.kind = PACKED_KIND_KEY_MAPPING;
+    header.recordSize = sizeof(PackedKeyMappingRecord);
+    header.recordCount = static_cast<uint32_t>(recordCount);
+    header.firstGroupCount = static_cast<uint32_t>(customMappings.size());
+    return WriteBlock(parcel, header, payload);
+}
+
+bool PackedParcelCodec::ReadKeyMappings(Parcel &parcel, std::vector<KeyToTouchMappingInfo> &customMappings,
+                                        std::vector<KeyToTouchMappingInfo> &defaultMappings)
+{
+    PackedBlockHeader header;
+    const uint8_t* payload = nullptr;
+    if (!ReadBlock(parcel, header, PACKED_KIND_KEY_MAPPING, PACKED_KEY_MAPPING_RECORD_MIN_SIZE,
+                   MAX_PACKED_KEY_MAPPING_RECORDS, payload)) {
+        return false;
+    }
+    uint32_t defaultCount = header.recordCount - header.firstGroupCount;
+    if (header.firstGroupCount > static_cast<uint32_t>(MAX_KEY_MAPPING_SIZE) ||
+        defaultCount > static_cast<uint32_t>(MAX_KEY_MAPPING_SIZE)) {
+        return false;
+    }
+    customMappings.clear();
+    defaultMappings.clear();
+    customMappings.reserve(header.firstGroupCount);
+    defaultMappings.reserve(defaultCount);
+    for (uint32_t idx = 0; idx < header.recordCount; idx++) {
+        // The record may not be aligned in the parcel buffer, so copy it out. Only the known prefix is copied.
+        PackedKeyMappingRecord record;
+        if (memcpy_s(&record, sizeof(record), payload + static_cast<size_t>(idx) * header.recordSize,
+                     std::min<size_t>(header.recordSize, sizeof(record))) != EOK) {
+            return false;
+        }
+        KeyToTouchMappingInfo info;
+        if (!ParseKeyMappingRecord(record, info)) {
+            return false;
+        }
+        if (idx < header.firstGroupCount) {
+            customMappings.push_back(std::move(info));
+        } else {
+            defaultMappings.push_back(std::move(info));
+        }
+    }
+    return true;
+}
+
+bool PackedParcelCodec::WriteDeviceInfo(Parcel &parcel, const DeviceInfo &deviceInfo)
+{
+    if (deviceInfo.ids.size() > PACKED_MAX_DEVICE_ITEMS || deviceInfo.names.size() > PACKED_MAX_DEVICE_ITEMS ||
+        deviceInfo.sourceTypeSet.size() > PACKED_MAX_DEVICE_ITEMS) {
+        HILOGE("device items over the limit of the packed record");
+        return false;
+    }
+    PackedDeviceRecord record;
+    std::vector<uint8_t> stringTable;
+    record.product = deviceInfo.product;
+    record.vendor = deviceInfo.vendor;
+    record.version = deviceInfo.version;
+    record.deviceType = static_cast<int32_t>(deviceInfo.deviceType);
+    record.status = deviceInfo.status;
+    for (auto id: deviceInfo.ids) {
+        record.ids[record.idCount++] = id;
+    }
+    for (auto sourceType: deviceInfo.sourceTypeSet) {
+        record.sourceTypes[record.sourceTypeCount++] = static_cast<int32_t>(sourceType);
+    }
+    record.uniq = AppendString(stringTable, deviceInfo.uniq);
+    record.name = AppendString(stringTable, deviceInfo.name);
+    record.phys = AppendString(stringTable, deviceInfo.phys);
+    for (const auto &name: deviceInfo.names) {
+        record.names[record.nameCount++] = AppendString(stringTable, name);
+    }
+    if (stringTable.size() > MAX_PACKED_PAYLOAD_SIZE - sizeof(PackedDeviceRecord)) {
+        HILOGE("device strings over the limit of the packed block");
+        return false;
+    }
+
+    std::vector<uint8_t> payload;
+    payload.reserve(sizeof(PackedDeviceRecord) + stringTable.size());
+    AppendRecord(payload, record);
+    payload.insert(payload.end(), stringTable.begin(), stringTable.end());
+
+    PackedBlockHeader header;
+    header.kind = PACKED_KIND_DEVICE_INFO;
+    header.recordSize = sizeof(PackedDeviceRecord);
+    header.recordCount = MAX_PACKED_DEVICE_RECORDS;
+    header.stringTableSize = static_cast<uint32_t>(stringTable.size());
+    return WriteBlock(parcel, header, payload);
+}
+
+bool PackedParcelCodec::ReadDeviceInfo(Parcel &parcel, DeviceInfo &deviceInfo)
+{
+    PackedBlockHeader header;
+    const uint8_t* payload = nullptr;
+    if (!ReadBlock(parcel, header, PACKED_KIND_DEVICE_INFO, sizeof(PackedDeviceRecord), MAX_PACKED_DEVICE_RECORDS,
+                   payload) || header.recordCount != MAX_PACKED_DEVICE_RECORDS) {
+        return false;
+    }
+    PackedDeviceRecord record;
+    if (memcpy_s(&record, sizeof(record), payload, sizeof(record)) != EOK) {
+        return false;
+    }
+    if (record.idCount > PACKED_MAX_DEVICE_ITEMS || record.sourceTypeCount > PACKED_MAX_DEVICE_ITEMS ||
+        record.nameCount > PACKED_MAX_DEVICE_ITEMS) {
+        return false;
+    }
+    const uint8_t* stringTable = payload + header.recordSize;
+    if (!ParseString(stringTable, header.stringTableSize, record.uniq, deviceInfo.uniq) ||
+        !ParseString(stringTable, header.stringTableSize, record.name, deviceInfo.name) ||
+        !ParseString(stringTable, header.stringTableSize, record.phys, deviceInfo.phys)) {
+        return false;
+    }
+    for (uint32_t idx = 0; idx < record.nameCount; idx++) {
+        std::string name;
+        if (!ParseString(stringTable, header.stringTableSize, record.names[idx], name)) {
+            return false;
+        }
+        deviceInfo.names.insert(std::move(name));
+    }
+    deviceInfo.product = record.product;
+    deviceInfo.vendor = record.vendor;
+    deviceInfo.version = record.version;
+    deviceInfo.deviceType = static_cast<DeviceTypeEnum>(record.deviceType);
+    deviceInfo.status = record.status;
+    deviceInfo.ids.insert(record.ids, record.ids + record.idCount);
+    for (uint32_t idx = 0; idx < record.sourceTypeCount; idx++) {
+        deviceInfo.sourceTypeSet.insert(static_cast<InputSourceTypeEnum>(record.sourceTypes[idx]));
+    }
+    return true;
+}
+
+PackedKeyMappingRecord PackedParcelCodec::ToKeyMappingRecord(const KeyToTouchMappingInfo &info)
+{
+    return BuildKeyMappingRecord(info);
+}
+
+bool PackedParcelCodec::FromKeyMappingRecord(const PackedKeyMappingRecord &record, KeyToTouchMappingInfo &info)
+{
+    return ParseKeyMappingRecord(record, info);
+}
+
+bool PackedParcelCodec::WriteBlock(Parcel &parcel, PackedBlockHeader &header, const std::vector<uint8_t> &payload)
+{
+    MessageParcel* messageParcel = dynamic_cast<MessageParcel*>(&parcel);
+    if (messageParcel != nullptr && payload.size() > PACKED_RAW_DATA_THRESHOLD) {
+        header.flags |= PACKED_FLAG_RAW_DATA;
+    }
+    if (!parcel.WriteBuffer(&header, sizeof(header))) {
+        return false;
+    }
+    if (payload.empty()) {
+        return true;
+    }
+    if ((header.flags & PACKED_FLAG_RAW_DATA) != 0) {
+        return messageParcel->WriteRawData(payload.data(), payload.size());
+    }
+    return parcel.WriteBuffer(payload.data(), payload.size());
+}
+
+bool PackedParcelCodec::ReadBlock(Parcel &parcel, PackedBlockHeader &header, uint16_t kind, uint32_t recordSize,
+                                  uint32_t maxRecordCount, const uint8_t* &payload)
+{
+    payload = nullptr;
+    const uint8_t* headerBuffer = parcel.ReadBuffer(sizeof(PackedBlockHeader));
+    if (headerBuffer == nullptr ||
+        memcpy_s(&header, sizeof(header), headerBuffer, sizeof(PackedBlockHeader)) != EOK) {
+        return false;
+    }
+    // Records from a newer minor layout may be larger, and the known prefix is still readable.
+    if (header.magic != PACKED_MAGIC || header.version != PACKED_VERSION || header.kind != kind ||
+        header.recordSize < recordSize || header.recordCount > maxRecordCount ||
+        header.firstGroupCount > header.recordCount) {
+        HILOGE("invalid packed header, kind[%{public}u], version[%{public}u]", header.kind, header.version);
+        return false;
+    }
+    uint64_t payloadSize = static_cast<uint64_t>(header.recordSize) * header.recordCount + header.stringTableSize;
+    if (payloadSize > MAX_PACKED_PAYLOAD_SIZE) {
+        HILOGE("packed payload is over the limit");
+        return false;
+    }
+    if (payloadSize == 0) {
+        return true;
+    }
+    if ((header.flags & PACKED_FLAG_RAW_DATA) != 0) {
+        MessageParcel* messageParcel = dynamic_cast<MessageParcel*>(&parcel);
+        if (messageParcel == nullptr) {
+            return false;
+        }
+        payload = reinterpret_cast<const uint8_t*>(messageParcel->ReadRawData(static_cast<size_t>(payloadSize)));
+    } else {
+        payload = parcel.ReadBuffer(static_cast<size_t>(payloadSize));
+    }
+    return payload != nullptr;
+}
+}
+}
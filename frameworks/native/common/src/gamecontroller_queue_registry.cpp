@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include "gamecontroller_queue_registry.h"
+#include "gamecontroller_log.h"
+#include "gamecontroller_utils.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+/**
+ * The QoS classes of the framework queues.
+ * The queues which turn the input into touches or callbacks while the game is played are user-interactive.
+ * The queues of the configuration, the plugin windows and the traces are in the background.
+ */
+const QueueQosConfig QUEUE_QOS_CONFIGS[] = {
+    // the templates, the window information and the periodic checks of the key mapping
+    {KEY_TO_TOUCH_HANDLE_QUEUE_NAME, ffrt::qos_background},
+
+    {"keyboard-observation-thread", ffrt::qos_user_interactive},
+    {"mouse-right-walking-thread", ffrt::qos_user_interactive},
+    {"inputEventCallbackQueue", ffrt::qos_user_interactive},
+    {"plugin-input-thread", ffrt::qos_user_interactive},
+
+    {"KeyMappingServiceHandleQueue", ffrt::qos_background},
+    {"plugin-callback-thread", ffrt::qos_background},
+    {"InputTraceWriteQueue", ffrt::qos_background},
+
+    {"deviceQueryQueue_", ffrt::qos_default},
+    {"deviceTaskQueue", ffrt::qos_default},
+    {"deviceEventCallbackQueue", ffrt::qos_default},
+};
+
+/**
+ * The QoS classes of the queues of every device class, which are named by GetDeviceQueueName.
+ */
+const QueueQosConfig DEVICE_QUEUE_QOS_CONFIGS[] = {
+    // the input of GAME_PAD, HOVER_TOUCH_PAD and GAME_KEY_BOARD
+    {KEY_TO_TOUCH_HANDLE_QUEUE_NAME, ffrt::qos_user_interactive},
+};
+
+const char DEVICE_QUEUE_NAME_SEPARATOR = '-';
+
+bool IsDeviceQueueName(const std::string &name, const char* sharedName)
+{
+    size_t prefixLength = strlen(sharedName);
+    if (name.size() <= prefixLength + 1 || name.compare(0, prefixLength, sharedName) != 0 ||
+        name[prefixLength] != DEVICE_QUEUE_NAME_SEPARATOR) {
+        return false;
+    }
+    return std::all_of(name.begin() + static_cast<std::ptrdiff_t>(prefixLength + 1), name.end(), [](char c) {
+        return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    });
+}
+}
+
+QueueStatsRecorder::QueueStatsRecorder(const std::string &name, int32_t qos) : name_(name), qos_(qos)
+{
+}
+
+void QueueStatsRecorder::OnSubmitted()
+{
+    int64_t depth = depth_.fetch_add(1, std::memory_order_relaxed) + 1;
+    UpdateMax(maxDepth_, depth);
+}
+
+void QueueStatsRecorder::OnStarted(int64_t waitTime)
+{
+    depth_.fetch_sub(1, std::memory_order_relaxed);
+    taskCount_.fetch_add(1, std::memory_order_relaxed);
+    // a delayed task may run a little before its due time
+    waitTime = std::max<int64_t>(waitTime, 0);
+    totalWaitTime_.fetch_add(waitTime, std::memory_order_relaxed);
+    UpdateMax(maxWaitTime_, waitTime);
+}
+
+void QueueStatsRecorder::OnCancelled(int64_t count)
+{
+    depth_.fetch_sub(count, std::memory_order_relaxed);
+}
+
+QueueStats QueueStatsRecorder::GetStats() const
+{
+    QueueStats stats;
+    stats.name = name_;
+    stats.qos = qos_;
+    stats.depth = depth_.load(std::memory_order_relaxed);
+    stats.maxDepth = maxDepth_.load(std::memory_order_relaxed);
+    stats.taskCount = taskCount_.load(std::memory_order_relaxed);
+    stats.totalWaitTime = totalWaitTime_.load(std::memory_order_relaxed);
+    stats.maxWaitTime = maxWaitTime_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void QueueStatsRecorder::UpdateMax(std::atomic<int64_t> &maxValue, int64_t value)
+{
+    int64_t current = maxValue.load(std::memory_order_relaxed);
+    while (value > current) {
+        if (maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+GameControllerQueue::GameControllerQueue(const std::string &name, int32_t qos,
+                                         const std::shared_ptr<QueueStatsRecorder> &recorder)
+    : qos_(qos), recorder_(recorder)
+{
+    queue_ = std::make_unique<ffrt::queue>(name.c_str(), ffrt::queue_attr().qos(qos));
+}
+
+GameControllerQueue::~GameControllerQueue()
+{
+    queue_ = nullptr;
+    int64_t pendingCount = pendingCount_.load();
+    if (pendingCount > 0) {
+        recorder_->OnCancelled(pendingCount);
+    }
+}
+
+void GameControllerQueue::submit(const std::function<void()> &task, const ffrt::task_attr &attr)
+{
+    queue_->submit(WrapTask(task, attr), attr);
+}
+
+ffrt::task_handle GameControllerQueue::submit_h(const std::function<void()> &task, const ffrt::task_attr &attr)
+{
+    return queue_->submit_h(WrapTask(task, attr), attr);
+}
+
+int GameControllerQueue::cancel(const ffrt::task_handle &handle)
+{
+    int ret = queue_->cancel(handle);
+    if (ret == 0) {
+        pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+        recorder_->OnCancelled(1);
+    }
+    return ret;
+}
+
+void GameControllerQueue::wait(const ffrt::task_handle &handle)
+{
+    queue_->wait(handle);
+}
+
+std::function<void()> GameControllerQueue::WrapTask(const std::function<void()> &task, const ffrt::task_attr &attr)
+{
+    int64_t dueTime = StringUtils::GetSysClockTime() + static_cast<int64_t>(attr.delay());
+    pendingCount_.fetch_add(1, std::memory_order_relaxed);
+    recorder_->OnSubmitted();
+    // The queue is destroyed before the counters, so the tasks can use this.
+    return [this, task, dueTime] {
+        pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+        recorder_->OnStarted(StringUtils::GetSysClockTime() - dueTime);
+        task();
+    };
+}
+
+GameControllerQueueRegistry::GameControllerQueueRegistry()
+{
+}
+
+GameControllerQueueRegistry::~GameControllerQueueRegistry()
+{
+}
+
+std::unique_ptr<GameControllerQueue> GameControllerQueueRegistry::CreateQueue(const std::string &name)
+{
+    int32_t qos = GetQos(name);
+    std::shared_ptr<QueueStatsRecorder> recorder;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto iter = recorders_.find(name);
+        if (iter == recorders_.end()) {
+            iter = recorders_.emplace(name, std::make_shared<QueueStatsRecorder>(name, qos)).first;
+        }
+        recorder = iter->second;
+    }
+    HILOGI("create the queue [%{public}s], qos is [%{public}d]", name.c_str(), qos);
+    return std::make_unique<GameControllerQueue>(name, qos, recorder);
+}
+
+int32_t GameControllerQueueRegistry::GetQos(const std::string &name)
+{
+    for (const auto &config: QUEUE_QOS_CONFIGS) {
+        if (strcmp(config.name, name.c_str()) == 0) {
+            return config.qos;
+        }
+    }
+    for (const auto &config: DEVICE_QUEUE_QOS_CONFIGS) {
+        if (IsDeviceQueueName(name, config.name)) {
+            return config.qos;
+        }
+    }
+    return ffrt::qos_default;
+}
+
+std::string GameControllerQueueRegistry::GetDeviceQueueName(const std::string &name, int32_t deviceType)
+{
+    return name + DEVICE_QUEUE_NAME_SEPARATOR + std::to_string(deviceType);
+}
+
+std::vector<QueueStats> GameControllerQueueRegistry::GetAllStats()
+{
+    std::vector<QueueStats> allStats;
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (const auto &pair: recorders_) {
+        allStats.push_back(pair.second->GetStats());
+    }
+    return allStats;
+}
+
+bool GameControllerQueueRegistry::GetStats(const std::string &name, QueueStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto iter = recorders_.find(name);
+    if (iter == recorders_.end()) {
+        return false;
+    }
+    stats = iter->second->GetStats();
+    return true;
+}
+}
+}
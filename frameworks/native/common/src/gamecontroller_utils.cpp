@@ -15,9 +15,7 @@
 
 #include <cstring>
 #include <cstdint>
-#include <vector>
 #include <securec.h>
-#include <sstream>
 #include "gamecontroller_utils.h"
 #include "gamecontroller_errors.h"
 #include "gamecontroller_log.h"
@@ -51,27 +49,29 @@ int32_t StringUtils::ConvertToCharPtrArray(const std::string &string, char** res
 
 std::string StringUtils::AnonymizationUniq(const std::string &uniq)
 {
-    std::vector<std::string> fields;
-    std::stringstream ss(uniq);
-    std::string field;
-    while (std::getline(ss, field, DEVICE_DELIMITER)) {
-        fields.push_back(field);
-    }
-
-    int32_t size = static_cast<int32_t>(fields.size());
-    if (size <= START_IDX) {
-        return "**";
-    }
+    // The fields are split in the same way as std::getline, so a trailing delimiter doesn't add an empty field.
     std::string temp;
-    for (int32_t idx = 0; idx < size; idx++) {
+    temp.reserve(uniq.size());
+    int32_t idx = 0;
+    size_t start = 0;
+    while (start < uniq.size()) {
+        size_t end = uniq.find(DEVICE_DELIMITER, start);
+        if (end == std::string::npos) {
+            end = uniq.size();
+        }
         if (idx != 0) {
             temp.push_back(DEVICE_DELIMITER);
         }
         if (idx >= START_IDX && idx <= END_IDX) {
             temp.append("**");
         } else {
-            temp.append(fields[idx]);
+            temp.append(uniq, start, end - start);
         }
+        idx++;
+        start = end + 1;
+    }
+    if (idx <= START_IDX) {
+        return "**";
     }
     return temp;
 }
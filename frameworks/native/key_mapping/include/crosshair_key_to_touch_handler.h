@@ -19,23 +19,82 @@
 
 namespace OHOS {
 namespace GameController {
+/**
+ * The recenter cycles of the crosshair. Each cycle is an UP and a DOWN of the touch.
+ */
+struct CrosshairRecenterStats {
+    /**
+     * The action time in microseconds when the current minute starts.
+     */
+    int64_t periodStartTime = 0;
+
+    /**
+     * The recenter cycles in the current minute.
+     */
+    int32_t recenterCount = 0;
+
+    /**
+     * The recenter cycles in the current minute which are done while the mouse moves slowly.
+     */
+    int32_t predictiveRecenterCount = 0;
+
+    /**
+     * The recenter cycles in the last full minute.
+     */
+    int32_t lastMinuteRecenterCount = 0;
+};
+
+/**
+ * The region which the touch of the crosshair moves in, around the position of the crosshair key.
+ * The extents are the distances from the center to the sides, so the region is smaller on the side near an edge.
+ */
+struct TrackballRegion {
+    Point center;
+    double left = 0.0;
+    double right = 0.0;
+    double top = 0.0;
+    double bottom = 0.0;
+
+    /**
+     * @param xOffset the x offset from the center
+     * @param yOffset the y offset from the center
+     * @param ratio the ratio of the extents
+     * @return true means the offset is out of the region scaled by the ratio
+     */
+    bool IsOutside(double xOffset, double yOffset, double ratio) const
+    {
+        return xOffset <= -left * ratio || xOffset >= right * ratio || yOffset <= -top * ratio
+            || yOffset >= bottom * ratio;
+    }
+};
+
 class CrosshairKeyToTouchHandler : public BaseKeyToTouchHandler {
 public:
+    CrosshairKeyToTouchHandler();
+
     void HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
                             const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
                             const KeyToTouchMappingInfo &mappingInfo) override;
 
     void ExitCrosshairKeyStatus(const std::shared_ptr<InputToTouchContext> &context) override;
 
+    /**
+     * In the trackball mode, the touch moves in a region sized from the window and it's recentered
+     * before it leaves the region or when the mouse moves slowly. Otherwise it's recentered near the edges
+     * of the window or 200px away from the center.
+     * @param isTrackballMode true means the trackball mode
+     */
+    void SetTrackballMode(bool isTrackballMode);
+
+    CrosshairRecenterStats GetRecenterStats() const;
+
 protected:
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo) override;
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override;
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                     const DeviceInfo &deviceInfo) override;
+                     const KeyInputSample &sample) override;
 
     void SendMoveTouch(std::shared_ptr<InputToTouchContext> &context,
                        const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
@@ -50,8 +109,39 @@ protected:
     void SetLastMousePoint(std::shared_ptr<InputToTouchContext> &context,
                            const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
 
+private:
+    /**
+     * Move the touch in the trackball mode. If it's recentered, the mouse move is applied from the center
+     * in the same event, so no mouse move is lost.
+     */
+    void HandleTrackballMove(std::shared_ptr<InputToTouchContext> &context,
+                             const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                             const KeyToTouchMappingInfo &mappingInfo);
+
+    static TrackballRegion ComputeTrackballRegion(const std::shared_ptr<InputToTouchContext> &context);
+
+    /**
+     * Count a recenter cycle. The cycles of every minute are logged.
+     * @param actionTime the action time in microseconds
+     * @param isPredictive true means it's recentered because the mouse moves slowly
+     */
+    void CountRecenter(int64_t actionTime, bool isPredictive);
+
 private:
     bool isSendDownTouch_{true};
+    bool isTrackballMode_{false};
+
+    /**
+     * The action time of the last mouse move in the trackball mode.
+     */
+    int64_t lastMoveTime_{0};
+
+    /**
+     * The touch move of the last mouse move. The next one is expected to be the same.
+     */
+    Point lastMoveStep_;
+
+    CrosshairRecenterStats recenterStats_;
 };
 }
 }
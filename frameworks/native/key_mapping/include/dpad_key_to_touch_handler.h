@@ -27,22 +27,19 @@ public:
 
 protected:
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo) override;
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override;
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                     const DeviceInfo &deviceInfo) override;
+                     const KeyInputSample &sample) override;
 
 private:
 
     void MoveByKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo);
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo);
 
-    void MoveByKeyUp(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+    void MoveByKeyUp(const KeyInputSample &sample,
                      const KeyToTouchMappingInfo &mappingInfo,
                      std::shared_ptr<InputToTouchContext> &context,
                      std::vector<DpadKeyItem> &dpadKeys);
@@ -50,7 +47,7 @@ private:
     int32_t GetAngle(const int32_t currentKeyCode, const DpadKeyTypeEnum currentKeyType,
                      std::vector<DpadKeyItem> &dpadKeys);
 
-    void MoveToTarget(std::shared_ptr<InputToTouchContext> &context, const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+    void MoveToTarget(std::shared_ptr<InputToTouchContext> &context, const KeyInputSample &sample,
                       const KeyToTouchMappingInfo &mappingInfo, const int32_t angle);
 
 private:
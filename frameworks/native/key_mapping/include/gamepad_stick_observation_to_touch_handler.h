@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_GAMEPAD_STICK_OBSERVATION_TO_TOUCH_HANDLER_H
+#define GAME_CONTROLLER_FRAMEWORK_GAMEPAD_STICK_OBSERVATION_TO_TOUCH_HANDLER_H
+
+#include "key_to_touch_handler.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * The thumbstick drags the camera. The touch is pressed at the start point when the thumbstick leaves
+ * the dead zone, and it's dragged by xStep and yStep times the output every 50ms while the thumbstick is held.
+ * The drag is lifted and pressed again at the start point when it reaches the edge of the window.
+ */
+class GamePadStickObservationToTouchHandler : public BaseKeyToTouchHandler {
+public:
+    void HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
+                            const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                            const KeyToTouchMappingInfo &mappingInfo) override;
+
+protected:
+    /**
+     * Move the touch by the deflection held from the last advance time to currentTime.
+     * It's called by every tick and before the deflection is changed, so the dragged distance
+     * only depends on how long the thumbstick is held, not on when the ticks run.
+     * @param context context
+     * @param entity the axis entity
+     * @param currentTime the monotonic time in microseconds
+     */
+    void Advance(std::shared_ptr<InputToTouchContext> &context, GamePadAxisEntity &entity, int64_t currentTime);
+
+    /**
+     * Advance the drag and schedule the next tick.
+     * @param context context
+     * @param axisSource GamePadAxisSourceTypeEnum
+     * @param sequence the sequence of the observation which the tick is scheduled for
+     * @param currentTime the monotonic time in microseconds
+     */
+    void RunTick(std::shared_ptr<InputToTouchContext> &context, int32_t axisSource, uint64_t sequence,
+                 int64_t currentTime);
+
+private:
+    void ScheduleTick(std::shared_ptr<InputToTouchContext> &context, int32_t axisSource);
+
+    /**
+     * Lift the touch at the edge of the window, and press it again at the start point.
+     */
+    void Recenter(std::shared_ptr<InputToTouchContext> &context, GamePadAxisEntity &entity,
+                  const PointerEvent::PointerItem &lastMovePoint, int64_t currentTime);
+};
+}
+}
+
+#endif //GAME_CONTROLLER_FRAMEWORK_GAMEPAD_STICK_OBSERVATION_TO_TOUCH_HANDLER_H
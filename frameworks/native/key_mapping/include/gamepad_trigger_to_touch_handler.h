@@ -0,0 +1,36 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_GAMEPAD_TRIGGER_TO_TOUCH_HANDLER_H
+#define GAME_CONTROLLER_FRAMEWORK_GAMEPAD_TRIGGER_TO_TOUCH_HANDLER_H
+
+#include "key_to_touch_handler.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * The trigger taps the screen. The touch is pressed when the trigger leaves the dead zone, and it's released
+ * when the trigger is back under half of the dead zone, so a trigger resting at the edge doesn't tap repeatedly.
+ */
+class GamePadTriggerToTouchHandler : public BaseKeyToTouchHandler {
+public:
+    void HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
+                            const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                            const KeyToTouchMappingInfo &mappingInfo) override;
+};
+}
+}
+
+#endif //GAME_CONTROLLER_FRAMEWORK_GAMEPAD_TRIGGER_TO_TOUCH_HANDLER_H
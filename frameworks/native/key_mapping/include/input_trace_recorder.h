@@ -0,0 +1,145 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_INPUT_TRACE_RECORDER_H
+#define GAME_CONTROLLER_FRAMEWORK_INPUT_TRACE_RECORDER_H
+
+#include <algorithm>
+#include <atomic>
+#include <singleton.h>
+#include <unordered_map>
+#include "key_to_touch_handler.h"
+#include "gamecontroller_input_trace.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * Number of the traced axes. The axis is indexed by MMI::PointerEvent::AxisType.
+ */
+const uint32_t INPUT_TRACE_AXIS_COUNT =
+    std::min(INPUT_TRACE_MAX_AXES, static_cast<uint32_t>(PointerEvent::AXIS_TYPE_MAX));
+
+/**
+ * Captures the input stream reached the window input intercept, the active template, the window information
+ * and the injected touches into a binary trace. It's disabled by default and costs one atomic load per event.
+ */
+class InputTraceRecorder : public DelayedSingleton<InputTraceRecorder> {
+DECLARE_DELAYED_SINGLETON(InputTraceRecorder)
+
+public:
+    /**
+     * Start capturing into the trace file. The current template and window information are written first.
+     * @param path trace file path
+     * @return true means success
+     */
+    bool StartCapture(const std::string &path);
+
+    /**
+     * Stop capturing and flush the trace file.
+     */
+    void StopCapture();
+
+    /**
+     * Start capturing the injected touches into memory. It's used by InputTraceReplayer.
+     */
+    void StartReplayCapture();
+
+    /**
+     * Stop capturing into memory.
+     * @return the captured touch records
+     */
+    std::vector<InputTraceRecord> StopReplayCapture();
+
+    bool IsCapturing() const
+    {
+        return isCapturing_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Record the key event reached the window input intercept.
+     * @param keyEvent key event
+     * @param isDispatched true means it was taken over by the key mapping
+     */
+    void RecordKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent, bool isDispatched);
+
+    /**
+     * Record the pointer event reached the window input intercept.
+     * @param pointerEvent pointer event
+     * @param isDispatched true means it was taken over by the key mapping
+     */
+    void RecordPointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent, bool isDispatched);
+
+    /**
+     * Record the touch event injected by the key mapping.
+     * @param pointerEvent touch event
+     */
+    void RecordTouchEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
+
+    /**
+     * Update the active template. It's kept even when not capturing so that a capture can start from it.
+     * @param deviceType device type
+     * @param mappingInfos key mappings
+     */
+    void UpdateTemplate(const DeviceTypeEnum &deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+
+    /**
+     * Update the active window information. It's kept even when not capturing.
+     * @param windowInfoEntity window information
+     */
+    void UpdateWindowInfo(const WindowInfoEntity &windowInfoEntity);
+
+private:
+    void AppendRecord(InputTraceKindEnum kind, uint16_t flags, const void* payload, uint32_t payloadSize);
+
+    void AppendTemplateRecord(int32_t deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+
+    void AppendWindowRecord(const WindowInfoEntity &windowInfoEntity);
+
+    /**
+     * Move the buffered records to the write queue.
+     */
+    void SubmitBuffer();
+
+    int64_t GetElapsedTime() const;
+
+private:
+    ffrt::mutex mutex_;
+    std::atomic<bool> isCapturing_{false};
+
+    /**
+     * true means the touches are kept in replayRecords_ instead of the trace file.
+     */
+    bool isReplayCapture_{false};
+    int64_t startTime_{0};
+    std::vector<uint8_t> buffer_;
+    std::vector<InputTraceRecord> replayRecords_;
+    std::shared_ptr<InputTraceWriter> writer_{nullptr};
+
+    /**
+     * The file is written on this queue so that the input path does not wait for the disk.
+     */
+    std::unique_ptr<GameControllerQueue> writeQueue_{nullptr};
+
+    /**
+     * key is deviceType, value is the active key mappings
+     */
+    std::unordered_map<int32_t, std::vector<KeyToTouchMappingInfo>> templates_;
+    WindowInfoEntity windowInfoEntity_;
+    bool hasWindowInfo_{false};
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_INPUT_TRACE_RECORDER_H
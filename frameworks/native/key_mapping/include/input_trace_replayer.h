@@ -0,0 +1,86 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_INPUT_TRACE_REPLAYER_H
+#define GAME_CONTROLLER_FRAMEWORK_INPUT_TRACE_REPLAYER_H
+
+#include "key_to_touch_handler.h"
+#include "gamecontroller_input_trace.h"
+
+namespace OHOS {
+namespace GameController {
+enum InputTraceReplayModeEnum {
+    /**
+     * Keep the interval between the records of the capture
+     */
+    REPLAY_ORIGINAL_TIMING = 0,
+
+    /**
+     * Feed the records back to back
+     */
+    REPLAY_AS_FAST_AS_POSSIBLE = 1
+};
+
+struct InputTraceReplayResult {
+    size_t inputCount = 0;
+    InputTraceCompareResult compareResult;
+};
+
+/**
+ * Feeds a captured trace back through KeyToTouchManager and compares the injected touch stream with the capture.
+ */
+class InputTraceReplayer {
+public:
+    /**
+     * Replay the trace file.
+     * @param path trace file path
+     * @param mode replay mode
+     * @param result replay result
+     * @return GAME_CONTROLLER_SUCCESS means the trace was replayed. Check result.compareResult.isSame for the diff.
+     */
+    int32_t Replay(const std::string &path, InputTraceReplayModeEnum mode, InputTraceReplayResult &result);
+
+    /**
+     * Replay the decoded records.
+     * @param records records of the capture
+     * @param mode replay mode
+     * @param result replay result
+     * @return GAME_CONTROLLER_SUCCESS means the trace was replayed.
+     */
+    int32_t Replay(const std::vector<InputTraceRecord> &records, InputTraceReplayModeEnum mode,
+                   InputTraceReplayResult &result);
+
+private:
+    /**
+     * Feed one record to KeyToTouchManager.
+     * @param record record
+     * @return true means it's an input event
+     */
+    bool ReplayRecord(const InputTraceRecord &record);
+
+    void ReplayKeyRecord(const InputTraceRecord &record);
+
+    void ReplayPointerRecord(const InputTraceRecord &record);
+
+    void ReplayTemplateRecord(const InputTraceRecord &record);
+
+    void ReplayWindowRecord(const InputTraceRecord &record);
+
+private:
+    std::string bundleName_;
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_INPUT_TRACE_REPLAYER_H
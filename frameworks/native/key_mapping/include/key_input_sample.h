@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_KEY_INPUT_SAMPLE_H
+#define GAME_CONTROLLER_FRAMEWORK_KEY_INPUT_SAMPLE_H
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <key_event.h>
+
+#include "gamecontroller_client_model.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * Ten fingers on the keyboard. The oldest keys are dropped when more keys are pressed.
+ */
+const int32_t MAX_SAMPLE_PRESSED_KEYS = 10;
+
+struct PressedKey {
+    int64_t downTime;
+    int32_t keyCode;
+};
+
+/**
+ * The key event converted once when it's dispatched.
+ * It's a fixed-size POD, so it's queued without any heap allocation,
+ * and the handlers read the fields instead of calling the accessors of KeyEvent again and again.
+ */
+struct KeyInputSample {
+    int64_t actionTime;
+    int64_t deviceOnlineTime;
+    int32_t keyCode;
+    int32_t keyAction;
+    int32_t deviceId;
+    DeviceTypeEnum deviceType;
+
+    /**
+     * The keys which are pressed on the same device since it's online, in the order they are pressed.
+     * The key of the down event is one of them, the key of the up event isn't.
+     */
+    int32_t pressedKeyCount;
+    PressedKey pressedKeys[MAX_SAMPLE_PRESSED_KEYS];
+
+    /**
+     * Convert the key event. The null event is converted to KEY_ACTION_UNKNOWN.
+     * @param keyEvent the key event
+     * @param deviceType the device type which the event is handled as
+     * @param deviceOnlineTime the keys pressed before it are ignored
+     * @return the sample
+     */
+    static KeyInputSample Build(const std::shared_ptr<MMI::KeyEvent> &keyEvent, DeviceTypeEnum deviceType,
+                                int64_t deviceOnlineTime);
+
+    bool IsKeyDown() const
+    {
+        return keyAction == MMI::KeyEvent::KEY_ACTION_DOWN;
+    }
+
+    /**
+     * If shift is pressed before ctrl, KEY_ACTION_CANCEL rather than KEY_ACTION_UP is received
+     * when ctrl is released, so it's a key up event too.
+     */
+    bool IsKeyUp() const
+    {
+        return keyAction == MMI::KeyEvent::KEY_ACTION_UP || keyAction == MMI::KeyEvent::KEY_ACTION_CANCEL;
+    }
+};
+
+static_assert(std::is_trivially_copyable<KeyInputSample>::value, "KeyInputSample must be trivially copyable");
+}
+}
+
+#endif //GAME_CONTROLLER_FRAMEWORK_KEY_INPUT_SAMPLE_H
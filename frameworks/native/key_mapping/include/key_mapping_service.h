@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include "gamecontroller_keymapping_model.h"
 #include "ffrt.h"
+#include "gamecontroller_queue_registry.h"
 #include "gamecontroller_log.h"
 #include "nlohmann/json.hpp"
 
@@ -72,6 +73,14 @@ public:
      */
     void UpdateGameKeyMappingWhenTemplateChange(const std::string &bundleName, DeviceTypeEnum deviceType);
 
+    /**
+     * When several templates are changed at once, update the key mapping with one request.
+     * @param bundleName bundleName
+     * @param deviceTypes the device types of the changed templates
+     */
+    void UpdateGameKeyMappingWhenTemplateChange(const std::string &bundleName,
+                                                const std::vector<DeviceTypeEnum> &deviceTypes);
+
     /**
      * Broadcast Opening Template Configuration Page
      * @param deviceInfo DeviceInfo
@@ -99,6 +108,20 @@ private:
      */
     void ExecuteGetGameKeyMapping(DeviceTypeEnum deviceType);
 
+    /**
+     * Get KeyMapping configs of several device types in one request.
+     * If the request fails, they're requested one by one.
+     * @param deviceTypes the device types
+     */
+    void ExecuteGetGameKeyMappings(const std::vector<DeviceTypeEnum> &deviceTypes);
+
+    /**
+     * Apply the KeyMapping config got from sa
+     * @param deviceType DeviceTypeEnum
+     * @param gameKeyMappingInfo GameKeyMappingInfo
+     */
+    void ApplyGameKeyMappingInfo(DeviceTypeEnum deviceType, const GameKeyMappingInfo &gameKeyMappingInfo);
+
     /**
      * Broadcast device information.
      * @param deviceInfo DeviceInfo
@@ -142,7 +165,7 @@ private:
     /**
      * handle queue
      */
-    std::unique_ptr<ffrt::queue> handleQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> handleQueue_{nullptr};
 
     ffrt::mutex configMutex_;
 
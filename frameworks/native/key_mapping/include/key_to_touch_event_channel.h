@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_EVENT_CHANNEL_H
+#define GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_EVENT_CHANNEL_H
+
+#include <functional>
+#include <memory>
+#include <key_event.h>
+#include <pointer_event.h>
+
+#include "gamecontroller_batched_channel.h"
+#include "key_input_sample.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * Default number of the event slots of a KeyToTouchEventChannel.
+ */
+const size_t KEY_TO_TOUCH_EVENT_CHANNEL_CAPACITY = 256;
+
+/**
+ * Default number of the events handled by one drain task.
+ * The timers of the handlers wait behind a drain task, so a long burst is split into several ones.
+ */
+const size_t KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE = 32;
+
+enum KeyToTouchEventTypeEnum {
+    KEY_TO_TOUCH_KEY_EVENT = 0,
+    KEY_TO_TOUCH_MOUSE_EVENT = 1,
+    KEY_TO_TOUCH_GAME_PAD_AXIS_EVENT = 2,
+
+    /**
+     * A task of the context, such as applying a template. It's queued with the events to keep the order.
+     */
+    KEY_TO_TOUCH_CONTEXT_TASK = 3,
+};
+
+/**
+ * An event handled on the handle queue of a device class.
+ * sample and keyEvent are set for a key event, pointerEvent for a mouse or axis event, task for a context task.
+ */
+struct KeyToTouchEvent {
+    KeyToTouchEventTypeEnum type{KEY_TO_TOUCH_KEY_EVENT};
+    KeyInputSample sample{};
+    std::shared_ptr<MMI::KeyEvent> keyEvent{nullptr};
+    std::shared_ptr<MMI::PointerEvent> pointerEvent{nullptr};
+    std::function<void()> task{nullptr};
+
+    void Release()
+    {
+        keyEvent = nullptr;
+        pointerEvent = nullptr;
+        task = nullptr;
+    }
+};
+
+/**
+ * Queues the events of a device class in front of its handle queue, at most KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE
+ * events per drain task by default.
+ */
+using KeyToTouchEventChannel = BatchedChannel<KeyToTouchEvent>;
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_EVENT_CHANNEL_H
@@ -15,6 +15,8 @@
 #ifndef GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_HANDLER_H
 #define GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_HANDLER_H
 
+#include <algorithm>
+#include <cstdlib>
 #include <pointer_event.h>
 #include <unordered_map>
 #include <key_event.h>
@@ -23,6 +25,10 @@
 
 #include "gamecontroller_keymapping_model.h"
 #include "gamecontroller_log.h"
+#include "gamecontroller_queue_registry.h"
+#include "key_input_sample.h"
+#include "rapid_fire_scheduler.h"
+#include "touch_motion_predictor.h"
 #include "ffrt.h"
 
 namespace OHOS {
@@ -33,6 +39,7 @@ const int32_t MOUSE_LEFT_BUTTON_KEYCODE = 100000;
 const int32_t MOUSE_RIGHT_BUTTON_KEYCODE = 100001;
 const int32_t HALF_LENGTH = 2;
 const int32_t MIN_EDGE = 1;
+const int32_t AXIS_RESPONSE_TABLE_SIZE = 256;
 
 enum DpadKeyTypeEnum {
     DPAD_KEYTYPE_UNKNOWN = -1,
@@ -49,10 +56,10 @@ struct DpadKeyItem {
 
     DpadKeyItem() = default;
 
-    DpadKeyItem(const KeyEvent::KeyItem &keyItem, const DpadKeyTypeEnum keyType)
+    DpadKeyItem(const PressedKey &pressedKey, const DpadKeyTypeEnum keyType)
     {
-        keyCode = keyItem.GetKeyCode();
-        downTime = keyItem.GetDownTime();
+        keyCode = pressedKey.keyCode;
+        downTime = pressedKey.downTime;
         keyTypeEnum = keyType;
     }
 };
@@ -65,6 +72,11 @@ enum KeyCodeForPointer : int32_t {
     KEY_CODE_CROSSHAIR = 100000004,
     KEY_CODE_MOUSE_LEFT = 100000005,
     KEY_CODE_MOUSE_RIGHT = 100000006,
+
+    /**
+     * The axes of the game pad use KEY_CODE_GAMEPAD_AXIS + GamePadAxisSourceTypeEnum
+     */
+    KEY_CODE_GAMEPAD_AXIS = 100000007,
 };
 
 /**
@@ -111,6 +123,134 @@ struct WindowInfoEntity {
     }
 };
 
+/**
+ * Scales a template from its reference resolution to the current window.
+ * It's computed once when the template or the window size changes, so the input path only uses window pixels.
+ */
+struct TemplateTransform {
+    double xScale = 1.0;
+    double yScale = 1.0;
+
+    /**
+     * Scale of the radius and the skill range. The smaller one is used so that a circle stays in the window.
+     */
+    double lengthScale = 1.0;
+    bool isIdentity = true;
+
+    TemplateTransform() = default;
+
+    TemplateTransform(const TemplateResolution &resolution, const WindowInfoEntity &windowInfo);
+
+    /**
+     * Get the key mapping in window pixels.
+     * @param mappingInfo key mapping based on the reference resolution
+     * @return the scaled key mapping
+     */
+    KeyToTouchMappingInfo Apply(const KeyToTouchMappingInfo &mappingInfo) const;
+};
+
+/**
+ * The gains of a response curve for the mouse speeds from 0 to RESPONSE_CURVE_MAX_SPEED.
+ * It's built once with the template, so a mouse move only looks up the gain.
+ */
+struct ResponseCurveTable {
+    bool isLinear = true;
+
+    /**
+     * The index is the mouse speed in counts per RESPONSE_CURVE_SPEED_INTERVAL, and the value is the scale of it.
+     */
+    std::vector<double> gains;
+
+    ResponseCurveTable() = default;
+
+    explicit ResponseCurveTable(const ResponseCurve &curve);
+
+    double GetGain(int32_t speed) const
+    {
+        if (isLinear) {
+            return 1.0;
+        }
+        speed = std::abs(speed);
+        return gains[std::min(speed, RESPONSE_CURVE_MAX_SPEED)];
+    }
+};
+
+/**
+ * The outputs of a game pad axis for the deflections from 0 to 1. The dead zone is cut off, and the rest of
+ * the travel is rescaled to (0, 1] before the response curve is applied.
+ * It's built once with the template, so an axis event only looks up the output.
+ */
+struct AxisResponseTable {
+    /**
+     * The dead zone in [0, 1]
+     */
+    double deadZone = 0.0;
+
+    /**
+     * The index is the deflection scaled by AXIS_RESPONSE_TABLE_SIZE, and the value is the output in [0, 1].
+     */
+    std::vector<double> outputs;
+
+    AxisResponseTable() = default;
+
+    /**
+     * @param deadZonePercent the dead zone of the key mapping. 0 means DEFAULT_AXIS_DEAD_ZONE.
+     * @param curve the response curve of the template
+     */
+    AxisResponseTable(int32_t deadZonePercent, const ResponseCurve &curve);
+
+    /**
+     * Get the output of the deflection. Only the magnitude is used.
+     * @param deflection the deflection of the axis
+     * @return the output in [0, 1]. 0 means the axis is in the dead zone.
+     */
+    double GetOutput(double deflection) const;
+};
+
+/**
+ * The touch of a game pad axis which is out of the dead zone.
+ */
+struct GamePadAxisEntity {
+    KeyToTouchMappingInfo mappingInfo;
+    int32_t pointerId = 0;
+    AxisResponseTable responseTable;
+
+    /**
+     * The direction and the output of the thumbstick. The length of (xOutput, yOutput) is the output.
+     */
+    double xOutput = 0.0;
+    double yOutput = 0.0;
+
+    /**
+     * The monotonic time in microseconds which the observation has been moved to,
+     * and the fractions of the pixels which are not moved yet.
+     */
+    int64_t lastAdvanceTime = 0;
+    double xRemainder = 0.0;
+    double yRemainder = 0.0;
+
+    /**
+     * Identifies the observation, so the ticks of the observation stopped before are ignored.
+     */
+    uint64_t sequence = 0;
+    ffrt::task_handle taskHandle;
+};
+
+/**
+ * The repeated taps of a held mouse button.
+ */
+struct RapidFireEntity {
+    KeyToTouchMappingInfo mappingInfo;
+    int32_t pointerId = 0;
+
+    /**
+     * Identifies the taps, so the ticks of the taps stopped before are ignored.
+     */
+    uint64_t sequence = 0;
+    RapidFireScheduler scheduler;
+    ffrt::task_handle taskHandle;
+};
+
 /**
  * the context for handle KeyEvent or PointerEvent
  */
@@ -153,16 +293,180 @@ struct InputToTouchContext {
     std::unordered_map<int32_t, PointerEvent::PointerItem> pointerItems;
     PointerEvent::PointerItem lastMousePointer;
 
+    /**
+     * The action time of lastMousePointer, 0 means unknown
+     */
+    int64_t lastMouseActionTime = 0;
+
     /**
      * PointerId caching applied by keyCode
      * key is keycode, value is pointerId of keycode
      */
     std::unordered_map<int32_t, int32_t> pointerIdWithKeyCodeMap;
 
+    /**
+     * The key mappings of the replaced template whose keys are still pressed.
+     * key is keycode, value is the key mapping of the replaced template
+     */
+    std::unordered_map<int32_t, KeyToTouchMappingInfo> heldKeyMappings;
+
+    /**
+     * The mouse button mappings of the replaced template whose buttons are still pressed.
+     * key is the button keycode, value is the key mapping of the replaced template
+     */
+    std::unordered_map<int32_t, KeyToTouchMappingInfo> heldMouseBtnKeyMappings;
+
+    /**
+     * The template as configured. The key mappings above are built from it for the current window.
+     */
+    std::vector<KeyToTouchMappingInfo> templateMappingInfos;
+
+    /**
+     * The reference resolution of the template. It's invalid when the template is in window pixels.
+     */
+    TemplateResolution templateResolution;
+
+    /**
+     * The response curve of the template for the mouse moves.
+     */
+    ResponseCurveTable responseCurveTable;
+
+    /**
+     * The fractions of the touch moves computed from the mouse moves which are not moved yet.
+     */
+    double xMoveRemainder = 0.0;
+    double yMoveRemainder = 0.0;
+
+    /**
+     * Extrapolates the touch moved by the mouse. It's disabled by default.
+     */
+    TouchMotionPredictor motionPredictor;
+
+    /**
+     * The touch which is moved ahead of the mouse, and whether a task is pending to settle it at the last sample
+     * once the mouse stops.
+     */
+    int32_t motionSettlePointerId = 0;
+    bool isMotionSettlePending = false;
+
+    /**
+     * The serial queue which handles the events of the context. The ticks of the repeated taps are submitted to it,
+     * and they aren't scheduled without it.
+     */
+    GameControllerQueue* handleQueue = nullptr;
+
+    /**
+     * The repeated taps of the held mouse buttons.
+     * key is KEY_CODE_MOUSE_LEFT or KEY_CODE_MOUSE_RIGHT
+     */
+    std::unordered_map<int32_t, RapidFireEntity> rapidFires;
+    uint64_t rapidFireSequence = 0;
+
+    /**
+     * The jitter of the repeated taps which are stopped.
+     */
+    RapidFireStats rapidFireStats;
+
+    /**
+     * The axis mappings of the game pad.
+     * key is GamePadAxisSourceTypeEnum
+     */
+    std::unordered_map<int32_t, KeyToTouchMappingInfo> axisKeyMappings;
+
+    /**
+     * The outputs of the axes, built from the dead zones of the axis mappings and the response curve.
+     * key is GamePadAxisSourceTypeEnum
+     */
+    std::unordered_map<int32_t, AxisResponseTable> axisResponseTables;
+
+    /**
+     * The axes which are out of the dead zone. They keep their key mappings until they are released.
+     * key is GamePadAxisSourceTypeEnum
+     */
+    std::unordered_map<int32_t, GamePadAxisEntity> gamePadAxes;
+    uint64_t gamePadAxisSequence = 0;
+
+    /**
+     * The last values of the axes, because an axis event only carries the axes which are changed.
+     * key is PointerEvent::AxisType
+     */
+    std::unordered_map<int32_t, double> gamePadAxisValues;
+
     InputToTouchContext() = default;
 
     InputToTouchContext(const DeviceTypeEnum &type, const WindowInfoEntity &windowInfo,
-                        const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+                        const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                        const TemplateResolution &resolution = TemplateResolution(),
+                        const ResponseCurve &responseCurve = ResponseCurve());
+
+    /**
+     * Update the window information. If the template has a reference resolution and the window size is changed,
+     * the key mappings are rebuilt for the new size. The pressed keys and the pointers are kept.
+     * @param windowInfo window information
+     * @return true means the key mappings are rebuilt
+     */
+    bool UpdateWindowInfo(const WindowInfoEntity &windowInfo);
+
+    /**
+     * Get the key mappings of the template in window pixels of the current window.
+     * @return key mappings
+     */
+    std::vector<KeyToTouchMappingInfo> GetWindowMappingInfos() const;
+
+    void BuildKeyMappings(const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+
+    /**
+     * Replace the template by the key mappings built in another context. The operations in progress are kept,
+     * and the keys pressed under the old template are handled by the old key mappings until they are released.
+     * @param newContext the context built for the new template. It takes the old key mappings.
+     */
+    void SwapTemplate(InputToTouchContext &newContext);
+
+    /**
+     * Keep the key mappings of all the operations in progress in heldKeyMappings, including the combination key,
+     * the walking, the observation, the skill and the crosshair, so their keys are released by them.
+     */
+    void HoldOperatingKeyMappings();
+
+    /**
+     * Find the key mapping of the replaced template if the key is still pressed.
+     * @param keyCode keycode
+     * @param mappingInfo the key mapping
+     * @return true means the key is still pressed under the replaced template
+     */
+    bool FindHeldKeyMapping(int32_t keyCode, KeyToTouchMappingInfo &mappingInfo) const;
+
+    /**
+     * Find the mouse button mapping. The one of the replaced template is used while it's still pressed.
+     * @param keyCode MOUSE_LEFT_BUTTON_KEYCODE or MOUSE_RIGHT_BUTTON_KEYCODE
+     * @param mappingInfo the key mapping
+     * @return true means found
+     */
+    bool FindMouseBtnKeyMapping(int32_t keyCode, KeyToTouchMappingInfo &mappingInfo) const;
+
+    /**
+     * Remove the key mappings of the replaced template that are released.
+     * @return true means some key mappings are removed
+     */
+    bool PruneHeldKeyMappings();
+
+    /**
+     * @return true means the key mappings of the replaced template still need the mouse events
+     */
+    bool IsHeldMonitorMouse() const;
+
+    /**
+     * Find the axis mapping. The one of the replaced template is used while the axis is out of the dead zone.
+     * @param axisSource GamePadAxisSourceTypeEnum
+     * @param mappingInfo the key mapping
+     * @return true means found
+     */
+    bool FindAxisKeyMapping(int32_t axisSource, KeyToTouchMappingInfo &mappingInfo) const;
+
+    /**
+     * @return true means the game pad axis events are handled by the context
+     */
+    bool IsMonitorGamePadAxis() const;
 
     void SetCurrentSingleKeyInfo(const KeyToTouchMappingInfo &mappingInfo, const int32_t pointerId);
 
@@ -190,7 +494,7 @@ struct InputToTouchContext {
 
     void ResetCurrentWalking();
 
-    bool IsMouseRightWalking();
+    bool IsMouseRightWalking() const;
 
     void SetCurrentMouseLeftClick(const int32_t pointerId);
 
@@ -200,6 +504,26 @@ struct InputToTouchContext {
 
     void ResetCurrentMouseRightClick();
 
+    /**
+     * Stop the repeated taps of the mouse button. The touch isn't released here.
+     * @param keyCode KEY_CODE_MOUSE_LEFT or KEY_CODE_MOUSE_RIGHT
+     */
+    void StopRapidFire(int32_t keyCode);
+
+    /**
+     * Start the touch of the axis which leaves the dead zone.
+     * @param mappingInfo the axis mapping
+     * @param pointerId the pointerId of the touch
+     * @return the axis entity
+     */
+    GamePadAxisEntity &SetCurrentGamePadAxis(const KeyToTouchMappingInfo &mappingInfo, const int32_t pointerId);
+
+    /**
+     * Stop the ticks of the axis and release its pointerId. The touch isn't released here.
+     * @param axisSource GamePadAxisSourceTypeEnum
+     */
+    void ResetCurrentGamePadAxis(int32_t axisSource);
+
     /**
      * Reset Temporary Variables when disable key-mapping
      */
@@ -270,6 +594,11 @@ struct MouseMoveReq {
      * The step length of the mouse movement each time
      */
     int32_t step = 0;
+
+    /**
+     * The scale of the step from the response curve
+     */
+    double gain = 1.0;
 };
 
 class PointerManager : public DelayedSingleton<PointerManager> {
@@ -288,6 +617,22 @@ public:
      */
     void ReleasePointerId(const int32_t pointerId);
 
+    /**
+     * Inject the touch event of a context. The pointers held by all the contexts are added to the event and the
+     * injection is serialized, so the touch stream stays consistent when the contexts are handled on different queues.
+     * @param bundleName bundleName
+     * @param pointerEvent pointerEvent
+     * @param pointerItem pointer of the current action
+     */
+    void InjectPointerEvent(const std::string &bundleName, std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                            const PointerEvent::PointerItem &pointerItem);
+
+    /**
+     * Get the action time of the last injected touch event
+     * @return action time in microseconds
+     */
+    int64_t GetLastSendTime();
+
 private:
     ffrt::mutex locker;
 
@@ -295,6 +640,14 @@ private:
      * The set of pointerId already are applied
      */
     std::unordered_set<int32_t> pointerIdCacheSet_;
+
+    /**
+     * The pointers held by all the contexts
+     * key is pointerId, value is last pointer
+     */
+    std::unordered_map<int32_t, PointerEvent::PointerItem> activePointerItems_;
+
+    int64_t lastSendTime_{0};
 };
 
 class BaseKeyToTouchHandler {
@@ -311,22 +664,33 @@ public:
 
     static bool IsKeyUpEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent);
 
+    static bool IsGamePadAxisEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
+
+    /**
+     * Get the axes of the thumbstick or the trigger. The trigger only has xAxis.
+     * @param axisSource GamePadAxisSourceTypeEnum
+     * @param xAxis the x axis
+     * @param yAxis the y axis. It's AXIS_TYPE_UNKNOWN for the trigger.
+     * @return false means it's not a thumbstick or a trigger
+     */
+    static bool GetGamePadAxisTypes(int32_t axisSource, PointerEvent::AxisType &xAxis, PointerEvent::AxisType &yAxis);
+
+    /**
+     * @return true means the event carries the axes of the thumbstick or the trigger
+     */
+    static bool HasGamePadAxis(const std::shared_ptr<MMI::PointerEvent> &pointerEvent, int32_t axisSource);
+
 public:
     virtual void HandleKeyEvent(std::shared_ptr<InputToTouchContext> &context,
-                                const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                const DeviceInfo &deviceInfo,
+                                const KeyInputSample &sample,
                                 const KeyToTouchMappingInfo &mappingInfo)
     {
-        if (keyEvent == nullptr) {
-            HILOGW("keyEvent is nullptr");
-            return;
-        }
-        if (keyEvent->GetKeyAction() == KeyEvent::KEY_ACTION_DOWN) {
-            HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
-        } else if (BaseKeyToTouchHandler::IsKeyUpEvent(keyEvent)) {
-            HandleKeyUp(context, keyEvent, deviceInfo);
+        if (sample.IsKeyDown()) {
+            HandleKeyDown(context, sample, mappingInfo);
+        } else if (sample.IsKeyUp()) {
+            HandleKeyUp(context, sample);
         } else {
-            HILOGW("unknown [%{private}d]'s keyAction[%{public}d]", keyEvent->GetKeyCode(), keyEvent->GetKeyAction());
+            HILOGW("unknown [%{private}d]'s keyAction[%{public}d]", sample.keyCode, sample.keyAction);
         }
     };
 
@@ -345,15 +709,13 @@ protected:
                                           const TouchEntity &touchEntity);
 
     virtual void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                               const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                               const KeyToTouchMappingInfo &mappingInfo,
-                               const DeviceInfo &deviceInfo)
+                               const KeyInputSample &sample,
+                               const KeyToTouchMappingInfo &mappingInfo)
     {
     }
 
     virtual void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                             const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                             const DeviceInfo &deviceInfo)
+                             const KeyInputSample &sample)
     {
     }
 
@@ -371,6 +733,36 @@ protected:
                                      const Point &destPoint,
                                      const int64_t actionTime);
 
+    /**
+     * Start the repeated taps of the held mouse button if its key mapping has a tap interval.
+     * The first press is sent by the caller.
+     * @param context context
+     * @param keyCode KEY_CODE_MOUSE_LEFT or KEY_CODE_MOUSE_RIGHT
+     * @param mappingInfo the key mapping of the button
+     * @param pointerId the pointerId of the touch
+     * @param startTime the monotonic time of the first press in microseconds
+     */
+    void StartRapidFire(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode,
+                        const KeyToTouchMappingInfo &mappingInfo, int32_t pointerId, int64_t startTime);
+
+    /**
+     * Stop the repeated taps when the mouse button is released.
+     * @param context context
+     * @param keyCode KEY_CODE_MOUSE_LEFT or KEY_CODE_MOUSE_RIGHT
+     * @return true means the touch is pressed now, so the up event is sent by the caller
+     */
+    bool StopRapidFire(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode);
+
+    /**
+     * Send the press or the release which is due, and schedule the next tick.
+     * @param context context
+     * @param keyCode KEY_CODE_MOUSE_LEFT or KEY_CODE_MOUSE_RIGHT
+     * @param sequence the sequence of the taps which the tick is scheduled for
+     * @param currentTime the monotonic time in microseconds
+     */
+    void RunRapidFireTick(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode, uint64_t sequence,
+                          int64_t currentTime);
+
     /**
      * Calculate the distance between two points
      * @param centerPoint Center point
@@ -402,41 +794,89 @@ protected:
                                            const int32_t &touchPointId);
 
     /**
-     * Get all pressed valid dpad keys from KeyEvent. and sort by downTime asc
-     * @param keyEvent KeyEvent
-     * @param deviceInfo DeviceInfo
+     * Get the point to inject for the target point computed from the mouse move.
+     * If the motion predictor is enabled, the target point is extrapolated and kept in the window.
+     * @param context InputToTouchContext
+     * @param targetPoint the target point
+     * @param actionTime the action time of the mouse move
+     * @return the point to inject
+     */
+    Point PredictTouchPoint(std::shared_ptr<InputToTouchContext> &context, const Point &targetPoint,
+                            int64_t actionTime);
+
+    /**
+     * Move the predicted touch back to the last sample if no sample arrives within MAX_SAMPLE_GAP,
+     * so it doesn't stay ahead of where the mouse stops. Otherwise the task is scheduled again.
+     * @param context context
+     * @param currentTime the monotonic time in microseconds
+     */
+    void RunMotionSettle(std::shared_ptr<InputToTouchContext> &context, int64_t currentTime);
+
+    /**
+     * Get all pressed valid dpad keys from the sample, in the ascending order of downTime
+     * @param sample KeyInputSample
      * @param mapping KeyToTouchMappingInfo
      * @return all pressed valid dpad keys
      */
-    std::vector<DpadKeyItem> CollectValidDpadKeys(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                  const DeviceInfo &deviceInfo,
+    std::vector<DpadKeyItem> CollectValidDpadKeys(const KeyInputSample &sample,
                                                   const KeyToTouchMappingInfo &mapping);
 
     DpadKeyTypeEnum GetDpadKeyType(const int32_t keyCode, const KeyToTouchMappingInfo &mappingInfo);
 
-private:
+    /**
+     * Get the value of the axis. The value is kept in the context, and the last one is used
+     * if the event doesn't carry the axis.
+     * @param context context
+     * @param pointerEvent the axis event
+     * @param axisType the axis
+     * @return the value of the axis
+     */
+    double GetGamePadAxisValue(std::shared_ptr<InputToTouchContext> &context,
+                               const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                               PointerEvent::AxisType axisType);
+
+    /**
+     * Get the response table of the axis. The one of the pressed axis is kept until it's released.
+     * @param context context
+     * @param axisSource GamePadAxisSourceTypeEnum
+     * @return the response table. It's empty if the axis has no mapping, so the output is always 0.
+     */
+    const AxisResponseTable &GetAxisResponseTable(std::shared_ptr<InputToTouchContext> &context, int32_t axisSource);
 
-    void SortDpadKeys(std::vector<DpadKeyItem> &dpadKeys);
+    /**
+     * Release the touch of the axis at its last point, and reset the axis.
+     * @param context context
+     * @param axisSource GamePadAxisSourceTypeEnum
+     * @param actionTime the action time of the release
+     */
+    void ReleaseGamePadAxis(std::shared_ptr<InputToTouchContext> &context, int32_t axisSource, int64_t actionTime);
+
+private:
 
     int32_t ComputeMovePositionForX(std::shared_ptr<InputToTouchContext> &context,
                                     const PointerEvent::PointerItem &currentPointItem,
                                     const PointerEvent::PointerItem &lastMovePoint,
-                                    const KeyToTouchMappingInfo &mappingInfo);
+                                    const KeyToTouchMappingInfo &mappingInfo, int64_t actionTime);
 
     int32_t ComputeMovePositionForY(std::shared_ptr<InputToTouchContext> &context,
                                     const PointerEvent::PointerItem &currentPointItem,
                                     const PointerEvent::PointerItem &lastMovePoint,
-                                    const KeyToTouchMappingInfo &mappingInfo);
+                                    const KeyToTouchMappingInfo &mappingInfo, int64_t actionTime);
 
     /**
      * compute x position or y position for move touch
      * @param mouseMoveReq MouseMoveReq
+     * @param remainder the fraction of the move which is not moved. It's updated with the fraction of this move.
      * @return return x position or y position for move touch
      */
-    int32_t ComputeMovePosition(MouseMoveReq mouseMoveReq);
+    int32_t ComputeMovePosition(MouseMoveReq mouseMoveReq, double &remainder);
 
     PointerEvent::PointerItem BuildPointerItem(std::shared_ptr<InputToTouchContext> &context,
                                                const TouchEntity &touchEntity);
+
+    void ScheduleRapidFireTick(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode);
+
+    void ScheduleMotionSettle(std::shared_ptr<InputToTouchContext> &context, int64_t delay);
 };
 
 }
@@ -16,14 +16,46 @@
 #ifndef GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_MANAGER_H
 #define GAME_CONTROLLER_FRAMEWORK_KEY_TO_TOUCH_MANAGER_H
 
+#include <functional>
 #include <singleton.h>
 #include <unordered_map>
 #include "key_to_touch_handler.h"
+#include "key_to_touch_event_channel.h"
 #include "gamecontroller_keymapping_model.h"
 #include "ffrt.h"
 
 namespace OHOS {
 namespace GameController {
+/**
+ * The key-to-touch context of a device class and the serial queue that handles its events.
+ * The device classes are handled in parallel, the events of one device class are handled in order.
+ */
+struct InputToTouchShard {
+    DeviceTypeEnum deviceType = UNKNOWN;
+
+    /**
+     * The events and the context tasks of the device class, drained on the handleQueue in batches.
+     * Declared before handleQueue, so it's destroyed after the queue which runs its drain tasks.
+     */
+    std::unique_ptr<KeyToTouchEventChannel> eventChannel{nullptr};
+
+    std::unique_ptr<GameControllerQueue> handleQueue{nullptr};
+
+    /**
+     * It's read and replaced under checkMutex_ of KeyToTouchManager, and only used on the handleQueue
+     */
+    std::shared_ptr<InputToTouchContext> context{nullptr};
+
+    /**
+     * The keys and mouse monitored by the context. They're accessed under checkMutex_ of KeyToTouchManager
+     */
+    std::unordered_set<int32_t> monitorKeys;
+    bool isMonitorMouse = false;
+    bool isMonitorGamePadAxis = false;
+};
+
+using ContextTask = std::function<void(std::shared_ptr<InputToTouchContext> &context)>;
+
 class KeyToTouchManager : public DelayedSingleton<KeyToTouchManager> {
 DECLARE_DELAYED_SINGLETON(KeyToTouchManager)
 
@@ -32,10 +64,28 @@ public:
 
     bool DispatchKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent);
 
+    /**
+     * Dispatch the key event replayed from an input trace. The device isn't queried from the multimodal input.
+     * @param keyEvent keyEvent
+     * @param deviceInfo device information captured in the trace
+     * @return true means it's taken over by the key mapping
+     */
+    bool DispatchReplayKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo);
+
     bool DispatchPointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
 
+    /**
+     * Update the template of the device type.
+     * @param deviceType device type
+     * @param bundleName bundle name of the template
+     * @param mappingInfos key mappings
+     * @param resolution reference resolution of the key mappings. Invalid means they are window pixels.
+     * @param responseCurve response curve of the mouse moves
+     */
     void UpdateTemplateConfig(const DeviceTypeEnum &deviceType, const std::string &bundleName,
-                              const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+                              const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                              const TemplateResolution &resolution = TemplateResolution(),
+                              const ResponseCurve &responseCurve = ResponseCurve());
 
     void UpdateWindowInfo(const WindowInfoEntity &windowInfoEntity);
 
@@ -62,7 +112,33 @@ public:
      */
     void UpdateFocusStatus(const std::string &bundleName, bool isFocus);
 
+    /**
+     * Wait until the tasks submitted to the handle queue and the queues of the contexts are finished
+     */
+    void WaitHandleQueueIdle();
+
+    /**
+     * Get the batch sizes of the events drained on the handle queue of the device class.
+     * @param deviceType device type of the context
+     * @return the stats. They're empty if the device type has no context.
+     */
+    BatchedChannelStats GetEventChannelStats(const DeviceTypeEnum &deviceType);
+
 private:
+    /**
+     * Dispatch key event
+     * @param keyEvent keyEvent
+     * @param replayDeviceInfo nullptr means querying the device from the multimodal input
+     * @return true means it's taken over by the key mapping
+     */
+    bool DispatchKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo* replayDeviceInfo);
+
+    /**
+     * Dispatch the axis event of the game pad to the context of GAME_PAD if it has axis mappings.
+     * @param pointerEvent the axis event
+     * @return true means it's taken over by the key mapping
+     */
+    bool DispatchGamePadAxisEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
 
     bool IsDispatchToPluginMode(const std::shared_ptr<MMI::KeyEvent> &keyEvent);
 
@@ -70,59 +146,134 @@ private:
 
     bool DeviceIsSupportKeyMapping(DeviceTypeEnum deviceTypeEnum);
 
-    void HandleKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceTypeEnum &deviceType,
-                        const DeviceInfo &deviceInfo);
+    /**
+     * Handle the key event on the input queue of the device type.
+     * @param keyEvent the key event. It's only sent to the plugin when it's not handled by the key mapping.
+     * @param sample the key event converted when it's dispatched
+     */
+    void HandleKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent, const KeyInputSample &sample);
+
+    /**
+     * Handle the mouse event on the input queue of GAME_KEY_BOARD, whose template has the mouse mappings.
+     * @param pointerEvent the mouse event
+     */
+    void HandlePointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
 
-    void HandlePointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent, const DeviceTypeEnum &deviceType);
+    void HandleGamePadAxisEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
+
+    /**
+     * Handle the event drained from the event channel of a device class.
+     * @param event the key event, the pointer event or the context task
+     */
+    void HandleChannelEvent(const KeyToTouchEvent &event);
 
     /**
      * Get mapping info
      * @param context context
-     * @param keyEvent keyEvent
-     * @param deviceInfo deviceInfo
+     * @param sample the key event
      * @param keyToTouchMappingInfo out param
      * @return true means get mapping info success
      */
     bool GetMappingInfoByKeyCode(const std::shared_ptr<InputToTouchContext> &context,
-                                 const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                 const DeviceInfo &deviceInfo,
+                                 const KeyInputSample &sample,
                                  KeyToTouchMappingInfo &keyToTouchMappingInfo);
 
     bool GetMappingInfoByKeyCodeWhenKeyDown(const std::shared_ptr<InputToTouchContext> &context,
-                                            const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                            const DeviceInfo &deviceInfo,
+                                            const KeyInputSample &sample,
                                             KeyToTouchMappingInfo &keyToTouchMappingInfo);
 
     bool GetMappingInfoByKeyCodeWhenKeyUp(const std::shared_ptr<InputToTouchContext> &context,
-                                          const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                                          const KeyInputSample &sample,
                                           KeyToTouchMappingInfo &keyToTouchMappingInfo);
 
     bool GetMappingInfoByKeyCodeFromCombinationKey(const std::shared_ptr<InputToTouchContext> &context,
-                                                   const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                   const DeviceInfo &deviceInfo,
+                                                   const KeyInputSample &sample,
                                                    KeyToTouchMappingInfo &keyToTouchMappingInfo);
 
-    void HandleTemplateConfig(const DeviceTypeEnum &deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+    void HandleTemplateConfig(const DeviceTypeEnum &deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                              const TemplateResolution &resolution = TemplateResolution(),
+                              const ResponseCurve &responseCurve = ResponseCurve());
+
+    /**
+     * Build the context of the new template. It's called before the context task is submitted,
+     * so the input queue of the device type does not wait for it.
+     * @return nullptr means the template is empty
+     */
+    std::shared_ptr<InputToTouchContext> BuildTemplateContext(const DeviceTypeEnum &deviceType,
+                                                              const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                                              const TemplateResolution &resolution,
+                                                              const ResponseCurve &responseCurve);
+
+    /**
+     * Apply the context of the new template. If there's a context already, the new key mappings are swapped into it
+     * and the keys pressed under the old template keep their pointers until they are released.
+     * @param deviceType device type
+     * @param newContext the context built by BuildTemplateContext
+     */
+    void ApplyTemplateContext(const DeviceTypeEnum &deviceType, const std::shared_ptr<InputToTouchContext> &newContext);
+
+    /**
+     * Remove the released keys of the replaced template, and stop monitoring them.
+     * @param context context
+     */
+    void RefreshHeldKeyMappings(const std::shared_ptr<InputToTouchContext> &context);
 
     void HandleWindowInfo(const WindowInfoEntity &windowInfoEntity);
 
     void UpdateContextWindowInfo(const std::shared_ptr<InputToTouchContext> &context);
 
-    void InitGcKeyboardContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+    void InitGcKeyboardContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                               const TemplateResolution &resolution = TemplateResolution());
 
-    void InitHoverTouchPadContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos);
+    void InitHoverTouchPadContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                  const TemplateResolution &resolution = TemplateResolution());
+
+    void InitGamePadContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                            const TemplateResolution &resolution = TemplateResolution());
 
     void ReleaseContext(const std::shared_ptr<InputToTouchContext> &inputToTouchContext);
 
-    void ResetMonitor();
+    /**
+     * Get the shard of the device class. The shards are created in the constructor and never added or removed.
+     * @param deviceType device type of the context
+     * @return nullptr means the device type has no context
+     */
+    InputToTouchShard* GetShard(const DeviceTypeEnum &deviceType);
+
+    /**
+     * Get the context of the device class. The context must only be used on the handle queue of the shard.
+     * @param deviceType device type of the context
+     * @return context
+     */
+    std::shared_ptr<InputToTouchContext> GetContext(const DeviceTypeEnum &deviceType);
+
+    /**
+     * Replace the context of the shard under checkMutex_. It's called on the handle queue of the shard.
+     * @param shard shard of the context
+     * @param context the new context, nullptr means the device class has no template
+     */
+    void SetContext(InputToTouchShard* shard, const std::shared_ptr<InputToTouchContext> &context);
 
-    void ResetAllMonitorKeysAndMouseMonitor(const std::shared_ptr<InputToTouchContext> &context);
+    /**
+     * Submit the task to the handle queue of the device class. It's queued behind the events sent before.
+     * @param deviceType device type of the context
+     * @param task task executed with the context of the shard
+     */
+    void SubmitContextTask(const DeviceTypeEnum &deviceType, const ContextTask &task);
+
+    /**
+     * Submit the task to the handle queues of all the device classes.
+     * @param task task executed with the context of each shard
+     */
+    void SubmitContextTaskToAll(const ContextTask &task);
 
-    void AddToMonitorKeys(const DeviceTypeEnum &deviceType,
-                          const std::unordered_map<int32_t, KeyToTouchMappingInfo> &keyMap);
+    /**
+     * Reset the monitored keys of the device class and merge the monitored keys of all the device classes.
+     * @param deviceType device type of the context
+     */
+    void ResetMonitor(const DeviceTypeEnum &deviceType);
 
-    void AddToMonitorKeys(const DeviceTypeEnum &deviceType,
-                          const int32_t &keyCode);
+    void MergeMonitorKeys();
 
     bool IsHandleMouseMove(std::shared_ptr<InputToTouchContext> &context,
                            const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
@@ -135,8 +286,7 @@ private:
 
     void ExecuteHandle(std::shared_ptr<InputToTouchContext> &context,
                        const KeyToTouchMappingInfo &mappingInfo,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const DeviceInfo &deviceInfo);
+                       const KeyInputSample &sample);
 
     void ExecuteHandle(std::shared_ptr<InputToTouchContext> &context,
                        const KeyToTouchMappingInfo &mappingInfo,
@@ -150,17 +300,29 @@ private:
     bool isSupportKeyMapping_{false};
     std::unordered_set<int32_t> supportDeviceTypeSet_;
     ffrt::mutex checkMutex_;
-    std::unique_ptr<ffrt::queue> handleQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> handleQueue_{nullptr};
     ffrt::task_handle curTaskHandler_{nullptr};
     std::unordered_map<MappingTypeEnum, std::shared_ptr<BaseKeyToTouchHandler>> mappingHandler_;
-    std::shared_ptr<InputToTouchContext> gcKeyboardContext_{nullptr};
-    std::shared_ptr<InputToTouchContext> hoverTouchPadContext_{nullptr};
+
+    /**
+     * key is the device type of the context, value is the shard.
+     * The map itself is immutable after construction, so it's read without lock.
+     */
+    std::unordered_map<DeviceTypeEnum, InputToTouchShard> contextShards_;
     std::unordered_map<int32_t, std::unordered_set<DeviceTypeEnum>> allMonitorKeys_;
     bool isMonitorMouse_{false};
+    bool isMonitorGamePadAxis_{false};
     WindowInfoEntity windowInfoEntity_;
     bool isEnableKeyMapping_{true};
     std::string bundleName_;
     bool isPluginMode_{false};
+
+    /**
+     * Whether the touch moved by the mouse is extrapolated, and the latency after the injection in microseconds.
+     * They're read from the system parameters once.
+     */
+    bool isMotionPredictionEnabled_{false};
+    int64_t motionPredictionExtraHorizon_{0};
 };
 }
 }
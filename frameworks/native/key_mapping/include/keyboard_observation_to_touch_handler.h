@@ -51,6 +51,14 @@ public:
                         const DpadKeyTypeEnum currentKeyType,
                         std::vector<DpadKeyItem> &dpadKeys);
 
+    /**
+     * Set how many times per second the move pointer is sent while the keys are held.
+     * It's limited to the refresh rate of the display, so no move is sent which can't be shown.
+     * The task starts with persist.gamecontroller.keyboard_observation.update_rate, 60Hz by default.
+     * @param updateRate the update rate in Hz
+     */
+    void SetUpdateRate(uint32_t updateRate);
+
 private:
     void PutTaskToDelayQueue();
 
@@ -59,26 +67,53 @@ private:
      */
     void RunTask();
 
+    /**
+     * Move the pointer by the keys held from the last advance time to currentTime.
+     * It's called by every tick and before the keys are changed, so the moved distance
+     * only depends on how long the keys are held, not on when the ticks run.
+     * @param currentTime the monotonic time in microseconds
+     */
+    void Advance(int64_t currentTime);
+
     /**
      * Compute and send the move pointer.
+     * @param stepRatio how many steps to move. One step is xStep and yStep, which is moved every 50ms.
      */
-    void ComputeAndSendMovePointer();
+    void ComputeAndSendMovePointer(double stepRatio = 1.0);
 
     /**
-     * Compute the target point
+     * Compute the offset of the key
      * @param context InputToTouchContext
-     * @param lastMovePoint the last move point
      * @param currentKeyType current pressed keyType
+     * @param stepRatio how many steps to move
+     * @param xOffset the offset of x is added to it
+     * @param yOffset the offset of y is added to it
+     */
+    void ComputeOffset(std::shared_ptr<InputToTouchContext> &context,
+                       const DpadKeyTypeEnum currentKeyType,
+                       double stepRatio,
+                       double &xOffset,
+                       double &yOffset);
+
+    /**
+     * Compute the target point. The fraction of the offset is kept, and added to the next offset.
+     * @param context InputToTouchContext
+     * @param lastMovePoint the last move point
+     * @param xOffset the offset of x
+     * @param yOffset the offset of y
      * @param targetPoint the target point
      */
     void ComputeTargetPoint(std::shared_ptr<InputToTouchContext> &context,
                             const PointerEvent::PointerItem &lastMovePoint,
-                            const DpadKeyTypeEnum currentKeyType,
+                            double xOffset,
+                            double yOffset,
                             Point &targetPoint);
 
+    static uint32_t GetMaxUpdateRate();
+
 private:
     ffrt::mutex taskLock_;
-    std::unique_ptr<ffrt::queue> taskQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> taskQueue_{nullptr};
     ffrt::task_handle curTaskHandler_;
     bool taskIsStarting_{false};
     std::shared_ptr<InputToTouchContext> context_{nullptr};
@@ -86,6 +121,22 @@ private:
     DpadKeyTypeEnum currentDpadKeyType_{DPAD_KEYTYPE_UNKNOWN};
     int32_t currentKeyCode_{0};
     std::unordered_set<std::string> validCombinationKeys_;
+
+    /**
+     * The delay between two ticks in microseconds.
+     */
+    int64_t tickInterval_{0};
+
+    /**
+     * The monotonic time in microseconds which the pointer has been moved to.
+     */
+    int64_t lastAdvanceTime_{0};
+
+    /**
+     * The fractions of the pixels which are not moved yet.
+     */
+    double remainderX_{0.0};
+    double remainderY_{0.0};
 };
 
 class KeyboardObservationToTouchHandler : public BaseKeyToTouchHandler {
@@ -94,21 +145,18 @@ public:
 
 protected:
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo) override;
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override;
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                     const DeviceInfo &deviceInfo) override;
+                     const KeyInputSample &sample) override;
 
 private:
     void MoveByKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo);
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo);
 
-    void MoveByKeyUp(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+    void MoveByKeyUp(const KeyInputSample &sample,
                      const KeyToTouchMappingInfo &mappingInfo,
                      std::shared_ptr<InputToTouchContext> &context,
                      std::vector<DpadKeyItem> &dpadKeys);
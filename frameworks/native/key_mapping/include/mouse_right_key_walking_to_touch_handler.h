@@ -17,10 +17,20 @@
 #define GAME_CONTROLLER_FRAMEWORK_MOUSE_RIGHT_KEY_WALKING_TO_TOUCH_HANDLER_H
 
 #include <cstdint>
+#include <unordered_map>
 #include "key_to_touch_handler.h"
 
 namespace OHOS {
 namespace GameController {
+/**
+ * The delayed up event of the walking of a device class.
+ */
+struct WalkingDelayTask {
+    ffrt::task_handle taskHandle;
+    bool hasDelayTask = false;
+    std::shared_ptr<InputToTouchContext> context{nullptr};
+};
+
 class MouseRightKeyWalkingDelayHandleTask
     : public DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>, BaseKeyToTouchHandler {
 DECLARE_DELAYED_SINGLETON(MouseRightKeyWalkingDelayHandleTask)
@@ -28,19 +38,27 @@ DECLARE_DELAYED_SINGLETON(MouseRightKeyWalkingDelayHandleTask)
 public:
     void StartDelayHandle(std::shared_ptr<InputToTouchContext> &context, const int32_t delayTime);
 
-    bool CancelDelayHandle();
+    /**
+     * Cancel the delayed up event of the context and send it at once.
+     * The delayed up events of the other device classes are kept, because they're handled on other queues.
+     * @param context context of the caller
+     * @return true means the delayed up event was sent
+     */
+    bool CancelDelayHandle(const std::shared_ptr<InputToTouchContext> &context);
 
 private:
-    void DoDelayHandle();
+    void DoDelayHandle(DeviceTypeEnum deviceType);
 
     void SendUpEvent(std::shared_ptr<InputToTouchContext> &context);
 
 private:
     ffrt::mutex taskLock_;
-    std::unique_ptr<ffrt::queue> taskQueue_{nullptr};
-    ffrt::task_handle curTaskHandler_;
-    bool hasDelayTask_{false};
-    std::shared_ptr<InputToTouchContext> context_{nullptr};
+    std::unique_ptr<GameControllerQueue> taskQueue_{nullptr};
+
+    /**
+     * key is the device class of the context, so the shards don't overwrite each other. Guarded by taskLock_.
+     */
+    std::unordered_map<DeviceTypeEnum, WalkingDelayTask> delayTasks_;
 };
 
 class MouseRightKeyWalkingToTouchHandler : public BaseKeyToTouchHandler {
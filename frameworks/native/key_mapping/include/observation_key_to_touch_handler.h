@@ -28,13 +28,11 @@ public:
 
 protected:
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo) override;
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override;
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                     const DeviceInfo &deviceInfo) override;
+                     const KeyInputSample &sample) override;
 };
 }
 }
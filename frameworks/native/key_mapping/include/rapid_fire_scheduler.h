@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_RAPID_FIRE_SCHEDULER_H
+#define GAME_CONTROLLER_FRAMEWORK_RAPID_FIRE_SCHEDULER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace GameController {
+enum RapidFireActionEnum {
+    RAPID_FIRE_NONE = 0,
+    RAPID_FIRE_PRESS = 1,
+    RAPID_FIRE_RELEASE = 2,
+};
+
+/**
+ * The jitter of the taps, which is how late the ticks run after their deadlines, in microseconds.
+ */
+struct RapidFireStats {
+    uint32_t tickCount = 0;
+    int64_t totalJitter = 0;
+    int64_t maxJitter = 0;
+
+    /**
+     * The taps which are skipped because the ticks are too late for them.
+     */
+    uint32_t skippedTapCount = 0;
+
+    int64_t GetMeanJitter() const
+    {
+        return tickCount == 0 ? 0 : totalJitter / static_cast<int64_t>(tickCount);
+    }
+
+    void Merge(const RapidFireStats &stats);
+};
+
+/**
+ * The deadlines of the repeated taps while a button is held.
+ * The presses are on a fixed grid from the start time, one every interval, and each release is the press
+ * duration after its press. So a late tick doesn't delay the taps after it, and the cadence doesn't drift.
+ * When a tick is so late that a tap can't be pressed in time, the tap is skipped instead of being sent
+ * in a burst.
+ * It's not thread-safe. It's used on the queue of its context.
+ */
+class RapidFireScheduler {
+public:
+    /**
+     * Start the taps. The first press is at the start time, and it's sent by the caller.
+     * @param startTime the monotonic time in microseconds
+     * @param interval the time from a press to the next press in microseconds
+     * @param pressDuration the time from a press to its release in microseconds
+     */
+    void Start(int64_t startTime, int64_t interval, int64_t pressDuration);
+
+    void Stop();
+
+    bool IsRunning() const
+    {
+        return isRunning_;
+    }
+
+    /**
+     * @return true means the touch is pressed now
+     */
+    bool IsPressed() const
+    {
+        return isPressed_;
+    }
+
+    /**
+     * @return the monotonic time of the next press or release in microseconds
+     */
+    int64_t GetNextDeadline() const;
+
+    /**
+     * Run a tick. Nothing is done if the next deadline isn't reached yet.
+     * @param currentTime the monotonic time in microseconds
+     * @return the action to send at the deadline
+     */
+    RapidFireActionEnum OnTick(int64_t currentTime);
+
+    const RapidFireStats &GetStats() const
+    {
+        return stats_;
+    }
+
+private:
+    int64_t GetPressTime(int64_t cycle) const
+    {
+        return startTime_ + cycle * interval_;
+    }
+
+    /**
+     * Move to the first tap after the current one which is pressed after now.
+     * @param currentTime the monotonic time in microseconds
+     */
+    void MoveToNextCycle(int64_t currentTime);
+
+private:
+    bool isRunning_{false};
+    bool isPressed_{false};
+    int64_t startTime_{0};
+    int64_t interval_{0};
+    int64_t pressDuration_{0};
+
+    /**
+     * The index of the current tap on the grid.
+     */
+    int64_t cycle_{0};
+    RapidFireStats stats_;
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_RAPID_FIRE_SCHEDULER_H
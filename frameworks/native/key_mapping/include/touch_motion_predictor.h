@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GAME_CONTROLLER_FRAMEWORK_TOUCH_MOTION_PREDICTOR_H
+#define GAME_CONTROLLER_FRAMEWORK_TOUCH_MOTION_PREDICTOR_H
+
+#include <array>
+#include <cstdint>
+
+namespace OHOS {
+namespace GameController {
+/**
+ * The position of the touch computed from a mouse move, and the action time of the mouse move in microseconds.
+ */
+struct MotionSample {
+    double x = 0.0;
+    double y = 0.0;
+    int64_t time = 0;
+};
+
+/**
+ * Extrapolates the touch moved by the mouse, so the injected touch doesn't lag behind the hand by the time
+ * the mouse move takes to be injected.
+ * The velocity is computed from the recent samples, and the touch is moved ahead by the velocity multiplied by
+ * the horizon. The horizon is the measured latency plus the extra horizon, which is the latency after the
+ * injection that can't be measured here.
+ * The overshoot is limited, and the velocity of the last move is used when the hand slows down, so the touch
+ * doesn't go far beyond where the hand stops. The handler moves it back to the last sample once no sample
+ * arrives within MAX_SAMPLE_GAP.
+ * It's not thread-safe. It's used on the queue of its context.
+ */
+class TouchMotionPredictor {
+public:
+    static constexpr size_t SAMPLE_CAPACITY = 8;
+
+    /**
+     * The samples before a pause longer than 50ms are dropped.
+     */
+    static constexpr int64_t MAX_SAMPLE_GAP = 50000;
+
+    void SetEnabled(bool isEnabled);
+
+    bool IsEnabled() const
+    {
+        return isEnabled_;
+    }
+
+    /**
+     * Set the latency added to the measured one.
+     * @param extraHorizon the extra horizon in microseconds
+     */
+    void SetExtraHorizon(int64_t extraHorizon);
+
+    /**
+     * Drop the samples, such as when the touch is pressed again at another position.
+     * The measured latency is kept.
+     */
+    void Reset();
+
+    /**
+     * Add the position computed from a mouse move. The samples before a long pause are dropped,
+     * so the motion before it isn't extrapolated.
+     * @param x x position of the touch
+     * @param y y position of the touch
+     * @param time the action time of the mouse move in microseconds
+     */
+    void AddSample(double x, double y, int64_t time);
+
+    /**
+     * Update the measured latency from the action time of a mouse move to the injection of its touch.
+     * @param latency the latency in microseconds
+     */
+    void UpdateLatency(int64_t latency);
+
+    /**
+     * Extrapolate the last sample by the horizon.
+     * @param x the predicted x position
+     * @param y the predicted y position
+     * @return false means there are not enough samples, and x and y are the last sample
+     */
+    bool Predict(double &x, double &y) const;
+
+    /**
+     * @param sample the last sample
+     * @return false means there is no sample
+     */
+    bool GetLastSample(MotionSample &sample) const;
+
+    /**
+     * @return the horizon in microseconds
+     */
+    int64_t GetHorizon() const;
+
+    /**
+     * Save the position of the touch which is injected for the last sample.
+     */
+    void SetInjectedPoint(int32_t x, int32_t y);
+
+    /**
+     * @return true means the touch is still at the position injected for the last sample. Otherwise it's moved
+     * by others, such as pressed again, and the samples can't be used.
+     */
+    bool IsInjectedPoint(int32_t x, int32_t y) const;
+
+private:
+    const MotionSample &GetSample(size_t index) const;
+
+private:
+    bool isEnabled_{false};
+    int64_t extraHorizon_{0};
+
+    /**
+     * The smoothed latency in microseconds. It's negative before the latency is measured.
+     */
+    int64_t latency_{-1};
+
+    /**
+     * The ring buffer of the recent samples. head_ is the index of the next sample.
+     */
+    std::array<MotionSample, SAMPLE_CAPACITY> samples_;
+    size_t head_{0};
+    size_t count_{0};
+    bool hasInjectedPoint_{false};
+    int32_t injectedX_{0};
+    int32_t injectedY_{0};
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_TOUCH_MOTION_PREDICTOR_H
@@ -12,7 +12,9 @@
  *  See the License for the specific language governing permissions and
  *  limitations under the License.
  */
+#include <cmath>
 #include <input_manager.h>
+#include <syspara/parameters.h>
 #include "crosshair_key_to_touch_handler.h"
 #include "window_info_manager.h"
 #include "plugin_callback_manager.h"
@@ -22,49 +24,80 @@ namespace GameController {
 namespace {
 const int32_t TO_EDGE_DISTANCE = 40;
 const double MAX_MOVE_DISTANCE = 200.0;
+const char* CROSSHAIR_TRACKBALL_PARAM = "persist.gamecontroller.crosshair.trackball";
+
+/**
+ * The trackball region reaches a quarter of the window width and height from the center.
+ */
+const double TRACKBALL_RADIUS_RATIO = 0.25;
+
+/**
+ * The touch is recentered while the mouse moves slowly if it's farther than half of the radius from the center.
+ */
+const double PREDICTIVE_RECENTER_RATIO = 0.5;
+
+/**
+ * The mouse moves slowly if it moves less than this in pixels per millisecond.
+ */
+const double SLOW_MOUSE_SPEED = 0.2;
+const double US_PER_MS = 1000.0;
+const int64_t ONE_MINUTE = 60000000; // in microseconds
+}
+
+CrosshairKeyToTouchHandler::CrosshairKeyToTouchHandler()
+{
+    isTrackballMode_ = OHOS::system::GetBoolParameter(CROSSHAIR_TRACKBALL_PARAM, false);
+}
+
+void CrosshairKeyToTouchHandler::SetTrackballMode(bool isTrackballMode)
+{
+    isTrackballMode_ = isTrackballMode;
+}
+
+CrosshairRecenterStats CrosshairKeyToTouchHandler::GetRecenterStats() const
+{
+    return recenterStats_;
 }
 
 void CrosshairKeyToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                               const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                               const KeyToTouchMappingInfo &mappingInfo,
-                                               const DeviceInfo &deviceInfo)
+                                               const KeyInputSample &sample,
+                                               const KeyToTouchMappingInfo &mappingInfo)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (context->isCrosshairMode) {
         if (context->currentCrosshairInfo.keyCode != keyCode) {
-            HILOGW("discard keyCode [%{private}d]. It's cross-key-operating now", keyCode);
+            HILOGW_LIMIT("discard keyCode [%{private}d]. It's cross-key-operating now", keyCode);
         }
         return;
     }
 
-    HILOGI("enter into CrosshairMode");
+    HILOGI_LIMIT("enter into CrosshairMode");
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentCrosshairInfo(mappingInfo, pointerId);
-    SendDownTouch(context, keyEvent->GetActionTime());
+    SendDownTouch(context, sample.actionTime);
 }
 
 void CrosshairKeyToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                                             const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                             const DeviceInfo &deviceInfo)
+                                             const KeyInputSample &sample)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (!context->isCrosshairMode) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. No crosshair-key-operating",
-               keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. No crosshair-key-operating",
+                     keyCode);
         return;
     }
 
     if (context->isEnterCrosshairInfo) {
         // exit the crosshair mode
-        SendUpTouch(context, keyEvent->GetActionTime());
-        HILOGI("exit CrosshairMode, and show mouse pointer");
+        SendUpTouch(context, sample.actionTime);
+        HILOGI_LIMIT("exit CrosshairMode, and show mouse pointer");
         ExitCrosshairKeyStatus(context);
         context->ResetCurrentCrosshairInfo();
         return;
     }
 
     context->isEnterCrosshairInfo = true;
-    HILOGI("keyCode [%{private}d] hide mouse pointer", keyCode);
+    HILOGI_LIMIT("keyCode [%{private}d] hide mouse pointer", keyCode);
     DelayedSingleton<PluginCallbackManager>::GetInstance()->SetPointerVisible(context->windowInfoEntity.bundleName,
                                                                               false);
     DelayedSingleton<PluginCallbackManager>::GetInstance()->DisableGestureBack(context->windowInfoEntity.bundleName);
@@ -87,6 +120,13 @@ void CrosshairKeyToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouch
     if (isSendDownTouch_) {
         SendDownTouch(context, pointerEvent->GetActionTime());
         SetLastMousePoint(context, pointerEvent);
+        lastMoveTime_ = pointerEvent->GetActionTime();
+        lastMoveStep_ = Point();
+        return;
+    }
+
+    if (isTrackballMode_) {
+        HandleTrackballMove(context, pointerEvent, mappingInfo);
         return;
     }
 
@@ -97,13 +137,97 @@ void CrosshairKeyToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouch
     }
 }
 
+void CrosshairKeyToTouchHandler::HandleTrackballMove(std::shared_ptr<InputToTouchContext> &context,
+                                                     const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                                     const KeyToTouchMappingInfo &mappingInfo)
+{
+    std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
+    if (!pair.first || context->pointerItems.find(pair.second) == context->pointerItems.end()) {
+        HILOGW_LIMIT("discard trackball move. because cannot find the last move point");
+        return;
+    }
+    int32_t pointerId = pair.second;
+    int64_t actionTime = pointerEvent->GetActionTime();
+    PointerEvent::PointerItem currentPointItem;
+    pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), currentPointItem);
+    Point mouseDelta;
+    mouseDelta.x = currentPointItem.GetWindowX() - context->lastMousePointer.GetWindowX();
+    mouseDelta.y = currentPointItem.GetWindowY() - context->lastMousePointer.GetWindowY();
+    int64_t elapsedTime = actionTime - lastMoveTime_;
+    bool isSlow = elapsedTime > 0 &&
+        CalculateDistance(Point(), mouseDelta) * US_PER_MS / elapsedTime < SLOW_MOUSE_SPEED;
+
+    TrackballRegion region = ComputeTrackballRegion(context);
+    PointerEvent::PointerItem lastMovePoint = context->pointerItems[pointerId];
+    double xOffset = lastMovePoint.GetWindowX() - region.center.x;
+    double yOffset = lastMovePoint.GetWindowY() - region.center.y;
+
+    // It's recentered before the touch leaves the region if the next move is the same as the last one.
+    bool isLeaving = region.IsOutside(xOffset + lastMoveStep_.x, yOffset + lastMoveStep_.y, 1.0);
+    bool isFar = region.IsOutside(xOffset, yOffset, PREDICTIVE_RECENTER_RATIO);
+    if (isLeaving || (isSlow && isFar)) {
+        CountRecenter(actionTime, !isLeaving);
+        SendUpTouch(context, actionTime);
+        SendDownTouch(context, actionTime);
+        if (context->pointerItems.find(pointerId) == context->pointerItems.end()) {
+            return;
+        }
+        lastMovePoint = context->pointerItems[pointerId];
+    }
+
+    SendMoveTouch(context, pointerEvent, mappingInfo);
+    lastMoveTime_ = actionTime;
+    if (context->pointerItems.find(pointerId) != context->pointerItems.end()) {
+        lastMoveStep_.x = context->pointerItems[pointerId].GetWindowX() - lastMovePoint.GetWindowX();
+        lastMoveStep_.y = context->pointerItems[pointerId].GetWindowY() - lastMovePoint.GetWindowY();
+    }
+}
+
+TrackballRegion CrosshairKeyToTouchHandler::ComputeTrackballRegion(
+    const std::shared_ptr<InputToTouchContext> &context)
+{
+    const WindowInfoEntity &windowInfo = context->windowInfoEntity;
+    TrackballRegion region;
+    region.center.x = context->currentCrosshairInfo.xValue;
+    region.center.y = context->currentCrosshairInfo.yValue;
+    double xRadius = windowInfo.maxWidth * TRACKBALL_RADIUS_RATIO;
+    double yRadius = windowInfo.maxHeight * TRACKBALL_RADIUS_RATIO;
+
+    // The region keeps the same distance to the edges of the window as the other mode.
+    region.left = std::max(std::min(xRadius, region.center.x - TO_EDGE_DISTANCE), static_cast<double>(MIN_EDGE));
+    region.right = std::max(std::min(xRadius, windowInfo.maxWidth - TO_EDGE_DISTANCE - region.center.x),
+                            static_cast<double>(MIN_EDGE));
+    region.top = std::max(std::min(yRadius, region.center.y - TO_EDGE_DISTANCE), static_cast<double>(MIN_EDGE));
+    region.bottom = std::max(std::min(yRadius, windowInfo.maxHeight - TO_EDGE_DISTANCE - region.center.y),
+                             static_cast<double>(MIN_EDGE));
+    return region;
+}
+
+void CrosshairKeyToTouchHandler::CountRecenter(int64_t actionTime, bool isPredictive)
+{
+    if (recenterStats_.periodStartTime == 0) {
+        recenterStats_.periodStartTime = actionTime;
+    } else if (actionTime - recenterStats_.periodStartTime >= ONE_MINUTE) {
+        HILOGI("[%{public}d] recenter cycles of the crosshair in the last minute, [%{public}d] are predictive",
+               recenterStats_.recenterCount, recenterStats_.predictiveRecenterCount);
+        recenterStats_.lastMinuteRecenterCount = recenterStats_.recenterCount;
+        recenterStats_.periodStartTime = actionTime;
+        recenterStats_.recenterCount = 0;
+        recenterStats_.predictiveRecenterCount = 0;
+    }
+    recenterStats_.recenterCount++;
+    if (isPredictive) {
+        recenterStats_.predictiveRecenterCount++;
+    }
+}
+
 void CrosshairKeyToTouchHandler::SendMoveTouch(std::shared_ptr<InputToTouchContext> &context,
                                                const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
                                                const KeyToTouchMappingInfo &mappingInfo)
 {
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
     if (!pair.first) {
-        HILOGW("discard send move touch. because cannot find the pointerId");
+        HILOGW_LIMIT("discard send move touch. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
@@ -114,10 +238,10 @@ void CrosshairKeyToTouchHandler::SendDownTouch(std::shared_ptr<InputToTouchConte
 {
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
     if (!pair.first) {
-        HILOGW("discard send down touch. because cannot find the pointerId");
+        HILOGW_LIMIT("discard send down touch. because cannot find the pointerId");
         return;
     }
-    HILOGI("Send down touch in Crosshair");
+    HILOGI_LIMIT("Send down touch in Crosshair");
     int32_t pointerId = pair.second;
     TouchEntity touchEntity = BuildTouchEntity(context->currentCrosshairInfo, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
@@ -129,7 +253,7 @@ bool CrosshairKeyToTouchHandler::IsSendUpTouch(std::shared_ptr<InputToTouchConte
 {
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
     if (!pair.first) {
-        HILOGW("discard send up touch. because cannot find the pointerId");
+        HILOGW_LIMIT("discard send up touch. because cannot find the pointerId");
         return false;
     }
     int32_t pointerId = pair.second;
@@ -149,7 +273,8 @@ bool CrosshairKeyToTouchHandler::IsSendUpTouch(std::shared_ptr<InputToTouchConte
         || (lastMovePoint.GetWindowY() - TO_EDGE_DISTANCE) <= 0
         || (lastMovePoint.GetWindowX() - TO_EDGE_DISTANCE) <= 0
         || CalculateDistance(centerPoint, targetPoint) >= MAX_MOVE_DISTANCE) {
-        HILOGI("Send up touch in Crosshair");
+        HILOGI_LIMIT("Send up touch in Crosshair");
+        CountRecenter(actionTime, false);
         TouchEntity touchEntity = BuildTouchUpEntity(lastMovePoint, pointerId,
                                                      PointerEvent::POINTER_ACTION_UP, actionTime);
         BuildAndSendPointerEvent(context, touchEntity);
@@ -168,6 +293,7 @@ void CrosshairKeyToTouchHandler::ExitCrosshairKeyStatus(const std::shared_ptr<In
         context->windowInfoEntity.bundleName);
 
     isSendDownTouch_ = true;
+    lastMoveStep_ = Point();
 }
 
 void CrosshairKeyToTouchHandler::SetLastMousePoint(std::shared_ptr<InputToTouchContext> &context,
@@ -176,20 +302,21 @@ void CrosshairKeyToTouchHandler::SetLastMousePoint(std::shared_ptr<InputToTouchC
     PointerEvent::PointerItem currentPointItem;
     pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), currentPointItem);
     context->lastMousePointer = currentPointItem;
+    context->lastMouseActionTime = pointerEvent->GetActionTime();
 }
 
 void CrosshairKeyToTouchHandler::SendUpTouch(std::shared_ptr<InputToTouchContext> &context, int64_t actionTime)
 {
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
     if (!pair.first) {
-        HILOGW("discard send up touch. because cannot find the pointerId");
+        HILOGW_LIMIT("discard send up touch. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
     if (context->pointerItems.find(pointerId) == context->pointerItems.end()) {
         return;
     }
-    HILOGI("Send up touch in Crosshair");
+    HILOGI_LIMIT("Send up touch in Crosshair");
     PointerEvent::PointerItem lastMovePoint = context->pointerItems[pointerId];
     TouchEntity touchEntity = BuildTouchUpEntity(lastMovePoint, pointerId,
                                                  PointerEvent::POINTER_ACTION_UP, actionTime);
@@ -51,21 +51,20 @@ DpadKeyToTouchHandler::DpadKeyToTouchHandler()
 }
 
 void DpadKeyToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                          const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                          const KeyToTouchMappingInfo &mappingInfo,
-                                          const DeviceInfo &deviceInfo)
+                                          const KeyInputSample &sample,
+                                          const KeyToTouchMappingInfo &mappingInfo)
 {
     if (context->isWalking) {
         if (context->currentWalking.mappingType == DPAD_KEY_TO_TOUCH) {
-            MoveByKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+            MoveByKeyDown(context, sample, mappingInfo);
         }
         return;
     }
-    HILOGI("Enter walking by dpad");
+    HILOGI_LIMIT("Enter walking by dpad");
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
-    DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->CancelDelayHandle();
+    DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->CancelDelayHandle(context);
     context->SetCurrentWalking(mappingInfo, pointerId);
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
@@ -75,34 +74,33 @@ void DpadKeyToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &
      * 导致游戏中的第一个手指按下的位置概率变为MOVE的坐标位置
      */
     ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
-    MoveByKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+    MoveByKeyDown(context, sample, mappingInfo);
 }
 
 void DpadKeyToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                                        const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                        const DeviceInfo &deviceInfo)
+                                        const KeyInputSample &sample)
 {
     if (!context->isWalking
         || context->currentWalking.mappingType != DPAD_KEY_TO_TOUCH) {
         return;
     }
 
-    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(keyEvent, deviceInfo, context->currentWalking);
+    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(sample, context->currentWalking);
     if (!dpadKeys.empty()) {
         //If there are pressed dpad keys, calculate the movement position based on the first and last pressed buttons.
-        MoveByKeyUp(keyEvent, context->currentWalking, context, dpadKeys);
+        MoveByKeyUp(sample, context->currentWalking, context, dpadKeys);
         return;
     }
 
     // If no directional key is pressed, need to exit walking.
-    HILOGI("Exit walking by dpad");
+    HILOGI_LIMIT("Exit walking by dpad");
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_WALK);
     if (!pair.first) {
-        HILOGW("discard keyup event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard keyup event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchEntity(context->currentWalking, pointerId,
                                                PointerEvent::POINTER_ACTION_UP, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
@@ -110,43 +108,42 @@ void DpadKeyToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &co
 }
 
 void DpadKeyToTouchHandler::MoveByKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                          const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                          const KeyToTouchMappingInfo &mappingInfo,
-                                          const DeviceInfo &deviceInfo)
+                                          const KeyInputSample &sample,
+                                          const KeyToTouchMappingInfo &mappingInfo)
 {
     // Get the pressed dpad's keycode
-    int32_t currentKeyCode = keyEvent->GetKeyCode();
+    int32_t currentKeyCode = sample.keyCode;
     DpadKeyTypeEnum currentDpadKeyType = GetDpadKeyType(currentKeyCode, mappingInfo);
     if (currentDpadKeyType == DPAD_KEYTYPE_UNKNOWN) {
-        HILOGW("the current keycode[%{private}d]'s keyType is unknown.", currentKeyCode);
+        HILOGW_LIMIT("the current keycode[%{private}d]'s keyType is unknown.", currentKeyCode);
         return;
     }
 
-    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(keyEvent, deviceInfo, mappingInfo);
+    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(sample, mappingInfo);
     if (dpadKeys.empty()) {
-        HILOGW("the current keycode[%{private}d]. no valid dpad keys.", currentKeyCode);
+        HILOGW_LIMIT("the current keycode[%{private}d]. no valid dpad keys.", currentKeyCode);
         return;
     }
     int32_t angle = GetAngle(currentKeyCode, currentDpadKeyType, dpadKeys);
     if (angle == INVALID_VALUE) {
-        HILOGW("cannot find valid angle value. the keycode is [%{private}d]'s", currentKeyCode);
+        HILOGW_LIMIT("cannot find valid angle value. the keycode is [%{private}d]'s", currentKeyCode);
         return;
     }
-    MoveToTarget(context, keyEvent, mappingInfo, angle);
+    MoveToTarget(context, sample, mappingInfo, angle);
 }
 
 void DpadKeyToTouchHandler::MoveToTarget(std::shared_ptr<InputToTouchContext> &context,
-                                         const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                                         const KeyInputSample &sample,
                                          const KeyToTouchMappingInfo &mappingInfo, const int32_t angle)
 {
     Point centerPoint;
     centerPoint.x = mappingInfo.xValue;
     centerPoint.y = mappingInfo.yValue;
     Point targetPoint = ComputeTargetPoint(centerPoint, mappingInfo.radius, static_cast<double>(angle));
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_WALK);
     if (!pair.first) {
-        HILOGW("discard MoveToTarget. because cannot find the pointerId");
+        HILOGW_LIMIT("discard MoveToTarget. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
@@ -154,7 +151,7 @@ void DpadKeyToTouchHandler::MoveToTarget(std::shared_ptr<InputToTouchContext> &c
     BuildAndSendPointerEvent(context, touchEntity);
 }
 
-void DpadKeyToTouchHandler::MoveByKeyUp(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+void DpadKeyToTouchHandler::MoveByKeyUp(const KeyInputSample &sample,
                                         const KeyToTouchMappingInfo &mappingInfo,
                                         std::shared_ptr<InputToTouchContext> &context,
                                         std::vector<DpadKeyItem> &dpadKeys)
@@ -165,10 +162,10 @@ void DpadKeyToTouchHandler::MoveByKeyUp(const std::shared_ptr<MMI::KeyEvent> &ke
     DpadKeyTypeEnum currentDpadKeyType = lastItem.keyTypeEnum;
     int32_t angle = GetAngle(currentKeyCode, currentDpadKeyType, dpadKeys);
     if (angle == INVALID_VALUE) {
-        HILOGW("cannot find valid angle value. the keycode is [%{private}d]'s", currentKeyCode);
+        HILOGW_LIMIT("cannot find valid angle value. the keycode is [%{private}d]'s", currentKeyCode);
         return;
     }
-    MoveToTarget(context, keyEvent, mappingInfo, angle);
+    MoveToTarget(context, sample, mappingInfo, angle);
 }
 
 int32_t DpadKeyToTouchHandler::GetAngle(const int32_t currentKeyCode, const DpadKeyTypeEnum currentKeyType,
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include "gamepad_stick_observation_to_touch_handler.h"
+#include "gamecontroller_log.h"
+#include "gamecontroller_utils.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const int64_t STEP_TIME = 50000; // 50ms, xStep and yStep are moved in one step at the full output
+const double MAX_STEP_RATIO = 4.0; // the ticks delayed more than it are not caught up
+const int64_t TICK_INTERVAL = 16666; // 60Hz
+}
+
+void GamePadStickObservationToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
+                                                               const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                                               const KeyToTouchMappingInfo &mappingInfo)
+{
+    int32_t axisSource = mappingInfo.keyCode;
+    PointerEvent::AxisType xAxis;
+    PointerEvent::AxisType yAxis;
+    if (!GetGamePadAxisTypes(axisSource, xAxis, yAxis) || yAxis == PointerEvent::AxisType::AXIS_TYPE_UNKNOWN) {
+        HILOGW_LIMIT("discard axis event. [%{public}d] is not a thumbstick", axisSource);
+        return;
+    }
+    double xValue = GetGamePadAxisValue(context, pointerEvent, xAxis);
+    double yValue = GetGamePadAxisValue(context, pointerEvent, yAxis);
+    double deflection = std::sqrt(xValue * xValue + yValue * yValue);
+    double output = GetAxisResponseTable(context, axisSource).GetOutput(deflection);
+    int64_t currentTime = StringUtils::GetSysClockTime();
+    auto iter = context->gamePadAxes.find(axisSource);
+    if (output <= 0.0) {
+        if (iter != context->gamePadAxes.end()) {
+            HILOGI_LIMIT("thumbstick [%{public}d] convert to up event of gamepad_stick_observation_to_touch",
+                         axisSource);
+            // the distance dragged since the last tick is sent before the touch is released
+            Advance(context, iter->second, currentTime);
+            ReleaseGamePadAxis(context, axisSource, currentTime);
+        }
+        return;
+    }
+
+    if (iter == context->gamePadAxes.end()) {
+        HILOGI_LIMIT("thumbstick [%{public}d] convert to down event of gamepad_stick_observation_to_touch",
+                     axisSource);
+        int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
+        GamePadAxisEntity &entity = context->SetCurrentGamePadAxis(mappingInfo, pointerId);
+        entity.lastAdvanceTime = currentTime;
+        entity.xOutput = xValue * output / deflection;
+        entity.yOutput = yValue * output / deflection;
+        BuildAndSendPointerEvent(context, BuildTouchEntity(mappingInfo, pointerId, PointerEvent::POINTER_ACTION_DOWN,
+                                                           currentTime));
+        ScheduleTick(context, axisSource);
+        return;
+    }
+
+    // the deflection held before is dragged up to now
+    GamePadAxisEntity &entity = iter->second;
+    Advance(context, entity, currentTime);
+    entity.xOutput = xValue * output / deflection;
+    entity.yOutput = yValue * output / deflection;
+}
+
+void GamePadStickObservationToTouchHandler::Advance(std::shared_ptr<InputToTouchContext> &context,
+                                                    GamePadAxisEntity &entity, int64_t currentTime)
+{
+    int64_t elapsedTime = currentTime - entity.lastAdvanceTime;
+    entity.lastAdvanceTime = currentTime;
+    if (elapsedTime <= 0) {
+        return;
+    }
+    auto itemIter = context->pointerItems.find(entity.pointerId);
+    if (itemIter == context->pointerItems.end()) {
+        HILOGW_LIMIT("discard the drag, because cannot find the last move event");
+        return;
+    }
+    double stepRatio = std::min(static_cast<double>(elapsedTime) / STEP_TIME, MAX_STEP_RATIO);
+    double xOffset = entity.mappingInfo.xStep * entity.xOutput * stepRatio + entity.xRemainder;
+    double yOffset = entity.mappingInfo.yStep * entity.yOutput * stepRatio + entity.yRemainder;
+    double xPixels = std::trunc(xOffset);
+    double yPixels = std::trunc(yOffset);
+    entity.xRemainder = xOffset - xPixels;
+    entity.yRemainder = yOffset - yPixels;
+    if (xPixels == 0.0 && yPixels == 0.0) {
+        return;
+    }
+
+    PointerEvent::PointerItem lastMovePoint = itemIter->second;
+    Point targetPoint;
+    targetPoint.x = lastMovePoint.GetWindowX() + xPixels;
+    targetPoint.y = lastMovePoint.GetWindowY() + yPixels;
+    if (targetPoint.x < MIN_EDGE || targetPoint.x > context->windowInfoEntity.maxWidth ||
+        targetPoint.y < MIN_EDGE || targetPoint.y > context->windowInfoEntity.maxHeight) {
+        Recenter(context, entity, lastMovePoint, currentTime);
+        return;
+    }
+    BuildAndSendPointerEvent(context, BuildMoveTouchEntity(entity.pointerId, targetPoint, currentTime));
+}
+
+void GamePadStickObservationToTouchHandler::Recenter(std::shared_ptr<InputToTouchContext> &context,
+                                                     GamePadAxisEntity &entity,
+                                                     const PointerEvent::PointerItem &lastMovePoint,
+                                                     int64_t currentTime)
+{
+    HILOGI_LIMIT("the drag of thumbstick [%{public}d] reaches the edge, press it again at the start point",
+                 entity.mappingInfo.keyCode);
+    BuildAndSendPointerEvent(context, BuildTouchUpEntity(lastMovePoint, entity.pointerId,
+                                                         PointerEvent::POINTER_ACTION_UP, currentTime));
+    BuildAndSendPointerEvent(context, BuildTouchEntity(entity.mappingInfo, entity.pointerId,
+                                                       PointerEvent::POINTER_ACTION_DOWN, currentTime));
+    entity.xRemainder = 0.0;
+    entity.yRemainder = 0.0;
+}
+
+void GamePadStickObservationToTouchHandler::RunTick(std::shared_ptr<InputToTouchContext> &context,
+                                                    int32_t axisSource, uint64_t sequence, int64_t currentTime)
+{
+    auto iter = context->gamePadAxes.find(axisSource);
+    if (iter == context->gamePadAxes.end() || iter->second.sequence != sequence) {
+        return;
+    }
+    Advance(context, iter->second, currentTime);
+    ScheduleTick(context, axisSource);
+}
+
+void GamePadStickObservationToTouchHandler::ScheduleTick(std::shared_ptr<InputToTouchContext> &context,
+                                                         int32_t axisSource)
+{
+    auto iter = context->gamePadAxes.find(axisSource);
+    if (context->handleQueue == nullptr || iter == context->gamePadAxes.end()) {
+        return;
+    }
+    std::weak_ptr<InputToTouchContext> weakContext = context;
+    uint64_t sequence = iter->second.sequence;
+    iter->second.taskHandle = context->handleQueue->submit_h([this, weakContext, axisSource, sequence] {
+        std::shared_ptr<InputToTouchContext> context = weakContext.lock();
+        if (context != nullptr) {
+            RunTick(context, axisSource, sequence, StringUtils::GetSysClockTime());
+        }
+    }, ffrt::task_attr().name("gamepad-observation-task").delay(static_cast<uint64_t>(TICK_INTERVAL)));
+}
+}
+}
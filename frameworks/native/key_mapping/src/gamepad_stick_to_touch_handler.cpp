@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <cmath>
+#include "gamepad_stick_to_touch_handler.h"
+#include "gamecontroller_log.h"
+
+namespace OHOS {
+namespace GameController {
+void GamePadStickToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
+                                                    const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                                    const KeyToTouchMappingInfo &mappingInfo)
+{
+    int32_t axisSource = mappingInfo.keyCode;
+    PointerEvent::AxisType xAxis;
+    PointerEvent::AxisType yAxis;
+    if (!GetGamePadAxisTypes(axisSource, xAxis, yAxis) || yAxis == PointerEvent::AxisType::AXIS_TYPE_UNKNOWN) {
+        HILOGW_LIMIT("discard axis event. [%{public}d] is not a thumbstick", axisSource);
+        return;
+    }
+    double xValue = GetGamePadAxisValue(context, pointerEvent, xAxis);
+    double yValue = GetGamePadAxisValue(context, pointerEvent, yAxis);
+    double deflection = std::sqrt(xValue * xValue + yValue * yValue);
+    double output = GetAxisResponseTable(context, axisSource).GetOutput(deflection);
+    int64_t actionTime = pointerEvent->GetActionTime();
+    std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + axisSource);
+    if (output <= 0.0) {
+        if (pair.first) {
+            HILOGI_LIMIT("thumbstick [%{public}d] convert to up event of gamepad_stick_to_touch", axisSource);
+            ReleaseGamePadAxis(context, axisSource, actionTime);
+        }
+        return;
+    }
+
+    int32_t pointerId = pair.second;
+    if (!pair.first) {
+        HILOGI_LIMIT("thumbstick [%{public}d] convert to down event of gamepad_stick_to_touch", axisSource);
+        pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
+        context->SetCurrentGamePadAxis(mappingInfo, pointerId);
+        BuildAndSendPointerEvent(context, BuildTouchEntity(mappingInfo, pointerId, PointerEvent::POINTER_ACTION_DOWN,
+                                                           actionTime));
+    }
+
+    // The distance from the center follows the output, in the direction of the thumbstick.
+    double scale = output * mappingInfo.radius / deflection;
+    Point targetPoint;
+    targetPoint.x = std::round(mappingInfo.xValue + xValue * scale);
+    targetPoint.y = std::round(mappingInfo.yValue + yValue * scale);
+    const PointerEvent::PointerItem &lastMovePoint = context->pointerItems[pointerId];
+    if (targetPoint.x == lastMovePoint.GetWindowX() && targetPoint.y == lastMovePoint.GetWindowY()) {
+        return;
+    }
+    BuildAndSendPointerEvent(context, BuildMoveTouchEntity(pointerId, targetPoint, actionTime));
+}
+}
+}
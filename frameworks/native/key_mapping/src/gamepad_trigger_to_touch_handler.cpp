@@ -0,0 +1,57 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <cmath>
+#include "gamepad_trigger_to_touch_handler.h"
+#include "gamecontroller_log.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const double TRIGGER_RELEASE_RATIO = 0.5;
+}
+
+void GamePadTriggerToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
+                                                      const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                                      const KeyToTouchMappingInfo &mappingInfo)
+{
+    int32_t axisSource = mappingInfo.keyCode;
+    PointerEvent::AxisType axis;
+    PointerEvent::AxisType unusedAxis;
+    if (!GetGamePadAxisTypes(axisSource, axis, unusedAxis) ||
+        unusedAxis != PointerEvent::AxisType::AXIS_TYPE_UNKNOWN) {
+        HILOGW_LIMIT("discard axis event. [%{public}d] is not a trigger", axisSource);
+        return;
+    }
+    double value = GetGamePadAxisValue(context, pointerEvent, axis);
+    const AxisResponseTable &responseTable = GetAxisResponseTable(context, axisSource);
+    int64_t actionTime = pointerEvent->GetActionTime();
+    if (context->gamePadAxes.count(axisSource) == 0) {
+        if (responseTable.GetOutput(value) <= 0.0) {
+            return;
+        }
+        HILOGI_LIMIT("trigger [%{public}d] convert to down event of gamepad_trigger_to_touch", axisSource);
+        int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
+        context->SetCurrentGamePadAxis(mappingInfo, pointerId);
+        BuildAndSendPointerEvent(context, BuildTouchEntity(mappingInfo, pointerId, PointerEvent::POINTER_ACTION_DOWN,
+                                                           actionTime));
+        return;
+    }
+    if (std::abs(value) <= responseTable.deadZone * TRIGGER_RELEASE_RATIO) {
+        HILOGI_LIMIT("trigger [%{public}d] convert to up event of gamepad_trigger_to_touch", axisSource);
+        ReleaseGamePadAxis(context, axisSource, actionTime);
+    }
+}
+}
+}
@@ -42,6 +42,7 @@ const char* SCB_FORWARD_KEY_EVENT = "custom.event.SCB_FORWARD_KEYEVENT";
 const char* SCB_BUNDLE_NAME = "com.ohos.sceneboard";
 const char* EVENT_PARAM_BUNDLE_NAME = "bundleName";
 const char* EVENT_PARAM_DEVICE_TYPE = "deviceType";
+const char* EVENT_PARAM_DEVICE_TYPES = "deviceTypes";
 const char* EVENT_PARAM_ENABLE = "enable";
 const char* EVENT_PARAM_KEYCODE = "keyCode";
 const int32_t GAME_CONTROLLER_UID = 6227;
@@ -190,6 +191,18 @@ void GameCommonEventListener::HandleTemplateChangeEvent(const std::string &bundl
                                                         const EventFwk::CommonEventData &data)
 {
     AAFwk::Want want = data.GetWant();
+    std::vector<int> deviceTypes = want.GetIntArrayParam(EVENT_PARAM_DEVICE_TYPES);
+    if (deviceTypes.size() > 1) {
+        HILOGI("Get the keymapping info by bundleName:%{public}s, size:%{public}zu",
+               bundleName.c_str(), deviceTypes.size());
+        std::vector<DeviceTypeEnum> deviceTypeEnums;
+        for (const auto &deviceType: deviceTypes) {
+            deviceTypeEnums.push_back(static_cast<DeviceTypeEnum>(deviceType));
+        }
+        DelayedSingleton<KeyMappingService>::GetInstance()->UpdateGameKeyMappingWhenTemplateChange(
+            bundleName, deviceTypeEnums);
+        return;
+    }
     int deviceType = want.GetIntParam(EVENT_PARAM_DEVICE_TYPE, 0);
     HILOGI("Get the keymapping info by bundleName:%{public}s, deviceType:%{public}d",
            bundleName.c_str(), deviceType);
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <ctime>
+#include <syspara/parameters.h>
+#include "input_trace_recorder.h"
+#include "gamecontroller_utils.h"
+#include "multi_modal_input_mgt_service.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const char* INPUT_TRACE_ENABLE_PARAM = "persist.gamecontroller.input_trace.enable";
+const char* INPUT_TRACE_PATH_PARAM = "persist.gamecontroller.input_trace.path";
+const char* DEFAULT_INPUT_TRACE_PATH = "/data/storage/el2/base/cache/gamecontroller_input.trace";
+
+/**
+ * The buffered records are moved to the write queue when they are more than it.
+ */
+const size_t FLUSH_BUFFER_SIZE = 32 * 1024;
+const int64_t US_TO_NS = 1000LL;
+const int64_t S_TO_US = 1000000LL;
+}
+
+InputTraceRecorder::InputTraceRecorder()
+{
+    writeQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("InputTraceWriteQueue");
+    if (OHOS::system::GetBoolParameter(INPUT_TRACE_ENABLE_PARAM, false)) {
+        StartCapture(OHOS::system::GetParameter(INPUT_TRACE_PATH_PARAM, DEFAULT_INPUT_TRACE_PATH));
+    }
+}
+
+InputTraceRecorder::~InputTraceRecorder()
+{
+    StopCapture();
+    writeQueue_ = nullptr;
+}
+
+bool InputTraceRecorder::StartCapture(const std::string &path)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (isCapturing_) {
+        HILOGW("input trace is capturing");
+        return false;
+    }
+    struct timespec ts = {0, 0};
+    clock_gettime(CLOCK_REALTIME, &ts);
+    InputTraceFileHeader fileHeader;
+    fileHeader.startRealTime = ts.tv_sec * S_TO_US + ts.tv_nsec / US_TO_NS;
+    std::shared_ptr<InputTraceWriter> writer = std::make_shared<InputTraceWriter>();
+    if (!writer->Open(path, fileHeader)) {
+        return false;
+    }
+    HILOGI("start input trace capture");
+    writer_ = writer;
+    isReplayCapture_ = false;
+    startTime_ = StringUtils::GetSysClockTime();
+    buffer_.clear();
+    if (hasWindowInfo_) {
+        AppendWindowRecord(windowInfoEntity_);
+    }
+    for (const auto &pair: templates_) {
+        AppendTemplateRecord(pair.first, pair.second);
+    }
+    isCapturing_ = true;
+    return true;
+}
+
+void InputTraceRecorder::StopCapture()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!isCapturing_ || isReplayCapture_) {
+        return;
+    }
+    isCapturing_ = false;
+    SubmitBuffer();
+    std::shared_ptr<InputTraceWriter> writer = writer_;
+    writer_ = nullptr;
+    if (writeQueue_ != nullptr) {
+        ffrt::task_handle handle = writeQueue_->submit_h([writer] {
+            writer->Close();
+        });
+        writeQueue_->wait(handle);
+    }
+    HILOGI("stop input trace capture");
+}
+
+void InputTraceRecorder::StartReplayCapture()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (isCapturing_) {
+        HILOGW("input trace is capturing");
+        return;
+    }
+    isReplayCapture_ = true;
+    startTime_ = StringUtils::GetSysClockTime();
+    replayRecords_.clear();
+    isCapturing_ = true;
+}
+
+std::vector<InputTraceRecord> InputTraceRecorder::StopReplayCapture()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    std::vector<InputTraceRecord> records;
+    if (!isReplayCapture_) {
+        return records;
+    }
+    isCapturing_ = false;
+    isReplayCapture_ = false;
+    records.swap(replayRecords_);
+    return records;
+}
+
+void InputTraceRecorder::RecordKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent, bool isDispatched)
+{
+    if (!IsCapturing() || keyEvent == nullptr) {
+        return;
+    }
+    InputTraceKeyRecord record;
+    record.actionTime = keyEvent->GetActionTime();
+    record.deviceId = keyEvent->GetDeviceId();
+    record.keyCode = keyEvent->GetKeyCode();
+    record.keyAction = keyEvent->GetKeyAction();
+    DeviceInfo deviceInfo = DelayedSingleton<MultiModalInputMgtService>::GetInstance()->GetDeviceInfo(
+        record.deviceId);
+    record.deviceType = static_cast<int32_t>(deviceInfo.deviceType);
+    record.deviceOnlineTime = deviceInfo.onlineTime;
+    for (const auto &keyItem: keyEvent->GetKeyItems()) {
+        if (record.keyItemCount >= INPUT_TRACE_MAX_KEY_ITEMS) {
+            break;
+        }
+        InputTraceKeyItem &item = record.keyItems[record.keyItemCount++];
+        item.downTime = keyItem.GetDownTime();
+        item.keyCode = keyItem.GetKeyCode();
+        item.deviceId = keyItem.GetDeviceId();
+        item.pressed = keyItem.IsPressed() ? 1 : 0;
+    }
+    AppendRecord(INPUT_TRACE_KEY, isDispatched ? INPUT_TRACE_FLAG_DISPATCHED : 0, &record, sizeof(record));
+}
+
+void InputTraceRecorder::RecordPointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                            bool isDispatched)
+{
+    if (!IsCapturing() || pointerEvent == nullptr) {
+        return;
+    }
+    InputTracePointerRecord record;
+    record.actionTime = pointerEvent->GetActionTime();
+    record.deviceId = pointerEvent->GetDeviceId();
+    record.sourceType = pointerEvent->GetSourceType();
+    record.pointerAction = pointerEvent->GetPointerAction();
+    record.pointerId = pointerEvent->GetPointerId();
+    record.buttonId = pointerEvent->GetButtonId();
+    PointerEvent::PointerItem pointerItem;
+    if (pointerEvent->GetPointerItem(record.pointerId, pointerItem)) {
+        record.windowX = pointerItem.GetWindowX();
+        record.windowY = pointerItem.GetWindowY();
+        record.displayX = pointerItem.GetDisplayX();
+        record.displayY = pointerItem.GetDisplayY();
+    }
+    for (uint32_t axis = 0; axis < INPUT_TRACE_AXIS_COUNT; axis++) {
+        PointerEvent::AxisType axisType = static_cast<PointerEvent::AxisType>(axis);
+        if (pointerEvent->HasAxis(axisType)) {
+            record.axisMask |= (1U << axis);
+            record.axisValues[axis] = pointerEvent->GetAxisValue(axisType);
+        }
+    }
+    AppendRecord(INPUT_TRACE_POINTER, isDispatched ? INPUT_TRACE_FLAG_DISPATCHED : 0, &record, sizeof(record));
+}
+
+void InputTraceRecorder::RecordTouchEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
+{
+    if (!IsCapturing() || pointerEvent == nullptr) {
+        return;
+    }
+    InputTraceTouchRecord record;
+    record.pointerAction = pointerEvent->GetPointerAction();
+    record.pointerId = pointerEvent->GetPointerId();
+    record.sourceType = pointerEvent->GetSourceType();
+    record.windowId = pointerEvent->GetTargetWindowId();
+    record.displayId = pointerEvent->GetTargetDisplayId();
+    for (int32_t pointerId: pointerEvent->GetPointerIds()) {
+        if (record.touchItemCount >= INPUT_TRACE_MAX_TOUCH_ITEMS) {
+            break;
+        }
+        PointerEvent::PointerItem pointerItem;
+        if (!pointerEvent->GetPointerItem(pointerId, pointerItem)) {
+            continue;
+        }
+        InputTraceTouchItem &item = record.touchItems[record.touchItemCount++];
+        item.pointerId = pointerId;
+        item.windowX = pointerItem.GetWindowX();
+        item.windowY = pointerItem.GetWindowY();
+    }
+    AppendRecord(INPUT_TRACE_TOUCH, 0, &record, sizeof(record));
+}
+
+void InputTraceRecorder::UpdateTemplate(const DeviceTypeEnum &deviceType,
+                                        const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    templates_[static_cast<int32_t>(deviceType)] = mappingInfos;
+    if (isCapturing_ && !isReplayCapture_) {
+        AppendTemplateRecord(static_cast<int32_t>(deviceType), mappingInfos);
+    }
+}
+
+void InputTraceRecorder::UpdateWindowInfo(const WindowInfoEntity &windowInfoEntity)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    windowInfoEntity_ = windowInfoEntity;
+    hasWindowInfo_ = true;
+    if (isCapturing_ && !isReplayCapture_) {
+        AppendWindowRecord(windowInfoEntity);
+    }
+}
+
+void InputTraceRecorder::AppendRecord(InputTraceKindEnum kind, uint16_t flags, const void* payload,
+                                      uint32_t payloadSize)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!isCapturing_) {
+        return;
+    }
+    InputTraceRecordHeader header;
+    header.kind = static_cast<uint16_t>(kind);
+    header.flags = flags;
+    header.elapsedTime = GetElapsedTime();
+    if (isReplayCapture_) {
+        if (kind != INPUT_TRACE_TOUCH) {
+            return;
+        }
+        InputTraceRecord record;
+        header.payloadSize = payloadSize;
+        record.header = header;
+        const uint8_t* begin = reinterpret_cast<const uint8_t*>(payload);
+        record.payload.assign(begin, begin + payloadSize);
+        replayRecords_.push_back(std::move(record));
+        return;
+    }
+    InputTraceCodec::AppendRecord(buffer_, header, payload, payloadSize);
+    if (buffer_.size() >= FLUSH_BUFFER_SIZE) {
+        SubmitBuffer();
+    }
+}
+
+void InputTraceRecorder::AppendTemplateRecord(int32_t deviceType,
+                                              const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+{
+    std::vector<uint8_t> payload;
+    if (!InputTraceCodec::BuildTemplatePayload(deviceType, mappingInfos, payload)) {
+        return;
+    }
+    InputTraceRecordHeader header;
+    header.kind = INPUT_TRACE_TEMPLATE;
+    header.elapsedTime = GetElapsedTime();
+    InputTraceCodec::AppendRecord(buffer_, header, payload.data(), static_cast<uint32_t>(payload.size()));
+}
+
+void InputTraceRecorder::AppendWindowRecord(const WindowInfoEntity &windowInfoEntity)
+{
+    InputTraceWindowRecord record;
+    record.windowId = windowInfoEntity.windowId;
+    record.maxWidth = windowInfoEntity.maxWidth;
+    record.maxHeight = windowInfoEntity.maxHeight;
+    record.currentWidth = windowInfoEntity.currentWidth;
+    record.currentHeight = windowInfoEntity.currentHeight;
+    record.xPosition = windowInfoEntity.xPosition;
+    record.yPosition = windowInfoEntity.yPosition;
+    record.xCenter = windowInfoEntity.xCenter;
+    record.yCenter = windowInfoEntity.yCenter;
+    record.displayId = windowInfoEntity.displayId;
+    record.isFullScreen = windowInfoEntity.isFullScreen ? 1 : 0;
+    record.isPluginMode = windowInfoEntity.isPluginMode ? 1 : 0;
+    std::string bundleName = windowInfoEntity.bundleName.substr(0, INPUT_TRACE_MAX_NAME_LENGTH);
+    record.bundleNameLength = static_cast<uint32_t>(bundleName.size());
+    std::vector<uint8_t> payload(reinterpret_cast<const uint8_t*>(&record),
+                                 reinterpret_cast<const uint8_t*>(&record) + sizeof(record));
+    payload.insert(payload.end(), bundleName.begin(), bundleName.end());
+    InputTraceRecordHeader header;
+    header.kind = INPUT_TRACE_WINDOW;
+    header.elapsedTime = GetElapsedTime();
+    InputTraceCodec::AppendRecord(buffer_, header, payload.data(), static_cast<uint32_t>(payload.size()));
+}
+
+void InputTraceRecorder::SubmitBuffer()
+{
+    if (buffer_.empty() || writer_ == nullptr || writeQueue_ == nullptr) {
+        return;
+    }
+    std::shared_ptr<std::vector<uint8_t>> buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->swap(buffer_);
+    std::shared_ptr<InputTraceWriter> writer = writer_;
+    writeQueue_->submit([writer, buffer] {
+        writer->Write(*buffer);
+    });
+}
+
+int64_t InputTraceRecorder::GetElapsedTime() const
+{
+    return StringUtils::GetSysClockTime() - startTime_;
+}
+}
+}
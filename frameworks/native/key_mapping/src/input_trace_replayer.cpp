@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <thread>
+#include <securec.h>
+#include "input_trace_replayer.h"
+#include "input_trace_recorder.h"
+#include "key_to_touch_manager.h"
+#include "gamecontroller_errors.h"
+#include "gamecontroller_utils.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+/**
+ * The replayed key events have no real device, so a fixed uniq is used to pass the device check.
+ */
+const char* REPLAY_DEVICE_UNIQ = "input-trace-replay";
+
+template<typename T>
+bool ReadPayload(const InputTraceRecord &record, T &value)
+{
+    if (record.payload.size() < sizeof(T)) {
+        HILOGE("invalid input trace payload. kind is [%{public}d]", record.header.kind);
+        return false;
+    }
+    return memcpy_s(&value, sizeof(T), record.payload.data(), sizeof(T)) == EOK;
+}
+}
+
+int32_t InputTraceReplayer::Replay(const std::string &path, InputTraceReplayModeEnum mode,
+                                   InputTraceReplayResult &result)
+{
+    InputTraceFileHeader fileHeader;
+    std::vector<InputTraceRecord> records;
+    if (!InputTraceCodec::ReadFile(path, fileHeader, records)) {
+        HILOGE("read input trace failed");
+        return GAME_ERR_ARGUMENT_INVALID;
+    }
+    return Replay(records, mode, result);
+}
+
+int32_t InputTraceReplayer::Replay(const std::vector<InputTraceRecord> &records, InputTraceReplayModeEnum mode,
+                                   InputTraceReplayResult &result)
+{
+    std::shared_ptr<InputTraceRecorder> recorder = DelayedSingleton<InputTraceRecorder>::GetInstance();
+    if (recorder->IsCapturing()) {
+        HILOGE("cannot replay while the input trace is capturing");
+        return GAME_ERR_FAIL;
+    }
+    HILOGI("start replay input trace. records size is [%{public}zu], mode is [%{public}d]", records.size(), mode);
+    DelayedSingleton<KeyToTouchManager>::GetInstance()->SetSupportKeyMapping(true, {});
+    recorder->StartReplayCapture();
+    int64_t startTime = StringUtils::GetSysClockTime();
+    result.inputCount = 0;
+    for (const auto &record: records) {
+        if (mode == REPLAY_ORIGINAL_TIMING) {
+            int64_t waitTime = startTime + record.header.elapsedTime - StringUtils::GetSysClockTime();
+            if (waitTime > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(waitTime));
+            }
+        }
+        if (ReplayRecord(record)) {
+            result.inputCount++;
+        }
+    }
+    DelayedSingleton<KeyToTouchManager>::GetInstance()->WaitHandleQueueIdle();
+    std::vector<InputTraceRecord> actualRecords = recorder->StopReplayCapture();
+    result.compareResult = InputTraceCodec::CompareTouchStream(records, actualRecords);
+    HILOGI("replay input trace finished. isSame [%{public}d], expected [%{public}zu], actual [%{public}zu], "
+           "firstMismatchIndex [%{public}zu]", result.compareResult.isSame, result.compareResult.expectedCount,
+           result.compareResult.actualCount, result.compareResult.firstMismatchIndex);
+    return GAME_CONTROLLER_SUCCESS;
+}
+
+bool InputTraceReplayer::ReplayRecord(const InputTraceRecord &record)
+{
+    switch (record.header.kind) {
+        case INPUT_TRACE_KEY:
+            ReplayKeyRecord(record);
+            return true;
+        case INPUT_TRACE_POINTER:
+            ReplayPointerRecord(record);
+            return true;
+        case INPUT_TRACE_TEMPLATE:
+            // The following input events are checked against the template, so wait until it's applied.
+            ReplayTemplateRecord(record);
+            DelayedSingleton<KeyToTouchManager>::GetInstance()->WaitHandleQueueIdle();
+            return false;
+        case INPUT_TRACE_WINDOW:
+            ReplayWindowRecord(record);
+            DelayedSingleton<KeyToTouchManager>::GetInstance()->WaitHandleQueueIdle();
+            return false;
+        default:
+            return false;
+    }
+}
+
+void InputTraceReplayer::ReplayKeyRecord(const InputTraceRecord &record)
+{
+    InputTraceKeyRecord keyRecord;
+    if (!ReadPayload(record, keyRecord) || keyRecord.keyItemCount > INPUT_TRACE_MAX_KEY_ITEMS) {
+        return;
+    }
+    if ((record.header.flags & INPUT_TRACE_FLAG_DISPATCHED) == 0) {
+        // The key mapping did not take it over in the capture, it has no effect on the touch stream.
+        return;
+    }
+    std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+    if (keyEvent == nullptr) {
+        HILOGE("Create KeyEvent failed.");
+        return;
+    }
+    keyEvent->SetKeyCode(keyRecord.keyCode);
+    keyEvent->SetKeyAction(keyRecord.keyAction);
+    keyEvent->SetDeviceId(keyRecord.deviceId);
+    keyEvent->SetActionTime(keyRecord.actionTime);
+    for (uint32_t idx = 0; idx < keyRecord.keyItemCount; idx++) {
+        const InputTraceKeyItem &item = keyRecord.keyItems[idx];
+        MMI::KeyEvent::KeyItem keyItem;
+        keyItem.SetKeyCode(item.keyCode);
+        keyItem.SetDownTime(item.downTime);
+        keyItem.SetDeviceId(item.deviceId);
+        keyItem.SetPressed(item.pressed != 0);
+        keyEvent->AddKeyItem(keyItem);
+    }
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = REPLAY_DEVICE_UNIQ;
+    deviceInfo.deviceType = static_cast<DeviceTypeEnum>(keyRecord.deviceType);
+    deviceInfo.onlineTime = keyRecord.deviceOnlineTime;
+    deviceInfo.ids.insert(keyRecord.deviceId);
+    DelayedSingleton<KeyToTouchManager>::GetInstance()->DispatchReplayKeyEvent(keyEvent, deviceInfo);
+}
+
+void InputTraceReplayer::ReplayPointerRecord(const InputTraceRecord &record)
+{
+    InputTracePointerRecord pointerRecord;
+    if (!ReadPayload(record, pointerRecord)) {
+        return;
+    }
+    if ((record.header.flags & INPUT_TRACE_FLAG_DISPATCHED) == 0) {
+        return;
+    }
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+    if (pointerEvent == nullptr) {
+        HILOGE("Create PointerEvent failed.");
+        return;
+    }
+    PointerEvent::PointerItem pointerItem;
+    pointerItem.SetPointerId(pointerRecord.pointerId);
+    pointerItem.SetDeviceId(pointerRecord.deviceId);
+    pointerItem.SetWindowX(pointerRecord.windowX);
+    pointerItem.SetWindowY(pointerRecord.windowY);
+    pointerItem.SetDisplayX(pointerRecord.displayX);
+    pointerItem.SetDisplayY(pointerRecord.displayY);
+    pointerEvent->AddPointerItem(pointerItem);
+    pointerEvent->SetPointerId(pointerRecord.pointerId);
+    pointerEvent->SetDeviceId(pointerRecord.deviceId);
+    pointerEvent->SetSourceType(pointerRecord.sourceType);
+    pointerEvent->SetPointerAction(pointerRecord.pointerAction);
+    pointerEvent->SetButtonId(pointerRecord.buttonId);
+    pointerEvent->SetActionTime(pointerRecord.actionTime);
+    for (uint32_t axis = 0; axis < INPUT_TRACE_AXIS_COUNT; axis++) {
+        if ((pointerRecord.axisMask & (1U << axis)) != 0) {
+            pointerEvent->SetAxisValue(static_cast<PointerEvent::AxisType>(axis), pointerRecord.axisValues[axis]);
+        }
+    }
+    DelayedSingleton<KeyToTouchManager>::GetInstance()->DispatchPointerEvent(pointerEvent);
+}
+
+void InputTraceReplayer::ReplayTemplateRecord(const InputTraceRecord &record)
+{
+    int32_t deviceType = 0;
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    if (!InputTraceCodec::ParseTemplatePayload(record.payload, deviceType, mappingInfos)) {
+        HILOGE("invalid input trace template");
+        return;
+    }
+    DelayedSingleton<KeyToTouchManager>::GetInstance()->UpdateTemplateConfig(
+        static_cast<DeviceTypeEnum>(deviceType), bundleName_, mappingInfos);
+}
+
+void InputTraceReplayer::ReplayWindowRecord(const InputTraceRecord &record)
+{
+    InputTraceWindowRecord windowRecord;
+    if (!ReadPayload(record, windowRecord) ||
+        record.payload.size() != sizeof(InputTraceWindowRecord) + windowRecord.bundleNameLength) {
+        return;
+    }
+    WindowInfoEntity windowInfoEntity;
+    windowInfoEntity.bundleName.assign(
+        reinterpret_cast<const char*>(record.payload.data() + sizeof(InputTraceWindowRecord)),
+        windowRecord.bundleNameLength);
+    windowInfoEntity.windowId = windowRecord.windowId;
+    windowInfoEntity.maxWidth = windowRecord.maxWidth;
+    windowInfoEntity.maxHeight = windowRecord.maxHeight;
+    windowInfoEntity.currentWidth = windowRecord.currentWidth;
+    windowInfoEntity.currentHeight = windowRecord.currentHeight;
+    windowInfoEntity.xPosition = windowRecord.xPosition;
+    windowInfoEntity.yPosition = windowRecord.yPosition;
+    windowInfoEntity.xCenter = windowRecord.xCenter;
+    windowInfoEntity.yCenter = windowRecord.yCenter;
+    windowInfoEntity.displayId = windowRecord.displayId;
+    windowInfoEntity.isFullScreen = windowRecord.isFullScreen != 0;
+    windowInfoEntity.isPluginMode = windowRecord.isPluginMode != 0;
+    std::shared_ptr<KeyToTouchManager> manager = DelayedSingleton<KeyToTouchManager>::GetInstance();
+    if (windowInfoEntity.bundleName != bundleName_) {
+        bundleName_ = windowInfoEntity.bundleName;
+        manager->SetCurrentBundleName(bundleName_, true, windowInfoEntity.isPluginMode);
+    }
+    manager->UpdateWindowInfo(windowInfoEntity);
+}
+}
+}
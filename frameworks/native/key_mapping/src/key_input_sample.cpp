@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "key_input_sample.h"
+
+namespace OHOS {
+namespace GameController {
+KeyInputSample KeyInputSample::Build(const std::shared_ptr<MMI::KeyEvent> &keyEvent, DeviceTypeEnum deviceType,
+                                     int64_t deviceOnlineTime)
+{
+    KeyInputSample sample{};
+    sample.deviceType = deviceType;
+    sample.deviceOnlineTime = deviceOnlineTime;
+    if (keyEvent == nullptr) {
+        sample.keyAction = MMI::KeyEvent::KEY_ACTION_UNKNOWN;
+        return sample;
+    }
+    sample.actionTime = keyEvent->GetActionTime();
+    sample.keyCode = keyEvent->GetKeyCode();
+    sample.keyAction = keyEvent->GetKeyAction();
+    sample.deviceId = keyEvent->GetDeviceId();
+
+    // Insertion sort by the down time. Only a few keys are pressed, and the newest ones are kept.
+    for (const auto &keyItem: keyEvent->GetKeyItems()) {
+        if (!keyItem.IsPressed() || keyItem.GetDeviceId() != sample.deviceId ||
+            keyItem.GetDownTime() < deviceOnlineTime) {
+            continue;
+        }
+        PressedKey pressedKey{keyItem.GetDownTime(), keyItem.GetKeyCode()};
+        int32_t idx = sample.pressedKeyCount;
+        if (idx == MAX_SAMPLE_PRESSED_KEYS) {
+            if (pressedKey.downTime < sample.pressedKeys[0].downTime) {
+                continue;
+            }
+            for (int32_t moveIdx = 1; moveIdx < MAX_SAMPLE_PRESSED_KEYS; moveIdx++) {
+                sample.pressedKeys[moveIdx - 1] = sample.pressedKeys[moveIdx];
+            }
+            idx--;
+        } else {
+            sample.pressedKeyCount++;
+        }
+        while (idx > 0 && sample.pressedKeys[idx - 1].downTime > pressedKey.downTime) {
+            sample.pressedKeys[idx] = sample.pressedKeys[idx - 1];
+            idx--;
+        }
+        sample.pressedKeys[idx] = pressedKey;
+    }
+    return sample;
+}
+}
+}
@@ -57,8 +57,8 @@ KeyMappingSupportConfig::KeyMappingSupportConfig(const json &jsonObj)
 
 KeyMappingService::KeyMappingService()
 {
-    handleQueue_ = std::make_unique<ffrt::queue>("KeyMappingServiceHandleQueue",
-                                                 ffrt::queue_attr().qos(ffrt::qos_default));
+    handleQueue_ =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("KeyMappingServiceHandleQueue");
 }
 
 KeyMappingService::~KeyMappingService()
@@ -146,33 +146,73 @@ void KeyMappingService::ExecuteGetGameKeyMapping(DeviceTypeEnum deviceType)
     int32_t result = DelayedSingleton<GameControllerServerClient>::GetInstance()->
         GetGameKeyMappingConfig(param, gameKeyMappingInfo);
     if (result == GAME_CONTROLLER_SUCCESS) {
-        loadTemplateCache_[deviceType] = true;
-        std::vector<KeyToTouchMappingInfo> mappingInfos;
-        if (gameKeyMappingInfo.customKeyToTouchMappings.empty() &&
-            gameKeyMappingInfo.defaultKeyToTouchMappings.empty()) {
-            HILOGI("deviceType[%{public}d] doesn't have key-mapping config", deviceType);
-            DelayedSingleton<KeyToTouchManager>::GetInstance()->UpdateTemplateConfig(deviceType,
-                                                                                     bundleName_,
-                                                                                     mappingInfos);
-            return;
-        }
+        ApplyGameKeyMappingInfo(deviceType, gameKeyMappingInfo);
+        return;
+    }
+    HILOGE("GetGameKeyMapping failed. deviceType[%{public}d]. result [%{private}d]",
+           deviceType, result);
+}
 
-        HILOGI("deviceType[%{public}d] has key-mapping config", deviceType);
-        if (gameKeyMappingInfo.customKeyToTouchMappings.empty()) {
-            if (!gameKeyMappingInfo.defaultKeyToTouchMappings.empty()) {
-                mappingInfos = gameKeyMappingInfo.defaultKeyToTouchMappings;
-            }
-        } else {
-            mappingInfos = gameKeyMappingInfo.customKeyToTouchMappings;
+void KeyMappingService::ExecuteGetGameKeyMappings(const std::vector<DeviceTypeEnum> &deviceTypes)
+{
+    std::vector<GetGameKeyMappingInfoParam> params;
+    for (const auto &deviceType: deviceTypes) {
+        GetGameKeyMappingInfoParam param;
+        param.bundleName = bundleName_;
+        param.deviceType = deviceType;
+        params.push_back(param);
+    }
+    std::vector<GameKeyMappingInfo> gameKeyMappingInfos;
+    int32_t result = DelayedSingleton<GameControllerServerClient>::GetInstance()->
+        GetGameKeyMappingConfigs(params, gameKeyMappingInfos);
+    if (result != GAME_CONTROLLER_SUCCESS || gameKeyMappingInfos.size() != deviceTypes.size()) {
+        HILOGE("GetGameKeyMappings failed. size[%{public}zu]. result [%{private}d]. get them one by one",
+               deviceTypes.size(), result);
+        // one failed template doesn't drop the others
+        for (const auto &deviceType: deviceTypes) {
+            ExecuteGetGameKeyMapping(deviceType);
         }
+        return;
+    }
+    for (size_t idx = 0; idx < deviceTypes.size(); idx++) {
+        ApplyGameKeyMappingInfo(deviceTypes[idx], gameKeyMappingInfos[idx]);
+    }
+}
 
+void KeyMappingService::ApplyGameKeyMappingInfo(DeviceTypeEnum deviceType,
+                                                const GameKeyMappingInfo &gameKeyMappingInfo)
+{
+    loadTemplateCache_[deviceType] = true;
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    if (gameKeyMappingInfo.customKeyToTouchMappings.empty() &&
+        gameKeyMappingInfo.defaultKeyToTouchMappings.empty()) {
+        HILOGI("deviceType[%{public}d] doesn't have key-mapping config", deviceType);
         DelayedSingleton<KeyToTouchManager>::GetInstance()->UpdateTemplateConfig(deviceType,
                                                                                  bundleName_,
                                                                                  mappingInfos);
         return;
     }
-    HILOGE("GetGameKeyMapping failed. deviceType[%{public}d]. result [%{private}d]",
-           deviceType, result);
+
+    HILOGI("deviceType[%{public}d] has key-mapping config", deviceType);
+    TemplateResolution resolution;
+    ResponseCurve responseCurve;
+    if (gameKeyMappingInfo.customKeyToTouchMappings.empty()) {
+        if (!gameKeyMappingInfo.defaultKeyToTouchMappings.empty()) {
+            mappingInfos = gameKeyMappingInfo.defaultKeyToTouchMappings;
+            resolution = gameKeyMappingInfo.defaultResolution;
+            responseCurve = gameKeyMappingInfo.defaultResponseCurve;
+        }
+    } else {
+        mappingInfos = gameKeyMappingInfo.customKeyToTouchMappings;
+        resolution = gameKeyMappingInfo.customResolution;
+        responseCurve = gameKeyMappingInfo.customResponseCurve;
+    }
+
+    DelayedSingleton<KeyToTouchManager>::GetInstance()->UpdateTemplateConfig(deviceType,
+                                                                             bundleName_,
+                                                                             mappingInfos,
+                                                                             resolution,
+                                                                             responseCurve);
 }
 
 void KeyMappingService::ExecuteBroadCastDeviceInfo(const DeviceInfo &deviceInfo)
@@ -265,6 +305,29 @@ void KeyMappingService::UpdateGameKeyMappingWhenTemplateChange(const std::string
     });
 }
 
+void KeyMappingService::UpdateGameKeyMappingWhenTemplateChange(const std::string &bundleName,
+                                                               const std::vector<DeviceTypeEnum> &deviceTypes)
+{
+    handleQueue_->submit([bundleName, deviceTypes, this] {
+        std::lock_guard<ffrt::mutex> lock(configMutex_);
+        if (bundleName != bundleName_) {
+            HILOGW("discard UpdateGameKeyMappingWhenTemplateChange. bundleName [%{public}s] is "
+                   "not same with bundleName [%{public}s]", bundleName.c_str(), bundleName_.c_str());
+            return;
+        }
+        std::vector<DeviceTypeEnum> supportDeviceTypes;
+        for (const auto &deviceType: deviceTypes) {
+            if (DeviceIsSupportKeyMapping(deviceType)) {
+                supportDeviceTypes.push_back(deviceType);
+            }
+        }
+        if (supportDeviceTypes.empty()) {
+            return;
+        }
+        ExecuteGetGameKeyMappings(supportDeviceTypes);
+    });
+}
+
 std::pair<bool, KeyMappingSupportConfig> KeyMappingService::GetKeyMappingSupportConfig(const std::string &bundleName)
 {
     std::pair<bool, KeyMappingSupportConfig> result;
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <window_input_intercept_client.h>
 #include "key_to_touch_handler.h"
@@ -30,7 +31,121 @@ const double ANGLE = 180.0;
 const int32_t TOUCH_RANGE = 10;
 const int32_t START_POINTER_ID = 3;
 const int64_t SEND_DURATION = 500000;
-static int32_t g_lastSendTime = 0;
+const int64_t ONE_MILLISECOND = 1000;
+const int64_t PERCENT = 100;
+
+/**
+ * The shortest interval of the mouse reports, which is 8000Hz.
+ */
+const int64_t MIN_MOUSE_REPORT_INTERVAL = 125;
+
+int32_t ScalePosition(int32_t value, double scale)
+{
+    return static_cast<int32_t>(std::lround(value * scale));
+}
+
+/**
+ * A positive length stays positive after scaling, because the handlers divide by the skill range and the steps.
+ */
+int32_t ScaleLength(int32_t value, double scale)
+{
+    if (value <= 0) {
+        return value;
+    }
+    return std::max(1, ScalePosition(value, scale));
+}
+
+/**
+ * The output of the curve for the input in (0, 1]. The table is linked by lines from (0, 0),
+ * and the inputs after the last point keep its scale.
+ */
+double EvaluateResponseCurve(const ResponseCurve &curve, double input)
+{
+    if (curve.type == RESPONSE_CURVE_POWER) {
+        return std::pow(input, curve.exponent);
+    }
+    if (curve.type != RESPONSE_CURVE_TABLE || curve.points.empty()) {
+        return input;
+    }
+    ResponseCurvePoint lastPoint;
+    for (const auto &point: curve.points) {
+        if (input <= point.input) {
+            return lastPoint.output +
+                (point.output - lastPoint.output) * (input - lastPoint.input) / (point.input - lastPoint.input);
+        }
+        lastPoint = point;
+    }
+    return lastPoint.output * input / lastPoint.input;
+}
+
+/**
+ * The mouse speed in counts per RESPONSE_CURVE_SPEED_INTERVAL. The first event after a pause only carries
+ * one report, so an interval longer than RESPONSE_CURVE_SPEED_INTERVAL or an unknown one is taken as it.
+ */
+int32_t ComputeMouseSpeed(int32_t delta, int64_t lastActionTime, int64_t actionTime)
+{
+    int64_t interval = RESPONSE_CURVE_SPEED_INTERVAL;
+    if (lastActionTime > 0) {
+        interval = std::clamp(actionTime - lastActionTime, MIN_MOUSE_REPORT_INTERVAL, RESPONSE_CURVE_SPEED_INTERVAL);
+    }
+    double speed = static_cast<double>(std::abs(delta)) * RESPONSE_CURVE_SPEED_INTERVAL / interval;
+    return static_cast<int32_t>(std::lround(std::min(speed, static_cast<double>(RESPONSE_CURVE_MAX_SPEED))));
+}
+
+/**
+ * Whether the key of the mapping is still pressed. Only the mappings that take the key up from their own
+ * operating state are checked. The combination key is released by currentCombinationKey.
+ */
+bool IsKeyMappingOperating(const InputToTouchContext &context, int32_t keyCode,
+                           const KeyToTouchMappingInfo &mappingInfo)
+{
+    switch (mappingInfo.mappingType) {
+        case SINGE_KEY_TO_TOUCH:
+            return context.currentSingleKeyMap.count(keyCode) != 0;
+        case COMBINATION_KEY_TO_TOUCH:
+            // Only the up event of the last key releases the combination.
+            return context.isCombinationKeyOperating &&
+                context.currentCombinationKey.combinationKeys.size() == MAX_COMBINATION_KEYS &&
+                context.currentCombinationKey.combinationKeys[COMBINATION_LAST_KEYCODE_IDX] == keyCode;
+        case DPAD_KEY_TO_TOUCH:
+            return context.isWalking && context.currentWalking.mappingType == DPAD_KEY_TO_TOUCH;
+        case KEY_BOARD_OBSERVATION_TO_TOUCH:
+            return context.isPerspectiveObserving &&
+                context.currentPerspectiveObserving.mappingType == KEY_BOARD_OBSERVATION_TO_TOUCH;
+        case OBSERVATION_KEY_TO_TOUCH:
+            return context.isPerspectiveObserving && context.currentPerspectiveObserving.keyCode == keyCode &&
+                context.currentPerspectiveObserving.mappingType == OBSERVATION_KEY_TO_TOUCH;
+        case SKILL_KEY_TO_TOUCH:
+            return context.isSkillOperating && context.currentSkillKeyInfo.keyCode == keyCode;
+        case CROSSHAIR_KEY_TO_TOUCH:
+            return context.isCrosshairMode && context.currentCrosshairInfo.keyCode == keyCode;
+        default:
+            return false;
+    }
+}
+
+bool IsGamePadAxisMapping(MappingTypeEnum mappingType)
+{
+    return mappingType == GAMEPAD_STICK_TO_TOUCH || mappingType == GAMEPAD_STICK_OBSERVATION_TO_TOUCH ||
+        mappingType == GAMEPAD_TRIGGER_TO_TOUCH;
+}
+
+bool IsMouseBtnMappingOperating(const InputToTouchContext &context, const KeyToTouchMappingInfo &mappingInfo)
+{
+    switch (mappingInfo.mappingType) {
+        case MOUSE_RIGHT_KEY_WALKING_TO_TOUCH:
+            return context.IsMouseRightWalking();
+        case MOUSE_OBSERVATION_TO_TOUCH:
+            return context.isPerspectiveObserving &&
+                context.currentPerspectiveObserving.mappingType == MOUSE_OBSERVATION_TO_TOUCH;
+        case MOUSE_RIGHT_KEY_CLICK_TO_TOUCH:
+            return context.isMouseRightClickOperating;
+        case MOUSE_LEFT_FIRE_TO_TOUCH:
+            return context.isMouseLeftFireOperating;
+        default:
+            return false;
+    }
+}
 }
 
 void BaseKeyToTouchHandler::BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context,
@@ -53,10 +168,6 @@ void BaseKeyToTouchHandler::BuildAndSendPointerEvent(std::shared_ptr<InputToTouc
         context->pointerItems[touchEntity.pointerId] = pointerItem;
     }
 
-    for (auto &pointerPair: context->pointerItems) {
-        pointerEvent->AddPointerItem(pointerPair.second);
-    }
-
     pointerEvent->SetPointerAction(touchEntity.pointerAction);
     context->SendPointerEvent(pointerEvent, pointerItem);
 }
@@ -121,6 +232,76 @@ TouchEntity BaseKeyToTouchHandler::BuildMoveTouchEntity(const int32_t touchPoint
     return touchEntity;
 }
 
+void BaseKeyToTouchHandler::StartRapidFire(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode,
+                                           const KeyToTouchMappingInfo &mappingInfo, int32_t pointerId,
+                                           int64_t startTime)
+{
+    if (mappingInfo.tapInterval <= 0) {
+        return;
+    }
+    context->StopRapidFire(keyCode);
+    int64_t interval = static_cast<int64_t>(mappingInfo.tapInterval) * ONE_MILLISECOND;
+    int32_t dutyCycle = mappingInfo.tapDutyCycle == 0 ? DEFAULT_TAP_DUTY_CYCLE : mappingInfo.tapDutyCycle;
+    RapidFireEntity &entity = context->rapidFires[keyCode];
+    entity.mappingInfo = mappingInfo;
+    entity.pointerId = pointerId;
+    entity.sequence = ++context->rapidFireSequence;
+    entity.scheduler.Start(startTime, interval, interval * dutyCycle / PERCENT);
+    HILOGI_LIMIT("start rapid fire of [%{public}d], interval [%{public}d]ms, duty cycle [%{public}d]%%",
+                 keyCode, mappingInfo.tapInterval, dutyCycle);
+    ScheduleRapidFireTick(context, keyCode);
+}
+
+bool BaseKeyToTouchHandler::StopRapidFire(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode)
+{
+    auto iter = context->rapidFires.find(keyCode);
+    if (iter == context->rapidFires.end()) {
+        return true;
+    }
+    bool isPressed = iter->second.scheduler.IsPressed();
+    context->StopRapidFire(keyCode);
+    return isPressed;
+}
+
+void BaseKeyToTouchHandler::RunRapidFireTick(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode,
+                                             uint64_t sequence, int64_t currentTime)
+{
+    auto iter = context->rapidFires.find(keyCode);
+    if (iter == context->rapidFires.end() || iter->second.sequence != sequence) {
+        return;
+    }
+    RapidFireEntity &entity = iter->second;
+    RapidFireActionEnum action = entity.scheduler.OnTick(currentTime);
+    if (action == RAPID_FIRE_PRESS) {
+        BuildAndSendPointerEvent(context, BuildTouchEntity(entity.mappingInfo, entity.pointerId,
+                                                           PointerEvent::POINTER_ACTION_DOWN, currentTime));
+    } else if (action == RAPID_FIRE_RELEASE) {
+        BuildAndSendPointerEvent(context, BuildTouchEntity(entity.mappingInfo, entity.pointerId,
+                                                           PointerEvent::POINTER_ACTION_UP, currentTime));
+    }
+    ScheduleRapidFireTick(context, keyCode);
+}
+
+void BaseKeyToTouchHandler::ScheduleRapidFireTick(std::shared_ptr<InputToTouchContext> &context, int32_t keyCode)
+{
+    auto iter = context->rapidFires.find(keyCode);
+    if (context->handleQueue == nullptr || iter == context->rapidFires.end()) {
+        return;
+    }
+    RapidFireEntity &entity = iter->second;
+    // The delay is computed from the deadline, so a tick that runs late doesn't delay the next one.
+    int64_t delay = std::max(entity.scheduler.GetNextDeadline() - StringUtils::GetSysClockTime(),
+                             static_cast<int64_t>(0));
+    std::weak_ptr<InputToTouchContext> weakContext = context;
+    uint64_t sequence = entity.sequence;
+    entity.taskHandle = context->handleQueue->submit_h([this, weakContext, keyCode, sequence] {
+        std::shared_ptr<InputToTouchContext> context = weakContext.lock();
+        if (context != nullptr) {
+            RunRapidFireTick(context, keyCode, sequence, StringUtils::GetSysClockTime());
+        }
+    }, ffrt::task_attr().name("rapid-fire-task").delay(static_cast<uint64_t>(delay)));
+}
+
 double BaseKeyToTouchHandler::CalculateAngle(const Point &centerPoint, const Point &targetPoint)
 {
     double dx = targetPoint.x - centerPoint.x;
@@ -153,29 +334,112 @@ void BaseKeyToTouchHandler::ComputeTouchPointByMouseMoveEvent(std::shared_ptr<In
         return;
     }
     if (context->pointerItems.find(touchPointId) == context->pointerItems.end()) {
-        HILOGW("discard mouse move event, because cannot find the last move event");
+        HILOGW_LIMIT("discard mouse move event, because cannot find the last move event");
         return;
     }
 
     PointerEvent::PointerItem lastMovePoint = context->pointerItems[touchPointId];
+    TouchMotionPredictor &predictor = context->motionPredictor;
+    if (predictor.IsEnabled()) {
+        MotionSample lastSample;
+        if (predictor.IsInjectedPoint(lastMovePoint.GetWindowX(), lastMovePoint.GetWindowY()) &&
+            predictor.GetLastSample(lastSample)) {
+            // The move starts from the position computed from the mouse, not from the predicted one.
+            lastMovePoint.SetWindowX(static_cast<int32_t>(lastSample.x));
+            lastMovePoint.SetWindowY(static_cast<int32_t>(lastSample.y));
+        } else {
+            predictor.Reset();
+        }
+    }
 
     // Get current mouse pointer
     PointerEvent::PointerItem currentPointItem;
     pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), currentPointItem);
 
     Point targetPoint{};
-    targetPoint.x = ComputeMovePositionForX(context, currentPointItem, lastMovePoint, mappingInfo);
-    targetPoint.y = ComputeMovePositionForY(context, currentPointItem, lastMovePoint, mappingInfo);
     int64_t actionTime = pointerEvent->GetActionTime();
-    TouchEntity touchEntity = BuildMoveTouchEntity(touchPointId, targetPoint, actionTime);
+    targetPoint.x = ComputeMovePositionForX(context, currentPointItem, lastMovePoint, mappingInfo, actionTime);
+    targetPoint.y = ComputeMovePositionForY(context, currentPointItem, lastMovePoint, mappingInfo, actionTime);
+    TouchEntity touchEntity = BuildMoveTouchEntity(touchPointId, PredictTouchPoint(context, targetPoint, actionTime),
+                                                   actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
     context->lastMousePointer = currentPointItem;
+    context->lastMouseActionTime = actionTime;
+    if (predictor.IsEnabled()) {
+        predictor.SetInjectedPoint(touchEntity.xValue, touchEntity.yValue);
+        predictor.UpdateLatency(StringUtils::GetSysClockTime() - actionTime);
+        context->motionSettlePointerId = touchPointId;
+        ScheduleMotionSettle(context, TouchMotionPredictor::MAX_SAMPLE_GAP);
+    }
+}
+
+void BaseKeyToTouchHandler::ScheduleMotionSettle(std::shared_ptr<InputToTouchContext> &context, int64_t delay)
+{
+    // One pending task is enough, it's scheduled again if the mouse is still moving when it runs.
+    if (context->handleQueue == nullptr || context->isMotionSettlePending) {
+        return;
+    }
+    context->isMotionSettlePending = true;
+    std::weak_ptr<InputToTouchContext> weakContext = context;
+    context->handleQueue->submit([this, weakContext] {
+        std::shared_ptr<InputToTouchContext> context = weakContext.lock();
+        if (context != nullptr) {
+            RunMotionSettle(context, StringUtils::GetSysClockTime());
+        }
+    }, ffrt::task_attr().name("motion-settle-task").delay(static_cast<uint64_t>(delay)));
+}
+
+void BaseKeyToTouchHandler::RunMotionSettle(std::shared_ptr<InputToTouchContext> &context, int64_t currentTime)
+{
+    context->isMotionSettlePending = false;
+    TouchMotionPredictor &predictor = context->motionPredictor;
+    MotionSample lastSample;
+    auto iter = context->pointerItems.find(context->motionSettlePointerId);
+    if (!predictor.IsEnabled() || !predictor.GetLastSample(lastSample) || iter == context->pointerItems.end() ||
+        !predictor.IsInjectedPoint(iter->second.GetWindowX(), iter->second.GetWindowY())) {
+        // The touch is released or moved by others.
+        return;
+    }
+    int64_t idleTime = std::max(currentTime - lastSample.time, static_cast<int64_t>(0));
+    if (idleTime < TouchMotionPredictor::MAX_SAMPLE_GAP) {
+        ScheduleMotionSettle(context, TouchMotionPredictor::MAX_SAMPLE_GAP - idleTime);
+        return;
+    }
+    int32_t x = static_cast<int32_t>(std::lround(lastSample.x));
+    int32_t y = static_cast<int32_t>(std::lround(lastSample.y));
+    if (predictor.IsInjectedPoint(x, y)) {
+        return;
+    }
+    Point settlePoint{};
+    settlePoint.x = x;
+    settlePoint.y = y;
+    BuildAndSendPointerEvent(context, BuildMoveTouchEntity(context->motionSettlePointerId, settlePoint, currentTime));
+    predictor.SetInjectedPoint(x, y);
+}
+
+Point BaseKeyToTouchHandler::PredictTouchPoint(std::shared_ptr<InputToTouchContext> &context,
+                                               const Point &targetPoint, int64_t actionTime)
+{
+    TouchMotionPredictor &predictor = context->motionPredictor;
+    if (!predictor.IsEnabled()) {
+        return targetPoint;
+    }
+    predictor.AddSample(targetPoint.x, targetPoint.y, actionTime);
+    Point touchPoint = targetPoint;
+    if (!predictor.Predict(touchPoint.x, touchPoint.y)) {
+        return targetPoint;
+    }
+    touchPoint.x = std::clamp(std::round(touchPoint.x), static_cast<double>(MIN_EDGE),
+                              static_cast<double>(context->windowInfoEntity.maxWidth));
+    touchPoint.y = std::clamp(std::round(touchPoint.y), static_cast<double>(MIN_EDGE),
+                              static_cast<double>(context->windowInfoEntity.maxHeight));
+    return touchPoint;
 }
 
 int32_t BaseKeyToTouchHandler::ComputeMovePositionForX(std::shared_ptr<InputToTouchContext> &context,
                                                        const PointerEvent::PointerItem &currentPointItem,
                                                        const PointerEvent::PointerItem &lastMovePoint,
-                                                       const KeyToTouchMappingInfo &mappingInfo)
+                                                       const KeyToTouchMappingInfo &mappingInfo, int64_t actionTime)
 {
     MouseMoveReq mouseMoveReqForX{};
     mouseMoveReqForX.currentMousePosition = currentPointItem.GetWindowX();
@@ -184,13 +448,16 @@ int32_t BaseKeyToTouchHandler::ComputeMovePositionForX(std::shared_ptr<InputToTo
     mouseMoveReqForX.maxEdge = context->windowInfoEntity.maxWidth;
     mouseMoveReqForX.step = mappingInfo.xStep;
     mouseMoveReqForX.mappingType = mappingInfo.mappingType;
-    return ComputeMovePosition(mouseMoveReqForX);
+    mouseMoveReqForX.gain = context->responseCurveTable.GetGain(ComputeMouseSpeed(
+        mouseMoveReqForX.currentMousePosition - mouseMoveReqForX.lastMousePosition, context->lastMouseActionTime,
+        actionTime));
+    return ComputeMovePosition(mouseMoveReqForX, context->xMoveRemainder);
 }
 
 int32_t BaseKeyToTouchHandler::ComputeMovePositionForY(std::shared_ptr<InputToTouchContext> &context,
                                                        const PointerEvent::PointerItem &currentPointItem,
                                                        const PointerEvent::PointerItem &lastMovePoint,
-                                                       const KeyToTouchMappingInfo &mappingInfo)
+                                                       const KeyToTouchMappingInfo &mappingInfo, int64_t actionTime)
 {
     MouseMoveReq mouseMoveReqForY{};
     mouseMoveReqForY.currentMousePosition = currentPointItem.GetWindowY();
@@ -199,23 +466,37 @@ int32_t BaseKeyToTouchHandler::ComputeMovePositionForY(std::shared_ptr<InputToTo
     mouseMoveReqForY.maxEdge = context->windowInfoEntity.maxHeight;
     mouseMoveReqForY.step = mappingInfo.yStep;
     mouseMoveReqForY.mappingType = mappingInfo.mappingType;
-    return ComputeMovePosition(mouseMoveReqForY);
+    mouseMoveReqForY.gain = context->responseCurveTable.GetGain(ComputeMouseSpeed(
+        mouseMoveReqForY.currentMousePosition - mouseMoveReqForY.lastMousePosition, context->lastMouseActionTime,
+        actionTime));
+    return ComputeMovePosition(mouseMoveReqForY, context->yMoveRemainder);
 }
 
-int32_t BaseKeyToTouchHandler::ComputeMovePosition(MouseMoveReq mouseMoveReq)
+int32_t BaseKeyToTouchHandler::ComputeMovePosition(MouseMoveReq mouseMoveReq, double &remainder)
 {
     int32_t result;
     int32_t step = mouseMoveReq.step;
-    if (mouseMoveReq.currentMousePosition > mouseMoveReq.lastMousePosition) {
+    if (mouseMoveReq.currentMousePosition != mouseMoveReq.lastMousePosition) {
+        int32_t delta = mouseMoveReq.currentMousePosition - mouseMoveReq.lastMousePosition;
         if (mouseMoveReq.mappingType == MappingTypeEnum::CROSSHAIR_KEY_TO_TOUCH) {
-            step = std::min(step, mouseMoveReq.currentMousePosition - mouseMoveReq.lastMousePosition);
+            step = std::min(step, std::abs(delta));
         }
-        result = std::min(mouseMoveReq.lastMovePosition + step, mouseMoveReq.maxEdge);
-    } else if (mouseMoveReq.currentMousePosition < mouseMoveReq.lastMousePosition) {
-        if (mouseMoveReq.mappingType == MappingTypeEnum::CROSSHAIR_KEY_TO_TOUCH) {
-            step = std::min(step, mouseMoveReq.lastMousePosition - mouseMoveReq.currentMousePosition);
+        // The fraction is kept for the next move in the same direction, so the slow moves are not lost.
+        double distance = step * mouseMoveReq.gain;
+        if ((delta > 0) != (remainder > 0)) {
+            remainder = 0.0;
+        }
+        distance = (delta > 0 ? distance : -distance) + remainder;
+        double pixels = std::trunc(distance);
+        remainder = distance - pixels;
+        result = mouseMoveReq.lastMovePosition + static_cast<int32_t>(pixels);
+        if (delta > 0 && result >= mouseMoveReq.maxEdge) {
+            result = mouseMoveReq.maxEdge;
+            remainder = 0.0;
+        } else if (delta < 0 && result <= MIN_EDGE) {
+            result = MIN_EDGE;
+            remainder = 0.0;
         }
-        result = std::max(mouseMoveReq.lastMovePosition - step, MIN_EDGE);
     } else {
         if (mouseMoveReq.currentMousePosition > MIN_EDGE &&
             mouseMoveReq.currentMousePosition < (mouseMoveReq.maxEdge - MIN_EDGE)) {
@@ -266,26 +547,17 @@ bool BaseKeyToTouchHandler::IsMouseMoveEvent(const std::shared_ptr<MMI::PointerE
     return pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_MOVE;
 }
 
-std::vector<DpadKeyItem> BaseKeyToTouchHandler::CollectValidDpadKeys(
-    const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-    const DeviceInfo &deviceInfo,
-    const KeyToTouchMappingInfo &mapping)
+std::vector<DpadKeyItem> BaseKeyToTouchHandler::CollectValidDpadKeys(const KeyInputSample &sample,
+                                                                    const KeyToTouchMappingInfo &mapping)
 {
-    std::vector<KeyEvent::KeyItem> keyItems = keyEvent->GetKeyItems();
     std::vector<DpadKeyItem> dpadKeys;
-    int32_t deviceId = keyEvent->GetDeviceId();
-    for (const auto &keyItem: keyItems) {
-        if (!keyItem.IsPressed() || keyItem.GetDeviceId() != deviceId ||
-            keyItem.GetDownTime() < deviceInfo.onlineTime) {
-            continue;
-        }
-        DpadKeyTypeEnum type = GetDpadKeyType(keyItem.GetKeyCode(), mapping);
+    for (int32_t idx = 0; idx < sample.pressedKeyCount; idx++) {
+        DpadKeyTypeEnum type = GetDpadKeyType(sample.pressedKeys[idx].keyCode, mapping);
         if (type == DPAD_KEYTYPE_UNKNOWN) {
             continue;
         }
-        dpadKeys.push_back(DpadKeyItem(keyItem, type));
+        dpadKeys.push_back(DpadKeyItem(sample.pressedKeys[idx], type));
     }
-    SortDpadKeys(dpadKeys);
     return dpadKeys;
 }
 
@@ -305,15 +577,6 @@ DpadKeyTypeEnum BaseKeyToTouchHandler::GetDpadKeyType(const int32_t keyCode, con
     }
 }
 
-void BaseKeyToTouchHandler::SortDpadKeys(std::vector<DpadKeyItem> &dpadKeys)
-{
-    //Sort in ascending order by downTime.
-    std::sort(dpadKeys.begin(), dpadKeys.end(),
-              [](const DpadKeyItem &a, const DpadKeyItem &b) {
-                  return a.downTime < b.downTime;
-              });
-}
-
 bool BaseKeyToTouchHandler::IsKeyUpEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
 {
     /**
@@ -324,12 +587,368 @@ bool BaseKeyToTouchHandler::IsKeyUpEvent(const std::shared_ptr<MMI::KeyEvent> &k
         keyEvent->GetKeyAction() == KeyEvent::KEY_ACTION_CANCEL;
 }
 
+bool BaseKeyToTouchHandler::IsGamePadAxisEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
+{
+    if (pointerEvent->GetSourceType() != PointerEvent::SOURCE_TYPE_JOYSTICK) {
+        return false;
+    }
+    int32_t action = pointerEvent->GetPointerAction();
+    return action == PointerEvent::POINTER_ACTION_AXIS_BEGIN || action == PointerEvent::POINTER_ACTION_AXIS_UPDATE ||
+        action == PointerEvent::POINTER_ACTION_AXIS_END;
+}
+
+bool BaseKeyToTouchHandler::GetGamePadAxisTypes(int32_t axisSource, PointerEvent::AxisType &xAxis,
+                                                PointerEvent::AxisType &yAxis)
+{
+    yAxis = PointerEvent::AxisType::AXIS_TYPE_UNKNOWN;
+    switch (axisSource) {
+        case GamePadAxisSourceTypeEnum::LeftThumbstick:
+            xAxis = PointerEvent::AxisType::AXIS_TYPE_ABS_X;
+            yAxis = PointerEvent::AxisType::AXIS_TYPE_ABS_Y;
+            return true;
+        case GamePadAxisSourceTypeEnum::RightThumbstick:
+            xAxis = PointerEvent::AxisType::AXIS_TYPE_ABS_Z;
+            yAxis = PointerEvent::AxisType::AXIS_TYPE_ABS_RZ;
+            return true;
+        case GamePadAxisSourceTypeEnum::LeftTriggerAxis:
+            xAxis = PointerEvent::AxisType::AXIS_TYPE_ABS_BRAKE;
+            return true;
+        case GamePadAxisSourceTypeEnum::RightTriggerAxis:
+            xAxis = PointerEvent::AxisType::AXIS_TYPE_ABS_GAS;
+            return true;
+        default:
+            xAxis = PointerEvent::AxisType::AXIS_TYPE_UNKNOWN;
+            return false;
+    }
+}
+
+bool BaseKeyToTouchHandler::HasGamePadAxis(const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                           int32_t axisSource)
+{
+    PointerEvent::AxisType xAxis;
+    PointerEvent::AxisType yAxis;
+    if (!GetGamePadAxisTypes(axisSource, xAxis, yAxis)) {
+        return false;
+    }
+    return pointerEvent->HasAxis(xAxis) ||
+        (yAxis != PointerEvent::AxisType::AXIS_TYPE_UNKNOWN && pointerEvent->HasAxis(yAxis));
+}
+
+double BaseKeyToTouchHandler::GetGamePadAxisValue(std::shared_ptr<InputToTouchContext> &context,
+                                                  const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                                  PointerEvent::AxisType axisType)
+{
+    if (pointerEvent->HasAxis(axisType)) {
+        double value = pointerEvent->GetAxisValue(axisType);
+        context->gamePadAxisValues[axisType] = value;
+        return value;
+    }
+    auto iter = context->gamePadAxisValues.find(axisType);
+    return iter == context->gamePadAxisValues.end() ? 0.0 : iter->second;
+}
+
+const AxisResponseTable &BaseKeyToTouchHandler::GetAxisResponseTable(std::shared_ptr<InputToTouchContext> &context,
+                                                                     int32_t axisSource)
+{
+    static const AxisResponseTable EMPTY_TABLE;
+    auto entityIter = context->gamePadAxes.find(axisSource);
+    if (entityIter != context->gamePadAxes.end()) {
+        return entityIter->second.responseTable;
+    }
+    auto iter = context->axisResponseTables.find(axisSource);
+    return iter == context->axisResponseTables.end() ? EMPTY_TABLE : iter->second;
+}
+
+void BaseKeyToTouchHandler::ReleaseGamePadAxis(std::shared_ptr<InputToTouchContext> &context, int32_t axisSource,
+                                               int64_t actionTime)
+{
+    std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + axisSource);
+    if (pair.first && context->pointerItems.find(pair.second) != context->pointerItems.end()) {
+        TouchEntity touchEntity = BuildTouchUpEntity(context->pointerItems[pair.second], pair.second,
+                                                     PointerEvent::POINTER_ACTION_UP, actionTime);
+        BuildAndSendPointerEvent(context, touchEntity);
+    }
+    context->ResetCurrentGamePadAxis(axisSource);
+}
+
+TemplateTransform::TemplateTransform(const TemplateResolution &resolution, const WindowInfoEntity &windowInfo)
+{
+    if (!resolution.IsValid() || windowInfo.currentWidth <= 0 || windowInfo.currentHeight <= 0) {
+        return;
+    }
+    if (resolution.width == windowInfo.currentWidth && resolution.height == windowInfo.currentHeight) {
+        return;
+    }
+    xScale = static_cast<double>(windowInfo.currentWidth) / resolution.width;
+    yScale = static_cast<double>(windowInfo.currentHeight) / resolution.height;
+    lengthScale = std::min(xScale, yScale);
+    isIdentity = false;
+}
+
+KeyToTouchMappingInfo TemplateTransform::Apply(const KeyToTouchMappingInfo &mappingInfo) const
+{
+    KeyToTouchMappingInfo result = mappingInfo;
+    if (isIdentity) {
+        return result;
+    }
+    result.xValue = ScalePosition(mappingInfo.xValue, xScale);
+    result.yValue = ScalePosition(mappingInfo.yValue, yScale);
+    result.xStep = ScaleLength(mappingInfo.xStep, xScale);
+    result.yStep = ScaleLength(mappingInfo.yStep, yScale);
+    result.radius = ScaleLength(mappingInfo.radius, lengthScale);
+    result.skillRange = ScaleLength(mappingInfo.skillRange, lengthScale);
+    return result;
+}
+
+ResponseCurveTable::ResponseCurveTable(const ResponseCurve &curve)
+{
+    if (curve.IsLinear() || !curve.CheckParamValid()) {
+        return;
+    }
+    isLinear = false;
+    gains.resize(RESPONSE_CURVE_MAX_SPEED + 1);
+    for (int32_t speed = 1; speed <= RESPONSE_CURVE_MAX_SPEED; speed++) {
+        double input = static_cast<double>(speed) / RESPONSE_CURVE_MAX_SPEED;
+        gains[speed] = EvaluateResponseCurve(curve, input) / input;
+    }
+    gains[0] = gains[1];
+}
+
+AxisResponseTable::AxisResponseTable(int32_t deadZonePercent, const ResponseCurve &curve)
+{
+    deadZone = static_cast<double>(deadZonePercent == 0 ? DEFAULT_AXIS_DEAD_ZONE : deadZonePercent) / PERCENT;
+    bool isLinear = curve.IsLinear() || !curve.CheckParamValid();
+    outputs.resize(AXIS_RESPONSE_TABLE_SIZE + 1);
+    for (int32_t idx = 1; idx <= AXIS_RESPONSE_TABLE_SIZE; idx++) {
+        double deflection = static_cast<double>(idx) / AXIS_RESPONSE_TABLE_SIZE;
+        if (deflection <= deadZone) {
+            continue;
+        }
+        double input = (deflection - deadZone) / (1.0 - deadZone);
+        outputs[idx] = std::clamp(isLinear ? input : EvaluateResponseCurve(curve, input), 0.0, 1.0);
+    }
+}
+
+double AxisResponseTable::GetOutput(double deflection) const
+{
+    deflection = std::abs(deflection);
+    if (outputs.empty() || std::isnan(deflection) || deflection <= deadZone) {
+        return 0.0;
+    }
+    if (deflection >= 1.0) {
+        return outputs[AXIS_RESPONSE_TABLE_SIZE];
+    }
+    double position = deflection * AXIS_RESPONSE_TABLE_SIZE;
+    size_t idx = static_cast<size_t>(position);
+    return outputs[idx] + (outputs[idx + 1] - outputs[idx]) * (position - idx);
+}
+
 InputToTouchContext::InputToTouchContext(const DeviceTypeEnum &type,
                                          const WindowInfoEntity &windowInfo,
-                                         const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+                                         const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                         const TemplateResolution &resolution,
+                                         const ResponseCurve &responseCurve)
 {
     deviceType = type;
     windowInfoEntity = windowInfo;
+    templateMappingInfos = mappingInfos;
+    templateResolution = resolution;
+    responseCurveTable = ResponseCurveTable(responseCurve);
+    for (const auto &mappingInfo: mappingInfos) {
+        if (IsGamePadAxisMapping(mappingInfo.mappingType)) {
+            axisResponseTables[mappingInfo.keyCode] = AxisResponseTable(mappingInfo.deadZone, responseCurve);
+        }
+    }
+    BuildKeyMappings(GetWindowMappingInfos());
+}
+
+bool InputToTouchContext::UpdateWindowInfo(const WindowInfoEntity &windowInfo)
+{
+    bool isResized = windowInfo.currentWidth != windowInfoEntity.currentWidth ||
+        windowInfo.currentHeight != windowInfoEntity.currentHeight;
+    windowInfoEntity = windowInfo;
+    if (!isResized || !templateResolution.IsValid()) {
+        return false;
+    }
+    singleKeyMappings.clear();
+    combinationKeyMappings.clear();
+    mouseBtnKeyMappings.clear();
+    axisKeyMappings.clear();
+    BuildKeyMappings(GetWindowMappingInfos());
+    return true;
+}
+
+void InputToTouchContext::HoldOperatingKeyMappings()
+{
+    // A key held across several swaps keeps its first mapping.
+    auto holdKeyMapping = [this](int32_t keyCode, const KeyToTouchMappingInfo &mappingInfo) {
+        if (heldKeyMappings.count(keyCode) == 0 && IsKeyMappingOperating(*this, keyCode, mappingInfo)) {
+            heldKeyMappings[keyCode] = mappingInfo;
+        }
+    };
+    auto holdDpadKeyMapping = [&holdKeyMapping](const KeyToTouchMappingInfo &mappingInfo) {
+        holdKeyMapping(mappingInfo.dpadKeyCodeEntity.up, mappingInfo);
+        holdKeyMapping(mappingInfo.dpadKeyCodeEntity.down, mappingInfo);
+        holdKeyMapping(mappingInfo.dpadKeyCodeEntity.left, mappingInfo);
+        holdKeyMapping(mappingInfo.dpadKeyCodeEntity.right, mappingInfo);
+    };
+    for (const auto &pair: currentSingleKeyMap) {
+        holdKeyMapping(pair.first, pair.second);
+    }
+    if (isCombinationKeyOperating && currentCombinationKey.combinationKeys.size() == MAX_COMBINATION_KEYS) {
+        holdKeyMapping(currentCombinationKey.combinationKeys[COMBINATION_LAST_KEYCODE_IDX], currentCombinationKey);
+    }
+    if (isWalking && currentWalking.mappingType == DPAD_KEY_TO_TOUCH) {
+        holdDpadKeyMapping(currentWalking);
+    }
+    if (isPerspectiveObserving && currentPerspectiveObserving.mappingType == KEY_BOARD_OBSERVATION_TO_TOUCH) {
+        holdDpadKeyMapping(currentPerspectiveObserving);
+    } else if (isPerspectiveObserving) {
+        holdKeyMapping(currentPerspectiveObserving.keyCode, currentPerspectiveObserving);
+    }
+    if (isSkillOperating) {
+        holdKeyMapping(currentSkillKeyInfo.keyCode, currentSkillKeyInfo);
+    }
+    if (isCrosshairMode) {
+        holdKeyMapping(currentCrosshairInfo.keyCode, currentCrosshairInfo);
+    }
+}
+
+void InputToTouchContext::SwapTemplate(InputToTouchContext &newContext)
+{
+    // Collect the pressed keys and buttons of the old template first.
+    HoldOperatingKeyMappings();
+    for (const auto &pair: mouseBtnKeyMappings) {
+        if (heldMouseBtnKeyMappings.count(pair.first) == 0 && IsMouseBtnMappingOperating(*this, pair.second)) {
+            heldMouseBtnKeyMappings[pair.first] = pair.second;
+        }
+    }
+
+    singleKeyMappings.swap(newContext.singleKeyMappings);
+    combinationKeyMappings.swap(newContext.combinationKeyMappings);
+    mouseBtnKeyMappings.swap(newContext.mouseBtnKeyMappings);
+    axisKeyMappings.swap(newContext.axisKeyMappings);
+    axisResponseTables.swap(newContext.axisResponseTables);
+    templateMappingInfos.swap(newContext.templateMappingInfos);
+    std::swap(templateResolution, newContext.templateResolution);
+    std::swap(responseCurveTable, newContext.responseCurveTable);
+    xMoveRemainder = 0.0;
+    yMoveRemainder = 0.0;
+    motionPredictor.Reset();
+    std::swap(isMonitorMouse, newContext.isMonitorMouse);
+
+    // The window may be resized after the new context was built.
+    bool isResized = newContext.windowInfoEntity.currentWidth != windowInfoEntity.currentWidth ||
+        newContext.windowInfoEntity.currentHeight != windowInfoEntity.currentHeight;
+    if (isResized && templateResolution.IsValid()) {
+        singleKeyMappings.clear();
+        combinationKeyMappings.clear();
+        mouseBtnKeyMappings.clear();
+        axisKeyMappings.clear();
+        BuildKeyMappings(GetWindowMappingInfos());
+    }
+    HILOGI("template is swapped. held keys [%{public}zu], held mouse buttons [%{public}zu], held axes [%{public}zu]",
+           heldKeyMappings.size(), heldMouseBtnKeyMappings.size(), gamePadAxes.size());
+}
+
+bool InputToTouchContext::FindHeldKeyMapping(int32_t keyCode, KeyToTouchMappingInfo &mappingInfo) const
+{
+    if (heldKeyMappings.empty()) {
+        return false;
+    }
+    auto iter = heldKeyMappings.find(keyCode);
+    if (iter == heldKeyMappings.end() || !IsKeyMappingOperating(*this, keyCode, iter->second)) {
+        return false;
+    }
+    mappingInfo = iter->second;
+    return true;
+}
+
+bool InputToTouchContext::FindMouseBtnKeyMapping(int32_t keyCode, KeyToTouchMappingInfo &mappingInfo) const
+{
+    auto iter = heldMouseBtnKeyMappings.find(keyCode);
+    if (iter != heldMouseBtnKeyMappings.end() && IsMouseBtnMappingOperating(*this, iter->second)) {
+        mappingInfo = iter->second;
+        return true;
+    }
+    iter = mouseBtnKeyMappings.find(keyCode);
+    if (iter != mouseBtnKeyMappings.end()) {
+        mappingInfo = iter->second;
+        return true;
+    }
+    return false;
+}
+
+bool InputToTouchContext::PruneHeldKeyMappings()
+{
+    size_t heldSize = heldKeyMappings.size() + heldMouseBtnKeyMappings.size();
+    for (auto iter = heldKeyMappings.begin(); iter != heldKeyMappings.end();) {
+        if (IsKeyMappingOperating(*this, iter->first, iter->second)) {
+            ++iter;
+        } else {
+            iter = heldKeyMappings.erase(iter);
+        }
+    }
+    for (auto iter = heldMouseBtnKeyMappings.begin(); iter != heldMouseBtnKeyMappings.end();) {
+        if (IsMouseBtnMappingOperating(*this, iter->second)) {
+            ++iter;
+        } else {
+            iter = heldMouseBtnKeyMappings.erase(iter);
+        }
+    }
+    return heldKeyMappings.size() + heldMouseBtnKeyMappings.size() != heldSize;
+}
+
+bool InputToTouchContext::IsHeldMonitorMouse() const
+{
+    if (!heldMouseBtnKeyMappings.empty()) {
+        return true;
+    }
+    for (const auto &pair: heldKeyMappings) {
+        if (pair.second.mappingType == SKILL_KEY_TO_TOUCH || pair.second.mappingType == CROSSHAIR_KEY_TO_TOUCH ||
+            pair.second.mappingType == OBSERVATION_KEY_TO_TOUCH) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InputToTouchContext::FindAxisKeyMapping(int32_t axisSource, KeyToTouchMappingInfo &mappingInfo) const
+{
+    auto entityIter = gamePadAxes.find(axisSource);
+    if (entityIter != gamePadAxes.end()) {
+        mappingInfo = entityIter->second.mappingInfo;
+        return true;
+    }
+    auto iter = axisKeyMappings.find(axisSource);
+    if (iter != axisKeyMappings.end()) {
+        mappingInfo = iter->second;
+        return true;
+    }
+    return false;
+}
+
+bool InputToTouchContext::IsMonitorGamePadAxis() const
+{
+    return !axisKeyMappings.empty() || !gamePadAxes.empty();
+}
+
+std::vector<KeyToTouchMappingInfo> InputToTouchContext::GetWindowMappingInfos() const
+{
+    TemplateTransform transform(templateResolution, windowInfoEntity);
+    if (transform.isIdentity) {
+        return templateMappingInfos;
+    }
+    std::vector<KeyToTouchMappingInfo> result;
+    result.reserve(templateMappingInfos.size());
+    for (const auto &mappingInfo: templateMappingInfos) {
+        result.push_back(transform.Apply(mappingInfo));
+    }
+    return result;
+}
+
+void InputToTouchContext::BuildKeyMappings(const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+{
     int32_t lastKeyCode;
     int32_t firstKeyCode;
     for (const auto &mappingInfo: mappingInfos) {
@@ -364,6 +983,8 @@ InputToTouchContext::InputToTouchContext(const DeviceTypeEnum &type,
             isMonitorMouse = true;
         } else if (mappingInfo.mappingType == SINGE_KEY_TO_TOUCH) {
             singleKeyMappings[mappingInfo.keyCode] = mappingInfo;
+        } else if (IsGamePadAxisMapping(mappingInfo.mappingType)) {
+            axisKeyMappings[mappingInfo.keyCode] = mappingInfo;
         } else {
             HILOGW("unknown mappingType[%{public}d]", static_cast<int32_t>(mappingInfo.mappingType));
         }
@@ -406,6 +1027,7 @@ void InputToTouchContext::ResetCurrentObserving()
     currentPerspectiveObserving = KeyToTouchMappingInfo();
     isPerspectiveObserving = false;
     lastMousePointer = PointerEvent::PointerItem();
+    lastMouseActionTime = 0;
     ReleasePointerId(KEY_CODE_OBSERVATION);
 }
 
@@ -415,6 +1037,7 @@ void InputToTouchContext::ResetCurrentCrosshairInfo()
     isEnterCrosshairInfo = false;
     isCrosshairMode = false;
     lastMousePointer = PointerEvent::PointerItem();
+    lastMouseActionTime = 0;
     ReleasePointerId(KEY_CODE_CROSSHAIR);
 }
 
@@ -425,7 +1048,7 @@ void InputToTouchContext::ResetCurrentWalking()
     ReleasePointerId(KEY_CODE_WALK);
 }
 
-bool InputToTouchContext::IsMouseRightWalking()
+bool InputToTouchContext::IsMouseRightWalking() const
 {
     return isWalking && currentWalking.mappingType == MOUSE_RIGHT_KEY_WALKING_TO_TOUCH;
 }
@@ -436,8 +1059,59 @@ void InputToTouchContext::ResetCurrentMouseRightClick()
     ReleasePointerId(KEY_CODE_MOUSE_RIGHT);
 }
 
+void InputToTouchContext::StopRapidFire(int32_t keyCode)
+{
+    auto iter = rapidFires.find(keyCode);
+    if (iter == rapidFires.end()) {
+        return;
+    }
+    if (handleQueue != nullptr) {
+        handleQueue->cancel(iter->second.taskHandle);
+    }
+    const RapidFireStats &stats = iter->second.scheduler.GetStats();
+    HILOGI_LIMIT("stop rapid fire of [%{public}d]. ticks [%{public}u], mean jitter [%{public}lld]us, "
+                 "max jitter [%{public}lld]us, skipped taps [%{public}u]", keyCode, stats.tickCount,
+                 static_cast<long long>(stats.GetMeanJitter()), static_cast<long long>(stats.maxJitter),
+                 stats.skippedTapCount);
+    rapidFireStats.Merge(stats);
+    rapidFires.erase(iter);
+}
+
+GamePadAxisEntity &InputToTouchContext::SetCurrentGamePadAxis(const KeyToTouchMappingInfo &mappingInfo,
+                                                              const int32_t pointerId)
+{
+    GamePadAxisEntity &entity = gamePadAxes[mappingInfo.keyCode];
+    auto iter = axisResponseTables.find(mappingInfo.keyCode);
+    entity.responseTable = iter == axisResponseTables.end() ? AxisResponseTable() : iter->second;
+    entity.mappingInfo = mappingInfo;
+    entity.pointerId = pointerId;
+    entity.sequence = ++gamePadAxisSequence;
+    pointerIdWithKeyCodeMap[KEY_CODE_GAMEPAD_AXIS + mappingInfo.keyCode] = pointerId;
+    return entity;
+}
+
+void InputToTouchContext::ResetCurrentGamePadAxis(int32_t axisSource)
+{
+    auto iter = gamePadAxes.find(axisSource);
+    if (iter == gamePadAxes.end()) {
+        return;
+    }
+    if (handleQueue != nullptr && iter->second.taskHandle != nullptr) {
+        handleQueue->cancel(iter->second.taskHandle);
+    }
+    gamePadAxes.erase(iter);
+    ReleasePointerId(KEY_CODE_GAMEPAD_AXIS + axisSource);
+}
+
 void InputToTouchContext::ResetTempVariables()
 {
+    while (!rapidFires.empty()) {
+        StopRapidFire(rapidFires.begin()->first);
+    }
+    while (!gamePadAxes.empty()) {
+        ResetCurrentGamePadAxis(gamePadAxes.begin()->first);
+    }
+    gamePadAxisValues.clear();
     currentSingleKeyMap.clear();
     for (const auto &pointerIdWithKeyCode: pointerIdWithKeyCodeMap) {
         DelayedSingleton<PointerManager>::GetInstance()->ReleasePointerId(pointerIdWithKeyCode.second);
@@ -451,6 +1125,8 @@ void InputToTouchContext::ResetTempVariables()
     ResetCurrentWalking();
     ResetCurrentMouseRightClick();
     ResetCurrentMouseLeftClick();
+    heldKeyMappings.clear();
+    heldMouseBtnKeyMappings.clear();
 }
 
 std::pair<bool, int32_t> InputToTouchContext::GetPointerIdByKeyCode(const int32_t keyCode)
@@ -484,6 +1160,9 @@ void InputToTouchContext::SetCurrentCrosshairInfo(const KeyToTouchMappingInfo &m
     isCrosshairMode = true;
     isEnterCrosshairInfo = false;
     currentCrosshairInfo = mappingInfo;
+    xMoveRemainder = 0.0;
+    yMoveRemainder = 0.0;
+    motionPredictor.Reset();
     pointerIdWithKeyCodeMap[KEY_CODE_CROSSHAIR] = pointerId;
 }
 
@@ -498,6 +1177,9 @@ void InputToTouchContext::SetCurrentObserving(const KeyToTouchMappingInfo &mappi
 {
     isPerspectiveObserving = true;
     currentPerspectiveObserving = mappingInfo;
+    xMoveRemainder = 0.0;
+    yMoveRemainder = 0.0;
+    motionPredictor.Reset();
     pointerIdWithKeyCodeMap[KEY_CODE_OBSERVATION] = pointerId;
 }
 
@@ -533,19 +1215,15 @@ void InputToTouchContext::SendPointerEvent(std::shared_ptr<MMI::PointerEvent> &p
                                            PointerEvent::PointerItem &pointerItem)
 {
     pointerItem.SetDownTime(StringUtils::GetSysClockTime());
-    pointerEvent->AddPointerItem(pointerItem);
     pointerEvent->SetDeviceId(DEVICE_ID);
     pointerEvent->SetActionTime(pointerItem.GetDownTime());
     pointerEvent->SetAgentWindowId(windowInfoEntity.windowId);
     pointerEvent->SetTargetWindowId(windowInfoEntity.windowId);
     pointerEvent->SetTargetDisplayId(windowInfoEntity.displayId);
     pointerEvent->SetId(GetEventId());
-    pointerEvent->SetPointerId(pointerItem.GetPointerId());
     pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
-    HILOGD("pointer is [%{public}s].", pointerEvent->ToString().c_str());
-    DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(windowInfoEntity.bundleName,
-                                                                           pointerEvent, true);
-    g_lastSendTime = pointerItem.GetDownTime();
+    DelayedSingleton<PointerManager>::GetInstance()->InjectPointerEvent(windowInfoEntity.bundleName,
+                                                                        pointerEvent, pointerItem);
 }
 
 int32_t InputToTouchContext::GetEventId()
@@ -558,7 +1236,8 @@ void InputToTouchContext::CheckPointerSendInterval()
     if (pointerItems.size() == 0) {
         return;
     }
-    if ((StringUtils::GetSysClockTime() - g_lastSendTime) <= SEND_DURATION) {
+    int64_t lastSendTime = DelayedSingleton<PointerManager>::GetInstance()->GetLastSendTime();
+    if ((StringUtils::GetSysClockTime() - lastSendTime) <= SEND_DURATION) {
         return;
     }
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
@@ -567,11 +1246,8 @@ void InputToTouchContext::CheckPointerSendInterval()
         return;
     }
 
-    PointerEvent::PointerItem pointerItem;
-    for (auto &pointerPair: pointerItems) {
-        pointerItem = pointerPair.second;
-        pointerEvent->AddPointerItem(pointerPair.second);
-    }
+    // The pointers of the other contexts are added when injecting
+    PointerEvent::PointerItem pointerItem = pointerItems.begin()->second;
     pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
     SendPointerEvent(pointerEvent, pointerItem);
 }
@@ -592,7 +1268,7 @@ int32_t PointerManager::ApplyPointerId()
         // Starting from 3, query an unused pointerId
         if (pointerIdCacheSet_.count(pointerId) == 0) {
             pointerIdCacheSet_.insert(pointerId);
-            HILOGI("ApplyPointerId [%{public}d]", pointerId);
+            HILOGD_LIMIT("ApplyPointerId [%{public}d]", pointerId);
             return pointerId;
         }
         pointerId++;
@@ -603,7 +1279,39 @@ void PointerManager::ReleasePointerId(const int32_t pointerId)
 {
     std::lock_guard<ffrt::mutex> lock(locker);
     pointerIdCacheSet_.erase(pointerId);
-    HILOGI("ReleasePointerId [%{public}d]", pointerId);
+    activePointerItems_.erase(pointerId);
+    HILOGD_LIMIT("ReleasePointerId [%{public}d]", pointerId);
+}
+
+void PointerManager::InjectPointerEvent(const std::string &bundleName,
+                                        std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                                        const PointerEvent::PointerItem &pointerItem)
+{
+    std::lock_guard<ffrt::mutex> lock(locker);
+    int32_t pointerId = pointerItem.GetPointerId();
+    if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_UP) {
+        activePointerItems_.erase(pointerId);
+    } else {
+        activePointerItems_[pointerId] = pointerItem;
+    }
+    for (const auto &pointerPair: activePointerItems_) {
+        if (pointerPair.first != pointerId) {
+            pointerEvent->AddPointerItem(pointerPair.second);
+        }
+    }
+    pointerEvent->AddPointerItem(pointerItem);
+    pointerEvent->SetPointerId(pointerId);
+    HILOGD_LIMIT("pointer is [%{public}s].", pointerEvent->ToString().c_str());
+
+    // Send under the lock, so the events of the contexts reach the callback queue in the same order as they're built
+    DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName, pointerEvent, true);
+    lastSendTime_ = pointerEvent->GetActionTime();
+}
+
+int64_t PointerManager::GetLastSendTime()
+{
+    std::lock_guard<ffrt::mutex> lock(locker);
+    return lastSendTime_;
 }
 }
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 
 #include <window_input_intercept_client.h>
 #include <input_manager.h>
+#include <syspara/parameters.h>
 #include "key_to_touch_manager.h"
 #include "multi_modal_input_mgt_service.h"
 #include "skill_key_to_touch_handler.h"
@@ -29,18 +30,53 @@
 #include "dpad_key_to_touch_handler.h"
 #include "mouse_right_key_walking_to_touch_handler.h"
 #include "mouse_right_key_click_to_touch_handler.h"
+#include "gamepad_stick_to_touch_handler.h"
+#include "gamepad_stick_observation_to_touch_handler.h"
+#include "gamepad_trigger_to_touch_handler.h"
 #include "plugin_callback_manager.h"
+#include "input_trace_recorder.h"
 
 namespace OHOS {
 namespace GameController {
 namespace {
 const int32_t DELAY_TIME_UNIT = 1000000;// 1s = 1000ms = 1000000μs
+
+/**
+ * The device classes that own a context. The mouse events are handled by the context of GAME_KEY_BOARD,
+ * because the mouse mappings are in the keyboard template.
+ */
+const DeviceTypeEnum CONTEXT_DEVICE_TYPES[] = {GAME_KEY_BOARD, HOVER_TOUCH_PAD, GAME_PAD};
+
+/**
+ * The axes of the game pad which can be mapped. The dpad is mapped by its keys.
+ */
+const GamePadAxisSourceTypeEnum GAME_PAD_AXIS_SOURCES[] = {
+    GamePadAxisSourceTypeEnum::LeftThumbstick, GamePadAxisSourceTypeEnum::RightThumbstick,
+    GamePadAxisSourceTypeEnum::LeftTriggerAxis, GamePadAxisSourceTypeEnum::RightTriggerAxis
+};
+const char* MOTION_PREDICTION_ENABLE_PARAM = "persist.gamecontroller.motion_prediction.enable";
+const char* MOTION_PREDICTION_EXTRA_HORIZON_PARAM = "persist.gamecontroller.motion_prediction.extra_horizon";
+const char* EVENT_MAX_BATCH_SIZE_PARAM = "persist.gamecontroller.key_to_touch.max_batch_size";
 }
 
 KeyToTouchManager::KeyToTouchManager()
 {
-    handleQueue_ = std::make_unique<ffrt::queue>("KeyToTouchHandleQueue",
-                                                 ffrt::queue_attr().qos(ffrt::qos_default));
+    handleQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(
+        KEY_TO_TOUCH_HANDLE_QUEUE_NAME);
+    // 0 or less means the default one
+    int32_t maxBatchSize = OHOS::system::GetIntParameter<int32_t>(EVENT_MAX_BATCH_SIZE_PARAM, 0);
+    for (const auto &deviceType: CONTEXT_DEVICE_TYPES) {
+        InputToTouchShard &shard = contextShards_[deviceType];
+        shard.deviceType = deviceType;
+        std::string queueName = GameControllerQueueRegistry::GetDeviceQueueName(KEY_TO_TOUCH_HANDLE_QUEUE_NAME,
+                                                                                deviceType);
+        shard.handleQueue = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(queueName);
+        shard.eventChannel = std::make_unique<KeyToTouchEventChannel>(
+            shard.handleQueue.get(), KEY_TO_TOUCH_EVENT_CHANNEL_CAPACITY, [this](const KeyToTouchEvent &event) {
+                HandleChannelEvent(event);
+            }, KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE);
+        shard.eventChannel->SetMaxBatchSize(static_cast<size_t>(std::max(maxBatchSize, 0)));
+    }
     mappingHandler_[MappingTypeEnum::SINGE_KEY_TO_TOUCH] = std::make_shared<SingleKeyToTouchHandler>();
     mappingHandler_[MappingTypeEnum::COMBINATION_KEY_TO_TOUCH] = std::make_shared<CombinationKeyToTouchHandler>();
     mappingHandler_[MappingTypeEnum::DPAD_KEY_TO_TOUCH] = std::make_shared<DpadKeyToTouchHandler>();
@@ -55,15 +91,34 @@ KeyToTouchManager::KeyToTouchManager()
     mappingHandler_[MappingTypeEnum::MOUSE_LEFT_FIRE_TO_TOUCH] = std::make_shared<MouseLeftFireToTouchHandler>();
     mappingHandler_[MappingTypeEnum::MOUSE_RIGHT_KEY_CLICK_TO_TOUCH]
         = std::make_shared<MouseRightKeyClickToTouchHandler>();
+    mappingHandler_[MappingTypeEnum::GAMEPAD_STICK_TO_TOUCH] = std::make_shared<GamePadStickToTouchHandler>();
+    mappingHandler_[MappingTypeEnum::GAMEPAD_STICK_OBSERVATION_TO_TOUCH] =
+        std::make_shared<GamePadStickObservationToTouchHandler>();
+    mappingHandler_[MappingTypeEnum::GAMEPAD_TRIGGER_TO_TOUCH] = std::make_shared<GamePadTriggerToTouchHandler>();
+    isMotionPredictionEnabled_ = OHOS::system::GetBoolParameter(MOTION_PREDICTION_ENABLE_PARAM, false);
+    motionPredictionExtraHorizon_ = OHOS::system::GetIntParameter<int64_t>(MOTION_PREDICTION_EXTRA_HORIZON_PARAM, 0);
 }
 
 KeyToTouchManager::~KeyToTouchManager()
 {
-    std::lock_guard<ffrt::mutex> lock(checkMutex_);
-    if (curTaskHandler_ != nullptr) {
-        handleQueue_->cancel(curTaskHandler_);
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        if (curTaskHandler_ != nullptr) {
+            handleQueue_->cancel(curTaskHandler_);
+        }
+        handleQueue_ = nullptr;
+    }
+
+    /*
+     * The handle queue submits tasks to the queues of the contexts, so they're destroyed after it.
+     * The channel keeps the queue of its shard, so it's stopped and destroyed first.
+     * The tasks of the contexts take checkMutex_, so it's not held here.
+     */
+    for (auto &shardPair: contextShards_) {
+        shardPair.second.eventChannel->Stop();
+        shardPair.second.eventChannel = nullptr;
+        shardPair.second.handleQueue = nullptr;
     }
-    handleQueue_ = nullptr;
 }
 
 void KeyToTouchManager::SetSupportKeyMapping(bool isSupportKeyMapping,
@@ -76,6 +131,18 @@ void KeyToTouchManager::SetSupportKeyMapping(bool isSupportKeyMapping,
 }
 
 bool KeyToTouchManager::DispatchKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+{
+    return DispatchKeyEvent(keyEvent, nullptr);
+}
+
+bool KeyToTouchManager::DispatchReplayKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                                               const DeviceInfo &deviceInfo)
+{
+    return DispatchKeyEvent(keyEvent, &deviceInfo);
+}
+
+bool KeyToTouchManager::DispatchKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                                         const DeviceInfo* replayDeviceInfo)
 {
     if (keyEvent->GetKeyAction() != KeyEvent::KEY_ACTION_DOWN
         && keyEvent->GetKeyAction() != KeyEvent::KEY_ACTION_UP
@@ -91,8 +158,8 @@ bool KeyToTouchManager::DispatchKeyEvent(const std::shared_ptr<MMI::KeyEvent> &k
         return IsDispatchToPluginMode(keyEvent);
     }
 
-    DeviceInfo deviceInfo = DelayedSingleton<MultiModalInputMgtService>::GetInstance()->GetDeviceInfo(
-        keyEvent->GetDeviceId());
+    DeviceInfo deviceInfo = replayDeviceInfo != nullptr ? *replayDeviceInfo :
+        DelayedSingleton<MultiModalInputMgtService>::GetInstance()->GetDeviceInfo(keyEvent->GetDeviceId());
     if (deviceInfo.UniqIsEmpty() || deviceInfo.name == VIRTUAL_KEYBOARD_DEVICE_NAME) {
         // 折叠PC的虚拟键盘不适合玩游戏
         return IsDispatchToPluginMode(keyEvent);
@@ -116,12 +183,16 @@ bool KeyToTouchManager::DispatchKeyEvent(const std::shared_ptr<MMI::KeyEvent> &k
             return IsDispatchToPluginMode(keyEvent);
         }
     }
-    if (!DeviceIsSupportKeyMapping(deviceType)) {
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (!DeviceIsSupportKeyMapping(deviceType) || shard == nullptr) {
         return IsDispatchToPluginMode(keyEvent);
     }
-    handleQueue_->submit([keyEvent, deviceType, deviceInfo, this] {
-        HandleKeyEvent(keyEvent, deviceType, deviceInfo);
-    });
+    // The event is converted once here, so the queued event doesn't copy the device information.
+    KeyToTouchEvent event;
+    event.type = KEY_TO_TOUCH_KEY_EVENT;
+    event.sample = KeyInputSample::Build(keyEvent, deviceType, deviceInfo.onlineTime);
+    event.keyEvent = keyEvent;
+    shard->eventChannel->Send(std::move(event));
     return true;
 }
 
@@ -136,6 +207,10 @@ bool KeyToTouchManager::IsDispatchToPluginMode(const std::shared_ptr<MMI::KeyEve
 
 bool KeyToTouchManager::DispatchPointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
 {
+    if (BaseKeyToTouchHandler::IsGamePadAxisEvent(pointerEvent)) {
+        return DispatchGamePadAxisEvent(pointerEvent);
+    }
+
     // current only handle mouse event
     if (!BaseKeyToTouchHandler::IsMouseLeftButtonEvent(pointerEvent)
         && !BaseKeyToTouchHandler::IsMouseRightButtonEvent(pointerEvent)
@@ -144,10 +219,12 @@ bool KeyToTouchManager::DispatchPointerEvent(const std::shared_ptr<MMI::PointerE
     }
 
     std::lock_guard<ffrt::mutex> lock(checkMutex_);
-    if (IsCanEnableKeyMapping() && isMonitorMouse_ && DeviceIsSupportKeyMapping(GAME_KEY_BOARD)) {
-        handleQueue_->submit([pointerEvent, this] {
-            HandlePointerEvent(pointerEvent, GAME_MOUSE);
-        });
+    InputToTouchShard* shard = GetShard(GAME_KEY_BOARD);
+    if (IsCanEnableKeyMapping() && isMonitorMouse_ && DeviceIsSupportKeyMapping(GAME_KEY_BOARD) && shard != nullptr) {
+        KeyToTouchEvent event;
+        event.type = KEY_TO_TOUCH_MOUSE_EVENT;
+        event.pointerEvent = pointerEvent;
+        shard->eventChannel->Send(std::move(event));
         return true;
     }
 
@@ -158,26 +235,51 @@ bool KeyToTouchManager::DispatchPointerEvent(const std::shared_ptr<MMI::PointerE
     return false;
 }
 
+bool KeyToTouchManager::DispatchGamePadAxisEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
+{
+    std::lock_guard<ffrt::mutex> lock(checkMutex_);
+    InputToTouchShard* shard = GetShard(GAME_PAD);
+    if (IsCanEnableKeyMapping() && isMonitorGamePadAxis_ && DeviceIsSupportKeyMapping(GAME_PAD) && shard != nullptr) {
+        KeyToTouchEvent event;
+        event.type = KEY_TO_TOUCH_GAME_PAD_AXIS_EVENT;
+        event.pointerEvent = pointerEvent;
+        shard->eventChannel->Send(std::move(event));
+        return true;
+    }
+    return false;
+}
+
 void KeyToTouchManager::UpdateTemplateConfig(const DeviceTypeEnum &deviceType,
                                              const std::string &bundleName,
-                                             const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+                                             const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                             const TemplateResolution &resolution,
+                                             const ResponseCurve &responseCurve)
 {
-    handleQueue_->submit([bundleName, deviceType, mappingInfos, this] {
-        if (bundleName != bundleName_) {
-            HILOGW("discard UpdateTemplateConfig. bundleName is [%{public}s]; bundleName_ is [%{public}s]",
-                   bundleName.c_str(), bundleName_.c_str());
-            return;
+    handleQueue_->submit([bundleName, deviceType, mappingInfos, resolution, responseCurve, this] {
+        {
+            std::lock_guard<ffrt::mutex> lock(checkMutex_);
+            if (bundleName != bundleName_) {
+                HILOGW("discard UpdateTemplateConfig. bundleName is [%{public}s]; bundleName_ is [%{public}s]",
+                       bundleName.c_str(), bundleName_.c_str());
+                return;
+            }
         }
 
-        HandleTemplateConfig(deviceType, mappingInfos);
+        // The key mappings are built here, so the input queue of the device type only swaps them in.
+        std::shared_ptr<InputToTouchContext> newContext = BuildTemplateContext(deviceType, mappingInfos, resolution,
+                                                                               responseCurve);
+        SubmitContextTask(deviceType, [deviceType, newContext, this](std::shared_ptr<InputToTouchContext> &) {
+            ApplyTemplateContext(deviceType, newContext);
+        });
     });
 }
 
 void KeyToTouchManager::UpdateWindowInfo(const WindowInfoEntity &windowInfoEntity)
 {
     handleQueue_->submit([windowInfoEntity, this] {
-        if (isPluginMode_) {
-            if (windowInfoEntity.bundleName != bundleName_) {
+        {
+            std::lock_guard<ffrt::mutex> lock(checkMutex_);
+            if (isPluginMode_ && windowInfoEntity.bundleName != bundleName_) {
                 HILOGW("discard windowInfo. bundleName is [%{public}s]; bundleName_ is [%{public}s]",
                        windowInfoEntity.bundleName.c_str(), bundleName_.c_str());
                 return;
@@ -189,61 +291,191 @@ void KeyToTouchManager::UpdateWindowInfo(const WindowInfoEntity &windowInfoEntit
 }
 
 void KeyToTouchManager::HandleKeyEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                       const DeviceTypeEnum &deviceType,
-                                       const DeviceInfo &deviceInfo)
+                                       const KeyInputSample &sample)
 {
-    if (!isEnableKeyMapping_) {
-        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName_, keyEvent, false);
-        return;
-    }
-    std::shared_ptr<InputToTouchContext> context = nullptr;
-    if (deviceType == GAME_KEY_BOARD) {
-        context = gcKeyboardContext_;
-    } else if (deviceType == HOVER_TOUCH_PAD) {
-        context = hoverTouchPadContext_;
+    bool isEnableKeyMapping;
+    std::string bundleName;
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        isEnableKeyMapping = isEnableKeyMapping_;
+        bundleName = bundleName_;
     }
-    if (context == nullptr) {
-        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName_, keyEvent, false);
+    std::shared_ptr<InputToTouchContext> context = GetContext(sample.deviceType);
+    if (!isEnableKeyMapping || context == nullptr) {
+        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName, keyEvent, false);
         return;
     }
     KeyToTouchMappingInfo keyToTouchMappingInfo;
-    bool isSuccess = GetMappingInfoByKeyCode(context, keyEvent, deviceInfo, keyToTouchMappingInfo);
+    bool isSuccess = GetMappingInfoByKeyCode(context, sample, keyToTouchMappingInfo);
     if (!isSuccess) {
         return;
     }
-    ExecuteHandle(context, keyToTouchMappingInfo, keyEvent, deviceInfo);
+    ExecuteHandle(context, keyToTouchMappingInfo, sample);
+    RefreshHeldKeyMappings(context);
 }
 
-void KeyToTouchManager::HandlePointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
-                                           const DeviceTypeEnum &deviceType)
+void KeyToTouchManager::HandlePointerEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
 {
-    if (!isEnableKeyMapping_ || !isMonitorMouse_ || gcKeyboardContext_ == nullptr) {
-        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName_, pointerEvent, false);
+    bool isHandleMouse;
+    std::string bundleName;
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        isHandleMouse = isEnableKeyMapping_ && isMonitorMouse_;
+        bundleName = bundleName_;
+    }
+    std::shared_ptr<InputToTouchContext> context = GetContext(GAME_KEY_BOARD);
+    if (!isHandleMouse || context == nullptr) {
+        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName, pointerEvent, false);
+        return;
+    }
+
+    if (IsHandleMouseMove(context, pointerEvent)) {
+        return;
+    }
+    if (IsHandleMouseRightButtonEvent(context, pointerEvent) ||
+        IsHandleMouseLeftButtonEvent(context, pointerEvent)) {
+        RefreshHeldKeyMappings(context);
         return;
     }
+    DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName, pointerEvent, false);
+}
 
-    if (IsHandleMouseMove(gcKeyboardContext_, pointerEvent) ||
-        IsHandleMouseRightButtonEvent(gcKeyboardContext_, pointerEvent) ||
-        IsHandleMouseLeftButtonEvent(gcKeyboardContext_, pointerEvent)) {
+void KeyToTouchManager::HandleGamePadAxisEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
+{
+    bool isEnableKeyMapping;
+    std::string bundleName;
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        isEnableKeyMapping = isEnableKeyMapping_;
+        bundleName = bundleName_;
+    }
+    std::shared_ptr<InputToTouchContext> context = GetContext(GAME_PAD);
+    if (!isEnableKeyMapping || context == nullptr) {
+        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName, pointerEvent, false);
         return;
     }
-    DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName_, pointerEvent, false);
+
+    // One event may carry several axes, and each of them is handled by its own key mapping.
+    bool isHandled = false;
+    for (const auto &axisSource: GAME_PAD_AXIS_SOURCES) {
+        KeyToTouchMappingInfo mappingInfo;
+        if (!BaseKeyToTouchHandler::HasGamePadAxis(pointerEvent, axisSource) ||
+            !context->FindAxisKeyMapping(axisSource, mappingInfo)) {
+            continue;
+        }
+        ExecuteHandle(context, mappingInfo, pointerEvent);
+        isHandled = true;
+    }
+    if (!isHandled) {
+        DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName, pointerEvent, false);
+    }
+    if (!context->IsMonitorGamePadAxis()) {
+        // The axes of the replaced template are released, and the new template has no axis mapping.
+        ResetMonitor(GAME_PAD);
+    }
+}
+
+void KeyToTouchManager::HandleChannelEvent(const KeyToTouchEvent &event)
+{
+    switch (event.type) {
+        case KEY_TO_TOUCH_KEY_EVENT:
+            HandleKeyEvent(event.keyEvent, event.sample);
+            break;
+        case KEY_TO_TOUCH_MOUSE_EVENT:
+            HandlePointerEvent(event.pointerEvent);
+            break;
+        case KEY_TO_TOUCH_GAME_PAD_AXIS_EVENT:
+            HandleGamePadAxisEvent(event.pointerEvent);
+            break;
+        case KEY_TO_TOUCH_CONTEXT_TASK:
+            if (event.task != nullptr) {
+                event.task();
+            }
+            break;
+        default:
+            break;
+    }
 }
 
 void KeyToTouchManager::HandleTemplateConfig(const DeviceTypeEnum &deviceType,
-                                             const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+                                             const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                             const TemplateResolution &resolution,
+                                             const ResponseCurve &responseCurve)
 {
-    HILOGI("HandleTemplateConfig deviceType is [%{public}d], mappingInfos size is [%{public}d]",
-           deviceType, static_cast<int32_t>(mappingInfos.size()));
+    ApplyTemplateContext(deviceType, BuildTemplateContext(deviceType, mappingInfos, resolution, responseCurve));
+}
+
+std::shared_ptr<InputToTouchContext> KeyToTouchManager::BuildTemplateContext(
+    const DeviceTypeEnum &deviceType, const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+    const TemplateResolution &resolution, const ResponseCurve &responseCurve)
+{
+    HILOGI("BuildTemplateContext deviceType is [%{public}d], mappingInfos size is [%{public}d], "
+           "resolution is [%{public}d x %{public}d], responseCurve type is [%{public}d]",
+           deviceType, static_cast<int32_t>(mappingInfos.size()), resolution.width, resolution.height,
+           responseCurve.type);
     for (const auto &mappingInfo: mappingInfos) {
         HILOGI("mappingInfos [%{public}s]", mappingInfo.GetKeyToTouchMappingInfoDesc().c_str());
     }
-    if (deviceType == GAME_KEY_BOARD) {
-        InitGcKeyboardContext(mappingInfos);
-    } else if (deviceType == HOVER_TOUCH_PAD) {
-        InitHoverTouchPadContext(mappingInfos);
+    if (mappingInfos.empty()) {
+        return nullptr;
+    }
+    WindowInfoEntity windowInfoEntity;
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        windowInfoEntity = windowInfoEntity_;
+    }
+    std::shared_ptr<InputToTouchContext> context = std::make_shared<InputToTouchContext>(
+        deviceType, windowInfoEntity, mappingInfos, resolution, responseCurve);
+    context->motionPredictor.SetEnabled(isMotionPredictionEnabled_);
+    context->motionPredictor.SetExtraHorizon(motionPredictionExtraHorizon_);
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (shard != nullptr) {
+        context->handleQueue = shard->handleQueue.get();
+    }
+    return context;
+}
+
+void KeyToTouchManager::ApplyTemplateContext(const DeviceTypeEnum &deviceType,
+                                             const std::shared_ptr<InputToTouchContext> &newContext)
+{
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (shard == nullptr) {
+        return;
+    }
+    if (newContext == nullptr) {
+        // The template is removed, so the pressed keys are released.
+        if (deviceType == GAME_KEY_BOARD) {
+            InitGcKeyboardContext(std::vector<KeyToTouchMappingInfo>());
+        } else if (deviceType == GAME_PAD) {
+            InitGamePadContext(std::vector<KeyToTouchMappingInfo>());
+        } else {
+            InitHoverTouchPadContext(std::vector<KeyToTouchMappingInfo>());
+        }
+    } else {
+        std::shared_ptr<InputToTouchContext> context = GetContext(deviceType);
+        if (context == nullptr) {
+            SetContext(shard, newContext);
+        } else {
+            context->SwapTemplate(*newContext);
+        }
+    }
+
+    // The trace keeps the window pixels, so that it's replayed without the reference resolution.
+    std::shared_ptr<InputToTouchContext> context = GetContext(deviceType);
+    DelayedSingleton<InputTraceRecorder>::GetInstance()->UpdateTemplate(deviceType,
+        context == nullptr ? std::vector<KeyToTouchMappingInfo>() : context->GetWindowMappingInfos());
+    ResetMonitor(deviceType);
+}
+
+void KeyToTouchManager::RefreshHeldKeyMappings(const std::shared_ptr<InputToTouchContext> &context)
+{
+    if (context->heldKeyMappings.empty() && context->heldMouseBtnKeyMappings.empty()) {
+        return;
+    }
+    if (context->PruneHeldKeyMappings()) {
+        // The released keys of the replaced template are not monitored any more.
+        ResetMonitor(context->deviceType);
     }
-    ResetMonitor();
 }
 
 void KeyToTouchManager::HandleWindowInfo(const WindowInfoEntity &windowInfoEntity)
@@ -253,8 +485,10 @@ void KeyToTouchManager::HandleWindowInfo(const WindowInfoEntity &windowInfoEntit
         std::lock_guard<ffrt::mutex> lock(checkMutex_);
         windowInfoEntity_ = windowInfoEntity;
     }
-    UpdateContextWindowInfo(gcKeyboardContext_);
-    UpdateContextWindowInfo(hoverTouchPadContext_);
+    DelayedSingleton<InputTraceRecorder>::GetInstance()->UpdateWindowInfo(windowInfoEntity);
+    SubmitContextTaskToAll([this](std::shared_ptr<InputToTouchContext> &context) {
+        UpdateContextWindowInfo(context);
+    });
 }
 
 void KeyToTouchManager::UpdateContextWindowInfo(const std::shared_ptr<InputToTouchContext> &context)
@@ -262,39 +496,92 @@ void KeyToTouchManager::UpdateContextWindowInfo(const std::shared_ptr<InputToTou
     if (context == nullptr) {
         return;
     }
-    context->windowInfoEntity = windowInfoEntity_;
+    WindowInfoEntity windowInfoEntity;
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        windowInfoEntity = windowInfoEntity_;
+    }
+
+    // The context is only used on its own queue, so the key mappings are rebuilt without holding the lock.
+    if (context->UpdateWindowInfo(windowInfoEntity)) {
+        HILOGI("the key mappings of deviceType [%{public}d] are rebuilt for the window size", context->deviceType);
+        DelayedSingleton<InputTraceRecorder>::GetInstance()->UpdateTemplate(context->deviceType,
+                                                                            context->GetWindowMappingInfos());
+    }
 }
 
-void KeyToTouchManager::InitGcKeyboardContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+void KeyToTouchManager::InitGcKeyboardContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                              const TemplateResolution &resolution)
 {
-    if (gcKeyboardContext_ != nullptr) {
-        DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->CancelDelayHandle();
+    InputToTouchShard* shard = GetShard(GAME_KEY_BOARD);
+    if (shard == nullptr) {
+        return;
+    }
+    std::shared_ptr<InputToTouchContext> context = GetContext(GAME_KEY_BOARD);
+    if (context != nullptr) {
+        DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->CancelDelayHandle(context);
         DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->StopTask();
-        ReleaseContext(gcKeyboardContext_);
+        ReleaseContext(context);
     }
     if (mappingInfos.empty()) {
-        gcKeyboardContext_ = nullptr;
+        SetContext(shard, nullptr);
         return;
     }
-    gcKeyboardContext_ = std::make_shared<InputToTouchContext>(GAME_KEY_BOARD,
-                                                               windowInfoEntity_, mappingInfos);
+    std::lock_guard<ffrt::mutex> lock(checkMutex_);
+    shard->context = std::make_shared<InputToTouchContext>(GAME_KEY_BOARD, windowInfoEntity_, mappingInfos,
+                                                           resolution);
+    shard->context->handleQueue = shard->handleQueue.get();
 }
 
-void KeyToTouchManager::InitHoverTouchPadContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos)
+void KeyToTouchManager::InitHoverTouchPadContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                                 const TemplateResolution &resolution)
 {
-    if (hoverTouchPadContext_ != nullptr) {
-        ReleaseContext(hoverTouchPadContext_);
+    InputToTouchShard* shard = GetShard(HOVER_TOUCH_PAD);
+    if (shard == nullptr) {
+        return;
+    }
+    std::shared_ptr<InputToTouchContext> context = GetContext(HOVER_TOUCH_PAD);
+    if (context != nullptr) {
+        ReleaseContext(context);
     }
     if (mappingInfos.empty()) {
-        hoverTouchPadContext_ = nullptr;
+        SetContext(shard, nullptr);
         return;
     }
-    hoverTouchPadContext_ = std::make_shared<InputToTouchContext>(HOVER_TOUCH_PAD,
-                                                                  windowInfoEntity_, mappingInfos);
+    std::lock_guard<ffrt::mutex> lock(checkMutex_);
+    shard->context = std::make_shared<InputToTouchContext>(HOVER_TOUCH_PAD, windowInfoEntity_, mappingInfos,
+                                                           resolution);
+    shard->context->handleQueue = shard->handleQueue.get();
+}
+
+void KeyToTouchManager::InitGamePadContext(const std::vector<KeyToTouchMappingInfo> &mappingInfos,
+                                           const TemplateResolution &resolution)
+{
+    InputToTouchShard* shard = GetShard(GAME_PAD);
+    if (shard == nullptr) {
+        return;
+    }
+    std::shared_ptr<InputToTouchContext> context = GetContext(GAME_PAD);
+    if (context != nullptr) {
+        ReleaseContext(context);
+        context->ResetTempVariables();
+    }
+    if (mappingInfos.empty()) {
+        SetContext(shard, nullptr);
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(checkMutex_);
+    shard->context = std::make_shared<InputToTouchContext>(GAME_PAD, windowInfoEntity_, mappingInfos, resolution);
+    shard->context->handleQueue = shard->handleQueue.get();
 }
 
 void KeyToTouchManager::ReleaseContext(const std::shared_ptr<InputToTouchContext> &inputToTouchContext)
 {
+    std::string bundleName;
+    {
+        std::lock_guard<ffrt::mutex> lock(checkMutex_);
+        bundleName = bundleName_;
+    }
     if (!inputToTouchContext->pointerItems.empty()) {
         // send pointer up event for all pointers
         PointerEvent::PointerItem pointerItem;
@@ -305,7 +592,6 @@ void KeyToTouchManager::ReleaseContext(const std::shared_ptr<InputToTouchContext
                 continue;
             }
             pointerItem = pointer.second;
-            pointerEvent->AddPointerItem(pointerItem);
             pointerEvent->SetDeviceId(pointerItem.GetDeviceId());
             pointerEvent->SetActionTime(pointerItem.GetDownTime());
             pointerEvent->SetAgentWindowId(inputToTouchContext->windowInfoEntity.windowId);
@@ -313,10 +599,9 @@ void KeyToTouchManager::ReleaseContext(const std::shared_ptr<InputToTouchContext
             pointerEvent->SetTargetDisplayId(inputToTouchContext->windowInfoEntity.displayId);
             pointerEvent->SetId(inputToTouchContext->GetEventId());
             pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_UP);
-            pointerEvent->SetPointerId(pointerItem.GetPointerId());
             pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
-            HILOGI("ReleaseContext pointer is [%{public}s].", pointerEvent->ToString().c_str());
-            DelayedSingleton<PluginCallbackManager>::GetInstance()->SendInputEvent(bundleName_, pointerEvent, true);
+            HILOGI("ReleaseContext pointerId is [%{public}d].", pointerItem.GetPointerId());
+            DelayedSingleton<PointerManager>::GetInstance()->InjectPointerEvent(bundleName, pointerEvent, pointerItem);
             DelayedSingleton<PointerManager>::GetInstance()->ReleasePointerId(pointerItem.GetPointerId());
         }
     }
@@ -327,74 +612,129 @@ void KeyToTouchManager::ReleaseContext(const std::shared_ptr<InputToTouchContext
     }
 }
 
-void KeyToTouchManager::ResetMonitor()
+InputToTouchShard* KeyToTouchManager::GetShard(const DeviceTypeEnum &deviceType)
+{
+    auto iter = contextShards_.find(deviceType);
+    if (iter == contextShards_.end()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+std::shared_ptr<InputToTouchContext> KeyToTouchManager::GetContext(const DeviceTypeEnum &deviceType)
 {
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (shard == nullptr) {
+        return nullptr;
+    }
     std::lock_guard<ffrt::mutex> lock(checkMutex_);
-    allMonitorKeys_.clear();
-    isMonitorMouse_ = false;
-    ResetAllMonitorKeysAndMouseMonitor(gcKeyboardContext_);
-    ResetAllMonitorKeysAndMouseMonitor(hoverTouchPadContext_);
+    return shard->context;
 }
 
-void KeyToTouchManager::ResetAllMonitorKeysAndMouseMonitor(const std::shared_ptr<InputToTouchContext> &context)
+void KeyToTouchManager::SetContext(InputToTouchShard* shard, const std::shared_ptr<InputToTouchContext> &context)
 {
-    if (context == nullptr) {
+    std::lock_guard<ffrt::mutex> lock(checkMutex_);
+    shard->context = context;
+}
+
+void KeyToTouchManager::SubmitContextTask(const DeviceTypeEnum &deviceType, const ContextTask &task)
+{
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (shard == nullptr || shard->handleQueue == nullptr) {
+        HILOGW_LIMIT("discard the context task. deviceType [%{public}d] has no context", deviceType);
         return;
     }
+    KeyToTouchEvent event;
+    event.type = KEY_TO_TOUCH_CONTEXT_TASK;
+    event.task = [this, deviceType, task] {
+        std::shared_ptr<InputToTouchContext> context = GetContext(deviceType);
+        task(context);
+    };
+    shard->eventChannel->Send(std::move(event));
+}
 
-    if (context->isMonitorMouse) {
-        isMonitorMouse_ = true;
-    }
-    AddToMonitorKeys(context->deviceType, context->singleKeyMappings);
-    AddToMonitorKeys(context->deviceType, context->mouseBtnKeyMappings);
-    for (const auto &combinationKeyMapping: context->combinationKeyMappings) {
-        AddToMonitorKeys(context->deviceType, combinationKeyMapping.first);
+void KeyToTouchManager::SubmitContextTaskToAll(const ContextTask &task)
+{
+    for (auto &shardPair: contextShards_) {
+        SubmitContextTask(shardPair.first, task);
     }
 }
 
-void KeyToTouchManager::AddToMonitorKeys(const DeviceTypeEnum &deviceType,
-                                         const std::unordered_map<int32_t, KeyToTouchMappingInfo> &keyMap)
+void KeyToTouchManager::ResetMonitor(const DeviceTypeEnum &deviceType)
 {
-    for (const auto &pair: keyMap) {
-        AddToMonitorKeys(deviceType, pair.first);
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (shard == nullptr) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(checkMutex_);
+    shard->monitorKeys.clear();
+    shard->isMonitorMouse = false;
+    shard->isMonitorGamePadAxis = false;
+    std::shared_ptr<InputToTouchContext> context = shard->context;
+    if (context != nullptr) {
+        shard->isMonitorMouse = context->isMonitorMouse || context->IsHeldMonitorMouse();
+        shard->isMonitorGamePadAxis = context->IsMonitorGamePadAxis();
+        for (const auto &pair: context->singleKeyMappings) {
+            shard->monitorKeys.insert(pair.first);
+        }
+        for (const auto &pair: context->heldKeyMappings) {
+            shard->monitorKeys.insert(pair.first);
+        }
+        for (const auto &pair: context->heldMouseBtnKeyMappings) {
+            shard->monitorKeys.insert(pair.first);
+        }
+        for (const auto &pair: context->mouseBtnKeyMappings) {
+            shard->monitorKeys.insert(pair.first);
+        }
+        for (const auto &combinationKeyMapping: context->combinationKeyMappings) {
+            shard->monitorKeys.insert(combinationKeyMapping.first);
+        }
     }
+    MergeMonitorKeys();
 }
 
-void KeyToTouchManager::AddToMonitorKeys(const DeviceTypeEnum &deviceType,
-                                         const int32_t &keyCode)
+void KeyToTouchManager::MergeMonitorKeys()
 {
-    if (allMonitorKeys_.find(keyCode) == allMonitorKeys_.end()) {
-        std::unordered_set<DeviceTypeEnum> deviceTypeSet;
-        deviceTypeSet.insert(deviceType);
-        allMonitorKeys_[keyCode] = deviceTypeSet;
-    } else {
-        std::unordered_set<DeviceTypeEnum> deviceTypeSet = allMonitorKeys_[keyCode];
-        deviceTypeSet.insert(deviceType);
-        allMonitorKeys_[keyCode] = deviceTypeSet;
+    allMonitorKeys_.clear();
+    isMonitorMouse_ = false;
+    isMonitorGamePadAxis_ = false;
+    for (const auto &shardPair: contextShards_) {
+        const InputToTouchShard &shard = shardPair.second;
+        if (shard.isMonitorMouse) {
+            isMonitorMouse_ = true;
+        }
+        if (shard.isMonitorGamePadAxis) {
+            isMonitorGamePadAxis_ = true;
+        }
+        for (const auto &keyCode: shard.monitorKeys) {
+            allMonitorKeys_[keyCode].insert(shard.deviceType);
+        }
     }
 }
 
 bool KeyToTouchManager::GetMappingInfoByKeyCode(const std::shared_ptr<InputToTouchContext> &context,
-                                                const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                const DeviceInfo &deviceInfo,
+                                                const KeyInputSample &sample,
                                                 KeyToTouchMappingInfo &keyToTouchMappingInfo)
 {
-    if (keyEvent->GetKeyAction() == KeyEvent::KEY_ACTION_DOWN) {
-        return GetMappingInfoByKeyCodeWhenKeyDown(context, keyEvent, deviceInfo, keyToTouchMappingInfo);
-    } else if (BaseKeyToTouchHandler::IsKeyUpEvent(keyEvent)) {
-        return GetMappingInfoByKeyCodeWhenKeyUp(context, keyEvent, keyToTouchMappingInfo);
+    // The key pressed under the replaced template is handled by its old key mapping until it's released.
+    if (context->FindHeldKeyMapping(sample.keyCode, keyToTouchMappingInfo)) {
+        return true;
+    }
+    if (sample.IsKeyDown()) {
+        return GetMappingInfoByKeyCodeWhenKeyDown(context, sample, keyToTouchMappingInfo);
+    } else if (sample.IsKeyUp()) {
+        return GetMappingInfoByKeyCodeWhenKeyUp(context, sample, keyToTouchMappingInfo);
     } else {
-        HILOGE("unknown KeyAction [%{public}d].", keyEvent->GetKeyAction());
+        HILOGE("unknown KeyAction [%{public}d].", sample.keyAction);
         return false;
     }
 }
 
 bool KeyToTouchManager::GetMappingInfoByKeyCodeWhenKeyDown(const std::shared_ptr<InputToTouchContext> &context,
-                                                           const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                           const DeviceInfo &deviceInfo,
+                                                           const KeyInputSample &sample,
                                                            KeyToTouchMappingInfo &keyToTouchMappingInfo)
 {
-    int32_t keycode = keyEvent->GetKeyCode();
+    int32_t keycode = sample.keyCode;
 
     /**
      * It's key up event.
@@ -411,7 +751,7 @@ bool KeyToTouchManager::GetMappingInfoByKeyCodeWhenKeyDown(const std::shared_ptr
             return true;
         }
     } else {
-        if (GetMappingInfoByKeyCodeFromCombinationKey(context, keyEvent, deviceInfo, keyToTouchMappingInfo)) {
+        if (GetMappingInfoByKeyCodeFromCombinationKey(context, sample, keyToTouchMappingInfo)) {
             return true;
         }
     }
@@ -424,10 +764,10 @@ bool KeyToTouchManager::GetMappingInfoByKeyCodeWhenKeyDown(const std::shared_ptr
 }
 
 bool KeyToTouchManager::GetMappingInfoByKeyCodeWhenKeyUp(const std::shared_ptr<InputToTouchContext> &context,
-                                                         const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                                                         const KeyInputSample &sample,
                                                          KeyToTouchMappingInfo &keyToTouchMappingInfo)
 {
-    int32_t keycode = keyEvent->GetKeyCode();
+    int32_t keycode = sample.keyCode;
     if (context->isCombinationKeyOperating) {
         /**
          * If the current state is combinationKeyOperating
@@ -458,52 +798,43 @@ bool KeyToTouchManager::GetMappingInfoByKeyCodeWhenKeyUp(const std::shared_ptr<I
 }
 
 bool KeyToTouchManager::GetMappingInfoByKeyCodeFromCombinationKey(const std::shared_ptr<InputToTouchContext> &context,
-                                                                  const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                                  const DeviceInfo &deviceInfo,
+                                                                  const KeyInputSample &sample,
                                                                   KeyToTouchMappingInfo &keyToTouchMappingInfo)
 {
-    int32_t keycode = keyEvent->GetKeyCode();
-    if (context->combinationKeyMappings.find(keycode) == context->combinationKeyMappings.end()) {
+    auto iter = context->combinationKeyMappings.find(sample.keyCode);
+    if (iter == context->combinationKeyMappings.end()) {
         return false;
     }
-    int64_t keyDownTime = keyEvent->GetActionTime();
-    int32_t deviceId = keyEvent->GetDeviceId();
-    bool isCombinationKey = false;
-    int64_t combinationKeyDownTime = 0;
-    std::unordered_map<int32_t, KeyToTouchMappingInfo> combinationMap = context->combinationKeyMappings[keycode];
-    for (const auto &keyItem: keyEvent->GetKeyItems()) {
-        if (keyItem.GetDeviceId() == deviceId
-            && keyItem.GetDownTime() >= deviceInfo.onlineTime
-            && keyItem.GetDownTime() < keyDownTime
-            && combinationMap.find(keyItem.GetKeyCode()) != combinationMap.end()) {
-            isCombinationKey = true;
-            if (combinationKeyDownTime == 0 || keyItem.GetDownTime() < combinationKeyDownTime) {
-                /**
-                 * for example, the combinationKey can be shift+B or alt+B,
-                 * If we press Shift, Alt, and B in sequence,
-                 * we will select Shift+B as the combination key.
-                 */
-                combinationKeyDownTime = keyItem.GetDownTime();
-                keyToTouchMappingInfo = combinationMap[keyItem.GetKeyCode()];
-                continue;
-            }
+    const std::unordered_map<int32_t, KeyToTouchMappingInfo> &combinationMap = iter->second;
+
+    /**
+     * The pressed keys are in the order they are pressed, so the first one is selected.
+     * for example, the combinationKey can be shift+B or alt+B,
+     * If we press Shift, Alt, and B in sequence,
+     * we will select Shift+B as the combination key.
+     */
+    for (int32_t idx = 0; idx < sample.pressedKeyCount; idx++) {
+        const PressedKey &pressedKey = sample.pressedKeys[idx];
+        if (pressedKey.downTime >= sample.actionTime) {
+            break;
+        }
+        auto mappingIter = combinationMap.find(pressedKey.keyCode);
+        if (mappingIter != combinationMap.end()) {
+            keyToTouchMappingInfo = mappingIter->second;
+            return true;
         }
-    }
-    if (isCombinationKey) {
-        return true;
     }
     return false;
 }
 
 void KeyToTouchManager::ExecuteHandle(std::shared_ptr<InputToTouchContext> &context,
                                       const KeyToTouchMappingInfo &mappingInfo,
-                                      const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo)
+                                      const KeyInputSample &sample)
 {
     if (mappingHandler_.find(mappingInfo.mappingType) == mappingHandler_.end()) {
         return;
     }
-    mappingHandler_[mappingInfo.mappingType]->HandleKeyEvent(context, keyEvent,
-                                                             deviceInfo, mappingInfo);
+    mappingHandler_[mappingInfo.mappingType]->HandleKeyEvent(context, sample, mappingInfo);
 }
 
 void KeyToTouchManager::ExecuteHandle(std::shared_ptr<InputToTouchContext> &context,
@@ -538,10 +869,10 @@ bool KeyToTouchManager::IsHandleMouseMove(std::shared_ptr<InputToTouchContext> &
         }
     }
 
+    KeyToTouchMappingInfo mappingInfo;
     if (context->IsMouseRightWalking()) {
-        if (context->mouseBtnKeyMappings.find(MOUSE_RIGHT_BUTTON_KEYCODE) != context->mouseBtnKeyMappings.end()) {
-            ExecuteHandle(context, context->mouseBtnKeyMappings[MOUSE_RIGHT_BUTTON_KEYCODE],
-                          pointerEvent);
+        if (context->FindMouseBtnKeyMapping(MOUSE_RIGHT_BUTTON_KEYCODE, mappingInfo)) {
+            ExecuteHandle(context, mappingInfo, pointerEvent);
             isNeedHandle = true;
         }
     }
@@ -562,8 +893,9 @@ bool KeyToTouchManager::IsHandleMouseRightButtonEvent(std::shared_ptr<InputToTou
         return false;
     }
 
-    if (context->mouseBtnKeyMappings.find(MOUSE_RIGHT_BUTTON_KEYCODE) != context->mouseBtnKeyMappings.end()) {
-        ExecuteHandle(context, context->mouseBtnKeyMappings[MOUSE_RIGHT_BUTTON_KEYCODE], pointerEvent);
+    KeyToTouchMappingInfo mappingInfo;
+    if (context->FindMouseBtnKeyMapping(MOUSE_RIGHT_BUTTON_KEYCODE, mappingInfo)) {
+        ExecuteHandle(context, mappingInfo, pointerEvent);
         return true;
     }
     return false;
@@ -576,21 +908,21 @@ bool KeyToTouchManager::IsHandleMouseLeftButtonEvent(std::shared_ptr<InputToTouc
         return false;
     }
 
-    if (context->isCrosshairMode
-        && context->mouseBtnKeyMappings.find(MOUSE_LEFT_BUTTON_KEYCODE) != context->mouseBtnKeyMappings.end()) {
+    KeyToTouchMappingInfo mappingInfo;
+    if (context->isCrosshairMode && context->FindMouseBtnKeyMapping(MOUSE_LEFT_BUTTON_KEYCODE, mappingInfo)) {
         // Perform mouse left button events in crosshair-mode
-        ExecuteHandle(context, context->mouseBtnKeyMappings[MOUSE_LEFT_BUTTON_KEYCODE], pointerEvent);
+        ExecuteHandle(context, mappingInfo, pointerEvent);
         return true;
     }
 
     if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_BUTTON_UP
         && context->isMouseLeftFireOperating
-        && context->mouseBtnKeyMappings.find(MOUSE_LEFT_BUTTON_KEYCODE) != context->mouseBtnKeyMappings.end()) {
+        && context->FindMouseBtnKeyMapping(MOUSE_LEFT_BUTTON_KEYCODE, mappingInfo)) {
         /*
          * When it's not in crosshair-mode, if it is a up event and the mouse leftButton was pressed,
          * perform mouse left button events.
          */
-        ExecuteHandle(context, context->mouseBtnKeyMappings[MOUSE_LEFT_BUTTON_KEYCODE], pointerEvent);
+        ExecuteHandle(context, mappingInfo, pointerEvent);
         return true;
     }
     return false;
@@ -633,8 +965,9 @@ void KeyToTouchManager::HandleEnableKeyMapping(bool isEnable)
 {
     isEnableKeyMapping_ = isEnable;
     HILOGI("EnableKeyMapping([%{public}d]). 1 is enable", isEnable);
-    ResetContext(gcKeyboardContext_);
-    ResetContext(hoverTouchPadContext_);
+    SubmitContextTaskToAll([this](std::shared_ptr<InputToTouchContext> &context) {
+        ResetContext(context);
+    });
 }
 
 void KeyToTouchManager::ResetContext(std::shared_ptr<InputToTouchContext> &context)
@@ -642,8 +975,12 @@ void KeyToTouchManager::ResetContext(std::shared_ptr<InputToTouchContext> &conte
     if (context == nullptr) {
         return;
     }
+    bool hasHeldKeyMappings = !context->heldKeyMappings.empty() || !context->heldMouseBtnKeyMappings.empty();
     ReleaseContext(context);
     context->ResetTempVariables();
+    if (hasHeldKeyMappings) {
+        ResetMonitor(context->deviceType);
+    }
 }
 
 bool KeyToTouchManager::IsCanEnableKeyMapping()
@@ -671,14 +1008,14 @@ void KeyToTouchManager::UpdateByDeviceStatusChanged(const DeviceInfo &deviceInfo
     }
     if (deviceInfo.status == 0
         && deviceInfo.sourceTypeSet.count(MOUSE) != 0) {
-        handleQueue_->submit([this] {
-            if (gcKeyboardContext_ == nullptr) {
+        SubmitContextTask(GAME_KEY_BOARD, [](std::shared_ptr<InputToTouchContext> &context) {
+            if (context == nullptr) {
                 return;
             }
 
-            if (gcKeyboardContext_->isEnterCrosshairInfo) {
+            if (context->isEnterCrosshairInfo) {
                 DelayedSingleton<PluginCallbackManager>::GetInstance()->SetPointerVisible(
-                    gcKeyboardContext_->windowInfoEntity.bundleName,
+                    context->windowInfoEntity.bundleName,
                     false);
             }
         });
@@ -696,19 +1033,35 @@ void KeyToTouchManager::ClearGameKeyMapping()
     supportDeviceTypeSet_.clear();
     allMonitorKeys_.clear();
     isMonitorMouse_ = false;
+    isMonitorGamePadAxis_ = false;
     windowInfoEntity_ = WindowInfoEntity{};
     isEnableKeyMapping_ = true;
     bundleName_ = "";
+    for (auto &shardPair: contextShards_) {
+        shardPair.second.monitorKeys.clear();
+        shardPair.second.isMonitorMouse = false;
+        shardPair.second.isMonitorGamePadAxis = false;
+    }
     handleQueue_->submit([this] {
-        if (!isPluginMode_) {
-            return;
+        {
+            std::lock_guard<ffrt::mutex> lock(checkMutex_);
+            if (!isPluginMode_) {
+                return;
+            }
         }
         HILOGI("do InitContext.");
 
         // Context must be reInited first
         std::vector<KeyToTouchMappingInfo> mappingInfos;
-        InitGcKeyboardContext(mappingInfos);
-        InitHoverTouchPadContext(mappingInfos);
+        SubmitContextTask(GAME_KEY_BOARD, [mappingInfos, this](std::shared_ptr<InputToTouchContext> &) {
+            InitGcKeyboardContext(mappingInfos);
+        });
+        SubmitContextTask(HOVER_TOUCH_PAD, [mappingInfos, this](std::shared_ptr<InputToTouchContext> &) {
+            InitHoverTouchPadContext(mappingInfos);
+        });
+        SubmitContextTask(GAME_PAD, [mappingInfos, this](std::shared_ptr<InputToTouchContext> &) {
+            InitGamePadContext(mappingInfos);
+        });
     });
 }
 
@@ -718,12 +1071,11 @@ void KeyToTouchManager::CheckPointerSendInterval()
     if (handleQueue_ == nullptr) {
         return;
     }
-    if (gcKeyboardContext_ != nullptr) {
-        gcKeyboardContext_->CheckPointerSendInterval();
-    }
-    if (hoverTouchPadContext_ != nullptr) {
-        hoverTouchPadContext_->CheckPointerSendInterval();
-    }
+    SubmitContextTaskToAll([](std::shared_ptr<InputToTouchContext> &context) {
+        if (context != nullptr) {
+            context->CheckPointerSendInterval();
+        }
+    });
     curTaskHandler_ = handleQueue_->submit_h([this] {
         CheckPointerSendInterval();
     }, ffrt::task_attr().name("pointer-check-task").delay(DELAY_TIME_UNIT));
@@ -742,9 +1094,35 @@ void KeyToTouchManager::UpdateFocusStatus(const std::string &bundleName, bool is
                    "with bundleName_[%{public}s]", bundleName.c_str(), bundleName_.c_str());
             return;
         }
-        ResetContext(gcKeyboardContext_);
-        ResetContext(hoverTouchPadContext_);
+        SubmitContextTaskToAll([this](std::shared_ptr<InputToTouchContext> &context) {
+            ResetContext(context);
+        });
     });
 }
+
+void KeyToTouchManager::WaitHandleQueueIdle()
+{
+    if (handleQueue_ == nullptr) {
+        return;
+    }
+    // The handle queue submits tasks to the queues of the contexts, so it's waited first
+    ffrt::task_handle handle = handleQueue_->submit_h([] {});
+    handleQueue_->wait(handle);
+    for (auto &shardPair: contextShards_) {
+        if (shardPair.second.handleQueue == nullptr) {
+            continue;
+        }
+        shardPair.second.eventChannel->WaitIdle();
+    }
+}
+
+BatchedChannelStats KeyToTouchManager::GetEventChannelStats(const DeviceTypeEnum &deviceType)
+{
+    InputToTouchShard* shard = GetShard(deviceType);
+    if (shard == nullptr) {
+        return BatchedChannelStats();
+    }
+    return shard->eventChannel->GetStats();
+}
+}
 }
-}
\ No newline at end of file
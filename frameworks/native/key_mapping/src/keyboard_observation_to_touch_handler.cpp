@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 
+#include <cmath>
 #include <cstdint>
+#include <display_manager.h>
+#include <syspara/parameters.h>
 #include "keyboard_observation_to_touch_handler.h"
 #include "gamecontroller_log.h"
 #include "gamecontroller_utils.h"
@@ -23,7 +26,12 @@ namespace GameController {
 namespace {
 const std::string JOINER = "_";
 const int32_t INVALID_VALUE = -1;
-const int64_t FFRT_TASK_DELAY_TIME = 50000; // 50ms
+const int64_t STEP_TIME = 50000; // 50ms, xStep and yStep are moved in one step
+const double MAX_STEP_RATIO = 4.0; // the ticks delayed more than it are not caught up
+const int64_t ONE_SECOND = 1000000;
+const uint32_t MIN_UPDATE_RATE = 20;
+const uint32_t DEFAULT_UPDATE_RATE = 60;
+const char* UPDATE_RATE_PARAM = "persist.gamecontroller.keyboard_observation.update_rate";
 }
 
 KeyboardObservationToTouchHandler::KeyboardObservationToTouchHandler()
@@ -31,93 +39,91 @@ KeyboardObservationToTouchHandler::KeyboardObservationToTouchHandler()
 }
 
 void KeyboardObservationToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                                      const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                      const KeyToTouchMappingInfo &mappingInfo,
-                                                      const DeviceInfo &deviceInfo)
+                                                      const KeyInputSample &sample,
+                                                      const KeyToTouchMappingInfo &mappingInfo)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (context->isPerspectiveObserving) {
         if (context->currentPerspectiveObserving.mappingType != KEY_BOARD_OBSERVATION_TO_TOUCH) {
-            HILOGW("discard key[%{private}d] down event. mappingType is not keyboard_observation_to_touch", keyCode);
+            HILOGW_LIMIT("discard key[%{private}d] down event. mappingType is not keyboard_observation_to_touch",
+                         keyCode);
             return;
         }
 
         // calculate new position
-        MoveByKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        MoveByKeyDown(context, sample, mappingInfo);
         return;
     }
 
-    HILOGI("keyCode [%{private}d] convert to down event of keyboard_observation_to_touch", keyCode);
+    HILOGI_LIMIT("keyCode [%{private}d] convert to down event of keyboard_observation_to_touch", keyCode);
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentObserving(mappingInfo, pointerId);
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchEntity(context->currentPerspectiveObserving, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
 
     DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->StartTaskByInterval();
-    MoveByKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+    MoveByKeyDown(context, sample, mappingInfo);
 }
 
 void KeyboardObservationToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                                                    const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                    const DeviceInfo &deviceInfo)
+                                                    const KeyInputSample &sample)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (!context->isPerspectiveObserving) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. Not observing state.", keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. Not observing state.", keyCode);
         return;
     }
     if (context->currentPerspectiveObserving.mappingType != KEY_BOARD_OBSERVATION_TO_TOUCH) {
-        HILOGW("discard key[%{private}d] up event. mappingType is not same with keyboard_observation_to_touch",
-               keyCode);
+        HILOGW_LIMIT("discard key[%{private}d] up event. mappingType is not same with keyboard_observation_to_touch",
+                     keyCode);
         return;
     }
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     if (!pair.first) {
-        HILOGW("discard keyup event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard keyup event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
 
     auto mapping = context->currentPerspectiveObserving;
-    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(keyEvent, deviceInfo, mapping);
+    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(sample, mapping);
     if (dpadKeys.empty()) {
-        HILOGI("keyCode[%{private}d] convert to up event of keyboard_observation_to_touch", keyCode);
+        HILOGI_LIMIT("keyCode[%{private}d] convert to up event of keyboard_observation_to_touch", keyCode);
         DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->StopTask();
         PointerEvent::PointerItem lastMovePoint = context->pointerItems[pointerId];
-        int64_t actionTime = keyEvent->GetActionTime();
+        int64_t actionTime = sample.actionTime;
         TouchEntity touchEntity = BuildTouchUpEntity(lastMovePoint, pointerId,
                                                      PointerEvent::POINTER_ACTION_UP, actionTime);
         BuildAndSendPointerEvent(context, touchEntity);
         context->ResetCurrentObserving();
         return;
     } else {
-        MoveByKeyUp(keyEvent, mapping, context, dpadKeys);
+        MoveByKeyUp(sample, mapping, context, dpadKeys);
     }
 }
 
 void KeyboardObservationToTouchHandler::MoveByKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                                      const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                      const KeyToTouchMappingInfo &mappingInfo,
-                                                      const DeviceInfo &deviceInfo)
+                                                      const KeyInputSample &sample,
+                                                      const KeyToTouchMappingInfo &mappingInfo)
 {
-    int32_t currentKeyCode = keyEvent->GetKeyCode();
+    int32_t currentKeyCode = sample.keyCode;
     DpadKeyTypeEnum currentDpadKeyType = GetDpadKeyType(currentKeyCode, mappingInfo);
     if (currentDpadKeyType == DPAD_KEYTYPE_UNKNOWN) {
-        HILOGW("the current keycode[%{private}d]'s keyType is unknown.", currentKeyCode);
+        HILOGW_LIMIT("the current keycode[%{private}d]'s keyType is unknown.", currentKeyCode);
         return;
     }
 
-    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(keyEvent, deviceInfo, mappingInfo);
+    std::vector<DpadKeyItem> dpadKeys = CollectValidDpadKeys(sample, mappingInfo);
     if (dpadKeys.empty()) {
-        HILOGW("the current keycode[%{private}d]. no valid dpad keys.", currentKeyCode);
+        HILOGW_LIMIT("the current keycode[%{private}d]. no valid dpad keys.", currentKeyCode);
         return;
     }
     UpdateTaskInfo(context, currentKeyCode, currentDpadKeyType, dpadKeys);
 }
 
-void KeyboardObservationToTouchHandler::MoveByKeyUp(const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+void KeyboardObservationToTouchHandler::MoveByKeyUp(const KeyInputSample &sample,
                                                     const KeyToTouchMappingInfo &mappingInfo,
                                                     std::shared_ptr<InputToTouchContext> &context,
                                                     std::vector<DpadKeyItem> &dpadKeys)
@@ -135,12 +141,12 @@ void KeyboardObservationToTouchHandler::UpdateTaskInfo(std::shared_ptr<InputToTo
 {
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     if (!pair.first) {
-        HILOGW("discard mouse move event, because cannot find pointerId");
+        HILOGW_LIMIT("discard mouse move event, because cannot find pointerId");
         return;
     }
     int32_t pointerId = pair.second;
     if (context->pointerItems.find(pointerId) == context->pointerItems.end()) {
-        HILOGW("discard mouse move event, because cannot find the last move event");
+        HILOGW_LIMIT("discard mouse move event, because cannot find the last move event");
         return;
     }
     DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->UpdateTaskInfo(currentKeyCode,
@@ -151,8 +157,10 @@ void KeyboardObservationToTouchHandler::UpdateTaskInfo(std::shared_ptr<InputToTo
 
 KeyboardObservationToTouchHandlerTask::KeyboardObservationToTouchHandlerTask()
 {
-    taskQueue_ = std::make_unique<ffrt::queue>("keyboard-observation-thread",
-                                               ffrt::queue_attr().qos(ffrt::qos_background));
+    taskQueue_ =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("keyboard-observation-thread");
+    int32_t updateRate = OHOS::system::GetIntParameter<int32_t>(UPDATE_RATE_PARAM, DEFAULT_UPDATE_RATE);
+    SetUpdateRate(updateRate > 0 ? static_cast<uint32_t>(updateRate) : DEFAULT_UPDATE_RATE);
 
     validCombinationKeys_.insert(std::to_string(DPAD_UP));
     validCombinationKeys_.insert(std::to_string(DPAD_UP) + JOINER + std::to_string(DPAD_LEFT));
@@ -183,20 +191,46 @@ void KeyboardObservationToTouchHandlerTask::StartTaskByInterval()
     }
     HILOGI("start KeyboardObservationToTouchHandlerTask success.");
     taskIsStarting_ = true;
+    lastAdvanceTime_ = StringUtils::GetSysClockTime();
+    remainderX_ = 0.0;
+    remainderY_ = 0.0;
     PutTaskToDelayQueue();
 }
 
+void KeyboardObservationToTouchHandlerTask::SetUpdateRate(uint32_t updateRate)
+{
+    uint32_t maxUpdateRate = std::max(GetMaxUpdateRate(), MIN_UPDATE_RATE);
+    uint32_t rate = std::min(std::max(updateRate, MIN_UPDATE_RATE), maxUpdateRate);
+    std::lock_guard<ffrt::mutex> lock(taskLock_);
+    tickInterval_ = ONE_SECOND / rate;
+    HILOGI("the update rate of keyboard observation is [%{public}u]Hz", rate);
+}
+
+uint32_t KeyboardObservationToTouchHandlerTask::GetMaxUpdateRate()
+{
+    sptr<Rosen::Display> display = Rosen::DisplayManager::GetInstance().GetDefaultDisplay();
+    if (display == nullptr || display->GetRefreshRate() == 0) {
+        HILOGW("get the refresh rate of the display failed, use [%{public}u]Hz", DEFAULT_UPDATE_RATE);
+        return DEFAULT_UPDATE_RATE;
+    }
+    return display->GetRefreshRate();
+}
+
 void KeyboardObservationToTouchHandlerTask::PutTaskToDelayQueue()
 {
     curTaskHandler_ = taskQueue_->submit_h([this] {
         RunTask();
-    }, ffrt::task_attr().name("keyboard-observation-task").delay(FFRT_TASK_DELAY_TIME));
+    }, ffrt::task_attr().name("keyboard-observation-task").delay(tickInterval_));
 }
 
 void KeyboardObservationToTouchHandlerTask::StopTask()
 {
     std::lock_guard<ffrt::mutex> lock(taskLock_);
     HILOGI("stop KeyboardObservationToTouchHandlerTask success.");
+    if (taskIsStarting_) {
+        // the distance moved since the last tick is sent before the keys are released
+        Advance(StringUtils::GetSysClockTime());
+    }
     taskIsStarting_ = false;
     context_ = nullptr;
     currentDpadKeyType_ = DPAD_KEYTYPE_UNKNOWN;
@@ -215,6 +249,10 @@ void KeyboardObservationToTouchHandlerTask::UpdateTaskInfo(int32_t currentKeyCod
         return;
     }
     std::lock_guard<ffrt::mutex> lock(taskLock_);
+    if (taskIsStarting_) {
+        // the keys held before are moved up to now
+        Advance(StringUtils::GetSysClockTime());
+    }
     currentKeyCode_ = currentKeyCode;
     context_ = context;
     currentDpadKeyType_ = currentKeyType;
@@ -229,25 +267,36 @@ void KeyboardObservationToTouchHandlerTask::RunTask()
         return;
     }
 
-    ComputeAndSendMovePointer();
+    Advance(StringUtils::GetSysClockTime());
     PutTaskToDelayQueue();
 }
 
-void KeyboardObservationToTouchHandlerTask::ComputeAndSendMovePointer()
+void KeyboardObservationToTouchHandlerTask::Advance(int64_t currentTime)
+{
+    int64_t elapsedTime = currentTime - lastAdvanceTime_;
+    lastAdvanceTime_ = currentTime;
+    if (elapsedTime <= 0) {
+        return;
+    }
+    double stepRatio = std::min(static_cast<double>(elapsedTime) / STEP_TIME, MAX_STEP_RATIO);
+    ComputeAndSendMovePointer(stepRatio);
+}
+
+void KeyboardObservationToTouchHandlerTask::ComputeAndSendMovePointer(double stepRatio)
 {
     if (context_ == nullptr || dpadKeys_.empty()
         || currentDpadKeyType_ == DPAD_KEYTYPE_UNKNOWN || currentKeyCode_ == 0) {
-        HILOGW("discard the compute event, because task info is invalid.");
+        HILOGW_LIMIT("discard the compute event, because task info is invalid.");
         return;
     }
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     if (!pair.first) {
-        HILOGW("discard compute. because cannot find the pointerId");
+        HILOGW_LIMIT("discard compute. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
     if (context_->pointerItems.find(pointerId) == context_->pointerItems.end()) {
-        HILOGW("discard the compute event, because cannot find the last move event");
+        HILOGW_LIMIT("discard the compute event, because cannot find the last move event");
         return;
     }
 
@@ -269,36 +318,69 @@ void KeyboardObservationToTouchHandlerTask::ComputeAndSendMovePointer()
             break;
         }
     }
+    double xOffset = 0.0;
+    double yOffset = 0.0;
+    if (hasCombinationKeys) {
+        ComputeOffset(context_, firstKeyItem.keyTypeEnum, stepRatio, xOffset, yOffset);
+    }
+    ComputeOffset(context_, currentDpadKeyType_, stepRatio, xOffset, yOffset);
     PointerEvent::PointerItem lastMovePoint = context_->pointerItems[pointerId];
     Point targetPoint;
-    targetPoint.x = lastMovePoint.GetWindowX();
-    targetPoint.y = lastMovePoint.GetWindowY();
-    if (hasCombinationKeys) {
-        ComputeTargetPoint(context_, lastMovePoint, firstKeyItem.keyTypeEnum, targetPoint);
+    ComputeTargetPoint(context_, lastMovePoint, xOffset, yOffset, targetPoint);
+    if (targetPoint.x == lastMovePoint.GetWindowX() && targetPoint.y == lastMovePoint.GetWindowY()) {
+        return;
     }
-    ComputeTargetPoint(context_, lastMovePoint, currentDpadKeyType_, targetPoint);
     int64_t actionTime = StringUtils::GetSysClockTime();
     TouchEntity touchEntity = BuildMoveTouchEntity(pointerId, targetPoint, actionTime);
     BuildAndSendPointerEvent(context_, touchEntity);
 }
 
-void KeyboardObservationToTouchHandlerTask::ComputeTargetPoint(std::shared_ptr<InputToTouchContext> &context,
-                                                               const PointerEvent::PointerItem &lastMovePoint,
-                                                               const DpadKeyTypeEnum currentKeyType,
-                                                               Point &targetPoint)
+void KeyboardObservationToTouchHandlerTask::ComputeOffset(std::shared_ptr<InputToTouchContext> &context,
+                                                          const DpadKeyTypeEnum currentKeyType,
+                                                          double stepRatio,
+                                                          double &xOffset,
+                                                          double &yOffset)
 {
-    auto xStep = context->currentPerspectiveObserving.xStep;
-    auto yStep = context->currentPerspectiveObserving.yStep;
+    double xDistance = context->currentPerspectiveObserving.xStep * stepRatio;
+    double yDistance = context->currentPerspectiveObserving.yStep * stepRatio;
     if (currentKeyType == DPAD_UP) {
-        targetPoint.y = std::max(lastMovePoint.GetWindowY() - yStep, 0);
+        yOffset -= yDistance;
     } else if (currentKeyType == DPAD_DOWN) {
-        targetPoint.y = std::min(lastMovePoint.GetWindowY() + yStep, context->windowInfoEntity.maxHeight);
+        yOffset += yDistance;
     } else if (currentKeyType == DPAD_LEFT) {
-        targetPoint.x = std::max(lastMovePoint.GetWindowX() - xStep, 0);
+        xOffset -= xDistance;
     } else {
-        targetPoint.x = std::min(lastMovePoint.GetWindowX() + xStep, context->windowInfoEntity.maxWidth);
+        xOffset += xDistance;
     }
 }
 
+void KeyboardObservationToTouchHandlerTask::ComputeTargetPoint(std::shared_ptr<InputToTouchContext> &context,
+                                                               const PointerEvent::PointerItem &lastMovePoint,
+                                                               double xOffset,
+                                                               double yOffset,
+                                                               Point &targetPoint)
+{
+    xOffset += remainderX_;
+    yOffset += remainderY_;
+    double xPixels = std::trunc(xOffset);
+    double yPixels = std::trunc(yOffset);
+    remainderX_ = xOffset - xPixels;
+    remainderY_ = yOffset - yPixels;
+
+    int32_t maxWidth = context->windowInfoEntity.maxWidth;
+    int32_t maxHeight = context->windowInfoEntity.maxHeight;
+    double x = lastMovePoint.GetWindowX() + xPixels;
+    double y = lastMovePoint.GetWindowY() + yPixels;
+    // the fraction beyond the edge isn't kept, so moving back leaves the edge at once
+    if (x + remainderX_ < 0 || x + remainderX_ > maxWidth) {
+        remainderX_ = 0.0;
+    }
+    if (y + remainderY_ < 0 || y + remainderY_ > maxHeight) {
+        remainderY_ = 0.0;
+    }
+    targetPoint.x = static_cast<int32_t>(std::min(std::max(x, 0.0), static_cast<double>(maxWidth)));
+    targetPoint.y = static_cast<int32_t>(std::min(std::max(y, 0.0), static_cast<double>(maxHeight)));
+}
+
+}
 }
-}
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 
 #include "mouse_left_fire_to_touch_handler.h"
+#include "gamecontroller_utils.h"
 
 namespace OHOS {
 namespace GameController {
@@ -38,7 +39,7 @@ bool MouseLeftFireToTouchHandler::HandleMouseLeftBtnDown(std::shared_ptr<InputTo
     }
 
     if (context->isMouseRightClickOperating) {
-        HILOGW("discard mouse left-button down event. It's mouseRightClickOperating now");
+        HILOGW_LIMIT("discard mouse left-button down event. It's mouseRightClickOperating now");
         return true;
     }
 
@@ -46,13 +47,14 @@ bool MouseLeftFireToTouchHandler::HandleMouseLeftBtnDown(std::shared_ptr<InputTo
         return true;
     }
 
-    HILOGI("convert to down event of mouse-left-fire");
+    HILOGI_LIMIT("convert to down event of mouse-left-fire");
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentMouseLeftClick(pointerId);
     int64_t actionTime = pointerEvent->GetActionTime();
     TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
+    StartRapidFire(context, KEY_CODE_MOUSE_LEFT, mappingInfo, pointerId, StringUtils::GetSysClockTime());
     return true;
 }
 
@@ -65,21 +67,24 @@ void MouseLeftFireToTouchHandler::HandleMouseLeftBtnUp(std::shared_ptr<InputToTo
     }
 
     if (!context->isMouseLeftFireOperating) {
-        HILOGW("discard mouse left-button up event. It's not mouseLeftFireOperating now");
+        HILOGW_LIMIT("discard mouse left-button up event. It's not mouseLeftFireOperating now");
         return;
     }
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_MOUSE_LEFT);
     if (!pair.first) {
-        HILOGW("discard mouse left-button up event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard mouse left-button up event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
 
-    HILOGI("convert to up event of mouse-left-fire");
-    int64_t actionTime = pointerEvent->GetActionTime();
-    TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
-                                               PointerEvent::POINTER_ACTION_UP, actionTime);
-    BuildAndSendPointerEvent(context, touchEntity);
+    HILOGI_LIMIT("convert to up event of mouse-left-fire");
+    // The touch may be released by the repeated taps already.
+    if (StopRapidFire(context, KEY_CODE_MOUSE_LEFT)) {
+        int64_t actionTime = pointerEvent->GetActionTime();
+        TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
+                                                   PointerEvent::POINTER_ACTION_UP, actionTime);
+        BuildAndSendPointerEvent(context, touchEntity);
+    }
     context->ResetCurrentMouseLeftClick();
 }
 }
@@ -33,7 +33,7 @@ void MouseObservationToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToT
     if (BaseKeyToTouchHandler::IsMouseMoveEvent(pointerEvent)) {
         std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
         if (!pair.first) {
-            HILOGW("discard mouse move event. because cannot find the pointerId");
+            HILOGW_LIMIT("discard mouse move event. because cannot find the pointerId");
             return;
         }
         int32_t pointerId = pair.second;
@@ -50,11 +50,11 @@ bool MouseObservationToTouchHandler::HandleMouseRightBtnDown(std::shared_ptr<Inp
     }
 
     if (context->isPerspectiveObserving) {
-        HILOGW("discard mouse right-button down event. It's perspectiveObserving now");
+        HILOGW_LIMIT("discard mouse right-button down event. It's perspectiveObserving now");
         return true;
     }
 
-    HILOGI("convert to down event of mouse-observation");
+    HILOGI_LIMIT("convert to down event of mouse-observation");
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentObserving(mappingInfo, pointerId);
     int64_t actionTime = pointerEvent->GetActionTime();
@@ -64,6 +64,7 @@ bool MouseObservationToTouchHandler::HandleMouseRightBtnDown(std::shared_ptr<Inp
     PointerEvent::PointerItem pointerItem;
     pointerEvent->GetPointerItem(pointerEvent->GetPointerId(), pointerItem);
     context->lastMousePointer = pointerItem;
+    context->lastMouseActionTime = actionTime;
     return true;
 }
 
@@ -75,16 +76,16 @@ void MouseObservationToTouchHandler::HandleMouseRightBtnUp(std::shared_ptr<Input
         return;
     }
     if (!context->isPerspectiveObserving) {
-        HILOGW("discard mouse right-button up event. It's not perspectiveObserving");
+        HILOGW_LIMIT("discard mouse right-button up event. It's not perspectiveObserving");
         return;
     }
     if (context->currentPerspectiveObserving.mappingType != MOUSE_OBSERVATION_TO_TOUCH) {
-        HILOGW("discard mouse right-button up event. mappingType is not same with mouse_observation_to_touch");
+        HILOGW_LIMIT("discard mouse right-button up event. mappingType is not same with mouse_observation_to_touch");
         return;
     }
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     if (!pair.first) {
-        HILOGW("discard mouse right-button up event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard mouse right-button up event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
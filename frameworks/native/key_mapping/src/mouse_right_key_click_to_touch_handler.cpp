@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "mouse_right_key_click_to_touch_handler.h"
+#include "gamecontroller_utils.h"
 
 namespace OHOS {
 namespace GameController {
@@ -37,20 +38,21 @@ bool MouseRightKeyClickToTouchHandler::HandleMouseRightBtnDown(std::shared_ptr<I
     }
 
     if (context->isMouseLeftFireOperating) {
-        HILOGW("discard mouse right-button up event. It's mouseLeftFireOperating now");
+        HILOGW_LIMIT("discard mouse right-button up event. It's mouseLeftFireOperating now");
         return true;
     }
 
     if (context->isMouseRightClickOperating) {
         return true;
     }
-    HILOGI("convert to down event of mouse-right-click");
+    HILOGI_LIMIT("convert to down event of mouse-right-click");
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentMouseRightClick(pointerId);
     int64_t actionTime = pointerEvent->GetActionTime();
     TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
+    StartRapidFire(context, KEY_CODE_MOUSE_RIGHT, mappingInfo, pointerId, StringUtils::GetSysClockTime());
     return true;
 }
 
@@ -63,22 +65,25 @@ void MouseRightKeyClickToTouchHandler::HandleMouseRightBtnUp(std::shared_ptr<Inp
     }
 
     if (!context->isMouseRightClickOperating) {
-        HILOGW("discard mouse right-button up event. It's not mouseRightClickOperating now");
+        HILOGW_LIMIT("discard mouse right-button up event. It's not mouseRightClickOperating now");
         return;
     }
 
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_MOUSE_RIGHT);
     if (!pair.first) {
-        HILOGW("discard mouse right-button up event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard mouse right-button up event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
 
-    HILOGI("convert to up event of mouse-right-click");
-    int64_t actionTime = pointerEvent->GetActionTime();
-    TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
-                                               PointerEvent::POINTER_ACTION_UP, actionTime);
-    BuildAndSendPointerEvent(context, touchEntity);
+    HILOGI_LIMIT("convert to up event of mouse-right-click");
+    // The touch may be released by the repeated taps already.
+    if (StopRapidFire(context, KEY_CODE_MOUSE_RIGHT)) {
+        int64_t actionTime = pointerEvent->GetActionTime();
+        TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
+                                                   PointerEvent::POINTER_ACTION_UP, actionTime);
+        BuildAndSendPointerEvent(context, touchEntity);
+    }
     context->ResetCurrentMouseRightClick();
 }
 }
@@ -24,8 +24,8 @@ const int32_t SLEEP_TIME = 40;
 
 MouseRightKeyWalkingDelayHandleTask::MouseRightKeyWalkingDelayHandleTask()
 {
-    taskQueue_ = std::make_unique<ffrt::queue>("mouse-right-walking-thread",
-                                               ffrt::queue_attr().qos(ffrt::qos_background));
+    taskQueue_ =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("mouse-right-walking-thread");
 }
 
 MouseRightKeyWalkingDelayHandleTask::~MouseRightKeyWalkingDelayHandleTask()
@@ -40,54 +40,69 @@ void MouseRightKeyWalkingDelayHandleTask::StartDelayHandle(std::shared_ptr<Input
         SendUpEvent(context);
         return;
     }
-    HILOGI("Start MouseRightKeyWalkingDelayHandleTask");
-    hasDelayTask_ = true;
+    HILOGI_LIMIT("Start MouseRightKeyWalkingDelayHandleTask. deviceType is [%{public}d]", context->deviceType);
     context->isWalking = false;
     context->currentWalking = KeyToTouchMappingInfo();
-    context_ = context;
-    curTaskHandler_ = taskQueue_->submit_h([this] {
-        DoDelayHandle();
+    DeviceTypeEnum deviceType = context->deviceType;
+    WalkingDelayTask &delayTask = delayTasks_[deviceType];
+    delayTask.hasDelayTask = true;
+    delayTask.context = context;
+    delayTask.taskHandle = taskQueue_->submit_h([this, deviceType] {
+        DoDelayHandle(deviceType);
     }, ffrt::task_attr().name("keyboard-observation-task").delay(delayTime));
 }
 
-bool MouseRightKeyWalkingDelayHandleTask::CancelDelayHandle()
+bool MouseRightKeyWalkingDelayHandleTask::CancelDelayHandle(const std::shared_ptr<InputToTouchContext> &context)
 {
+    if (context == nullptr) {
+        return false;
+    }
     std::lock_guard<ffrt::mutex> lock(taskLock_);
-    HILOGI("Cancel MouseRightKeyWalkingDelayHandleTask. hasDelayTask is [%{public}d]", hasDelayTask_ ? 1 : 0);
-    if (hasDelayTask_) {
-        hasDelayTask_ = false;
-        taskQueue_->cancel(curTaskHandler_);
-        SendUpEvent(context_);
-        context_ = nullptr;
+    auto iter = delayTasks_.find(context->deviceType);
+    if (iter == delayTasks_.end()) {
+        return false;
+    }
+    WalkingDelayTask &delayTask = iter->second;
+    HILOGI_LIMIT("Cancel MouseRightKeyWalkingDelayHandleTask. hasDelayTask is [%{public}d]",
+                 delayTask.hasDelayTask ? 1 : 0);
+    if (delayTask.context != nullptr && delayTask.context != context) {
+        return false;
+    }
+    if (delayTask.hasDelayTask) {
+        delayTask.hasDelayTask = false;
+        taskQueue_->cancel(delayTask.taskHandle);
+        SendUpEvent(delayTask.context);
+        delayTask.context = nullptr;
         return true;
     }
-    context_ = nullptr;
+    delayTask.context = nullptr;
     return false;
 }
 
-void MouseRightKeyWalkingDelayHandleTask::DoDelayHandle()
+void MouseRightKeyWalkingDelayHandleTask::DoDelayHandle(DeviceTypeEnum deviceType)
 {
     std::lock_guard<ffrt::mutex> lock(taskLock_);
-    HILOGI("Execute MouseRightKeyWalkingDelayHandleTask");
-    if (!hasDelayTask_) {
-        HILOGI("The MouseRightKeyWalkingDelayHandleTask has been canceled, so not send up event");
+    HILOGI_LIMIT("Execute MouseRightKeyWalkingDelayHandleTask. deviceType is [%{public}d]", deviceType);
+    WalkingDelayTask &delayTask = delayTasks_[deviceType];
+    if (!delayTask.hasDelayTask) {
+        HILOGI_LIMIT("The MouseRightKeyWalkingDelayHandleTask has been canceled, so not send up event");
         return;
     }
-    if (context_ == nullptr) {
-        HILOGW("The MouseRightKeyWalkingDelayHandleTask's context_ is null, so not send up event");
+    if (delayTask.context == nullptr) {
+        HILOGW_LIMIT("The MouseRightKeyWalkingDelayHandleTask's context is null, so not send up event");
         return;
     }
-    hasDelayTask_ = false;
-    SendUpEvent(context_);
-    context_ = nullptr;
+    delayTask.hasDelayTask = false;
+    SendUpEvent(delayTask.context);
+    delayTask.context = nullptr;
 }
 
 void MouseRightKeyWalkingDelayHandleTask::SendUpEvent(std::shared_ptr<InputToTouchContext> &context)
 {
-    HILOGI("Exit walking by mouse-right-key-walking");
+    HILOGI_LIMIT("Exit walking by mouse-right-key-walking");
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_WALK);
     if (!pair.first) {
-        HILOGW("discard mouse-right up event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard mouse-right up event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
@@ -126,9 +141,9 @@ bool MouseRightKeyWalkingToTouchHandler::HandleMouseRightBtnDown(std::shared_ptr
     if (context->isWalking) {
         return true;
     }
-    HILOGI("Enter walking by mouse-right-key-walking");
+    HILOGI_LIMIT("Enter walking by mouse-right-key-walking");
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
-    DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->CancelDelayHandle();
+    DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->CancelDelayHandle(context);
     context->SetCurrentWalking(mappingInfo, pointerId);
     int64_t actionTime = pointerEvent->GetActionTime();
     TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
@@ -166,7 +181,7 @@ void MouseRightKeyWalkingToTouchHandler::HandleMouseMove(std::shared_ptr<InputTo
 
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_WALK);
     if (!pair.first) {
-        HILOGW("discard mouse move event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard mouse move event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
@@ -24,7 +24,7 @@ void ObservationKeyToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTou
     if (BaseKeyToTouchHandler::IsMouseMoveEvent(pointerEvent)) {
         std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
         if (!pair.first) {
-            HILOGW("discard mouse move event. because cannot find the pointerId");
+            HILOGW_LIMIT("discard mouse move event. because cannot find the pointerId");
             return;
         }
         int32_t pointerId = pair.second;
@@ -33,51 +33,49 @@ void ObservationKeyToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTou
 }
 
 void ObservationKeyToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                                 const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                                 const KeyToTouchMappingInfo &mappingInfo,
-                                                 const DeviceInfo &deviceInfo)
+                                                 const KeyInputSample &sample,
+                                                 const KeyToTouchMappingInfo &mappingInfo)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (context->isPerspectiveObserving) {
         if (context->currentPerspectiveObserving.keyCode != keyCode) {
-            HILOGW("discard keyCode [%{private}d]. It's perspectiveObserving now", keyCode);
+            HILOGW_LIMIT("discard keyCode [%{private}d]. It's perspectiveObserving now", keyCode);
         }
         return;
     }
 
-    HILOGI("keyCode [%{private}d] convert to down event of observation_key_to_touch", keyCode);
+    HILOGI_LIMIT("keyCode [%{private}d] convert to down event of observation_key_to_touch", keyCode);
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentObserving(mappingInfo, pointerId);
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchEntity(context->currentPerspectiveObserving, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
 }
 
 void ObservationKeyToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                                               const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                               const DeviceInfo &deviceInfo)
+                                               const KeyInputSample &sample)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (!context->isPerspectiveObserving) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. No observation-key-operating",
-               keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. No observation-key-operating",
+                     keyCode);
         return;
     }
     if (context->currentPerspectiveObserving.keyCode != keyCode) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. keyCode is not current observation-key-operating keycode",
-               keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. "
+                     "keyCode is not current observation-key-operating keycode", keyCode);
         return;
     }
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     if (!pair.first) {
-        HILOGW("discard keyup event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard keyup event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
     if (context->pointerItems.find(pointerId) != context->pointerItems.end()) {
-        HILOGI("keyCode [%{private}d] convert to up event of observation-key-operating", keyCode);
-        int64_t actionTime = keyEvent->GetActionTime();
+        HILOGI_LIMIT("keyCode [%{private}d] convert to up event of observation-key-operating", keyCode);
+        int64_t actionTime = sample.actionTime;
         PointerEvent::PointerItem lastMovePoint = context->pointerItems[pointerId];
         TouchEntity touchEntity = BuildTouchUpEntity(lastMovePoint, pointerId,
                                                      PointerEvent::POINTER_ACTION_UP, actionTime);
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "rapid_fire_scheduler.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const int64_t MIN_PHASE_DURATION = 1000; // the touch is pressed and released for at least 1ms in every tap
+}
+
+void RapidFireStats::Merge(const RapidFireStats &stats)
+{
+    tickCount += stats.tickCount;
+    totalJitter += stats.totalJitter;
+    maxJitter = std::max(maxJitter, stats.maxJitter);
+    skippedTapCount += stats.skippedTapCount;
+}
+
+void RapidFireScheduler::Start(int64_t startTime, int64_t interval, int64_t pressDuration)
+{
+    isRunning_ = interval >= MIN_PHASE_DURATION * 2;
+    isPressed_ = isRunning_;
+    startTime_ = startTime;
+    interval_ = interval;
+    pressDuration_ = std::min(std::max(pressDuration, MIN_PHASE_DURATION), interval - MIN_PHASE_DURATION);
+    cycle_ = 0;
+    stats_ = RapidFireStats();
+}
+
+void RapidFireScheduler::Stop()
+{
+    isRunning_ = false;
+    isPressed_ = false;
+}
+
+int64_t RapidFireScheduler::GetNextDeadline() const
+{
+    int64_t pressTime = GetPressTime(cycle_);
+    return isPressed_ ? pressTime + pressDuration_ : pressTime;
+}
+
+RapidFireActionEnum RapidFireScheduler::OnTick(int64_t currentTime)
+{
+    int64_t deadline = GetNextDeadline();
+    if (!isRunning_ || currentTime < deadline) {
+        return RAPID_FIRE_NONE;
+    }
+    int64_t jitter = currentTime - deadline;
+    stats_.tickCount++;
+    stats_.totalJitter += jitter;
+    stats_.maxJitter = std::max(stats_.maxJitter, jitter);
+
+    if (isPressed_) {
+        isPressed_ = false;
+        MoveToNextCycle(currentTime);
+        return RAPID_FIRE_RELEASE;
+    }
+    if (currentTime >= GetPressTime(cycle_) + pressDuration_) {
+        // The release of this tap is due already, so it can't be pressed.
+        stats_.skippedTapCount++;
+        MoveToNextCycle(currentTime);
+        return RAPID_FIRE_NONE;
+    }
+    isPressed_ = true;
+    return RAPID_FIRE_PRESS;
+}
+
+void RapidFireScheduler::MoveToNextCycle(int64_t currentTime)
+{
+    // The first tap pressed after now, so the touch is released for a while before it's pressed again.
+    // The taps whose presses are passed are skipped.
+    int64_t nextCycle = (currentTime - startTime_) / interval_ + 1;
+    nextCycle = std::max(nextCycle, cycle_ + 1);
+    stats_.skippedTapCount += static_cast<uint32_t>(nextCycle - cycle_ - 1);
+    cycle_ = nextCycle;
+}
+}
+}
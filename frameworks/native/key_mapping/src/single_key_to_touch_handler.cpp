@@ -19,48 +19,46 @@
 namespace OHOS {
 namespace GameController {
 void SingleKeyToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                            const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                            const KeyToTouchMappingInfo &mappingInfo,
-                                            const DeviceInfo &deviceInfo)
+                                            const KeyInputSample &sample,
+                                            const KeyToTouchMappingInfo &mappingInfo)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (context->HasSingleKeyDown(keyCode)) {
         return;
     }
 
-    HILOGI("keyCode [%{private}d] convert to down event of single-key-to-touch", keyCode);
+    HILOGI_LIMIT("keyCode [%{private}d] convert to down event of single-key-to-touch", keyCode);
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentSingleKeyInfo(mappingInfo, pointerId);
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchEntity(mappingInfo, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
 }
 
 void SingleKeyToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                                          const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                          const DeviceInfo &deviceInfo)
+                                          const KeyInputSample &sample)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (!context->HasSingleKeyDown(keyCode)) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. No single-key-operating",
-               keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. No single-key-operating",
+                     keyCode);
         return;
     }
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(keyCode);
     if (!pair.first) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event, because cannot find the pointerId", keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event, because cannot find the pointerId", keyCode);
         return;
     }
     int32_t pointerId = pair.second;
     if (context->pointerItems.find(pointerId) == context->pointerItems.end()) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event, because cannot find the last point event", keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event, because cannot find the last point event", keyCode);
         return;
     }
     PointerEvent::PointerItem lastMovePoint = context->pointerItems[pointerId];
 
-    HILOGI("keyCode [%{private}d] convert to up event of single-key-to-touch", keyCode);
-    int64_t actionTime = keyEvent->GetActionTime();
+    HILOGI_LIMIT("keyCode [%{private}d] convert to up event of single-key-to-touch", keyCode);
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchUpEntity(lastMovePoint, pointerId,
                                                  PointerEvent::POINTER_ACTION_UP, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
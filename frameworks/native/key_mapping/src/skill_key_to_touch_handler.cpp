@@ -82,7 +82,7 @@ void SkillKeyToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouchCont
                                                 const KeyToTouchMappingInfo &mappingInfo)
 {
     if (pointerEvent == nullptr) {
-        HILOGW("pointerEvent is nullptr");
+        HILOGW_LIMIT("pointerEvent is nullptr");
         return;
     }
     if (IsNeedHandlePointEvent(context, pointerEvent)) {
@@ -92,56 +92,54 @@ void SkillKeyToTouchHandler::HandlePointerEvent(std::shared_ptr<InputToTouchCont
 }
 
 void SkillKeyToTouchHandler::HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                                           const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                           const KeyToTouchMappingInfo &mappingInfo,
-                                           const DeviceInfo &deviceInfo)
+                                           const KeyInputSample &sample,
+                                           const KeyToTouchMappingInfo &mappingInfo)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (context->isSkillOperating) {
         if (context->currentSkillKeyInfo.keyCode != keyCode) {
-            HILOGW("discard keyCode [%{private}d]. It's skill-operating now", keyCode);
+            HILOGW_LIMIT("discard keyCode [%{private}d]. It's skill-operating now", keyCode);
         }
         return;
     }
 
-    HILOGI("keyCode [%{private}d] convert to down event of skill-to-touch", keyCode);
+    HILOGI_LIMIT("keyCode [%{private}d] convert to down event of skill-to-touch", keyCode);
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context->SetCurrentSkillKeyInfo(mappingInfo, pointerId);
-    int64_t actionTime = keyEvent->GetActionTime();
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchEntity(context->currentSkillKeyInfo, pointerId,
                                                PointerEvent::POINTER_ACTION_DOWN, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
 }
 
 void SkillKeyToTouchHandler::HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                                         const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                                         const DeviceInfo &deviceInfo)
+                                         const KeyInputSample &sample)
 {
-    int32_t keyCode = keyEvent->GetKeyCode();
+    int32_t keyCode = sample.keyCode;
     if (!context->isSkillOperating) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. No skill-operating",
-               keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. No skill-operating",
+                     keyCode);
         return;
     }
     if (context->currentSkillKeyInfo.keyCode != keyCode) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. keyCode is not current skill-operating keycode",
-               keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. keyCode is not current skill-operating keycode",
+                     keyCode);
         return;
     }
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_SKILL);
     if (!pair.first) {
-        HILOGW("discard keyCode [%{private}d]'s keyup event. because cannot find the pointerId", keyCode);
+        HILOGW_LIMIT("discard keyCode [%{private}d]'s keyup event. because cannot find the pointerId", keyCode);
         return;
     }
     int32_t pointerId = pair.second;
     if (context->pointerItems.find(pointerId) == context->pointerItems.end()) {
-        HILOGW("discard button event, because cannot find the last point event");
+        HILOGW_LIMIT("discard button event, because cannot find the last point event");
         return;
     }
     PointerEvent::PointerItem lastMovePoint = context->pointerItems[pointerId];
 
-    HILOGI("keyCode [%{private}d] convert to up event of skill-to-touch", keyCode);
-    int64_t actionTime = keyEvent->GetActionTime();
+    HILOGI_LIMIT("keyCode [%{private}d] convert to up event of skill-to-touch", keyCode);
+    int64_t actionTime = sample.actionTime;
     TouchEntity touchEntity = BuildTouchUpEntity(lastMovePoint, pointerId,
                                                  PointerEvent::POINTER_ACTION_UP, actionTime);
     BuildAndSendPointerEvent(context, touchEntity);
@@ -194,7 +192,7 @@ void SkillKeyToTouchHandler::HandleMouseMove(std::shared_ptr<InputToTouchContext
 
     std::pair<bool, int32_t> pair = context->GetPointerIdByKeyCode(KEY_CODE_SKILL);
     if (!pair.first) {
-        HILOGW("discard mouse move event. because cannot find the pointerId");
+        HILOGW_LIMIT("discard mouse move event. because cannot find the pointerId");
         return;
     }
     int32_t pointerId = pair.second;
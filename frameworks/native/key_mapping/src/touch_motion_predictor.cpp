@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include "touch_motion_predictor.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+/**
+ * The velocity is computed from the samples in the last 32ms.
+ */
+const int64_t VELOCITY_WINDOW = 32000;
+
+const int64_t MAX_LATENCY = 200000;
+const int64_t MAX_HORIZON = 50000;
+
+/**
+ * The touch is moved ahead by 64px at most.
+ */
+const double MAX_OVERSHOOT = 64.0;
+
+/**
+ * The weight of a new latency in the smoothed latency is 1/8.
+ */
+const int64_t LATENCY_SMOOTHING = 8;
+}
+
+void TouchMotionPredictor::SetEnabled(bool isEnabled)
+{
+    isEnabled_ = isEnabled;
+    Reset();
+}
+
+void TouchMotionPredictor::SetExtraHorizon(int64_t extraHorizon)
+{
+    extraHorizon_ = std::max(extraHorizon, static_cast<int64_t>(0));
+}
+
+void TouchMotionPredictor::Reset()
+{
+    head_ = 0;
+    count_ = 0;
+    hasInjectedPoint_ = false;
+}
+
+void TouchMotionPredictor::AddSample(double x, double y, int64_t time)
+{
+    if (count_ > 0) {
+        int64_t elapsedTime = time - GetSample(0).time;
+        if (elapsedTime < 0 || elapsedTime > MAX_SAMPLE_GAP) {
+            Reset();
+        }
+    }
+    MotionSample &sample = samples_[head_];
+    sample.x = x;
+    sample.y = y;
+    sample.time = time;
+    head_ = (head_ + 1) % SAMPLE_CAPACITY;
+    count_ = std::min(count_ + 1, SAMPLE_CAPACITY);
+}
+
+void TouchMotionPredictor::UpdateLatency(int64_t latency)
+{
+    if (latency < 0 || latency > MAX_LATENCY) {
+        return;
+    }
+    if (latency_ < 0) {
+        latency_ = latency;
+        return;
+    }
+    latency_ += (latency - latency_) / LATENCY_SMOOTHING;
+}
+
+bool TouchMotionPredictor::Predict(double &x, double &y) const
+{
+    if (count_ == 0) {
+        return false;
+    }
+    const MotionSample &last = GetSample(0);
+    x = last.x;
+    y = last.y;
+    int64_t horizon = GetHorizon();
+    if (count_ < 2 || horizon <= 0) {
+        return false;
+    }
+
+    // The oldest sample in the window gives the average velocity, and the previous one gives the last velocity.
+    const MotionSample &previous = GetSample(1);
+    size_t oldestIndex = 1;
+    while (oldestIndex + 1 < count_ && last.time - GetSample(oldestIndex + 1).time <= VELOCITY_WINDOW) {
+        oldestIndex++;
+    }
+    const MotionSample &oldest = GetSample(oldestIndex);
+    if (last.time <= previous.time || last.time <= oldest.time) {
+        return false;
+    }
+    double averageTime = static_cast<double>(last.time - oldest.time);
+    double xVelocity = (last.x - oldest.x) / averageTime;
+    double yVelocity = (last.y - oldest.y) / averageTime;
+    double lastTime = static_cast<double>(last.time - previous.time);
+    double xLastVelocity = (last.x - previous.x) / lastTime;
+    double yLastVelocity = (last.y - previous.y) / lastTime;
+
+    // The hand is slowing down, so the last velocity is closer to where it stops.
+    if (std::hypot(xLastVelocity, yLastVelocity) < std::hypot(xVelocity, yVelocity)) {
+        xVelocity = xLastVelocity;
+        yVelocity = yLastVelocity;
+    }
+    double xOffset = xVelocity * horizon;
+    double yOffset = yVelocity * horizon;
+    double overshoot = std::hypot(xOffset, yOffset);
+    if (overshoot > MAX_OVERSHOOT) {
+        xOffset *= MAX_OVERSHOOT / overshoot;
+        yOffset *= MAX_OVERSHOOT / overshoot;
+    }
+    x += xOffset;
+    y += yOffset;
+    return true;
+}
+
+bool TouchMotionPredictor::GetLastSample(MotionSample &sample) const
+{
+    if (count_ == 0) {
+        return false;
+    }
+    sample = GetSample(0);
+    return true;
+}
+
+int64_t TouchMotionPredictor::GetHorizon() const
+{
+    return std::min(std::max(latency_, static_cast<int64_t>(0)) + extraHorizon_, MAX_HORIZON);
+}
+
+void TouchMotionPredictor::SetInjectedPoint(int32_t x, int32_t y)
+{
+    hasInjectedPoint_ = true;
+    injectedX_ = x;
+    injectedY_ = y;
+}
+
+bool TouchMotionPredictor::IsInjectedPoint(int32_t x, int32_t y) const
+{
+    return hasInjectedPoint_ && injectedX_ == x && injectedY_ == y;
+}
+
+const MotionSample &TouchMotionPredictor::GetSample(size_t index) const
+{
+    // index 0 is the last sample
+    return samples_[(head_ + SAMPLE_CAPACITY - 1 - index) % SAMPLE_CAPACITY];
+}
+}
+}
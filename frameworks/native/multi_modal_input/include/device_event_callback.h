@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include "gamecontroller_client_model.h"
 #include "ffrt.h"
+#include "gamecontroller_queue_registry.h"
 
 namespace OHOS {
 namespace GameController {
@@ -63,7 +64,7 @@ private:
     /**
      * Device online and offline processing queue
      */
-    std::unique_ptr<ffrt::queue> deviceQueryQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> deviceQueryQueue_{nullptr};
 };
 }
 }
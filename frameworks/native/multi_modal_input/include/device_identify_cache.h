@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_DEVICE_IDENTIFY_CACHE_H
+#define GAME_CONTROLLER_DEVICE_IDENTIFY_CACHE_H
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include "nlohmann/json.hpp"
+#include "gamecontroller_client_model.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * The generation of the identification rules, published by the service whenever the rules are changed.
+ */
+const std::string DEVICE_RULE_GENERATION_PATH =
+    "/data/service/el1/public/for-all-app/gamecontroller_server/device_rule_generation.json";
+
+const std::string DEVICE_IDENTIFY_CACHE_PATH = "/data/storage/el2/base/cache/gamecontroller_device_identify.json";
+
+const size_t DEVICE_IDENTIFY_CACHE_CAPACITY = 64;
+
+/**
+ * The device types identified by the service, saved in the app's cache directory.
+ * A device is found by its fingerprint, which is made of what the rules of the service match:
+ * the vendor, the product and the name.
+ * All the types belong to one generation of the rules, and they are dropped when the generation is changed.
+ * It's not thread-safe.
+ */
+class DeviceIdentifyCache {
+public:
+    DeviceIdentifyCache(const std::string &generationPath, const std::string &cachePath, size_t capacity);
+
+    ~DeviceIdentifyCache() = default;
+
+    /**
+     * Read the generation of the rules which the service uses now.
+     * @param generation the generation read
+     * @return false means it's not published, so no device can be identified by the cache
+     */
+    bool ReadRuleGeneration(int64_t &generation) const;
+
+    /**
+     * Find the device type identified under the generation.
+     * @param deviceInfo the device
+     * @param generation the generation of the rules now
+     * @param deviceType the device type found
+     * @return true means it's found
+     */
+    bool Find(const DeviceInfo &deviceInfo, int64_t generation, DeviceTypeEnum &deviceType);
+
+    /**
+     * Put the device type identified by the service.
+     * The types of the other generations are dropped.
+     * @param deviceInfo the device
+     * @param generation the generation read before the service is requested
+     * @param deviceType the device type identified
+     */
+    void Put(const DeviceInfo &deviceInfo, int64_t generation, DeviceTypeEnum deviceType);
+
+    /**
+     * Write the cache to the file if it's changed.
+     */
+    void Save();
+
+    size_t Size();
+
+    /**
+     * The devices without the vendor and the product, such as the virtual ones, are always sent to the service.
+     */
+    static bool IsCacheable(const DeviceInfo &deviceInfo);
+
+private:
+    struct CachedDevice {
+        int32_t vendor = 0;
+        int32_t product = 0;
+        std::string name;
+        DeviceTypeEnum deviceType = DeviceTypeEnum::UNKNOWN;
+    };
+
+    static std::string GetFingerprint(int32_t vendor, int32_t product, const std::string &name);
+
+    static std::pair<bool, nlohmann::json> ReadJsonFromFile(const std::string &path);
+
+    void LoadIfNeeded();
+
+    void Add(const CachedDevice &device);
+
+private:
+    std::string generationPath_;
+    std::string cachePath_;
+    size_t capacity_;
+    bool isLoaded_{false};
+    bool isChanged_{false};
+    int64_t generation_{0};
+
+    /**
+     * Fingerprint and the device.
+     */
+    std::unordered_map<std::string, CachedDevice> devices_;
+
+    /**
+     * The fingerprints in the order they are added. The oldest one is dropped when the cache is full.
+     */
+    std::deque<std::string> fingerprints_;
+};
+}
+}
+#endif //GAME_CONTROLLER_DEVICE_IDENTIFY_CACHE_H
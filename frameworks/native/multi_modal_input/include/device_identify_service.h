@@ -19,7 +19,9 @@
 
 #include <singleton.h>
 #include <unordered_map>
+#include <cpp/mutex.h>
 #include "gamecontroller_client_model.h"
+#include "device_identify_cache.h"
 
 namespace OHOS {
 namespace GameController {
@@ -30,14 +32,31 @@ class DeviceIdentifyService : public DelayedSingleton<DeviceIdentifyService> {
 DECLARE_DELAYED_SINGLETON(DeviceIdentifyService);
 public:
     /**
-     * Identifying Device Types in Batches
+     * Identifying Device Types in Batches.
+     * The devices identified under the current rules are found in the cache,
+     * and only the others are identified by the service.
      * @param deviceInfos Devices to be identified
      * @return Identification result
      */
     virtual std::vector<DeviceInfo> IdentifyDeviceType(const std::vector<DeviceInfo> &deviceInfos);
 
 private:
+    /**
+     * Take the devices found in the cache out of the deviceInfos.
+     * @param generation the generation of the rules now
+     * @param deviceInfos Devices to be identified. The devices not found are left.
+     * @return the devices found, with the device type set
+     */
+    std::vector<DeviceInfo> TakeCachedDevices(int64_t generation, std::vector<DeviceInfo> &deviceInfos);
+
+    void PutCachedDevices(int64_t generation, const std::vector<DeviceInfo> &result);
+
     bool HasFullKeyboard(const DeviceInfo &deviceInfo);
+
+private:
+    ffrt::mutex cacheMutex_;
+    DeviceIdentifyCache identifyCache_{DEVICE_RULE_GENERATION_PATH, DEVICE_IDENTIFY_CACHE_PATH,
+                                       DEVICE_IDENTIFY_CACHE_CAPACITY};
 };
 }
 }
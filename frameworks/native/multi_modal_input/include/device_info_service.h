@@ -20,6 +20,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <singleton.h>
+#include <unordered_map>
 #include <unordered_set>
 #include "input_device.h"
 #include "gamecontroller_client_model.h"
@@ -107,6 +108,20 @@ struct InputDeviceInfo {
     }
 };
 
+/**
+ * The capability of an input device, which doesn't change until the device is removed.
+ */
+struct InputDeviceCapability {
+    std::unordered_set<InputSourceTypeEnum> sourceTypeSet;
+
+    /**
+     * The keyboard type. It's only queried when sourceTypeSet contains the keyboard.
+     */
+    int32_t keyboardType{0};
+
+    bool isFullKeyboard{false};
+};
+
 /**
  * Querying device information from asynchronous to synchronous
  */
@@ -129,6 +144,22 @@ public:
      */
     virtual std::pair<int32_t, int32_t> GetKeyBoardType(int32_t id);
 
+    /**
+     * Get the capability of the input device. It's queried once, and cached until the device is removed.
+     * A failed query is not cached, so it's tried again next time.
+     * @param id the id of the input device
+     * @param sourceTypeSet the source types of the input device
+     * @return first indicates the query result, and second indicates the capability.
+     */
+    std::pair<int32_t, InputDeviceCapability> GetDeviceCapability(
+        int32_t id, const std::unordered_set<InputSourceTypeEnum> &sourceTypeSet);
+
+    /**
+     * Drop the capability when the device is removed.
+     * @param id the id of the input device
+     */
+    void RemoveDeviceCapability(int32_t id);
+
     /**
      * Setting the current device information
      * @param inputDevice Device Information
@@ -205,6 +236,14 @@ private:
     int32_t keyboardType_{0};
 
     bool isFoldPc_{false};
+
+    /**
+     * The capabilities of the input devices. The key is the id of the input device.
+     * It's guarded by capabilityMutex_ instead of taskMutex_, so a lookup never waits for a query.
+     */
+    std::unordered_map<int32_t, InputDeviceCapability> capabilities_;
+
+    std::mutex capabilityMutex_;
 };
 }
 }
@@ -16,12 +16,15 @@
 #define GAME_CONTROLLER_MULTI_MODAL_INPUT_MGT_SERVICE_H
 
 #include <condition_variable>
+#include <functional>
 #include "singleton.h"
 #include "input_device_listener.h"
 #include "gamecontroller_constants.h"
 #include "gamecontroller_client_model.h"
 #include "device_info_service.h"
 #include "ffrt.h"
+#include "gamecontroller_queue_registry.h"
+#include "gamecontroller_utils.h"
 
 namespace OHOS {
 namespace GameController {
@@ -63,6 +66,7 @@ public:
 
     /**
      * The same device has multiple device status change events. Therefore, the processing needs to be delayed.
+     * A lone event is handled at once. During a burst, the events are handled together when it's quiet.
      * @param deviceChangeEvent Device change event
      */
     virtual void DelayHandleDeviceChangeEvent(const DeviceChangeEvent &deviceChangeEvent);
@@ -87,6 +91,13 @@ private:
      */
     void HandleDeviceChangeEvent();
 
+    /**
+     * Submit the task of HandleDeviceChangeEvent
+     * @param delayTime the delay in microseconds
+     * @return false means it's failed, and needStartDelayHandle_ is reset
+     */
+    bool SubmitDeviceChangeTask(int64_t delayTime);
+
     /**
      * Processing Device Offline Events
      * @param deviceId Device ID.
@@ -151,6 +162,19 @@ private:
 
     void CheckDeviceType(DeviceInfo &deviceInfo);
 
+    static bool IsDeviceOfType(const DeviceInfo &deviceInfo, DeviceTypeEnum deviceTypeEnum);
+
+    /**
+     * Add the device to uniqsByDeviceType_. It's called whenever a device is put into deviceInfoByUniqMap_.
+     */
+    void AddDeviceTypeIndex(const DeviceInfo &deviceInfo);
+
+    /**
+     * Remove the device from uniqsByDeviceType_. It's called whenever a device in deviceInfoByUniqMap_
+     * is replaced or erased.
+     */
+    void RemoveDeviceTypeIndex(const DeviceInfo &deviceInfo);
+
 private:
 
     /**
@@ -167,6 +191,13 @@ private:
      */
     std::unordered_map<int32_t, std::string> deviceIdUniqMap_;
 
+    /**
+     * Index of deviceInfoByUniqMap_ by device type
+     * The key is the device type. The devices which have a full keyboard are also under GAME_KEY_BOARD.
+     * The value is the uniqs of the devices.
+     */
+    std::unordered_map<int32_t, std::unordered_set<std::string>> uniqsByDeviceType_;
+
     /**
      * Device change event lock
      */
@@ -182,15 +213,35 @@ private:
      */
     bool needStartDelayHandle_{true};
 
+    /**
+     * The clock of the debounce, in microseconds. The tests replace it to drive the debounce.
+     */
+    std::function<int64_t()> debounceClock_{StringUtils::GetSysClockTime};
+
+    /**
+     * The time of the last device change event, in microseconds
+     */
+    int64_t lastDeviceChangeTime_{0};
+
+    /**
+     * The time of the first event which is cached
+     */
+    int64_t batchStartTime_{0};
+
+    /**
+     * Whether the cached events are a burst, so the task waits until it's quiet.
+     */
+    bool isBurstBatch_{false};
+
     /**
      * Device online and offline processing queue
      */
-    std::unique_ptr<ffrt::queue> deviceTaskQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> deviceTaskQueue_{nullptr};
 
     /**
      * Event callback queue
      */
-    std::unique_ptr<ffrt::queue> eventCallbackQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> eventCallbackQueue_{nullptr};
 };
 }
 }
@@ -23,8 +23,7 @@ namespace OHOS {
 namespace GameController {
 DeviceEventCallback::DeviceEventCallback()
 {
-    deviceQueryQueue_ = std::make_unique<ffrt::queue>("deviceQueryQueue_",
-                                                      ffrt::queue_attr().qos(ffrt::qos_default));
+    deviceQueryQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("deviceQueryQueue_");
 }
 
 DeviceEventCallback::~DeviceEventCallback()
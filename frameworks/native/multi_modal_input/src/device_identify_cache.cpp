@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include "device_identify_cache.h"
+#include "gamecontroller_log.h"
+
+using json = nlohmann::json;
+namespace OHOS {
+namespace GameController {
+namespace {
+const char* FIELD_GENERATION = "generation";
+const char* FIELD_DEVICES = "devices";
+const char* FIELD_VENDOR = "vendor";
+const char* FIELD_PRODUCT = "product";
+const char* FIELD_NAME = "name";
+const char* FIELD_DEVICE_TYPE = "deviceType";
+const char* TEMP_FILE_SUFFIX = ".tmp";
+}
+
+DeviceIdentifyCache::DeviceIdentifyCache(const std::string &generationPath, const std::string &cachePath,
+                                         size_t capacity)
+    : generationPath_(generationPath), cachePath_(cachePath), capacity_(capacity)
+{
+}
+
+bool DeviceIdentifyCache::ReadRuleGeneration(int64_t &generation) const
+{
+    std::pair<bool, json> ret = ReadJsonFromFile(generationPath_);
+    if (!ret.first || !ret.second.is_object() || !ret.second.contains(FIELD_GENERATION)
+        || !ret.second.at(FIELD_GENERATION).is_number_integer()) {
+        return false;
+    }
+    generation = ret.second.at(FIELD_GENERATION).get<int64_t>();
+    return true;
+}
+
+bool DeviceIdentifyCache::Find(const DeviceInfo &deviceInfo, int64_t generation, DeviceTypeEnum &deviceType)
+{
+    if (!IsCacheable(deviceInfo)) {
+        return false;
+    }
+    LoadIfNeeded();
+    if (generation != generation_) {
+        return false;
+    }
+    auto iter = devices_.find(GetFingerprint(deviceInfo.vendor, deviceInfo.product, deviceInfo.name));
+    if (iter == devices_.end()) {
+        return false;
+    }
+    deviceType = iter->second.deviceType;
+    return true;
+}
+
+void DeviceIdentifyCache::Put(const DeviceInfo &deviceInfo, int64_t generation, DeviceTypeEnum deviceType)
+{
+    if (!IsCacheable(deviceInfo)) {
+        return;
+    }
+    LoadIfNeeded();
+    if (generation != generation_) {
+        HILOGI("The rule generation is changed from [%{public}lld] to [%{public}lld], drop [%{public}zu] devices.",
+               static_cast<long long>(generation_), static_cast<long long>(generation), devices_.size());
+        devices_.clear();
+        fingerprints_.clear();
+        generation_ = generation;
+        isChanged_ = true;
+    }
+    CachedDevice device;
+    device.vendor = deviceInfo.vendor;
+    device.product = deviceInfo.product;
+    device.name = deviceInfo.name;
+    device.deviceType = deviceType;
+    Add(device);
+}
+
+void DeviceIdentifyCache::Save()
+{
+    if (!isChanged_) {
+        return;
+    }
+    isChanged_ = false;
+    json jsonContent;
+    jsonContent[FIELD_GENERATION] = generation_;
+    jsonContent[FIELD_DEVICES] = json::array();
+    for (const auto &fingerprint: fingerprints_) {
+        const CachedDevice &device = devices_[fingerprint];
+        json deviceJson;
+        deviceJson[FIELD_VENDOR] = device.vendor;
+        deviceJson[FIELD_PRODUCT] = device.product;
+        deviceJson[FIELD_NAME] = device.name;
+        deviceJson[FIELD_DEVICE_TYPE] = static_cast<int32_t>(device.deviceType);
+        jsonContent[FIELD_DEVICES].push_back(deviceJson);
+    }
+
+    // Written to a temporary file first, so a broken write never leaves a half file.
+    std::string tempPath = cachePath_ + TEMP_FILE_SUFFIX;
+    std::ofstream outfile(tempPath, std::ios::trunc);
+    if (!outfile.is_open()) {
+        HILOGW("open the device identify cache failed.");
+        return;
+    }
+    outfile << jsonContent.dump(-1, ' ', false, json::error_handler_t::replace);
+    outfile.close();
+    if (outfile.fail() || std::rename(tempPath.c_str(), cachePath_.c_str()) != 0) {
+        HILOGW("save the device identify cache failed.");
+        std::remove(tempPath.c_str());
+    }
+}
+
+size_t DeviceIdentifyCache::Size()
+{
+    LoadIfNeeded();
+    return devices_.size();
+}
+
+bool DeviceIdentifyCache::IsCacheable(const DeviceInfo &deviceInfo)
+{
+    return deviceInfo.vendor != 0 || deviceInfo.product != 0;
+}
+
+std::string DeviceIdentifyCache::GetFingerprint(int32_t vendor, int32_t product, const std::string &name)
+{
+    return std::to_string(vendor) + ":" + std::to_string(product) + ":" + name;
+}
+
+std::pair<bool, json> DeviceIdentifyCache::ReadJsonFromFile(const std::string &path)
+{
+    json content;
+    char canonicalPath[PATH_MAX] = {};
+    if (realpath(path.c_str(), canonicalPath) == nullptr) {
+        return std::make_pair(false, content);
+    }
+
+    std::ifstream ifs(canonicalPath, std::ios::binary);
+    if (!ifs.is_open()) {
+        HILOGW("open [%{public}s] file failed.", canonicalPath);
+        return std::make_pair(false, content);
+    }
+    content = json::parse(ifs, nullptr, false);
+    if (content.is_discarded()) {
+        HILOGW("parse [%{public}s] file failed.", canonicalPath);
+        return std::make_pair(false, content);
+    }
+    return std::make_pair(true, content);
+}
+
+void DeviceIdentifyCache::LoadIfNeeded()
+{
+    if (isLoaded_) {
+        return;
+    }
+    isLoaded_ = true;
+    std::pair<bool, json> ret = ReadJsonFromFile(cachePath_);
+    if (!ret.first || !ret.second.is_object() || !ret.second.contains(FIELD_GENERATION)
+        || !ret.second.at(FIELD_GENERATION).is_number_integer()
+        || !ret.second.contains(FIELD_DEVICES) || !ret.second.at(FIELD_DEVICES).is_array()) {
+        return;
+    }
+    generation_ = ret.second.at(FIELD_GENERATION).get<int64_t>();
+    for (const auto &deviceJson: ret.second.at(FIELD_DEVICES)) {
+        if (!deviceJson.is_object()) {
+            continue;
+        }
+        CachedDevice device;
+        if (deviceJson.contains(FIELD_VENDOR) && deviceJson.at(FIELD_VENDOR).is_number_integer()) {
+            device.vendor = deviceJson.at(FIELD_VENDOR).get<int32_t>();
+        }
+        if (deviceJson.contains(FIELD_PRODUCT) && deviceJson.at(FIELD_PRODUCT).is_number_integer()) {
+            device.product = deviceJson.at(FIELD_PRODUCT).get<int32_t>();
+        }
+        if (deviceJson.contains(FIELD_NAME) && deviceJson.at(FIELD_NAME).is_string()) {
+            device.name = deviceJson.at(FIELD_NAME).get<std::string>();
+        }
+        if (!deviceJson.contains(FIELD_DEVICE_TYPE) || !deviceJson.at(FIELD_DEVICE_TYPE).is_number_integer()) {
+            continue;
+        }
+        int32_t deviceType = deviceJson.at(FIELD_DEVICE_TYPE).get<int32_t>();
+        if (deviceType < DeviceTypeEnum::UNKNOWN || deviceType > DeviceTypeEnum::GAME_MOUSE) {
+            continue;
+        }
+        device.deviceType = static_cast<DeviceTypeEnum>(deviceType);
+        Add(device);
+    }
+    isChanged_ = false;
+    HILOGI("[%{public}zu] devices are loaded from the device identify cache.", devices_.size());
+}
+
+void DeviceIdentifyCache::Add(const CachedDevice &device)
+{
+    std::string fingerprint = GetFingerprint(device.vendor, device.product, device.name);
+    auto iter = devices_.find(fingerprint);
+    if (iter != devices_.end()) {
+        if (iter->second.deviceType != device.deviceType) {
+            iter->second.deviceType = device.deviceType;
+            isChanged_ = true;
+        }
+        return;
+    }
+    while (!fingerprints_.empty() && fingerprints_.size() >= capacity_) {
+        devices_.erase(fingerprints_.front());
+        fingerprints_.pop_front();
+    }
+    devices_[fingerprint] = device;
+    fingerprints_.push_back(fingerprint);
+    isChanged_ = true;
+}
+
+}
+}
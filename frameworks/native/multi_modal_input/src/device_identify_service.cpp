@@ -21,10 +21,6 @@
 
 namespace OHOS {
 namespace GameController {
-namespace {
-const int32_t ALPHABETIC_KEYBOARD_TYPE = 2; // Full keyboard
-}
-
 DeviceIdentifyService::DeviceIdentifyService()
 {
 }
@@ -39,13 +35,33 @@ std::vector<DeviceInfo> DeviceIdentifyService::IdentifyDeviceType(const std::vec
     if (deviceInfos.empty()) {
         return result;
     }
+    int64_t generation = 0;
+    bool hasGeneration = identifyCache_.ReadRuleGeneration(generation);
+    std::vector<DeviceInfo> unknownDevices(deviceInfos);
+    std::vector<DeviceInfo> cachedDevices;
+    if (hasGeneration) {
+        cachedDevices = TakeCachedDevices(generation, unknownDevices);
+    }
+    for (auto &deviceInfo: cachedDevices) {
+        if (deviceInfo.deviceType == DeviceTypeEnum::UNKNOWN) {
+            deviceInfo.hasFullKeyBoard = HasFullKeyboard(deviceInfo);
+        }
+    }
+    if (unknownDevices.empty()) {
+        HILOGI("All the [%{public}zu] devices are identified by the cache.", cachedDevices.size());
+        return cachedDevices;
+    }
+
     std::unordered_map<std::string, DeviceInfo> deviceMap;
-    for (const auto &deviceInfo: deviceInfos) {
+    for (const auto &deviceInfo: unknownDevices) {
         deviceMap[deviceInfo.uniq] = deviceInfo;
     }
 
-    int32_t ret = DelayedSingleton<GameControllerServerClient>::GetInstance()->IdentifyDevice(deviceInfos, result);
+    int32_t ret = DelayedSingleton<GameControllerServerClient>::GetInstance()->IdentifyDevice(unknownDevices, result);
     if (ret == GAME_CONTROLLER_SUCCESS) {
+        if (hasGeneration) {
+            PutCachedDevices(generation, result);
+        }
         for (auto &deviceInfo: result) {
             if (deviceMap.count(deviceInfo.uniq) != 0) {
                 deviceInfo.idSourceTypeMap = deviceMap[deviceInfo.uniq].idSourceTypeMap;
@@ -62,36 +78,67 @@ std::vector<DeviceInfo> DeviceIdentifyService::IdentifyDeviceType(const std::vec
              */
             deviceInfo.hasFullKeyBoard = HasFullKeyboard(deviceInfo);
         }
+        result.insert(result.end(), cachedDevices.begin(), cachedDevices.end());
         return result;
     }
     HILOGE("IdentifyDeviceType failed. the error is %{public}d", ret);
-    for (auto deviceInfo: deviceInfos) {
+    for (auto deviceInfo: unknownDevices) {
         deviceInfo.hasFullKeyBoard = HasFullKeyboard(deviceInfo);
         result.push_back(deviceInfo);
     }
+    result.insert(result.end(), cachedDevices.begin(), cachedDevices.end());
     return result;
 }
 
+std::vector<DeviceInfo> DeviceIdentifyService::TakeCachedDevices(int64_t generation,
+                                                                 std::vector<DeviceInfo> &deviceInfos)
+{
+    std::vector<DeviceInfo> cachedDevices;
+    std::vector<DeviceInfo> unknownDevices;
+    std::lock_guard<ffrt::mutex> lock(cacheMutex_);
+    for (auto &deviceInfo: deviceInfos) {
+        DeviceTypeEnum deviceType = DeviceTypeEnum::UNKNOWN;
+        if (identifyCache_.Find(deviceInfo, generation, deviceType)) {
+            deviceInfo.deviceType = deviceType;
+            cachedDevices.push_back(std::move(deviceInfo));
+        } else {
+            unknownDevices.push_back(std::move(deviceInfo));
+        }
+    }
+    deviceInfos.swap(unknownDevices);
+    return cachedDevices;
+}
+
+void DeviceIdentifyService::PutCachedDevices(int64_t generation, const std::vector<DeviceInfo> &result)
+{
+    // If the rules are changed during the request, the generation read before is stale, so the results are never found.
+    std::lock_guard<ffrt::mutex> lock(cacheMutex_);
+    for (const auto &deviceInfo: result) {
+        identifyCache_.Put(deviceInfo, generation, deviceInfo.deviceType);
+    }
+    identifyCache_.Save();
+}
+
 bool DeviceIdentifyService::HasFullKeyboard(const DeviceInfo &deviceInfo)
 {
     if (deviceInfo.sourceTypeSet.count(InputSourceTypeEnum::KEYBOARD) == 0) {
         return false;
     }
-    std::pair<int32_t, int32_t> result;
+    std::shared_ptr<DeviceInfoService> deviceInfoService = DelayedSingleton<DeviceInfoService>::GetInstance();
     for (const auto &pair: deviceInfo.idSourceTypeMap) {
         if (pair.second.count(InputSourceTypeEnum::KEYBOARD) == 0) {
             continue;
         }
-        result = DelayedSingleton<DeviceInfoService>::GetInstance()->GetKeyBoardType(pair.first);
+        // The keyboard type is only queried once for each input device.
+        std::pair<int32_t, InputDeviceCapability> result = deviceInfoService->GetDeviceCapability(pair.first,
+                                                                                                 pair.second);
         if (result.first != GAME_CONTROLLER_SUCCESS) {
             continue;
         }
-        HILOGI("The keyboard type of the deviceId[%{public}d] is [%{public}d]", pair.first, result.second);
-        if (result.second == ALPHABETIC_KEYBOARD_TYPE) {
+        if (result.second.isFullKeyboard) {
             return true;
         }
-        if (deviceInfo.name == VIRTUAL_KEYBOARD_DEVICE_NAME
-            && DelayedSingleton<DeviceInfoService>::GetInstance()->IsFoldPc()) {
+        if (deviceInfo.name == VIRTUAL_KEYBOARD_DEVICE_NAME && deviceInfoService->IsFoldPc()) {
             return true;
         }
     }
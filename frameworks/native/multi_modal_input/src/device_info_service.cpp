@@ -42,6 +42,8 @@ InputSourceType g_inputSourceType[] = {
 };
 
 const std::string PC_DEVICE_TYPE = "2in1";
+
+const int32_t ALPHABETIC_KEYBOARD_TYPE = 2; // Full keyboard
 }
 
 DeviceInfoService::DeviceInfoService()
@@ -129,8 +131,8 @@ std::pair<int32_t, std::vector<InputDeviceInfo>> DeviceInfoService::GetAllDevice
         if (!GetUniqOnGetAllDeviceInfos(infos, inputDeviceInfo)) {
             continue;
         }
-        HILOGI("[GameController]GetAllDeviceInfos InputDeviceInfo %{private}s",
-               inputDeviceInfo.GetDeviceInfoDesc().c_str());
+        HILOGI_LIMIT("[GameController]GetAllDeviceInfos InputDeviceInfo %{private}s",
+                     inputDeviceInfo.GetDeviceInfoDesc().c_str());
         infos.push_back(inputDeviceInfo);
     }
     pair.second = infos;
@@ -147,9 +149,9 @@ bool DeviceInfoService::GetUniqOnGetAllDeviceInfos(std::vector<InputDeviceInfo>
     // uniq is empty in the virtual device information
     if (!inputDeviceInfo.IsVirtualDeviceForExternalDevice(IsFoldPc())) {
         // The system's own virtual devices do not need to be notified to the user.
-        HILOGW("[GameController]GetAllDeviceInfos discard system InputDeviceInfo %{private}s. "
-               "it's system virtual device",
-               inputDeviceInfo.GetDeviceInfoDesc().c_str());
+        HILOGW_LIMIT("[GameController]GetAllDeviceInfos discard system InputDeviceInfo %{private}s. "
+                     "it's system virtual device",
+                     inputDeviceInfo.GetDeviceInfoDesc().c_str());
         return false;
     }
 
@@ -199,6 +201,7 @@ std::pair<int32_t, int32_t> DeviceInfoService::GetKeyBoardType(int32_t id)
 {
     std::unique_lock<std::mutex> lock(taskMutex_);
     keyboardType_ = 0;
+    taskFinish_ = false;
     int result = InputManager::GetInstance()->GetKeyboardType(id, [](int32_t keyboardType) {
         DelayedSingleton<DeviceInfoService>::GetInstance()->HandleKeyBoardTypeCallback(keyboardType);
     });
@@ -224,9 +227,43 @@ std::pair<int32_t, int32_t> DeviceInfoService::GetKeyBoardType(int32_t id)
 void DeviceInfoService::HandleKeyBoardTypeCallback(int32_t keyboardType)
 {
     keyboardType_ = keyboardType;
+    taskFinish_ = true;
     taskConditionVar_.notify_all();
 }
 
+std::pair<int32_t, InputDeviceCapability> DeviceInfoService::GetDeviceCapability(
+    int32_t id, const std::unordered_set<InputSourceTypeEnum> &sourceTypeSet)
+{
+    {
+        std::lock_guard<std::mutex> lock(capabilityMutex_);
+        auto iter = capabilities_.find(id);
+        if (iter != capabilities_.end()) {
+            return std::make_pair(GAME_CONTROLLER_SUCCESS, iter->second);
+        }
+    }
+
+    InputDeviceCapability capability;
+    capability.sourceTypeSet = sourceTypeSet;
+    if (sourceTypeSet.count(InputSourceTypeEnum::KEYBOARD) != 0) {
+        std::pair<int32_t, int32_t> result = GetKeyBoardType(id);
+        if (result.first != GAME_CONTROLLER_SUCCESS) {
+            return std::make_pair(result.first, capability);
+        }
+        capability.keyboardType = result.second;
+        capability.isFullKeyboard = result.second == ALPHABETIC_KEYBOARD_TYPE;
+        HILOGI("The keyboard type of the deviceId[%{public}d] is [%{public}d]", id, result.second);
+    }
+    std::lock_guard<std::mutex> lock(capabilityMutex_);
+    capabilities_[id] = capability;
+    return std::make_pair(GAME_CONTROLLER_SUCCESS, capability);
+}
+
+void DeviceInfoService::RemoveDeviceCapability(int32_t id)
+{
+    std::lock_guard<std::mutex> lock(capabilityMutex_);
+    capabilities_.erase(id);
+}
+
 void DeviceInfoService::SetIsFoldPc()
 {
     if (OHOS::system::GetDeviceType() == PC_DEVICE_TYPE) {
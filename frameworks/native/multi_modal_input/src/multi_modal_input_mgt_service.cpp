@@ -13,6 +13,7 @@
  *  limitations under the License.
  */
 
+#include <algorithm>
 #include <input_manager.h>
 #include "multi_modal_input_mgt_service.h"
 #include "gamecontroller_log.h"
@@ -22,15 +23,22 @@
 #include "window_input_intercept.h"
 #include "key_mapping_service.h"
 #include "gamecontroller_utils.h"
+#include "gamecontroller_server_client.h"
 
 namespace OHOS {
 namespace GameController {
 using namespace OHOS::MMI;
 namespace {
 /**
- * Delay duration: 100 ms
+ * The longest delay of a device change event: 100 ms
  */
-constexpr int64_t DELAY_TIME = 100 * 1000;
+constexpr int64_t MAX_DELAY_TIME = 100 * 1000;
+
+/**
+ * The events closer than 10 ms are a burst, such as the devices of a dock or a USB hub.
+ * A burst is handled once no event arrives for this time.
+ */
+constexpr int64_t QUIET_TIME = 10 * 1000;
 
 /**
  * Querying Information About All Devices
@@ -46,10 +54,9 @@ const int32_t OPR_TYPE_DEVICE_ONLINE = 1;
 
 MultiModalInputMgtService::MultiModalInputMgtService()
 {
-    deviceTaskQueue_ = std::make_unique<ffrt::queue>("deviceTaskQueue",
-                                                     ffrt::queue_attr().qos(ffrt::qos_default));
-    eventCallbackQueue_ = std::make_unique<ffrt::queue>("deviceEventCallbackQueue",
-                                                        ffrt::queue_attr().qos(ffrt::qos_default));
+    deviceTaskQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("deviceTaskQueue");
+    eventCallbackQueue_ =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("deviceEventCallbackQueue");
 }
 
 MultiModalInputMgtService::~MultiModalInputMgtService()
@@ -70,6 +77,8 @@ void MultiModalInputMgtService::GetAllDeviceInfosWhenRegisterDeviceMonitor()
         }
     }
     if (isNeedGetAllDeviceInfos) {
+        // The devices are identified by the SA, so it's loaded while the devices are queried.
+        DelayedSingleton<GameControllerServerClient>::GetInstance()->PrewarmServiceProxy();
         GetAllDeviceInfos();
     }
 }
@@ -157,21 +166,37 @@ DeviceInfo MultiModalInputMgtService::GetDeviceInfoByUniq(const std::string &uni
 void MultiModalInputMgtService::DelayHandleDeviceChangeEvent(const DeviceChangeEvent &deviceChangeEvent)
 {
     std::lock_guard<ffrt::mutex> lock(deviceChangeEventMutex_);
+    int64_t now = debounceClock_();
+    bool isBurstEvent = now - lastDeviceChangeTime_ < QUIET_TIME;
+    lastDeviceChangeTime_ = now;
     deviceChangeEventCache_.push_back(deviceChangeEvent);
 
-    if (needStartDelayHandle_) {
-        // Start Delayed Aggregation Processing
-        needStartDelayHandle_ = false;
-        ffrt::task_attr taskAttr;
-        taskAttr.delay(DELAY_TIME);
-        ffrt::task_handle taskHandle = deviceTaskQueue_->submit_h([this] { HandleDeviceChangeEvent(); }, taskAttr);
-        if (taskHandle == nullptr) {
-            HILOGW("[GameController]DelayHandleDeviceChangeEvent submit queue fail");
-            needStartDelayHandle_ = true;
-        } else {
-            HILOGI("[GameController]DelayHandleDeviceChangeEvent task submit queue success");
-        }
+    if (!needStartDelayHandle_) {
+        // The pending task handles it. It waits for the end of the burst if the event comes before the task runs.
+        isBurstBatch_ = true;
+        return;
     }
+
+    // A lone event is handled at once, and a burst is aggregated until it's quiet.
+    needStartDelayHandle_ = false;
+    isBurstBatch_ = isBurstEvent;
+    batchStartTime_ = now;
+    SubmitDeviceChangeTask(isBurstEvent ? QUIET_TIME : 0);
+}
+
+bool MultiModalInputMgtService::SubmitDeviceChangeTask(int64_t delayTime)
+{
+    ffrt::task_attr taskAttr;
+    taskAttr.delay(delayTime);
+    ffrt::task_handle taskHandle = deviceTaskQueue_->submit_h([this] { HandleDeviceChangeEvent(); }, taskAttr);
+    if (taskHandle == nullptr) {
+        HILOGW("[GameController]DelayHandleDeviceChangeEvent submit queue fail");
+        needStartDelayHandle_ = true;
+        return false;
+    }
+    HILOGD("[GameController]DelayHandleDeviceChangeEvent task submit queue success, delay [%{public}lld]us",
+           static_cast<long long>(delayTime));
+    return true;
 }
 
 std::pair<bool, DeviceInfo> MultiModalInputMgtService::GetOneDeviceByDeviceType(DeviceTypeEnum deviceTypeEnum)
@@ -179,25 +204,64 @@ std::pair<bool, DeviceInfo> MultiModalInputMgtService::GetOneDeviceByDeviceType(
     std::lock_guard<ffrt::mutex> lock(deviceChangeEventMutex_);
     std::pair<bool, DeviceInfo> result;
     result.first = false;
-    for (const auto &deviceInfo: deviceInfoByUniqMap_) {
-        if (deviceInfo.second.deviceType == deviceTypeEnum) {
-            result.first = true;
-            result.second = deviceInfo.second;
-            return result;
+    auto indexIter = uniqsByDeviceType_.find(deviceTypeEnum);
+    if (indexIter == uniqsByDeviceType_.end()) {
+        return result;
+    }
+    for (const auto &uniq: indexIter->second) {
+        auto iter = deviceInfoByUniqMap_.find(uniq);
+        if (iter == deviceInfoByUniqMap_.end() || !IsDeviceOfType(iter->second, deviceTypeEnum)) {
+            continue;
         }
+        result.first = true;
+        result.second = iter->second;
+        return result;
+    }
+    return result;
+}
+
+bool MultiModalInputMgtService::IsDeviceOfType(const DeviceInfo &deviceInfo, DeviceTypeEnum deviceTypeEnum)
+{
+    return deviceInfo.deviceType == deviceTypeEnum || (deviceTypeEnum == GAME_KEY_BOARD && deviceInfo.hasFullKeyBoard);
+}
 
-        if (deviceTypeEnum == GAME_KEY_BOARD && deviceInfo.second.hasFullKeyBoard) {
-            result.first = true;
-            result.second = deviceInfo.second;
-            return result;
+void MultiModalInputMgtService::AddDeviceTypeIndex(const DeviceInfo &deviceInfo)
+{
+    uniqsByDeviceType_[deviceInfo.deviceType].insert(deviceInfo.uniq);
+    if (deviceInfo.hasFullKeyBoard) {
+        uniqsByDeviceType_[GAME_KEY_BOARD].insert(deviceInfo.uniq);
+    }
+}
+
+void MultiModalInputMgtService::RemoveDeviceTypeIndex(const DeviceInfo &deviceInfo)
+{
+    for (DeviceTypeEnum deviceType: {deviceInfo.deviceType, GAME_KEY_BOARD}) {
+        auto iter = uniqsByDeviceType_.find(deviceType);
+        if (iter == uniqsByDeviceType_.end()) {
+            continue;
+        }
+        iter->second.erase(deviceInfo.uniq);
+        if (iter->second.empty()) {
+            uniqsByDeviceType_.erase(iter);
         }
     }
-    return result;
 }
 
 void MultiModalInputMgtService::HandleDeviceChangeEvent()
 {
     std::lock_guard<ffrt::mutex> lock(deviceChangeEventMutex_);
+    if (isBurstBatch_) {
+        int64_t now = debounceClock_();
+        int64_t quietTime = now - lastDeviceChangeTime_;
+        int64_t waitTime = now - batchStartTime_;
+        // Wait until the burst is quiet, but no longer than MAX_DELAY_TIME since the first event.
+        if (quietTime < QUIET_TIME && waitTime < MAX_DELAY_TIME
+            && SubmitDeviceChangeTask(std::min(QUIET_TIME - quietTime, MAX_DELAY_TIME - waitTime))) {
+            return;
+        }
+    }
+    HILOGI("[GameController]HandleDeviceChangeEvent. the event count is [%{public}zu]",
+           deviceChangeEventCache_.size());
     std::unordered_map<int32_t, std::string> tempDeviceIdUniqMap;
     std::unordered_map<std::string, DeviceInfo> tempDeviceInfoByUniqMap;
     for (auto &deviceChangeEvent: deviceChangeEventCache_) {
@@ -217,6 +281,7 @@ void MultiModalInputMgtService::HandleDeviceChangeEvent()
     }
 
     deviceChangeEventCache_.clear();
+    isBurstBatch_ = false;
     needStartDelayHandle_ = true;
 }
 
@@ -225,6 +290,8 @@ void MultiModalInputMgtService::HandleDeviceRemoveEvent(
     std::unordered_map<int32_t, std::string> &tempDeviceIdUniqMap,
     std::unordered_map<std::string, DeviceInfo> &tempDeviceInfoByUniqMap)
 {
+    // The id may be used by another device later, so its capability is queried again.
+    DelayedSingleton<DeviceInfoService>::GetInstance()->RemoveDeviceCapability(deviceId);
     if (deviceIdUniqMap_.find(deviceId) == deviceIdUniqMap_.end()) {
         // No online information about the device is received.
         if (tempDeviceIdUniqMap.find(deviceId) == tempDeviceIdUniqMap.end()) {
@@ -308,33 +375,21 @@ void MultiModalInputMgtService::HandleInputDeviceInfo(
     std::unordered_map<std::string, DeviceInfo> &tempDeviceInfoByUniqMap,
     InputDeviceInfo &inputDeviceInfo)
 {
-    // Aggregation by uniq
-    if (tempDeviceInfoByUniqMap.find(inputDeviceInfo.uniq) == tempDeviceInfoByUniqMap.end()) {
-        DeviceInfo deviceInfo;
-        deviceInfo.ids.insert(inputDeviceInfo.id);
+    // Aggregation by uniq. The device is updated in place.
+    auto [iter, isNewDevice] = tempDeviceInfoByUniqMap.try_emplace(inputDeviceInfo.uniq);
+    DeviceInfo &deviceInfo = iter->second;
+    if (isNewDevice) {
         deviceInfo.uniq = inputDeviceInfo.uniq;
         deviceInfo.phys = inputDeviceInfo.phys;
         deviceInfo.product = inputDeviceInfo.product;
         deviceInfo.version = inputDeviceInfo.version;
-        deviceInfo.name = inputDeviceInfo.name;
-        deviceInfo.names.insert(inputDeviceInfo.name);
         deviceInfo.vendor = inputDeviceInfo.vendor;
-        for (auto &sourceType: inputDeviceInfo.sourceTypeSet) {
-            deviceInfo.sourceTypeSet.insert(sourceType);
-        }
-        deviceInfo.idSourceTypeMap[inputDeviceInfo.id] = inputDeviceInfo.sourceTypeSet;
-        tempDeviceInfoByUniqMap[inputDeviceInfo.uniq] = deviceInfo;
-    } else {
-        DeviceInfo deviceInfo = tempDeviceInfoByUniqMap[inputDeviceInfo.uniq];
-        deviceInfo.ids.insert(inputDeviceInfo.id);
-        deviceInfo.name = inputDeviceInfo.name;
-        deviceInfo.names.insert(inputDeviceInfo.name);
-        for (auto &sourceType: inputDeviceInfo.sourceTypeSet) {
-            deviceInfo.sourceTypeSet.insert(sourceType);
-        }
-        deviceInfo.idSourceTypeMap[inputDeviceInfo.id] = inputDeviceInfo.sourceTypeSet;
-        tempDeviceInfoByUniqMap[inputDeviceInfo.uniq] = deviceInfo;
     }
+    deviceInfo.ids.insert(inputDeviceInfo.id);
+    deviceInfo.name = inputDeviceInfo.name;
+    deviceInfo.names.insert(inputDeviceInfo.name);
+    deviceInfo.sourceTypeSet.insert(inputDeviceInfo.sourceTypeSet.begin(), inputDeviceInfo.sourceTypeSet.end());
+    deviceInfo.idSourceTypeMap[inputDeviceInfo.id] = inputDeviceInfo.sourceTypeSet;
 }
 
 void MultiModalInputMgtService::IdentifyDeviceType(
@@ -354,19 +409,22 @@ void MultiModalInputMgtService::IdentifyDeviceType(
         ClearAllDeviceIdUniqMap();
     }
 
-    bool isNeedNotify = false; // 需要对本地缓存新增或更新设备类型时，需要发送一个设备上线事件
     for (auto &deviceInfo: result) {
         deviceInfo.onlineTime = StringUtils::GetSysClockTime();
         deviceInfo.anonymizationUniq = StringUtils::AnonymizationUniq(deviceInfo.uniq);
         deviceInfo.vidPid = deviceInfo.GetVidPid();
-        if (deviceInfoByUniqMap_.find(deviceInfo.uniq) == deviceInfoByUniqMap_.end()) {
+
+        // 需要对本地缓存新增或更新设备类型时，需要发送一个设备上线事件
+        bool isNeedNotify = false;
+        auto iter = deviceInfoByUniqMap_.find(deviceInfo.uniq);
+        if (iter == deviceInfoByUniqMap_.end()) {
             // The local cache does not exist. The online event needs to be sent.
             isNeedNotify = true;
             CheckDeviceType(deviceInfo);
+            AddDeviceTypeIndex(deviceInfo);
+            iter = deviceInfoByUniqMap_.emplace(deviceInfo.uniq, std::move(deviceInfo)).first;
         } else {
-            DeviceInfo oriDeviceInfo = deviceInfoByUniqMap_[deviceInfo.uniq];
-
-            // When the device type changes, a notification needs to be sent to go online.
+            const DeviceInfo &oriDeviceInfo = iter->second;
             deviceInfo.ids.insert(oriDeviceInfo.ids.begin(), oriDeviceInfo.ids.end());
             deviceInfo.names.insert(oriDeviceInfo.names.begin(), oriDeviceInfo.names.end());
             deviceInfo.sourceTypeSet.insert(oriDeviceInfo.sourceTypeSet.begin(), oriDeviceInfo.sourceTypeSet.end());
@@ -377,22 +435,32 @@ void MultiModalInputMgtService::IdentifyDeviceType(
 
             // When the device type changes, a notification needs to be sent to go online.
             isNeedNotify = oriDeviceInfo.deviceType != deviceInfo.deviceType;
+            RemoveDeviceTypeIndex(oriDeviceInfo);
+            AddDeviceTypeIndex(deviceInfo);
+            iter->second = std::move(deviceInfo);
         }
 
-        deviceInfoByUniqMap_[deviceInfo.uniq] = deviceInfo;
-        tempDeviceInfoByUniqMap[deviceInfo.uniq] = deviceInfo;
-        for (auto id: deviceInfo.ids) {
-            deviceIdUniqMap_[id] = deviceInfo.uniq;
+        DeviceInfo &cachedDeviceInfo = iter->second;
+        if (oprType == OPR_TYPE_GET_ALL_DEVICES) {
+            tempDeviceInfoByUniqMap[cachedDeviceInfo.uniq] = cachedDeviceInfo;
+        }
+        for (auto id: cachedDeviceInfo.ids) {
+            // Only the new device IDs are registered.
+            auto [idIter, isNewId] = deviceIdUniqMap_.try_emplace(id, cachedDeviceInfo.uniq);
+            if (!isNewId && idIter->second == cachedDeviceInfo.uniq) {
+                continue;
+            }
+            idIter->second = cachedDeviceInfo.uniq;
             DelayedSingleton<WindowInputIntercept>::GetInstance()->RegisterWindowInputIntercept(id);
         }
         if (isNeedNotify) {
             HILOGI("[GameController]DeviceOnlineEvent. oprType is %{public}d, deviceInfo is %{public}s",
-                   oprType, deviceInfo.GetDeviceInfoDesc().c_str());
-            DelayedSingleton<KeyMappingService>::GetInstance()->BroadCastDeviceInfo(deviceInfo);
-            DoDeviceEventCallback(deviceInfo, ADD);
+                   oprType, cachedDeviceInfo.GetDeviceInfoDesc().c_str());
+            DelayedSingleton<KeyMappingService>::GetInstance()->BroadCastDeviceInfo(cachedDeviceInfo);
+            DoDeviceEventCallback(cachedDeviceInfo, ADD);
         } else {
             HILOGI("[GameController]UpdateDeviceEvent. oprType is %{public}d, deviceInfo is %{public}s",
-                   oprType, deviceInfo.GetDeviceInfoDesc().c_str());
+                   oprType, cachedDeviceInfo.GetDeviceInfoDesc().c_str());
         }
     }
 }
@@ -415,25 +483,26 @@ void MultiModalInputMgtService::CheckDeviceType(DeviceInfo &deviceInfo)
 void MultiModalInputMgtService::CleanOfflineDevice(
     const std::unordered_map<std::string, DeviceInfo> &tempDeviceInfoByUniqMap)
 {
-    std::vector<std::string> needDelete;
-    for (auto &pair: deviceInfoByUniqMap_) {
-        if (tempDeviceInfoByUniqMap.find(pair.first) != tempDeviceInfoByUniqMap.end()) {
+    for (auto iter = deviceInfoByUniqMap_.begin(); iter != deviceInfoByUniqMap_.end();) {
+        if (tempDeviceInfoByUniqMap.find(iter->first) != tempDeviceInfoByUniqMap.end()) {
+            ++iter;
             continue;
         }
         HILOGI("[GameController][CleanOfflineDevice]DeviceOfflineEvent. DeviceInfo is %{public}s",
-               pair.second.GetDeviceInfoDesc().c_str());
-        DoDeviceEventCallback(pair.second, REMOVE);
-        needDelete.push_back(pair.first);
-    }
-
-    for (auto uniq: needDelete) {
-        deviceInfoByUniqMap_.erase(uniq);
+               iter->second.GetDeviceInfoDesc().c_str());
+        DoDeviceEventCallback(iter->second, REMOVE);
+        RemoveDeviceTypeIndex(iter->second);
+        for (auto id: iter->second.ids) {
+            DelayedSingleton<DeviceInfoService>::GetInstance()->RemoveDeviceCapability(id);
+        }
+        iter = deviceInfoByUniqMap_.erase(iter);
     }
 }
 
 void MultiModalInputMgtService::ClearDeviceIdUniqMapByDeviceId(int32_t deviceId)
 {
     deviceIdUniqMap_.erase(deviceId);
+    DelayedSingleton<DeviceInfoService>::GetInstance()->RemoveDeviceCapability(deviceId);
     DelayedSingleton<WindowInputIntercept>::GetInstance()->UnRegisterWindowInputIntercept(deviceId);
 }
 
@@ -451,17 +520,20 @@ void MultiModalInputMgtService::ClearOfflineDeviceAndBroadcast(const int32_t dev
     }
     std::string uniq = deviceIdUniqMap_[deviceId];
     ClearDeviceIdUniqMapByDeviceId(deviceId);
-    if (deviceInfoByUniqMap_.find(uniq) == deviceInfoByUniqMap_.end()) {
+    auto iter = deviceInfoByUniqMap_.find(uniq);
+    if (iter == deviceInfoByUniqMap_.end()) {
         HILOGW("[GameController]Discard DeviceOfflineEvent. Because no deviceInfo. "
-               "deviceId is %{public}d, uniq is %{public}s", deviceId, StringUtils::AnonymizationUniq(uniq).c_str());
+               "deviceId is %{public}d, uniq is %{public}s",
+               deviceId, StringUtils::AnonymizationUniq(uniq).c_str());
         return;
     }
-    DeviceInfo deviceInfo = deviceInfoByUniqMap_[uniq];
+    DeviceInfo deviceInfo = std::move(iter->second);
+    deviceInfoByUniqMap_.erase(iter);
+    RemoveDeviceTypeIndex(deviceInfo);
     for (auto id: deviceInfo.ids) {
         // Delete other device IDs associated with the device.
         ClearDeviceIdUniqMapByDeviceId(id);
     }
-    deviceInfoByUniqMap_.erase(uniq);
     HILOGI("[GameController][ClearOfflineDeviceAndBroadcast]DeviceOfflineEvent. DeviceInfo is %{public}s",
            deviceInfo.GetDeviceInfoDesc().c_str());
     deviceInfo.status = 1;
@@ -20,7 +20,9 @@
 #include <cpp/queue.h>
 #include <cpp/mutex.h>
 #include "gamecontroller_client_model.h"
+#include "gamecontroller_queue_registry.h"
 #include "plugin_event_callback.h"
+#include "plugin_input_channel.h"
 
 namespace OHOS {
 namespace GameController {
@@ -54,9 +56,22 @@ public:
 
     void SetPointerVisible(const std::string &bundleName, bool visible);
 
+private:
+    void HandlePluginInputEvent(const PluginInputEvent &event);
+
 private:
     ffrt::mutex locker_;
-    std::unique_ptr<ffrt::queue> callbackQueue_{nullptr};
+
+    /**
+     * Delivers the window, device and SA events of the plugin mode.
+     */
+    std::unique_ptr<GameControllerQueue> callbackQueue_{nullptr};
+
+    /**
+     * Delivers the input events of the plugin mode, separate from callbackQueue_ so they're not delayed by
+     * the other events and run with a higher QoS.
+     */
+    std::unique_ptr<PluginInputChannel> inputChannel_{nullptr};
     std::string bundleName_;
     bool isPluginMode_{false};
     std::shared_ptr<WindowOprCallback> windowOprCallbackPtr_{nullptr};
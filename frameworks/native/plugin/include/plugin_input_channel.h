@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GAME_CONTROLLER_FRAMEWORK_PLUGIN_INPUT_CHANNEL_H
+#define GAME_CONTROLLER_FRAMEWORK_PLUGIN_INPUT_CHANNEL_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <key_event.h>
+#include <pointer_event.h>
+#include "gamecontroller_batched_channel.h"
+
+namespace OHOS {
+namespace GameController {
+/**
+ * Default number of the event slots of a PluginInputChannel.
+ */
+const size_t PLUGIN_INPUT_CHANNEL_CAPACITY = 256;
+
+/**
+ * An input event sent to the plugin. Only one of keyEvent and pointerEvent is set.
+ */
+struct PluginInputEvent {
+    std::string bundleName;
+    std::shared_ptr<MMI::KeyEvent> keyEvent{nullptr};
+    std::shared_ptr<MMI::PointerEvent> pointerEvent{nullptr};
+    bool isSimulate{false};
+
+    /**
+     * Release the event, and keep the capacity of bundleName for the next one.
+     */
+    void Release()
+    {
+        keyEvent = nullptr;
+        pointerEvent = nullptr;
+    }
+};
+
+using PluginInputEventHandler = std::function<void(const PluginInputEvent &)>;
+
+/**
+ * Delivers the input events of the plugin mode in order on a user-interactive queue, through a BatchedChannel
+ * without the max batch size.
+ */
+class PluginInputChannel {
+public:
+    /**
+     * @param queueName the name of the queue which delivers the events. Its QoS class is declared in the registry.
+     * @param capacity the number of the slots, rounded up to a power of 2
+     * @param handler called on the queue for every event
+     */
+    PluginInputChannel(const std::string &queueName, size_t capacity, const PluginInputEventHandler &handler);
+
+    ~PluginInputChannel() = default;
+
+    void Send(const std::string &bundleName, const std::shared_ptr<MMI::KeyEvent> &keyEvent, bool isSimulate);
+
+    void Send(const std::string &bundleName, const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+              bool isSimulate);
+
+    /**
+     * Wait until the events sent before are delivered.
+     */
+    void WaitIdle();
+
+    size_t GetCapacity() const;
+
+private:
+    void Push(const std::string &bundleName, const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+              const std::shared_ptr<MMI::PointerEvent> &pointerEvent, bool isSimulate);
+
+private:
+    std::unique_ptr<BatchedChannel<PluginInputEvent>> channel_{nullptr};
+
+    /**
+     * Declared last, so it's destroyed before the channel which its tasks use.
+     */
+    std::unique_ptr<GameControllerQueue> inputQueue_{nullptr};
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_PLUGIN_INPUT_CHANNEL_H
@@ -16,6 +16,7 @@
 #include "plugin_callback_manager.h"
 #include "window_opr_handle.h"
 #include "gamecontroller_log.h"
+#include "input_trace_recorder.h"
 
 namespace OHOS {
 namespace GameController {
@@ -26,8 +27,12 @@ PluginCallbackManager::~PluginCallbackManager()
 
 PluginCallbackManager::PluginCallbackManager()
 {
-    callbackQueue_ = std::make_unique<ffrt::queue>("plugin-callback-thread",
-                                                   ffrt::queue_attr().qos(ffrt::qos_background));
+    callbackQueue_ =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("plugin-callback-thread");
+    inputChannel_ = std::make_unique<PluginInputChannel>("plugin-input-thread", PLUGIN_INPUT_CHANNEL_CAPACITY,
+                                                         [this](const PluginInputEvent &event) {
+                                                             HandlePluginInputEvent(event);
+                                                         });
     windowOprCallbackPtr_ = std::make_shared<WindowOprHandle>();
 }
 
@@ -92,15 +97,7 @@ void PluginCallbackManager::SendInputEvent(const std::string &bundleName,
                                            bool isSimulate)
 {
     if (isPluginMode_) {
-        callbackQueue_->submit([bundleName, keyEvent, isSimulate, this] {
-            std::lock_guard<ffrt::mutex> lock(locker_);
-            if (windowOprCallbackPtr_ == nullptr) {
-                return;
-            }
-            if (!windowOprCallbackPtr_->SendInputEvent(bundleName, keyEvent, isSimulate)) {
-                Rosen::WindowInputInterceptClient::SendInputEvent(keyEvent);
-            }
-        });
+        inputChannel_->Send(bundleName, keyEvent, isSimulate);
     } else {
         std::lock_guard<ffrt::mutex> lock(locker_);
         if (windowOprCallbackPtr_ == nullptr) {
@@ -114,16 +111,11 @@ void PluginCallbackManager::SendInputEvent(const std::string &bundleName,
                                            const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
                                            bool isSimulate)
 {
+    if (isSimulate) {
+        DelayedSingleton<InputTraceRecorder>::GetInstance()->RecordTouchEvent(pointerEvent);
+    }
     if (isPluginMode_) {
-        callbackQueue_->submit([bundleName, pointerEvent, isSimulate, this] {
-            std::lock_guard<ffrt::mutex> lock(locker_);
-            if (windowOprCallbackPtr_ == nullptr) {
-                return;
-            }
-            if (!windowOprCallbackPtr_->SendInputEvent(bundleName, pointerEvent, isSimulate)) {
-                Rosen::WindowInputInterceptClient::SendInputEvent(pointerEvent);
-            }
-        });
+        inputChannel_->Send(bundleName, pointerEvent, isSimulate);
     } else {
         std::lock_guard<ffrt::mutex> lock(locker_);
         if (windowOprCallbackPtr_ == nullptr) {
@@ -133,6 +125,24 @@ void PluginCallbackManager::SendInputEvent(const std::string &bundleName,
     }
 }
 
+void PluginCallbackManager::HandlePluginInputEvent(const PluginInputEvent &event)
+{
+    std::lock_guard<ffrt::mutex> lock(locker_);
+    if (windowOprCallbackPtr_ == nullptr) {
+        return;
+    }
+    if (event.keyEvent != nullptr) {
+        if (!windowOprCallbackPtr_->SendInputEvent(event.bundleName, event.keyEvent, event.isSimulate)) {
+            Rosen::WindowInputInterceptClient::SendInputEvent(event.keyEvent);
+        }
+        return;
+    }
+    if (event.pointerEvent != nullptr &&
+        !windowOprCallbackPtr_->SendInputEvent(event.bundleName, event.pointerEvent, event.isSimulate)) {
+        Rosen::WindowInputInterceptClient::SendInputEvent(event.pointerEvent);
+    }
+}
+
 void PluginCallbackManager::RecoverGestureBackStatus(const std::string &bundleName)
 {
     if (isPluginMode_) {
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "plugin_input_channel.h"
+
+namespace OHOS {
+namespace GameController {
+
+PluginInputChannel::PluginInputChannel(const std::string &queueName, size_t capacity,
+                                       const PluginInputEventHandler &handler)
+{
+    inputQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(queueName);
+    channel_ = std::make_unique<BatchedChannel<PluginInputEvent>>(inputQueue_.get(), capacity, handler);
+}
+
+void PluginInputChannel::Send(const std::string &bundleName, const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                              bool isSimulate)
+{
+    Push(bundleName, keyEvent, nullptr, isSimulate);
+}
+
+void PluginInputChannel::Send(const std::string &bundleName, const std::shared_ptr<MMI::PointerEvent> &pointerEvent,
+                              bool isSimulate)
+{
+    Push(bundleName, nullptr, pointerEvent, isSimulate);
+}
+
+void PluginInputChannel::WaitIdle()
+{
+    channel_->WaitIdle();
+}
+
+size_t PluginInputChannel::GetCapacity() const
+{
+    return channel_->GetCapacity();
+}
+
+void PluginInputChannel::Push(const std::string &bundleName, const std::shared_ptr<MMI::KeyEvent> &keyEvent,
+                              const std::shared_ptr<MMI::PointerEvent> &pointerEvent, bool isSimulate)
+{
+    // The slot keeps the capacity of bundleName, so writing it doesn't allocate again.
+    channel_->Emplace([&bundleName, &keyEvent, &pointerEvent, isSimulate](PluginInputEvent &slot) {
+        slot.bundleName = bundleName;
+        slot.keyEvent = keyEvent;
+        slot.pointerEvent = pointerEvent;
+        slot.isSimulate = isSimulate;
+    });
+}
+
+}
+}
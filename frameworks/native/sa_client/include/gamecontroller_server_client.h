@@ -59,6 +59,15 @@ public:
     virtual int32_t GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
                                             GameKeyMappingInfo &gameKeyMappingInfo);
 
+    /**
+    * Getting the game key mapping configurations of several device types in one call
+    * @param params the request params
+    * @param gameKeyMappingInfos Game Key Mapping Configurations, in the same order as params
+    * @return Interface Invoking Result
+    */
+    virtual int32_t GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                             std::vector<GameKeyMappingInfo> &gameKeyMappingInfos);
+
     /**
      * Set custom game key mapping configuration (It can be invoked only by system service.)
      * @param gameKeyMappingInfo the custom game key mapping configuration
@@ -66,6 +75,14 @@ public:
      */
     virtual int32_t SetCustomGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfo);
 
+    /**
+     * Set several custom game key mapping configurations of one game atomically
+     * (It can be invoked only by system service.)
+     * @param gameKeyMappingInfos the custom game key mapping configurations
+     * @return Interface Invoking Result
+     */
+    virtual int32_t SetCustomGameKeyMappingConfigs(const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos);
+
     /**
      * Set default game key mapping configuration (It can be invoked only by system service.)
      * @param gameKeyMappingInfo default game key mapping configuration
@@ -96,6 +113,11 @@ public:
      * @return Interface Invoking Result
      */
     virtual int32_t EnableGameKeyMapping(const GameInfo &gameInfo, const bool isEnable);
+
+    /**
+     * Load the SA asynchronously before it's called, so the first call doesn't wait for the loading.
+     */
+    virtual void PrewarmServiceProxy();
 };
 }
 }
@@ -19,7 +19,9 @@
 #include <singleton.h>
 #include <system_ability_load_callback_stub.h>
 #include <iremote_object.h>
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include "igame_controller_server_interface.h"
 #include "gamecontroller_client_model.h"
 #include "gamecontroller_keymapping_model.h"
@@ -68,6 +70,11 @@ public:
      */
     void OnRemoteSaDead(const wptr<IRemoteObject> &object);
 
+    /**
+     * Load the SA asynchronously if the proxy isn't cached, so the first call doesn't wait for the loading.
+     */
+    void PrewarmServiceProxy();
+
     /**
      * Perform device identification.
      * @param deviceInfos Information about the device to be identified
@@ -101,6 +108,15 @@ public:
     int32_t GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
                                     GameKeyMappingInfo &gameKeyMappingInfo);
 
+    /**
+    * Getting the game key mapping configurations of several device types in one call
+    * @param params the request params
+    * @param gameKeyMappingInfos Game Key Mapping Configurations, in the same order as params
+    * @return Interface Invoking Result
+    */
+    int32_t GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                     std::vector<GameKeyMappingInfo> &gameKeyMappingInfos);
+
     /**
      * Set custom game key mapping configuration
      * @param gameKeyMappingInfo the custom game key mapping configuration
@@ -108,6 +124,13 @@ public:
      */
     int32_t SetCustomGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfo);
 
+    /**
+     * Set several custom game key mapping configurations of one game atomically
+     * @param gameKeyMappingInfos the custom game key mapping configurations
+     * @return Interface Invoking Result
+     */
+    int32_t SetCustomGameKeyMappingConfigs(const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos);
+
     /**
      * Set default game key mapping configuration
      * @param gameKeyMappingInfo default game key mapping configuration
@@ -140,15 +163,57 @@ public:
     int32_t EnableGameKeyMapping(const GameInfo &gameInfo, const bool isEnable);
 
 private:
+    /**
+     * Get the proxy of the SA. The cached proxy is returned without lock and without asking the samgr.
+     * @return nullptr means the SA can't be connected
+     */
     sptr<IGameControllerServerInterface> GetServiceProxy();
 
+    /**
+     * Cache the proxy of the remote object, and listen to its death. Called with loadServiceLock_.
+     */
+    void SetServiceProxy(const sptr<IRemoteObject> &remoteObject);
+
+    /**
+     * Called with loadServiceLock_.
+     */
     void ReleaseServiceProxy();
 
+    /**
+     * Release the proxy when the call failed because the SA is dead, so the next call connects it again.
+     * @param serviceProxy the proxy which is used by the failed call
+     */
+    void ReleaseServiceProxyIfDead(const sptr<IGameControllerServerInterface> &serviceProxy);
+
+    /**
+     * Ask the samgr for the remote object of the SA. It's one binder call.
+     * @return nullptr means the SA isn't running or the samgr can't be connected
+     */
+    virtual sptr<IRemoteObject> CheckSystemAbility();
+
+    /**
+     * Ask the samgr to load the SA. The result is sent to loadCallback.
+     * @param loadCallback the callback of the loading
+     * @return GAME_CONTROLLER_SUCCESS means the loading is started
+     */
+    virtual int32_t LoadSystemAbility(const sptr<GameControllerSaLoadCallback> &loadCallback);
+
 private:
     std::mutex loadServiceLock_;
     std::condition_variable loadServiceConVar_;
     sptr<IGameControllerServerInterface> gamecontrollerServerProxy_ = nullptr;
     sptr<GameControllerSaDeathRecipient> deathRecipient_;
+
+    /**
+     * The copy of gamecontrollerServerProxy_ read by the calls without lock.
+     * It's only accessed by std::atomic_load and std::atomic_store, and written with loadServiceLock_.
+     */
+    std::shared_ptr<const sptr<IGameControllerServerInterface>> cachedServiceProxy_{nullptr};
+
+    /**
+     * Whether an asynchronous loading started by PrewarmServiceProxy isn't finished.
+     */
+    std::atomic<bool> isPrewarming_{false};
 };
 }
 }
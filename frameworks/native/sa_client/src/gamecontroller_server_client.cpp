@@ -45,6 +45,20 @@ int32_t GameControllerServerClient::SetCustomGameKeyMappingConfig(const GameKeyM
         ->SetCustomGameKeyMappingConfig(gameKeyMappingInfo);
 }
 
+int32_t GameControllerServerClient::GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                                             std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    return DelayedSingleton<GameControllerServerClientProxy>::GetInstance()
+        ->GetGameKeyMappingConfigs(params, gameKeyMappingInfos);
+}
+
+int32_t GameControllerServerClient::SetCustomGameKeyMappingConfigs(
+    const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    return DelayedSingleton<GameControllerServerClientProxy>::GetInstance()
+        ->SetCustomGameKeyMappingConfigs(gameKeyMappingInfos);
+}
+
 int32_t GameControllerServerClient::BroadcastDeviceInfo(const GameInfo &gameInfo, const DeviceInfo &deviceInfo)
 {
     return DelayedSingleton<GameControllerServerClientProxy>::GetInstance()
@@ -82,5 +96,10 @@ int32_t GameControllerServerClient::EnableGameKeyMapping(const GameInfo &gameInf
         ->EnableGameKeyMapping(gameInfo, isEnable);
 }
 
+void GameControllerServerClient::PrewarmServiceProxy()
+{
+    DelayedSingleton<GameControllerServerClientProxy>::GetInstance()->PrewarmServiceProxy();
+}
+
 }
 }
\ No newline at end of file
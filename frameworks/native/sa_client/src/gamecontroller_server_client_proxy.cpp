@@ -77,22 +77,47 @@ void GameControllerServerClientProxy::LoadSystemAbilitySuccess(const sptr<IRemot
         return;
     }
     std::lock_guard<std::mutex> lock(loadServiceLock_);
-    if (deathRecipient_ != nullptr) {
-        remoteObject->AddDeathRecipient(deathRecipient_);
-    }
-    gamecontrollerServerProxy_ = iface_cast<IGameControllerServerInterface>(remoteObject);
+    SetServiceProxy(remoteObject);
+    isPrewarming_.store(false);
     loadServiceConVar_.notify_all();
 }
 
 void GameControllerServerClientProxy::LoadSystemAbilityFail()
 {
     std::lock_guard<std::mutex> lock(loadServiceLock_);
-    gamecontrollerServerProxy_ = nullptr;
+    ReleaseServiceProxy();
+    isPrewarming_.store(false);
     loadServiceConVar_.notify_all();
 }
 
 void GameControllerServerClientProxy::OnRemoteSaDead(const wptr<IRemoteObject> &object)
 {
+    std::lock_guard<std::mutex> lock(loadServiceLock_);
+    if (gamecontrollerServerProxy_ == nullptr) {
+        return;
+    }
+    sptr<IRemoteObject> remoteObject = object.promote();
+    if (remoteObject != nullptr && remoteObject != gamecontrollerServerProxy_->AsObject()) {
+        // The death of an old proxy, which is released already.
+        return;
+    }
+    HILOGI("Release game controller proxy, because the systemAbility is dead.");
+    ReleaseServiceProxy();
+}
+
+void GameControllerServerClientProxy::PrewarmServiceProxy()
+{
+    if (std::atomic_load(&cachedServiceProxy_) != nullptr || isPrewarming_.exchange(true)) {
+        return;
+    }
+    sptr<GameControllerSaLoadCallback> loadCallback = sptr<GameControllerSaLoadCallback>::MakeSptr();
+    int32_t ret = LoadSystemAbility(loadCallback);
+    if (ret != GAME_CONTROLLER_SUCCESS) {
+        HILOGW("Prewarm systemAbility failed. ret=[%{public}d]", ret);
+        isPrewarming_.store(false);
+        return;
+    }
+    HILOGI("Prewarm systemAbility.");
 }
 
 int32_t GameControllerServerClientProxy::IdentifyDevice(const std::vector<DeviceInfo> &deviceInfos,
@@ -107,33 +132,35 @@ int32_t GameControllerServerClientProxy::IdentifyDevice(const std::vector<Device
     int32_t ret = serviceProxy->IdentifyDevice(deviceInfos, identifyResult);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("serviceProxy IdentifyDevice ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
 
 sptr<IGameControllerServerInterface> GameControllerServerClientProxy::GetServiceProxy()
 {
-    std::unique_lock<std::mutex> lock(loadServiceLock_);
+    std::shared_ptr<const sptr<IGameControllerServerInterface>> cachedServiceProxy =
+        std::atomic_load(&cachedServiceProxy_);
+    if (cachedServiceProxy != nullptr) {
+        return *cachedServiceProxy;
+    }
 
-    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (samgr == nullptr) {
-        HILOGE("Get SystemAbilityManager failed.");
-        return nullptr;
+    std::unique_lock<std::mutex> lock(loadServiceLock_);
+    if (gamecontrollerServerProxy_ != nullptr) {
+        // Connected by another call while waiting for the lock.
+        return gamecontrollerServerProxy_;
     }
 
-    auto object = samgr->CheckSystemAbility(GAME_CONTROLLER_SA_ID);
-    if (object == nullptr) {
-        //If the SA does not exist, the current proxy object needs to be released and obtained again.
-        HILOGW("Check systemAbility not exist and try to release game controller proxy.");
-        ReleaseServiceProxy();
-    } else {
-        gamecontrollerServerProxy_ = iface_cast<IGameControllerServerInterface>(object);
+    auto object = CheckSystemAbility();
+    if (object != nullptr) {
+        SetServiceProxy(object);
         return gamecontrollerServerProxy_;
     }
+    HILOGW("Check systemAbility not exist.");
 
     HILOGI("Try load systemAbility.");
     sptr<GameControllerSaLoadCallback> loadCallback = sptr<GameControllerSaLoadCallback>::MakeSptr();
-    int32_t ret = samgr->LoadSystemAbility(GAME_CONTROLLER_SA_ID, loadCallback);
+    int32_t ret = LoadSystemAbility(loadCallback);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("Failed to load systemAbility.");
         return gamecontrollerServerProxy_;
@@ -148,9 +175,46 @@ sptr<IGameControllerServerInterface> GameControllerServerClientProxy::GetService
     return gamecontrollerServerProxy_;
 }
 
+sptr<IRemoteObject> GameControllerServerClientProxy::CheckSystemAbility()
+{
+    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (samgr == nullptr) {
+        HILOGE("Get SystemAbilityManager failed.");
+        return nullptr;
+    }
+    return samgr->CheckSystemAbility(GAME_CONTROLLER_SA_ID);
+}
+
+int32_t GameControllerServerClientProxy::LoadSystemAbility(const sptr<GameControllerSaLoadCallback> &loadCallback)
+{
+    auto samgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (samgr == nullptr) {
+        HILOGE("Get SystemAbilityManager failed.");
+        return GAME_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return samgr->LoadSystemAbility(GAME_CONTROLLER_SA_ID, loadCallback);
+}
+
+void GameControllerServerClientProxy::SetServiceProxy(const sptr<IRemoteObject> &remoteObject)
+{
+    if (gamecontrollerServerProxy_ != nullptr && gamecontrollerServerProxy_->AsObject() == remoteObject) {
+        return;
+    }
+    ReleaseServiceProxy();
+    if (deathRecipient_ != nullptr) {
+        remoteObject->AddDeathRecipient(deathRecipient_);
+    }
+    gamecontrollerServerProxy_ = iface_cast<IGameControllerServerInterface>(remoteObject);
+    if (gamecontrollerServerProxy_ != nullptr) {
+        std::atomic_store(&cachedServiceProxy_,
+                          std::make_shared<const sptr<IGameControllerServerInterface>>(gamecontrollerServerProxy_));
+    }
+}
+
 void GameControllerServerClientProxy::ReleaseServiceProxy()
 {
     if (gamecontrollerServerProxy_ != nullptr) {
+        std::atomic_store(&cachedServiceProxy_, std::shared_ptr<const sptr<IGameControllerServerInterface>>());
         auto remoteObject = gamecontrollerServerProxy_->AsObject();
         if (remoteObject != nullptr && deathRecipient_ != nullptr) {
             remoteObject->RemoveDeathRecipient(deathRecipient_);
@@ -159,6 +223,22 @@ void GameControllerServerClientProxy::ReleaseServiceProxy()
     }
 }
 
+void GameControllerServerClientProxy::ReleaseServiceProxyIfDead(
+    const sptr<IGameControllerServerInterface> &serviceProxy)
+{
+    // The dead object error of the call marks the remote object as dead.
+    sptr<IRemoteObject> remoteObject = serviceProxy->AsObject();
+    if (remoteObject != nullptr && !remoteObject->IsObjectDead()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(loadServiceLock_);
+    if (gamecontrollerServerProxy_ != serviceProxy) {
+        return;
+    }
+    HILOGW("Release game controller proxy, because the systemAbility is dead.");
+    ReleaseServiceProxy();
+}
+
 int32_t GameControllerServerClientProxy::GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
                                                                  GameKeyMappingInfo &gameKeyMappingInfo)
 {
@@ -171,6 +251,7 @@ int32_t GameControllerServerClientProxy::GetGameKeyMappingConfig(const GetGameKe
     int32_t ret = serviceProxy->GetGameKeyMappingConfig(param, gameKeyMappingInfo);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("GetGameKeyMappingConfig failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -186,6 +267,41 @@ int32_t GameControllerServerClientProxy::SetCustomGameKeyMappingConfig(const Gam
     int32_t ret = serviceProxy->SetCustomGameKeyMappingConfig(gameKeyMappingInfo);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("SetCustomGameKeyMappingConfig failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
+    }
+    return ret;
+}
+
+int32_t GameControllerServerClientProxy::GetGameKeyMappingConfigs(
+    const std::vector<GetGameKeyMappingInfoParam> &params, std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    sptr<IGameControllerServerInterface> serviceProxy = GetServiceProxy();
+    if (serviceProxy == nullptr) {
+        HILOGE("get GameControllerServerProxy failed!");
+        return GAME_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+
+    int32_t ret = serviceProxy->GetGameKeyMappingConfigs(params, gameKeyMappingInfos);
+    if (ret != GAME_CONTROLLER_SUCCESS) {
+        HILOGE("GetGameKeyMappingConfigs failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
+    }
+    return ret;
+}
+
+int32_t GameControllerServerClientProxy::SetCustomGameKeyMappingConfigs(
+    const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    sptr<IGameControllerServerInterface> serviceProxy = GetServiceProxy();
+    if (serviceProxy == nullptr) {
+        HILOGE("get GameControllerServerProxy failed!");
+        return GAME_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+
+    int32_t ret = serviceProxy->SetCustomGameKeyMappingConfigs(gameKeyMappingInfos);
+    if (ret != GAME_CONTROLLER_SUCCESS) {
+        HILOGE("SetCustomGameKeyMappingConfigs failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -201,6 +317,7 @@ int32_t GameControllerServerClientProxy::BroadcastDeviceInfo(const GameInfo &gam
     int32_t ret = serviceProxy->BroadcastDeviceInfo(gameInfo, deviceInfo);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("BroadcastDeviceInfo failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -217,6 +334,7 @@ int32_t GameControllerServerClientProxy::SyncSupportKeyMappingGames(bool isSyncA
     int32_t ret = serviceProxy->SyncSupportKeyMappingGames(isSyncAll, gameInfos);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("SyncSupportKeyMappingGames failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -232,6 +350,7 @@ int32_t GameControllerServerClientProxy::SetDefaultGameKeyMappingConfig(const Ga
     int32_t ret = serviceProxy->SetDefaultGameKeyMappingConfig(gameKeyMappingInfo);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("SetDefaultGameKeyMappingConfig failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -248,6 +367,7 @@ int32_t GameControllerServerClientProxy::BroadcastOpenTemplateConfig(const GameI
     int32_t ret = serviceProxy->BroadcastOpenTemplateConfig(gameInfo, deviceInfo);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("BroadcastOpenTemplateConfig failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -263,6 +383,7 @@ int32_t GameControllerServerClientProxy::SyncIdentifiedDeviceInfos(const std::ve
     int32_t ret = serviceProxy->SyncIdentifiedDeviceInfos(deviceInfos);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("SyncIdentifiedDeviceInfos failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -278,6 +399,7 @@ int32_t GameControllerServerClientProxy::EnableGameKeyMapping(const GameInfo &ga
     int32_t ret = serviceProxy->EnableGameKeyMapping(gameInfo, isEnable);
     if (ret != GAME_CONTROLLER_SUCCESS) {
         HILOGE("EnableGameKeyMapping failed. ret=[%{public}d]", ret);
+        ReleaseServiceProxyIfDead(serviceProxy);
     }
     return ret;
 }
@@ -16,11 +16,15 @@
 #ifndef GAME_CONTROLLER_FRAMEWORK_WINDOW_INPUT_INTERCEPT_H
 #define GAME_CONTROLLER_FRAMEWORK_WINDOW_INPUT_INTERCEPT_H
 
+#include <atomic>
 #include <singleton.h>
 #include <unordered_set>
+#include <common_event_subscriber.h>
+#include <common_event_data.h>
 #include "window_input_intercept_consumer.h"
 #include "gamecontroller_client_model.h"
 #include <cpp/queue.h>
+#include "gamecontroller_queue_registry.h"
 
 namespace OHOS {
 namespace GameController {
@@ -35,7 +39,27 @@ public:
 
     void OnInputEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent) override;
 
+    /**
+     * Re-derive the difference between the realtime clock and the monotonic clock.
+     * It's called periodically on the input path and when the system time is changed.
+     */
+    void RefreshDeltaTime();
+
 private:
+    /**
+     * Get the difference between the realtime clock and the monotonic clock.
+     * It's refreshed when the last refresh is older than the refresh interval.
+     * @return the difference in ns
+     */
+    int64_t GetDeltaTime();
+
+    /**
+     * Convert the MMI action time to the system time.
+     * @param actionTime the time span from startup, in μs
+     * @return the system time, in ms
+     */
+    int64_t ToSystemTime(int64_t actionTime);
+
     /**
      * Consume key event
      * @param keyEvent Key Event
@@ -99,7 +123,8 @@ private:
     void DoAxisEventCallback(const GamePadAxisEvent &axisEvent);
 
     GamePadAxisEvent BuildGamePadAxisEvent(const int32_t id, const DeviceInfo &deviceInfo, const int64_t actionTime,
-                                           const GamePadAxisSourceTypeEnum sourceTypeEnum);
+                                           const GamePadAxisSourceTypeEnum sourceTypeEnum,
+                                           const std::shared_ptr<MMI::PointerEvent> &pointerEvent);
 
     /**
      * Check whether the pressed key is valid.
@@ -122,12 +147,37 @@ private:
     /**
      * Event callback queue
      */
-    std::unique_ptr<ffrt::queue> eventCallbackQueue_{nullptr};
+    std::unique_ptr<GameControllerQueue> eventCallbackQueue_{nullptr};
 
     /**
      * Difference between the time span from startup to the current time and the actual timestamp, in ns.
      */
-    int64_t deltaTime_ = 0;
+    std::atomic<int64_t> deltaTime_{0};
+
+    /**
+     * Time of the last refresh of deltaTime_, in ns of CLOCK_BOOTTIME. CLOCK_BOOTTIME keeps running during suspend,
+     * so the first event after resume always refreshes deltaTime_.
+     */
+    std::atomic<int64_t> lastRefreshTime_{0};
+};
+
+/**
+ * Listens to the system time change so that the timestamps of the gamepad events follow the NTP step at once.
+ */
+class TimeChangeEventListener : public EventFwk::CommonEventSubscriber {
+public:
+    TimeChangeEventListener(const EventFwk::CommonEventSubscribeInfo &subscriberInfo,
+                            const std::weak_ptr<WindowInputInterceptConsumer> &consumer)
+        : EventFwk::CommonEventSubscriber(subscriberInfo), consumer_(consumer)
+    {
+    }
+
+    ~TimeChangeEventListener() = default;
+
+    void OnReceiveEvent(const EventFwk::CommonEventData &data) override;
+
+private:
+    std::weak_ptr<WindowInputInterceptConsumer> consumer_;
 };
 
 class WindowInputIntercept : public DelayedSingleton<WindowInputIntercept> {
@@ -150,6 +200,13 @@ public:
      */
     void UnRegisterAllWindowInputIntercept();
 
+private:
+    /**
+     * Subscribes to the system time change event for the consumer.
+     * @param consumer Consumer of window input event
+     */
+    void SubscribeTimeChangeEvent(const std::shared_ptr<WindowInputInterceptConsumer> &consumer);
+
 private:
     std::mutex registerMutex_;
 
@@ -162,6 +219,11 @@ private:
      * Consumer of window input event
      */
     std::shared_ptr<Rosen::IInputEventInterceptConsumer> consumer_;
+
+    /**
+     * Subscriber of the system time change event
+     */
+    std::shared_ptr<TimeChangeEventListener> timeChangeSubscriber_;
 };
 }
 }
@@ -85,8 +85,8 @@ void InputEventCallback::OnGamePadAxisEventCallback(const GamePadAxisEvent &even
             return;
         }
         if (gamePadAxisCallback_.find(event.axisSourceType) == gamePadAxisCallback_.end()) {
-            HILOGD("[InputEventCallback]OnGamePadAxisEventCallback. No callback on axisType [%{public}d]",
-                   event.axisSourceType);
+            HILOGD_LIMIT("[InputEventCallback]OnGamePadAxisEventCallback. No callback on axisType [%{public}d]",
+                         event.axisSourceType);
             return;
         }
         axisCallback = gamePadAxisCallback_[event.axisSourceType];
@@ -107,8 +107,8 @@ void InputEventCallback::OnGamePadButtonEventCallback(const GamePadButtonEvent &
         }
         GamePadButtonTypeEnum gamePadButtonTypeEnum = static_cast<GamePadButtonTypeEnum>(event.keyCode);
         if (gamePadButtonCallback_.find(gamePadButtonTypeEnum) == gamePadButtonCallback_.end()) {
-            HILOGD("[InputEventCallback]OnGamePadButtonEventCallback. No callback on keyCode [%{private}d]",
-                   event.keyCode);
+            HILOGD_LIMIT("[InputEventCallback]OnGamePadButtonEventCallback. No callback on keyCode [%{private}d]",
+                         event.keyCode);
             return;
         }
         buttonCallback = gamePadButtonCallback_[gamePadButtonTypeEnum];
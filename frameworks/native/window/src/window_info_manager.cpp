@@ -25,7 +25,7 @@ using namespace OHOS::Rosen;
 void WindowChangeListener::OnSizeChange(Rect rect, WindowSizeChangeReason reason,
                                         const std::shared_ptr<RSTransaction> &rsTransaction)
 {
-    HILOGI("OnSizeChange rect:%{public}s", rect.ToString().c_str());
+    HILOGI_LIMIT("OnSizeChange rect:%{public}s", rect.ToString().c_str());
     DelayedSingleton<WindowInfoManager>::GetInstance()->UpdateWindowInfo(rect);
 }
 
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 #include <optional>
+#include <common_event_manager.h>
+#include <matching_skills.h>
 #include "input_manager.h"
 #include "window_input_intercept.h"
 #include "window_input_intercept_client.h"
@@ -22,6 +24,8 @@
 #include "gamecontroller_client_model.h"
 #include "key_mapping_handle.h"
 #include "key_to_touch_manager.h"
+#include "input_trace_recorder.h"
+#include "gamecontroller_utils.h"
 
 namespace OHOS {
 namespace GameController {
@@ -80,28 +84,59 @@ const int64_t ONE_SECOND_BY_NS = 1000000000LL;
 const int32_t KEY_ACTION_DOWN = 0;
 const int32_t KEY_ACTION_UP = 1;
 const int64_t US_TO_NS = 1000LL;
+
+/**
+ * The realtime clock may be slewed by NTP, so deltaTime_ is re-derived at least once per second.
+ */
+const int64_t DELTA_TIME_REFRESH_INTERVAL = ONE_SECOND_BY_NS;
+const char* TIME_CHANGED_EVENT = "usual.event.TIME_CHANGED";
+
+int64_t GetClockTime(clockid_t clockId)
+{
+    timespec t = {};
+    clock_gettime(clockId, &t);
+    return int64_t(t.tv_sec) * ONE_SECOND_BY_NS + t.tv_nsec;
+}
 }
 
 WindowInputInterceptConsumer::WindowInputInterceptConsumer() noexcept
 {
-    eventCallbackQueue_ = std::make_unique<ffrt::queue>("inputEventCallbackQueue",
-                                                        ffrt::queue_attr().qos(ffrt::qos_default));
-    timespec t1 = {};
-    clock_gettime(CLOCK_MONOTONIC, &t1);
-    int64_t monoTime = int64_t(t1.tv_sec) * ONE_SECOND_BY_NS + t1.tv_nsec;
-    timespec t2 = {};
-    clock_gettime(CLOCK_REALTIME, &t2);
-    int64_t realTime = int64_t(t2.tv_sec) * ONE_SECOND_BY_NS + t2.tv_nsec;
-    deltaTime_ = realTime - monoTime;
+    eventCallbackQueue_ =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("inputEventCallbackQueue");
+    RefreshDeltaTime();
+}
+
+void WindowInputInterceptConsumer::RefreshDeltaTime()
+{
+    int64_t monoTime = GetClockTime(CLOCK_MONOTONIC);
+    int64_t realTime = GetClockTime(CLOCK_REALTIME);
+    deltaTime_.store(realTime - monoTime, std::memory_order_relaxed);
+    lastRefreshTime_.store(GetClockTime(CLOCK_BOOTTIME), std::memory_order_relaxed);
+}
+
+int64_t WindowInputInterceptConsumer::GetDeltaTime()
+{
+    if (GetClockTime(CLOCK_BOOTTIME) - lastRefreshTime_.load(std::memory_order_relaxed) >=
+        DELTA_TIME_REFRESH_INTERVAL) {
+        RefreshDeltaTime();
+    }
+    return deltaTime_.load(std::memory_order_relaxed);
+}
+
+int64_t WindowInputInterceptConsumer::ToSystemTime(int64_t actionTime)
+{
+    return (GetDeltaTime() + actionTime * US_TO_NS) / NS_TO_MS;
 }
 
 void WindowInputInterceptConsumer::OnInputEvent(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
 {
-    HILOGD("OnKeyEvent is %{private}s", keyEvent->ToString().c_str());
+    HILOGD_LIMIT("OnKeyEvent is %{private}s", keyEvent->ToString().c_str());
     if (IsNotifyOpenTemplateConfigPage(keyEvent)) {
         return;
     }
-    if (DelayedSingleton<KeyToTouchManager>::GetInstance()->DispatchKeyEvent(keyEvent)) {
+    bool isDispatched = DelayedSingleton<KeyToTouchManager>::GetInstance()->DispatchKeyEvent(keyEvent);
+    DelayedSingleton<InputTraceRecorder>::GetInstance()->RecordKeyEvent(keyEvent, isDispatched);
+    if (isDispatched) {
         return;
     }
     ConsumeKeyInputEvent(keyEvent);
@@ -110,8 +145,10 @@ void WindowInputInterceptConsumer::OnInputEvent(const std::shared_ptr<MMI::KeyEv
 
 void WindowInputInterceptConsumer::OnInputEvent(const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
 {
-    HILOGD("OnInputEvent is %{private}s", pointerEvent->ToString().c_str());
-    if (DelayedSingleton<KeyToTouchManager>::GetInstance()->DispatchPointerEvent(pointerEvent)) {
+    HILOGD_LIMIT("OnInputEvent is %{private}s", pointerEvent->ToString().c_str());
+    bool isDispatched = DelayedSingleton<KeyToTouchManager>::GetInstance()->DispatchPointerEvent(pointerEvent);
+    DelayedSingleton<InputTraceRecorder>::GetInstance()->RecordPointerEvent(pointerEvent, isDispatched);
+    if (isDispatched) {
         return;
     }
     ConsumePointerInputEvent(pointerEvent);
@@ -127,8 +164,8 @@ void WindowInputInterceptConsumer::ConsumeKeyInputEvent(const std::shared_ptr<MM
         keyEvent->GetKeyAction() == KeyEvent::KEY_ACTION_CANCEL) {
         buttonEvent.keyAction = KEY_ACTION_UP;
     } else {
-        HILOGW("OnKeyEvent Unknown KeyAction is %{public}d",
-               keyEvent->GetKeyAction());
+        HILOGW_LIMIT("OnKeyEvent Unknown KeyAction is %{public}d",
+                     keyEvent->GetKeyAction());
         return;
     }
     buttonEvent.keyCode = keyEvent->GetKeyCode();
@@ -139,12 +176,13 @@ void WindowInputInterceptConsumer::ConsumeKeyInputEvent(const std::shared_ptr<MM
     buttonEvent.id = keyEvent->GetDeviceId();
     DeviceInfo deviceInfo = DelayedSingleton<MultiModalInputMgtService>::GetInstance()->GetDeviceInfo(buttonEvent.id);
     if (deviceInfo.UniqIsEmpty()) {
-        HILOGW("OnKeyEvent Unknown device Id is %{public}d",
-               buttonEvent.id);
+        HILOGW_LIMIT("OnKeyEvent Unknown device Id is %{public}d",
+                     buttonEvent.id);
         return;
     }
     buttonEvent.uniq = deviceInfo.uniq;
-    buttonEvent.actionTime = (deltaTime_ + keyEvent->GetActionTime() * US_TO_NS) / NS_TO_MS; // 将距离开机启动时长转为系统时间
+    buttonEvent.actionTime = ToSystemTime(keyEvent->GetActionTime()); // 将距离开机启动时长转为系统时间
+    buttonEvent.originalTime = keyEvent->GetActionTime();
     std::vector<int32_t> pressedKeys = keyEvent->GetPressedKeys();
     for (auto keyCode: pressedKeys) {
         if (!PressedKeyIsValid(keyEvent, keyCode, deviceInfo)) {
@@ -169,14 +207,14 @@ bool WindowInputInterceptConsumer::PressedKeyIsValid(const std::shared_ptr<MMI::
 
     std::optional<MMI::KeyEvent::KeyItem> keyItem = keyEvent->GetKeyItem(pressedKeyCode);
     if (!keyItem.has_value()) {
-        HILOGW("OnKeyEvent discard pressed keyCode [%{private}d], no keyItem",
-               pressedKeyCode);
+        HILOGW_LIMIT("OnKeyEvent discard pressed keyCode [%{private}d], no keyItem",
+                     pressedKeyCode);
         return false;
     }
 
     if (keyItem.value().GetDeviceId() != keyEvent->GetDeviceId()) {
-        HILOGD("OnKeyEvent discard pressed keyCode [%{private}d], the deviceId is invalid",
-               pressedKeyCode);
+        HILOGD_LIMIT("OnKeyEvent discard pressed keyCode [%{private}d], the deviceId is invalid",
+                     pressedKeyCode);
         return false;
     }
 
@@ -216,10 +254,10 @@ void WindowInputInterceptConsumer::ConsumeGamePadAxisInputEvent(const std::share
     int32_t id = pointerEvent->GetDeviceId();
     DeviceInfo deviceInfo = DelayedSingleton<MultiModalInputMgtService>::GetInstance()->GetDeviceInfo(id);
     if (deviceInfo.UniqIsEmpty()) {
-        HILOGW("OnAxisEvent Unknown device Id is %{public}d", id);
+        HILOGW_LIMIT("OnAxisEvent Unknown device Id is %{public}d", id);
         return;
     }
-    int64_t actionTime = (deltaTime_ + pointerEvent->GetActionTime() * US_TO_NS) / NS_TO_MS;
+    int64_t actionTime = ToSystemTime(pointerEvent->GetActionTime());
     CallLeftThumbstickAxisEvent(id, deviceInfo, actionTime, pointerEvent);
     CallRightThumbstickAxisEvent(id, deviceInfo, actionTime, pointerEvent);
     CallLeftTriggerAxisEvent(id, deviceInfo, actionTime, pointerEvent);
@@ -229,14 +267,16 @@ void WindowInputInterceptConsumer::ConsumeGamePadAxisInputEvent(const std::share
 
 void WindowInputInterceptConsumer::DoGamePadKeyEventCallback(const GamePadButtonEvent &buttonEvent)
 {
-    eventCallbackQueue_->submit([buttonEvent, this] {
+    eventCallbackQueue_->submit([buttonEvent, this]() mutable {
+        buttonEvent.deliveryTime = StringUtils::GetSysClockTime();
         DelayedSingleton<InputEventCallback>::GetInstance()->OnGamePadButtonEventCallback(buttonEvent);
     });
 }
 
 void WindowInputInterceptConsumer::DoAxisEventCallback(const GamePadAxisEvent &axisEvent)
 {
-    eventCallbackQueue_->submit([axisEvent, this] {
+    eventCallbackQueue_->submit([axisEvent, this]() mutable {
+        axisEvent.deliveryTime = StringUtils::GetSysClockTime();
         DelayedSingleton<InputEventCallback>::GetInstance()->OnGamePadAxisEventCallback(axisEvent);
     });
 }
@@ -251,7 +291,7 @@ void WindowInputInterceptConsumer::CallLeftThumbstickAxisEvent(const int32_t id,
         return;
     }
     GamePadAxisEvent axisEvent = BuildGamePadAxisEvent(id, deviceInfo, actionTime,
-                                                       GamePadAxisSourceTypeEnum::LeftThumbstick);
+                                                       GamePadAxisSourceTypeEnum::LeftThumbstick, pointerEvent);
 
     axisEvent.xValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_X);
     axisEvent.yValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_Y);
@@ -268,7 +308,7 @@ void WindowInputInterceptConsumer::CallRightThumbstickAxisEvent(const int32_t id
         return;
     }
     GamePadAxisEvent axisEvent = BuildGamePadAxisEvent(id, deviceInfo, actionTime,
-                                                       GamePadAxisSourceTypeEnum::RightThumbstick);
+                                                       GamePadAxisSourceTypeEnum::RightThumbstick, pointerEvent);
     axisEvent.zValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_Z);
     axisEvent.rzValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_RZ);
     DoAxisEventCallback(axisEvent);
@@ -283,7 +323,7 @@ void WindowInputInterceptConsumer::CallLeftTriggerAxisEvent(const int32_t id,
         return;
     }
     GamePadAxisEvent axisEvent = BuildGamePadAxisEvent(id, deviceInfo, actionTime,
-                                                       GamePadAxisSourceTypeEnum::LeftTriggerAxis);
+                                                       GamePadAxisSourceTypeEnum::LeftTriggerAxis, pointerEvent);
     axisEvent.brakeValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_BRAKE);
     DoAxisEventCallback(axisEvent);
 }
@@ -297,7 +337,7 @@ void WindowInputInterceptConsumer::CallRightTriggerAxisEvent(const int32_t id,
         return;
     }
     GamePadAxisEvent axisEvent = BuildGamePadAxisEvent(id, deviceInfo, actionTime,
-                                                       GamePadAxisSourceTypeEnum::RightTriggerAxis);
+                                                       GamePadAxisSourceTypeEnum::RightTriggerAxis, pointerEvent);
     axisEvent.gasValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_GAS);
     DoAxisEventCallback(axisEvent);
 }
@@ -312,21 +352,22 @@ void WindowInputInterceptConsumer::CallDpadAxisEvent(const int32_t id,
         return;
     }
     GamePadAxisEvent axisEvent = BuildGamePadAxisEvent(id, deviceInfo, actionTime,
-                                                       GamePadAxisSourceTypeEnum::Dpad);
+                                                       GamePadAxisSourceTypeEnum::Dpad, pointerEvent);
     axisEvent.hatxValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_HAT0X);
     axisEvent.hatyValue = pointerEvent->GetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_HAT0Y);
     DoAxisEventCallback(axisEvent);
 }
 
-GamePadAxisEvent WindowInputInterceptConsumer::BuildGamePadAxisEvent(const int32_t id, const DeviceInfo &deviceInfo,
-                                                                     const int64_t actionTime,
-                                                                     const GamePadAxisSourceTypeEnum sourceTypeEnum)
+GamePadAxisEvent WindowInputInterceptConsumer::BuildGamePadAxisEvent(
+    const int32_t id, const DeviceInfo &deviceInfo, const int64_t actionTime,
+    const GamePadAxisSourceTypeEnum sourceTypeEnum, const std::shared_ptr<MMI::PointerEvent> &pointerEvent)
 {
     GamePadAxisEvent axisEvent;
     axisEvent.id = id;
     axisEvent.uniq = deviceInfo.uniq;
     axisEvent.axisSourceType = sourceTypeEnum;
     axisEvent.actionTime = actionTime;
+    axisEvent.originalTime = pointerEvent->GetActionTime();
     return axisEvent;
 }
 
@@ -335,6 +376,16 @@ bool WindowInputInterceptConsumer::IsNotifyOpenTemplateConfigPage(const std::sha
     return DelayedSingleton<KeyMappingHandle>::GetInstance()->IsNotifyOpenTemplateConfigPage(keyEvent);
 }
 
+void TimeChangeEventListener::OnReceiveEvent(const EventFwk::CommonEventData &data)
+{
+    std::shared_ptr<WindowInputInterceptConsumer> consumer = consumer_.lock();
+    if (consumer == nullptr) {
+        return;
+    }
+    HILOGI("The system time is changed, refresh the delta time");
+    consumer->RefreshDeltaTime();
+}
+
 WindowInputIntercept::~WindowInputIntercept()
 {
 }
@@ -347,7 +398,9 @@ void WindowInputIntercept::RegisterWindowInputIntercept(const int32_t deviceId)
 {
     std::lock_guard<std::mutex> lock(registerMutex_);
     if (consumer_ == nullptr) {
-        consumer_ = std::make_shared<WindowInputInterceptConsumer>();
+        std::shared_ptr<WindowInputInterceptConsumer> consumer = std::make_shared<WindowInputInterceptConsumer>();
+        SubscribeTimeChangeEvent(consumer);
+        consumer_ = consumer;
     }
     if (registerDeviceIdSet_.find(deviceId) != registerDeviceIdSet_.end()) {
         return;
@@ -357,6 +410,22 @@ void WindowInputIntercept::RegisterWindowInputIntercept(const int32_t deviceId)
     HILOGI("Call RegisterWindowInputIntercept. the deviceId is %{public}d", deviceId);
 }
 
+void WindowInputIntercept::SubscribeTimeChangeEvent(const std::shared_ptr<WindowInputInterceptConsumer> &consumer)
+{
+    if (timeChangeSubscriber_ != nullptr) {
+        EventFwk::CommonEventManager::UnSubscribeCommonEvent(timeChangeSubscriber_);
+    }
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(TIME_CHANGED_EVENT);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    timeChangeSubscriber_ = std::make_shared<TimeChangeEventListener>(subscribeInfo, consumer);
+    if (EventFwk::CommonEventManager::SubscribeCommonEvent(timeChangeSubscriber_)) {
+        HILOGI("SubscribeTimeChangeEvent success");
+    } else {
+        HILOGE("SubscribeTimeChangeEvent failed");
+    }
+}
+
 void WindowInputIntercept::UnRegisterWindowInputIntercept(const int32_t deviceId)
 {
     std::lock_guard<std::mutex> lock(registerMutex_);
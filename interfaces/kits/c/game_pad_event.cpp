@@ -81,6 +81,20 @@ GameController_ErrorCode OH_GamePad_ButtonEvent_GetActionTime(const struct GameP
     return OHOS::GameController::GamePadEventProxy::GetInstance().GetActionTimeFromButtonEvent(buttonEvent, actionTime);
 }
 
+GameController_ErrorCode OH_GamePad_ButtonEvent_GetOriginalTime(const struct GamePad_ButtonEvent* buttonEvent,
+                                                                int64_t* originalTime)
+{
+    return OHOS::GameController::GamePadEventProxy::GetInstance().GetOriginalTimeFromButtonEvent(buttonEvent,
+                                                                                                 originalTime);
+}
+
+GameController_ErrorCode OH_GamePad_ButtonEvent_GetDeliveryTime(const struct GamePad_ButtonEvent* buttonEvent,
+                                                                int64_t* deliveryTime)
+{
+    return OHOS::GameController::GamePadEventProxy::GetInstance().GetDeliveryTimeFromButtonEvent(buttonEvent,
+                                                                                                 deliveryTime);
+}
+
 GameController_ErrorCode OH_GamePad_AxisEvent_GetDeviceId(const struct GamePad_AxisEvent* axisEvent, char** deviceId)
 {
     return OHOS::GameController::GamePadEventProxy::GetInstance().GetDeviceIdFromAxisEvent(axisEvent, deviceId);
@@ -147,3 +161,15 @@ GameController_ErrorCode OH_GamePad_AxisEvent_GetActionTime(const struct GamePad
     return OHOS::GameController::GamePadEventProxy::GetInstance().GetActionTimeFromAxisEvent(axisEvent, actionTime);
 }
 
+GameController_ErrorCode OH_GamePad_AxisEvent_GetOriginalTime(const struct GamePad_AxisEvent* axisEvent,
+                                                              int64_t* originalTime)
+{
+    return OHOS::GameController::GamePadEventProxy::GetInstance().GetOriginalTimeFromAxisEvent(axisEvent, originalTime);
+}
+
+GameController_ErrorCode OH_GamePad_AxisEvent_GetDeliveryTime(const struct GamePad_AxisEvent* axisEvent,
+                                                              int64_t* deliveryTime)
+{
+    return OHOS::GameController::GamePadEventProxy::GetInstance().GetDeliveryTimeFromAxisEvent(axisEvent, deliveryTime);
+}
+
@@ -243,6 +243,32 @@ GameController_ErrorCode OH_GamePad_PressedButton_GetButtonCodeName(const struct
 GameController_ErrorCode OH_GamePad_ButtonEvent_GetActionTime(const struct GamePad_ButtonEvent* buttonEvent,
                                                               int64_t* actionTime);
 
+/**
+ * @brief Obtains the time when the event was generated from {@link GamePad_ButtonEvent}.
+ * The time is in microseconds since system startup and uses the same clock as the monotonic time of the system.
+ * @param buttonEvent Pointer to the {@link GamePad_ButtonEvent} instance.
+ * The value cannot be null. Otherwise, an error code is returned.
+ * @param originalTime Pointer to the time when the event was generated.
+ * @return Returns {@link GAME_CONTROLLER_SUCCESS} if the operation is successful.
+ * Returns {@link GAME_CONTROLLER_PARAM_ERROR} if the value of buttonEvent or originalTime is null.
+ * @since 22
+ */
+GameController_ErrorCode OH_GamePad_ButtonEvent_GetOriginalTime(const struct GamePad_ButtonEvent* buttonEvent,
+                                                                int64_t* originalTime);
+
+/**
+ * @brief Obtains the time when the event was delivered to the callback from {@link GamePad_ButtonEvent}.
+ * The time is in microseconds since system startup and uses the same clock as the monotonic time of the system.
+ * @param buttonEvent Pointer to the {@link GamePad_ButtonEvent} instance.
+ * The value cannot be null. Otherwise, an error code is returned.
+ * @param deliveryTime Pointer to the time when the event was delivered to the callback.
+ * @return Returns {@link GAME_CONTROLLER_SUCCESS} if the operation is successful.
+ * Returns {@link GAME_CONTROLLER_PARAM_ERROR} if the value of buttonEvent or deliveryTime is null.
+ * @since 22
+ */
+GameController_ErrorCode OH_GamePad_ButtonEvent_GetDeliveryTime(const struct GamePad_ButtonEvent* buttonEvent,
+                                                                int64_t* deliveryTime);
+
 /**
  * @brief Obtains the device ID from {@link GamePad_AxisEvent}.
  * @param axisEvent Pointer to the {@link GamePad_AxisEvent} instance.
@@ -374,6 +400,32 @@ GameController_ErrorCode OH_GamePad_AxisEvent_GetGasAxisValue(const struct GameP
 GameController_ErrorCode OH_GamePad_AxisEvent_GetActionTime(const struct GamePad_AxisEvent* axisEvent,
                                                             int64_t* actionTime);
 
+/**
+ * @brief Obtains the time when the event was generated from {@link GamePad_AxisEvent}.
+ * The time is in microseconds since system startup and uses the same clock as the monotonic time of the system.
+ * @param axisEvent Pointer to the {@link GamePad_AxisEvent} instance.
+ * The value cannot be null. Otherwise, an error code is returned.
+ * @param originalTime Pointer to the time when the event was generated.
+ * @return Returns {@link GAME_CONTROLLER_SUCCESS} if the operation is successful.
+ * Returns {@link GAME_CONTROLLER_PARAM_ERROR} if the value of axisEvent or originalTime is null.
+ * @since 22
+ */
+GameController_ErrorCode OH_GamePad_AxisEvent_GetOriginalTime(const struct GamePad_AxisEvent* axisEvent,
+                                                              int64_t* originalTime);
+
+/**
+ * @brief Obtains the time when the event was delivered to the callback from {@link GamePad_AxisEvent}.
+ * The time is in microseconds since system startup and uses the same clock as the monotonic time of the system.
+ * @param axisEvent Pointer to the {@link GamePad_AxisEvent} instance.
+ * The value cannot be null. Otherwise, an error code is returned.
+ * @param deliveryTime Pointer to the time when the event was delivered to the callback.
+ * @return Returns {@link GAME_CONTROLLER_SUCCESS} if the operation is successful.
+ * Returns {@link GAME_CONTROLLER_PARAM_ERROR} if the value of axisEvent or deliveryTime is null.
+ * @since 22
+ */
+GameController_ErrorCode OH_GamePad_AxisEvent_GetDeliveryTime(const struct GamePad_AxisEvent* axisEvent,
+                                                              int64_t* deliveryTime);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,71 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_CONFIG_SNAPSHOT_H
+#define GAME_CONTROLLER_CONFIG_SNAPSHOT_H
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace OHOS {
+namespace GameController {
+/**
+ * Holds an immutable snapshot of a configuration.
+ * Readers take the current snapshot and work on it without any other lock.
+ * Writers are serialized by a write lock of the owner, which readers never take. A writer builds a new
+ * configuration from a copy, saves the configuration file, and publishes it only after the save succeeds,
+ * so a reader never sees a partial update or one that isn't persisted.
+ * The internal lock only guards the pointer swap, so it's never held while the configuration is copied,
+ * converted or persisted.
+ */
+template<typename T>
+class ConfigSnapshot {
+public:
+    ConfigSnapshot() : data_(std::make_shared<const T>())
+    {
+    }
+
+    /**
+     * Get the current snapshot. It stays valid even if a new one is published later.
+     * @return the current snapshot, never nullptr
+     */
+    std::shared_ptr<const T> Load() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return data_;
+    }
+
+    /**
+     * Publish a new snapshot.
+     * @param data the new configuration
+     */
+    void Publish(T data)
+    {
+        std::shared_ptr<const T> newData = std::make_shared<const T>(std::move(data));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            data_.swap(newData);
+        }
+        // newData holds the old snapshot here, so it's released outside the lock.
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<const T> data_;
+};
+}
+}
+#endif //GAME_CONTROLLER_CONFIG_SNAPSHOT_H
@@ -50,6 +50,71 @@ public:
      */
     static std::pair<bool, nlohmann::json> ReadJsonFromFile(const std::string &path);
 
+    /**
+     * Write the text to the file. The file is replaced atomically, so it keeps the old content if the write fails.
+     * @param path File Path
+     * @param content the text
+     * @return The value true indicates that the data is successfully written.
+     */
+    static bool WriteFile(const std::string &path, const std::string &content);
+
+    /**
+     * Write the text to a temporary file next to the file and flush it to the disk. The file is not changed.
+     * @param path File Path
+     * @param content the text
+     * @param tempPath the temporary file
+     * @return true means success. The temporary file is removed if it fails.
+     */
+    static bool WriteTempFile(const std::string &path, const std::string &content, std::string &tempPath);
+
+    /**
+     * Replace the file by the temporary file written by WriteTempFile, and flush the directory to the disk.
+     * @param tempPath the temporary file
+     * @param path File Path
+     * @return true means success. The temporary file is removed and the file is not changed if it fails.
+     */
+    static bool ReplaceFile(const std::string &tempPath, const std::string &path);
+
+    /**
+     * Rename the temporary file written by WriteTempFile to the file. The rename is not persisted
+     * until SyncDirectory is called.
+     * @param tempPath the temporary file
+     * @param path File Path
+     * @return true means success. The temporary file is removed and the file is not changed if it fails.
+     */
+    static bool RenameFile(const std::string &tempPath, const std::string &path);
+
+    /**
+     * Flush the directory of the file to the disk, so the rename of the file is persisted.
+     * @param path File Path
+     */
+    static void SyncDirectory(const std::string &path);
+
+    /**
+     * Read the whole file.
+     * @param path File Path
+     * @param content the text read
+     * @return true means success
+     */
+    static bool ReadFile(const std::string &path, std::string &content);
+
+    /**
+     * Open the file for reading. The opened file is still read after the file is replaced.
+     * @param path File Path
+     * @return the file descriptor, which is closed by the caller. -1 means failure.
+     */
+    static int32_t OpenFile(const std::string &path);
+
+    /**
+     * Read a part of the file opened by OpenFile.
+     * @param fd the file descriptor
+     * @param offset the offset from the beginning of the file
+     * @param length the number of bytes
+     * @param content the text read
+     * @return true means exactly length bytes are read
+     */
+    static bool ReadFileRange(int32_t fd, size_t offset, size_t length, std::string &content);
+
     /**
      * Check whether the file exists.
      * @param filePath file path
@@ -12,7 +12,11 @@
  *  See the License for the specific language governing permissions and
  *  limitations under the License.
  */
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
 #include <fstream>
+#include <iterator>
 #include <unistd.h>
 #include <cstdlib>
 #include <iostream>
@@ -26,6 +30,7 @@
 namespace OHOS {
 namespace GameController {
 namespace {
+const char* TEMP_FILE_SUFFIX = ".tmp";
 const int32_t ONE_BYTE_CHAR = 1;
 const int32_t TWO_BYTE_CHAR = 2;
 const int32_t THREE_BYTE_CHAR = 3;
@@ -182,6 +187,153 @@ std::pair<bool, nlohmann::json> JsonUtils::ReadJsonFromFile(const std::string &p
     return std::make_pair(true, content);
 }
 
+bool JsonUtils::WriteFile(const std::string &path, const std::string &content)
+{
+    std::string tempPath;
+    if (!WriteTempFile(path, content, tempPath)) {
+        return false;
+    }
+    return ReplaceFile(tempPath, path);
+}
+
+bool JsonUtils::WriteTempFile(const std::string &path, const std::string &content, std::string &tempPath)
+{
+    char canonicalPath[PATH_MAX] = {};
+    if (realpath(path.c_str(), canonicalPath) == nullptr) {
+        HILOGE("Invalid path [%{public}s].", path.c_str());
+        return false;
+    }
+    // The file keeps its permissions after it's replaced.
+    struct stat fileStat = {};
+    mode_t mode = stat(canonicalPath, &fileStat) == 0 ? (fileStat.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO)) :
+        (S_IREAD | S_IWRITE);
+    tempPath = std::string(canonicalPath) + TEMP_FILE_SUFFIX;
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, mode);
+    if (fd < 0) {
+        HILOGE("open [%{public}s] file failed. errno is [%{public}d]", tempPath.c_str(), errno);
+        return false;
+    }
+    fchmod(fd, mode);
+    size_t written = 0;
+    while (written < content.size()) {
+        ssize_t ret = write(fd, content.data() + written, content.size() - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            break;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    bool isSuccess = written == content.size() && fsync(fd) == 0;
+    if (close(fd) != 0) {
+        isSuccess = false;
+    }
+    if (!isSuccess) {
+        HILOGE("write [%{public}s] file failed. errno is [%{public}d]", tempPath.c_str(), errno);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool JsonUtils::ReplaceFile(const std::string &tempPath, const std::string &path)
+{
+    if (!RenameFile(tempPath, path)) {
+        return false;
+    }
+    SyncDirectory(path);
+    return true;
+}
+
+bool JsonUtils::RenameFile(const std::string &tempPath, const std::string &path)
+{
+    char canonicalPath[PATH_MAX] = {};
+    if (realpath(path.c_str(), canonicalPath) == nullptr) {
+        HILOGE("Invalid path [%{public}s].", path.c_str());
+        unlink(tempPath.c_str());
+        return false;
+    }
+    if (rename(tempPath.c_str(), canonicalPath) != 0) {
+        HILOGE("replace [%{public}s] file failed. errno is [%{public}d]", canonicalPath, errno);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void JsonUtils::SyncDirectory(const std::string &path)
+{
+    char canonicalPath[PATH_MAX] = {};
+    if (realpath(path.c_str(), canonicalPath) == nullptr) {
+        HILOGE("Invalid path [%{public}s].", path.c_str());
+        return;
+    }
+    // The rename is persisted with the directory.
+    std::string dirPath = std::filesystem::path(canonicalPath).parent_path().string();
+    int dirFd = open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0) {
+        fsync(dirFd);
+        close(dirFd);
+    }
+}
+
+bool JsonUtils::ReadFile(const std::string &path, std::string &content)
+{
+    char canonicalPath[PATH_MAX] = {};
+    if (realpath(path.c_str(), canonicalPath) == nullptr) {
+        HILOGE("realpath failed for [%{public}s]", path.c_str());
+        return false;
+    }
+
+    std::ifstream ifs(canonicalPath, std::ios::binary);
+    if (!ifs.is_open()) {
+        HILOGE("open [%{public}s] file failed.", canonicalPath);
+        return false;
+    }
+    content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    if (ifs.bad()) {
+        HILOGE("read [%{public}s] file failed.", canonicalPath);
+        return false;
+    }
+    return true;
+}
+
+int32_t JsonUtils::OpenFile(const std::string &path)
+{
+    char canonicalPath[PATH_MAX] = {};
+    if (realpath(path.c_str(), canonicalPath) == nullptr) {
+        HILOGE("realpath failed for [%{public}s]", path.c_str());
+        return -1;
+    }
+    int fd = open(canonicalPath, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        HILOGE("open [%{public}s] file failed. errno is [%{public}d]", canonicalPath, errno);
+    }
+    return fd;
+}
+
+bool JsonUtils::ReadFileRange(int32_t fd, size_t offset, size_t length, std::string &content)
+{
+    content.resize(length);
+    size_t readLength = 0;
+    while (readLength < length) {
+        ssize_t ret = pread(fd, &content[readLength], length - readLength, static_cast<off_t>(offset + readLength));
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            break;
+        }
+        readLength += static_cast<size_t>(ret);
+    }
+    if (readLength != length) {
+        HILOGE("read [%{public}zu] bytes at [%{public}zu] failed. errno is [%{public}d]", length, offset, errno);
+        return false;
+    }
+    return true;
+}
+
 bool JsonUtils::IsFileExist(const std::string &filePath)
 {
     return access(filePath.c_str(), F_OK) == 0;
@@ -20,7 +20,9 @@
 #include <map>
 #include <unordered_map>
 #include <cstdint>
+#include <mutex>
 #include "singleton.h"
+#include "config_snapshot.h"
 #include "gamecontroller_client_model.h"
 #include "nlohmann/json.hpp"
 
@@ -99,13 +101,34 @@ private:
 
     int32_t SaveToConfigFile(nlohmann::json &jsonContent, std::vector<IdentifyDeviceInfo> &devices);
 
+    /**
+     * Keep the published generation, or publish a new one when the rules are changed or it's not published.
+     * @param isRuleChanged whether the rules are different from the ones the generation is published for
+     */
+    void LoadRuleGeneration(bool isRuleChanged);
+
+    /**
+     * Publish a new generation after the rules are changed. Called with writeMutex_ held.
+     */
+    void PublishRuleGeneration();
+
+    void RemoveRuleGeneration();
+
 private:
     /**
      * Identified Devices
      */
-    std::vector<IdentifyDeviceInfo> identifiedDevices_;
+    ConfigSnapshot<std::vector<IdentifyDeviceInfo>> identifiedDevices_;
+
+    /**
+     * Serializes the writers of identifiedDevices_
+     */
+    std::mutex writeMutex_;
 
-    std::mutex mMutex_;
+    /**
+     * The generation of the identification rules. Guarded by writeMutex_.
+     */
+    int64_t ruleGeneration_ = 0;
 };
 }
 }
@@ -17,6 +17,10 @@
 #include <iostream>
 #include <fstream>
 #include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <sys/stat.h>
 #include <nlohmann/json.hpp>
 #include "gamecontroller_constants.h"
 #include "device_manager.h"
@@ -35,6 +39,13 @@ const char* VENDOR = "Vendor";
 const char* NAME_PREFIX = "NamePrefix";
 const char* DEVICE_CONFIG = "device_config.json";
 const int32_t MAX_DEVICE_NUMBER = 10000;
+const char* FIELD_GENERATION = "generation";
+
+/**
+ * The generation of the rules is readable by all the apps, so they can tell whether their cached results are stale.
+ */
+const std::string RULE_GENERATION_PATH =
+    "/data/service/el1/public/for-all-app/gamecontroller_server/device_rule_generation.json";
 /**
  * The device type to be identified can be configured. Currently, only GamePad is supported.
  */
@@ -107,8 +118,8 @@ int32_t DeviceManager::DeviceIdentify(const std::vector<DeviceInfo> &devices, st
         return GAME_CONTROLLER_SUCCESS;
     }
 
-    std::lock_guard<std::mutex> lock(mMutex_);
-    if (identifiedDevices_.empty()) {
+    std::shared_ptr<const std::vector<IdentifyDeviceInfo>> identifiedDevices = identifiedDevices_.Load();
+    if (identifiedDevices->empty()) {
         HILOGI("No identified device.");
         result.insert(result.begin(), devices.begin(), devices.end());
         for (auto &item: result) {
@@ -119,9 +130,9 @@ int32_t DeviceManager::DeviceIdentify(const std::vector<DeviceInfo> &devices, st
 
     for (const auto &device: devices) {
         // If the fuzzy match fails, the exact match is performed.
-        auto it = find_if(identifiedDevices_.begin(), identifiedDevices_.end(),
-                          [device](const IdentifyDeviceInfo authed) { return authed.IsMatched(device); });
-        if (it != identifiedDevices_.end()) {
+        auto it = find_if(identifiedDevices->begin(), identifiedDevices->end(),
+                          [&device](const IdentifyDeviceInfo &authed) { return authed.IsMatched(device); });
+        if (it != identifiedDevices->end()) {
             BuildDeviceInfoWithType(device, result, static_cast<DeviceTypeEnum>((*it).deviceType));
             HILOGI("Device identified, name[%{private}s], type[%{public}d]", device.name.c_str(), (*it).deviceType);
             continue;
@@ -134,22 +145,72 @@ int32_t DeviceManager::DeviceIdentify(const std::vector<DeviceInfo> &devices, st
 
 void DeviceManager::LoadDeviceCacheFile()
 {
-    std::lock_guard<std::mutex> lock(mMutex_);
+    bool isCopied = false;
     if (!JsonUtils::IsFileExist(GAME_CONTROLLER_SERVICE_ROOT + DEVICE_CONFIG)) {
         HILOGI("[%{public}s] does not exist in service directory.", DEVICE_CONFIG);
         if (!JsonUtils::CopyFile(GAME_CONTROLLER_ETC_ROOT + DEVICE_CONFIG,
                                  GAME_CONTROLLER_SERVICE_ROOT + DEVICE_CONFIG,
                                  false)) {
             HILOGE("[%{public}s] copy to service directory failed.", DEVICE_CONFIG);
+            RemoveRuleGeneration();
             return;
         }
+        isCopied = true;
     }
     std::pair<bool, json> ret = JsonUtils::ReadJsonFromFile(GAME_CONTROLLER_SERVICE_ROOT + DEVICE_CONFIG);
     if (!ret.first) {
         HILOGW("load [%{public}s] file failed.", DEVICE_CONFIG);
+        RemoveRuleGeneration();
         return;
     }
     LoadFromJson(ret.second);
+    LoadRuleGeneration(isCopied);
+}
+
+void DeviceManager::LoadRuleGeneration(bool isRuleChanged)
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    if (!isRuleChanged && JsonUtils::IsFileExist(RULE_GENERATION_PATH)) {
+        std::pair<bool, json> ret = JsonUtils::ReadJsonFromFile(RULE_GENERATION_PATH);
+        if (ret.first && ret.second.is_object() && ret.second.contains(FIELD_GENERATION)
+            && ret.second.at(FIELD_GENERATION).is_number_integer()) {
+            ruleGeneration_ = ret.second.at(FIELD_GENERATION).get<int64_t>();
+            return;
+        }
+    }
+    PublishRuleGeneration();
+}
+
+void DeviceManager::PublishRuleGeneration()
+{
+    // The time keeps the generation unique even if the file was lost, so an old result never matches it.
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    ruleGeneration_ = std::max(ruleGeneration_ + 1, now);
+    json jsonContent;
+    jsonContent[FIELD_GENERATION] = ruleGeneration_;
+    std::ofstream outfile(RULE_GENERATION_PATH, std::ios::trunc);
+    if (outfile.is_open()) {
+        outfile << jsonContent;
+        outfile.close();
+        if (!outfile.fail()) {
+            if (chmod(RULE_GENERATION_PATH.c_str(), S_IREAD | S_IWRITE | S_IRGRP | S_IROTH) != 0) {
+                HILOGE("chmod the rule generation file failed");
+            }
+            HILOGI("The rule generation is [%{public}lld].", static_cast<long long>(ruleGeneration_));
+            return;
+        }
+    }
+    HILOGE("Publish the rule generation failed.");
+    RemoveRuleGeneration();
+}
+
+void DeviceManager::RemoveRuleGeneration()
+{
+    // Without the generation, the apps identify every device by the service.
+    if (std::remove(RULE_GENERATION_PATH.c_str()) == 0) {
+        HILOGI("The rule generation is removed.");
+    }
 }
 
 void DeviceManager::LoadFromJson(const json &config)
@@ -173,8 +234,11 @@ void DeviceManager::LoadFromJson(const json &config)
             continue;
         }
     }
-    identifiedDevices_.insert(identifiedDevices_.end(), devices.begin(), devices.end());
-    HILOGI("identifiedDevices size[%{public}zu].", identifiedDevices_.size());
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::vector<IdentifyDeviceInfo> identifiedDevices = *identifiedDevices_.Load();
+    identifiedDevices.insert(identifiedDevices.end(), devices.begin(), devices.end());
+    HILOGI("identifiedDevices size[%{public}zu].", identifiedDevices.size());
+    identifiedDevices_.Publish(std::move(identifiedDevices));
 }
 
 int32_t DeviceManager::SyncIdentifiedDeviceInfos(const std::vector<IdentifiedDeviceInfo> &deviceInfos)
@@ -183,7 +247,6 @@ int32_t DeviceManager::SyncIdentifiedDeviceInfos(const std::vector<IdentifiedDev
         HILOGE("Over max device number.identifiedDevices size[%{public}zu].", deviceInfos.size());
         return GAME_ERR_ARRAY_MAXSIZE;
     }
-    std::lock_guard<std::mutex> lock(mMutex_);
     json jsonContent;
     std::vector<IdentifyDeviceInfo> devices;
     for (const auto &device: deviceInfos) {
@@ -201,6 +264,7 @@ int32_t DeviceManager::SyncIdentifiedDeviceInfos(const std::vector<IdentifiedDev
         }
     }
 
+    std::lock_guard<std::mutex> lock(writeMutex_);
     return SaveToConfigFile(jsonContent, devices);
 }
 
@@ -211,8 +275,8 @@ int32_t DeviceManager::SaveToConfigFile(json &jsonContent, std::vector<IdentifyD
     }
     if (JsonUtils::WriteFileFromJson(GAME_CONTROLLER_SERVICE_ROOT + DEVICE_CONFIG, jsonContent)) {
         HILOGI("SyncIdentifiedDeviceInfos success. identifiedDevices size[%{public}zu].", devices.size());
-        identifiedDevices_.clear();
-        identifiedDevices_.insert(identifiedDevices_.end(), devices.begin(), devices.end());
+        identifiedDevices_.Publish(devices);
+        PublishRuleGeneration();
         return GAME_CONTROLLER_SUCCESS;
     } else {
         HILOGE("SyncIdentifiedDeviceInfos failed.");
@@ -33,6 +33,13 @@ public:
      */
     void SendGameKeyMappingConfigChangeNotify(const GameKeyMappingInfo &gameKeyMappingInfo);
 
+    /**
+     * Notify the GameKeyMappingConfigChange once when change several templates of one game
+     * @param bundleName bundleName
+     * @param deviceTypes the device types of the changed templates
+     */
+    void SendGameKeyMappingConfigChangeNotify(const std::string &bundleName, const std::vector<int32_t> &deviceTypes);
+
     /**
      * Notify deviceInfo when device status changed
      * @param gameInfo gameInfo
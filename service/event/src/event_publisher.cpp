@@ -33,6 +33,7 @@ const char* EVENT_PARAM_UNIQ = "uniq";
 const char* EVENT_PARAM_VID_PID = "vidPid";
 const char* EVENT_PARAM_WINDOW_ID = "windowId";
 const char* EVENT_PARAM_DEVICE_TYPE = "deviceType";
+const char* EVENT_PARAM_DEVICE_TYPES = "deviceTypes";
 const char* EVENT_PARAM_DEVICE_STATUS = "deviceStatus";
 const char* EVENT_PARAM_DEVICE_NAME = "deviceName";
 const char* EVENT_PARAM_GAME_PID = "gamePid";
@@ -72,6 +73,33 @@ void EventPublisher::SendGameKeyMappingConfigChangeNotify(const GameKeyMappingIn
     }
 }
 
+void EventPublisher::SendGameKeyMappingConfigChangeNotify(const std::string &bundleName,
+                                                          const std::vector<int32_t> &deviceTypes)
+{
+    if (deviceTypes.empty()) {
+        return;
+    }
+    EventFwk::CommonEventPublishInfo publishInfo;
+    publishInfo.SetOrdered(true);
+    publishInfo.SetSubscriberType(ALL_SUBSCRIBER_TYPE);
+
+    AAFwk::Want want;
+    want.SetAction(COMMON_EVENT_GAME_KEY_MAPPING_CHANGE);
+    want.SetParam(EVENT_PARAM_BUNDLE_NAME, bundleName);
+
+    // The subscriber which only knows deviceType still gets the first one.
+    want.SetParam(EVENT_PARAM_DEVICE_TYPE, deviceTypes.front());
+    want.SetParam(EVENT_PARAM_DEVICE_TYPES, deviceTypes);
+
+    EventFwk::CommonEventData event;
+    event.SetWant(want);
+    HILOGI("[PUB]GameKeyMappingConfigChangeNotify, bundle[%{public}s], size[%{public}zu].",
+           bundleName.c_str(), deviceTypes.size());
+    if (EventFwk::CommonEventManager::NewPublishCommonEvent(event, publishInfo) != 0) {
+        HILOGE("[PUB]GameKeyMappingConfigChangeNotify error, bundle[%{public}s].", bundleName.c_str());
+    }
+}
+
 int32_t EventPublisher::SendDeviceInfoNotify(const GameInfo &gameInfo,
                                              const DeviceInfo &deviceInfo,
                                              const int32_t &gamePid)
@@ -66,6 +66,15 @@ public:
     virtual int32_t GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
                                             GameKeyMappingInfo &gameKeyMappingInfo) override;
 
+    /**
+    * Getting the game key mapping configurations of several device types
+    * @param params the request params
+    * @param gameKeyMappingInfos Game Key Mapping Configurations, in the same order as params
+    * @return Interface Invoking Result
+    */
+    virtual int32_t GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                             std::vector<GameKeyMappingInfo> &gameKeyMappingInfos) override;
+
     /**
      * Set custom game key mapping configuration (It can be invoked only by system service.)
      * @param gameKeyMappingInfo the custom game key mapping configuration
@@ -73,6 +82,14 @@ public:
      */
     virtual int32_t SetCustomGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfo) override;
 
+    /**
+     * Set several custom game key mapping configurations of one game atomically
+     * (It can be invoked only by system service.)
+     * @param gameKeyMappingInfos the custom game key mapping configurations
+     * @return Interface Invoking Result
+     */
+    virtual int32_t SetCustomGameKeyMappingConfigs(const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos) override;
+
     /**
      * Set default game key mapping configuration (It can be invoked only by system service.)
      * @param gameKeyMappingInfo default game key mapping configuration
@@ -117,6 +117,33 @@ int32_t GameControllerServerAbility::GetGameKeyMappingConfig(const GetGameKeyMap
                                                                                              gameKeyMappingInfo);
 }
 
+int32_t GameControllerServerAbility::GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                                              std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    if (!IsSystemAppCall()) {
+        // 1. check the bundleName of every param is same with the caller.
+        for (const auto &param: params) {
+            if (!VerifyBundleNameIsValid(param.bundleName)) {
+                HILOGE("no sys permission");
+                return GAME_ERR_NO_SYS_PERMISSIONS;
+            }
+        }
+    }
+    return DelayedSingleton<KeyMappingConfigManager>::GetInstance()->GetGameKeyMappingConfigs(params,
+                                                                                              gameKeyMappingInfos);
+}
+
+int32_t GameControllerServerAbility::SetCustomGameKeyMappingConfigs(
+    const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    if (!IsSystemServiceCall()) {
+        HILOGE("no sys permission");
+        return GAME_ERR_NO_SYS_PERMISSIONS;
+    }
+    return DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfigs(
+        gameKeyMappingInfos);
+}
+
 int32_t GameControllerServerAbility::SyncIdentifiedDeviceInfos(const std::vector<IdentifiedDeviceInfo> &deviceInfos)
 {
     if (!IsSystemServiceCall()) {
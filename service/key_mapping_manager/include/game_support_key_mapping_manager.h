@@ -17,11 +17,13 @@
 #define GAME_CONTROLLER_GAME_SUPPORT_KEY_MAPPING_MANAGER_H
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <gamecontroller_keymapping_model.h>
 #include <vector>
 #include "nlohmann/json.hpp"
 #include "singleton.h"
+#include "config_snapshot.h"
 
 namespace OHOS {
 namespace GameController {
@@ -44,6 +46,11 @@ struct GameSupportKeyMappingConfig {
     nlohmann::json ConvertToJson() const;
 };
 
+/**
+ * key is the bundleName
+ */
+using GameSupportKeyMappingConfigMap = std::unordered_map<std::string, GameSupportKeyMappingConfig>;
+
 class GameSupportKeyMappingManager : public DelayedSingleton<GameSupportKeyMappingManager> {
 DECLARE_DELAYED_SINGLETON(GameSupportKeyMappingManager)
 
@@ -76,16 +83,18 @@ private:
      * @param configMap Configuration
      * @retrun true means success
      */
-    bool SaveToConfigFile(const std::unordered_map<std::string, GameSupportKeyMappingConfig> &configMap);
+    bool SaveToConfigFile(const GameSupportKeyMappingConfigMap &configMap);
 
 private:
-    std::mutex mutex_;
+    /**
+     * Serializes the writers of configMap_
+     */
+    std::mutex writeMutex_;
 
     /**
      * Cache game configuration
-     * key is the bundleName
      */
-    std::unordered_map<std::string, GameSupportKeyMappingConfig> configMap_;
+    ConfigSnapshot<GameSupportKeyMappingConfigMap> configMap_;
 };
 }
 }
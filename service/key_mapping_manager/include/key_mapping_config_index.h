@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_KEY_MAPPING_CONFIG_INDEX_H
+#define GAME_CONTROLLER_KEY_MAPPING_CONFIG_INDEX_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gamecontroller_client_model.h>
+
+namespace OHOS {
+namespace GameController {
+/**
+ * Number of the device type slots of one bundle. The slot is indexed by DeviceTypeEnum.
+ */
+const size_t DEVICE_TYPE_SLOT_COUNT = static_cast<size_t>(DeviceTypeEnum::GAME_MOUSE) + 1;
+
+/**
+ * Where a template is in the JSON configuration file.
+ */
+struct KeyMappingConfigLocation {
+    uint32_t offset = 0;
+
+    /**
+     * 0 means there is no template.
+     */
+    uint32_t length = 0;
+
+    bool IsValid() const
+    {
+        return length > 0;
+    }
+};
+
+/**
+ * The templates of one bundle. index: deviceType
+ */
+using BundleKeyMappingLocations = std::array<KeyMappingConfigLocation, DEVICE_TYPE_SLOT_COUNT>;
+
+/**
+ * Template locations indexed by the interned bundle name and then by the device type.
+ * The bundle name is hashed once per lookup, and the templates of one bundle are replaced or deleted
+ * in place, so no operation depends on the number of the bundles.
+ * It's not thread safe.
+ */
+class KeyMappingConfigIndex {
+public:
+    static bool IsValidDeviceType(int32_t deviceType)
+    {
+        return deviceType >= 0 && static_cast<size_t>(deviceType) < DEVICE_TYPE_SLOT_COUNT;
+    }
+
+    /**
+     * Find the template.
+     * @param bundleName bundle name
+     * @param deviceType device type
+     * @return an invalid location means not found
+     */
+    KeyMappingConfigLocation Find(const std::string &bundleName, int32_t deviceType) const;
+
+    /**
+     * Get all the templates of the bundle.
+     * @param bundleName bundle name
+     * @return every slot is invalid if the bundle is not found
+     */
+    BundleKeyMappingLocations GetBundle(const std::string &bundleName) const;
+
+    /**
+     * Add or replace the template.
+     * @param bundleName bundle name
+     * @param deviceType device type
+     * @param location the template location
+     * @return false means the deviceType is out of range
+     */
+    bool Set(const std::string &bundleName, int32_t deviceType, const KeyMappingConfigLocation &location);
+
+    /**
+     * Replace all the templates of the bundle. The bundle is released if all the slots are invalid.
+     * @param bundleName bundle name
+     * @param locations the template locations
+     */
+    void SetBundle(const std::string &bundleName, const BundleKeyMappingLocations &locations);
+
+    /**
+     * Delete all the templates of the bundle.
+     * @param bundleName bundle name
+     */
+    void EraseBundle(const std::string &bundleName);
+
+    /**
+     * Visit every bundle.
+     * @param func it's called with the bundle name and its template locations
+     */
+    template<typename Func>
+    void ForEach(Func func) const
+    {
+        for (const auto &bundleId: bundleIds_) {
+            func(bundleId.first, bundles_[bundleId.second].locations);
+        }
+    }
+
+    /**
+     * @return the number of the templates
+     */
+    size_t Size() const
+    {
+        return configCount_;
+    }
+
+    /**
+     * @return the number of the bundles
+     */
+    size_t BundleCount() const
+    {
+        return bundleIds_.size();
+    }
+
+    void Clear();
+
+private:
+    struct BundleEntry {
+        BundleKeyMappingLocations locations;
+        size_t count = 0;
+    };
+
+    void ReleaseBundle(uint32_t bundleId);
+
+private:
+    /**
+     * key: bundleName, value: the index of bundles_
+     */
+    std::unordered_map<std::string, uint32_t> bundleIds_;
+
+    std::vector<BundleEntry> bundles_;
+
+    /**
+     * The released indexes of bundles_, reused by the next new bundle.
+     */
+    std::vector<uint32_t> freeBundleIds_;
+
+    size_t configCount_ = 0;
+};
+}
+}
+#endif //GAME_CONTROLLER_KEY_MAPPING_CONFIG_INDEX_H
@@ -18,11 +18,13 @@
 
 #include <string>
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 #include <gamecontroller_client_model.h>
 #include <gamecontroller_keymapping_model.h>
 #include "nlohmann/json.hpp"
 #include "singleton.h"
+#include "key_mapping_config_store.h"
 
 namespace OHOS {
 namespace GameController {
@@ -75,6 +77,9 @@ struct KeyMapping {
         xStep = keyToTouchMappingInfo.xStep;
         yStep = keyToTouchMappingInfo.yStep;
         delayTime = keyToTouchMappingInfo.delayTime;
+        tapInterval = keyToTouchMappingInfo.tapInterval;
+        tapDutyCycle = keyToTouchMappingInfo.tapDutyCycle;
+        deadZone = keyToTouchMappingInfo.deadZone;
     }
 
     int32_t mappingType = 0;
@@ -88,6 +93,9 @@ struct KeyMapping {
     int32_t xStep = 0;
     int32_t yStep = 0;
     int32_t delayTime = 0;
+    int32_t tapInterval = 0;
+    int32_t tapDutyCycle = 0;
+    int32_t deadZone = 0;
 
     nlohmann::json ConvertToJson() const;
 
@@ -103,6 +111,9 @@ struct KeyMapping {
         keyToTouchMappingInfo.xStep = xStep;
         keyToTouchMappingInfo.yStep = yStep;
         keyToTouchMappingInfo.delayTime = delayTime;
+        keyToTouchMappingInfo.tapInterval = tapInterval;
+        keyToTouchMappingInfo.tapDutyCycle = tapDutyCycle;
+        keyToTouchMappingInfo.deadZone = deadZone;
         keyToTouchMappingInfo.combinationKeys = combinationKeys;
         keyToTouchMappingInfo.dpadKeyCodeEntity = dpadInfo.ConvertToDpadKeyCodeEntity();
         return keyToTouchMappingInfo;
@@ -127,6 +138,10 @@ struct KeyMappingInfoConfig {
         for (const auto &keyMapping: gameKeyMappingInfo.defaultKeyToTouchMappings) {
             defaultKeyMappings.push_back(KeyMapping(keyMapping));
         }
+        customResolution = gameKeyMappingInfo.customResolution;
+        defaultResolution = gameKeyMappingInfo.defaultResolution;
+        customResponseCurve = gameKeyMappingInfo.customResponseCurve;
+        defaultResponseCurve = gameKeyMappingInfo.defaultResponseCurve;
     };
 
     std::string bundleName;
@@ -137,8 +152,20 @@ struct KeyMappingInfoConfig {
 
     std::vector<KeyMapping> defaultKeyMappings;
 
+    TemplateResolution customResolution;
+
+    TemplateResolution defaultResolution;
+
+    ResponseCurve customResponseCurve;
+
+    ResponseCurve defaultResponseCurve;
+
     nlohmann::json ConvertToJson(const bool isCustom) const;
 
+    static ResponseCurve ParseResponseCurve(const nlohmann::json &jsonObj);
+
+    static nlohmann::json ConvertResponseCurveToJson(const ResponseCurve &responseCurve);
+
     std::vector<KeyToTouchMappingInfo> ConvertToCustomKeyToTouchMapping() const
     {
         std::vector<KeyToTouchMappingInfo> result;
@@ -156,19 +183,6 @@ struct KeyMappingInfoConfig {
         }
         return result;
     }
-
-    std::string GetKeyForDefaultKeyMapping()
-    {
-        if (deviceType == 0) {
-            return bundleName + "_";
-        }
-        return bundleName + "_" + std::to_string(deviceType);
-    }
-
-    std::string GetKeyForCustomKeyMapping()
-    {
-        return GetKeyForDefaultKeyMapping();
-    }
 };
 
 class KeyMappingConfigManager : public DelayedSingleton<KeyMappingConfigManager> {
@@ -198,44 +212,72 @@ public:
     int32_t GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
                                     GameKeyMappingInfo &gameKeyMappingInfo);
 
-private:
     /**
-     * Save to Configuration File
-     * @param configMap Configuration
-     * @param filePath the JSON configuration file.
-     * @param isCustom true means it's custom config
-     * @retrun true means success
+     * Set several custom game key mapping configurations of one game.
+     * The configuration file is written once and one change notification is sent.
+     * Either all of them are applied or none of them.
+     * @param gameKeyMappingInfos the custom configurations, and all of them must have the same bundleName
+     * @return Interface Invoking Result
      */
-    bool SaveToConfigFile(const std::unordered_map<std::string, KeyMappingInfoConfig> &configMap,
-                          const std::string &filePath, const bool isCustom);
+    int32_t SetCustomGameKeyMappingConfigs(const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos);
 
+    /**
+     * Getting the game key mapping configurations of several device types from one snapshot
+     * @param params the request params
+     * @param gameKeyMappingInfos Game Key Mapping Configurations, in the same order as params
+     * @return Interface Invoking Result
+     */
+    int32_t GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                     std::vector<GameKeyMappingInfo> &gameKeyMappingInfos);
+
+private:
     /**
      * Load the configuration from the JSON configuration file.
      */
     void LoadConfigFromJsonFile();
 
-    std::unordered_map<std::string, KeyMappingInfoConfig> LoadConfigFromJsonFile(const std::string &filePath,
-                                                                                 const bool isCustom);
+    /**
+     * Copy the configuration file from the etc directory if it does not exist in the service directory.
+     * @param fileName the configuration file name
+     * @return true means the configuration file exists in the service directory
+     */
+    bool PrepareConfigFile(const std::string &fileName);
+
+    /**
+     * Apply the change to the templates of the bundle.
+     * @param change the change of the bundle
+     * @param gameKeyMappingInfo the change
+     * @param isDelByBundleName true means all the templates of the bundle are deleted
+     * @return false means the deviceType is out of range
+     */
+    bool ApplyToBundle(BundleKeyMappingChange &change, const GameKeyMappingInfo &gameKeyMappingInfo,
+                       bool isDelByBundleName);
 
-    void DelFromMap(std::unordered_map<std::string, KeyMappingInfoConfig> &configMap, const std::string &key,
-                    bool isDelByBundleName);
+    /**
+     * Fill the default and custom key mappings from the configurations.
+     * @param defaultConfig the default configuration, nullptr means not found
+     * @param customConfig the custom configuration, nullptr means not found
+     * @param gameKeyMappingInfo Game Key Mapping Configuration
+     */
+    void FillGameKeyMappingInfo(const std::shared_ptr<const KeyMappingInfoConfig> &defaultConfig,
+                                const std::shared_ptr<const KeyMappingInfoConfig> &customConfig,
+                                GameKeyMappingInfo &gameKeyMappingInfo);
 
 private:
     /**
-     * Default Cache Configuration
-     * key: bundleName + _ + deviceType
-     * value: KeyMappingInfoConfig
+     * Default Cache Configuration. The templates are decoded from the file on demand.
      */
-    std::unordered_map<std::string, KeyMappingInfoConfig> defaultKeyMappingInfoConfigMap_;
+    KeyMappingConfigStore defaultKeyMappingConfigStore_;
 
     /**
-     * Customized Cache Configuration
-     * key: bundleName + _ + deviceType
-     * value: KeyMappingInfoConfig
+     * Customized Cache Configuration. The templates are decoded from the file on demand.
      */
-    std::unordered_map<std::string, KeyMappingInfoConfig> customKeyMappingInfoConfigMap_;
+    KeyMappingConfigStore customKeyMappingConfigStore_;
 
-    std::mutex mutex_;
+    /**
+     * Serializes the writers of the stores
+     */
+    std::mutex writeMutex_;
 };
 }
 }
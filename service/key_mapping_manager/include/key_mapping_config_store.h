@@ -0,0 +1,210 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_KEY_MAPPING_CONFIG_STORE_H
+#define GAME_CONTROLLER_KEY_MAPPING_CONFIG_STORE_H
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gamecontroller_keymapping_model.h>
+#include "key_mapping_config_index.h"
+
+namespace OHOS {
+namespace GameController {
+struct KeyMappingInfoConfig;
+
+/**
+ * Maximum number of the decoded templates kept by one KeyMappingConfigStore.
+ */
+const size_t MAX_CACHED_KEY_MAPPING_CONFIG_SIZE = 16;
+
+/**
+ * The change of the templates of one bundle.
+ */
+struct BundleKeyMappingChange {
+    /**
+     * index: deviceType, true means the template of the device type is replaced by configs
+     */
+    std::array<bool, DEVICE_TYPE_SLOT_COUNT> isChanged{};
+
+    /**
+     * index: deviceType, nullptr means the template is deleted
+     */
+    std::array<std::shared_ptr<const KeyMappingInfoConfig>, DEVICE_TYPE_SLOT_COUNT> configs;
+};
+
+/**
+ * The least recently used decoded templates.
+ */
+class KeyMappingConfigCache {
+public:
+    explicit KeyMappingConfigCache(size_t capacity) : capacity_(capacity)
+    {
+    }
+
+    /**
+     * Get the template and mark it as the most recently used one.
+     * @return nullptr means not cached
+     */
+    std::shared_ptr<const KeyMappingInfoConfig> Get(const std::string &bundleName, int32_t deviceType);
+
+    /**
+     * Add or replace the template. The least recently used one is dropped if the cache is full.
+     */
+    void Put(const std::string &bundleName, int32_t deviceType,
+             const std::shared_ptr<const KeyMappingInfoConfig> &config);
+
+    void Erase(const std::string &bundleName, int32_t deviceType);
+
+    void Clear();
+
+    size_t Size() const;
+
+private:
+    struct CacheKey {
+        std::string bundleName;
+        int32_t deviceType = 0;
+
+        bool operator==(const CacheKey &other) const
+        {
+            return deviceType == other.deviceType && bundleName == other.bundleName;
+        }
+    };
+
+    struct CacheKeyHash {
+        size_t operator()(const CacheKey &key) const
+        {
+            return std::hash<std::string>()(key.bundleName) ^ static_cast<size_t>(key.deviceType);
+        }
+    };
+
+    using CacheEntry = std::pair<CacheKey, std::shared_ptr<const KeyMappingInfoConfig>>;
+
+private:
+    mutable std::mutex mutex_;
+    size_t capacity_;
+
+    /**
+     * The most recently used one is at the front.
+     */
+    std::list<CacheEntry> entries_;
+    std::unordered_map<CacheKey, std::list<CacheEntry>::iterator, CacheKeyHash> entryIndex_;
+};
+
+/**
+ * The templates of one JSON configuration file.
+ * Only the location of every template is loaded. A template is decoded from the file when it's requested
+ * for the first time, and the recently used ones are kept in memory.
+ */
+class KeyMappingConfigStore {
+public:
+    /**
+     * @param filePath the JSON configuration file
+     * @param isCustom true means it's the custom configuration file
+     */
+    KeyMappingConfigStore(const std::string &filePath, bool isCustom);
+
+    /**
+     * Load the template locations from the file. The decoded templates are dropped.
+     * @return the number of the templates
+     */
+    size_t Load();
+
+    /**
+     * Find the template.
+     * @param bundleName bundle name
+     * @param deviceType device type
+     * @return nullptr means not found
+     */
+    std::shared_ptr<const KeyMappingInfoConfig> Find(const std::string &bundleName, int32_t deviceType);
+
+    /**
+     * Find the templates of several params. No update is applied in the middle of them.
+     * @param params the request params
+     * @return the templates in the same order as params, nullptr means not found
+     */
+    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> Find(
+        const std::vector<GetGameKeyMappingInfoParam> &params);
+
+    /**
+     * Apply the change of one bundle and rewrite the file.
+     * The untouched templates are copied from the file without being decoded. The new file replaces the old one
+     * atomically, so the old file and the old locations are kept if it fails.
+     * The callers must not update the same store at the same time.
+     * @param bundleName bundle name
+     * @param change the change
+     * @return true means the file is saved
+     */
+    bool Update(const std::string &bundleName, const BundleKeyMappingChange &change);
+
+    /**
+     * @return the number of the templates
+     */
+    size_t Size() const;
+
+    /**
+     * Drop the template locations and the decoded templates. The file is not changed.
+     */
+    void Clear();
+
+private:
+    /**
+     * The template which is not cached, and its location in the file.
+     */
+    struct PendingConfig {
+        size_t slot = 0;
+        std::string bundleName;
+        int32_t deviceType = 0;
+        KeyMappingConfigLocation location;
+    };
+
+    void FindLocked(const std::string &bundleName, int32_t deviceType, size_t slot,
+                    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> &configs,
+                    std::vector<PendingConfig> &pendingConfigs);
+
+    /**
+     * Read and decode the pending templates from the file opened with the lock, then close it.
+     * They're cached only if the file is not replaced in the meantime.
+     */
+    void DecodePendingConfigs(int32_t fd, uint64_t generation, const std::vector<PendingConfig> &pendingConfigs,
+                              std::vector<std::shared_ptr<const KeyMappingInfoConfig>> &configs);
+
+private:
+    std::string filePath_;
+    bool isCustom_;
+
+    /**
+     * Guards the replacement of the file, index_, generation_ and the fills of cache_. The file is read, written
+     * and flushed without it, so the readers only wait for the lookups of index_, the rename of the file and
+     * the swap of index_.
+     */
+    mutable std::mutex mutex_;
+    KeyMappingConfigIndex index_;
+    KeyMappingConfigCache cache_{MAX_CACHED_KEY_MAPPING_CONFIG_SIZE};
+
+    /**
+     * Increased every time index_ is replaced, so a template read from the old file is not cached.
+     */
+    uint64_t generation_ = 0;
+};
+}
+}
+#endif //GAME_CONTROLLER_KEY_MAPPING_CONFIG_STORE_H
@@ -63,10 +63,11 @@ GameSupportKeyMappingManager::GameSupportKeyMappingManager()
 
 int32_t GameSupportKeyMappingManager::IsSupportGameKeyMapping(const GameInfo &gameInfo, GameInfo &resultGameInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<const GameSupportKeyMappingConfigMap> configMap = configMap_.Load();
     resultGameInfo.bundleName = gameInfo.bundleName;
-    if (configMap_.find(gameInfo.bundleName) != configMap_.end()) {
-        GameSupportKeyMappingConfig gameConfig = configMap_[gameInfo.bundleName];
+    auto iter = configMap->find(gameInfo.bundleName);
+    if (iter != configMap->end()) {
+        const GameSupportKeyMappingConfig &gameConfig = iter->second;
         resultGameInfo.version = gameConfig.version;
         resultGameInfo.isSupportKeyMapping = true;
         resultGameInfo.supportedDeviceTypes = gameConfig.supportedDeviceTypes;
@@ -85,11 +86,11 @@ int32_t GameSupportKeyMappingManager::SyncSupportKeyMappingGames(bool isSyncAll,
         HILOGE("It's over max config for SyncSupportKeyMappingGames");
         return GAME_ERR_ARGUMENT_INVALID;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::unordered_map<std::string, GameSupportKeyMappingConfig> tempMap;
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    GameSupportKeyMappingConfigMap tempMap;
     std::vector<std::string> delBundles;
-    if (!isSyncAll && !configMap_.empty()) {
-        tempMap.insert(configMap_.begin(), configMap_.end());
+    if (!isSyncAll) {
+        tempMap = *configMap_.Load();
     }
     for (const auto &gameInfo: gameInfos) {
         if (!gameInfo.CheckParamValid() || !JsonUtils::IsUtf8(gameInfo.bundleName) ||
@@ -118,8 +119,7 @@ int32_t GameSupportKeyMappingManager::SyncSupportKeyMappingGames(bool isSyncAll,
 
     if (SaveToConfigFile(tempMap)) {
         HILOGI("save GameSupportKeyMappingConfig success");
-        configMap_.clear();
-        configMap_.insert(tempMap.begin(), tempMap.end());
+        configMap_.Publish(std::move(tempMap));
         DelayedSingleton<EventPublisher>::GetInstance()->SendSupportedKeyMappingChangeNotify();
         return GAME_CONTROLLER_SUCCESS;
     }
@@ -130,7 +130,7 @@ int32_t GameSupportKeyMappingManager::SyncSupportKeyMappingGames(bool isSyncAll,
 
 void GameSupportKeyMappingManager::LoadConfigFromJsonFile()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(writeMutex_);
     if (!JsonUtils::IsFileExist(BUNDLE_SUPPORT_KEYMAPPING_CFG + CONFIG_FILE)) {
         HILOGI("[%{public}s] does not exist in service directory.", CONFIG_FILE);
         if (!JsonUtils::CopyFile(GAME_CONTROLLER_ETC_ROOT + CONFIG_FILE,
@@ -141,7 +141,7 @@ void GameSupportKeyMappingManager::LoadConfigFromJsonFile()
         }
     }
 
-    configMap_.clear();
+    configMap_.Publish({});
     std::pair<bool, json> ret = JsonUtils::ReadJsonFromFile(BUNDLE_SUPPORT_KEYMAPPING_CFG + CONFIG_FILE);
     if (!ret.first) {
         HILOGW("load [%{public}s] file failed.", CONFIG_FILE);
@@ -157,16 +157,17 @@ void GameSupportKeyMappingManager::LoadConfigFromJsonFile()
         HILOGW("[%{public}s] is not json array.", CONFIG_FILE);
         return;
     }
+    GameSupportKeyMappingConfigMap configMap;
     for (const auto &jsonObj: config) {
         GameSupportKeyMappingConfig gameConfig(jsonObj);
-        configMap_.insert(make_pair(gameConfig.bundleName, gameConfig));
+        configMap.insert(make_pair(gameConfig.bundleName, gameConfig));
         HILOGI("game [%{public}s] is support .", gameConfig.bundleName.c_str());
     }
-    HILOGI("load [%{public}s] file success. size is [%{public}zu]", CONFIG_FILE, configMap_.size());
+    HILOGI("load [%{public}s] file success. size is [%{public}zu]", CONFIG_FILE, configMap.size());
+    configMap_.Publish(std::move(configMap));
 }
 
-bool GameSupportKeyMappingManager::SaveToConfigFile(const std::unordered_map<std::string,
-    GameSupportKeyMappingConfig> &configMap)
+bool GameSupportKeyMappingManager::SaveToConfigFile(const GameSupportKeyMappingConfigMap &configMap)
 {
     json jsonContent = json::array();
     for (const auto &config: configMap) {
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include "key_mapping_config_index.h"
+
+namespace OHOS {
+namespace GameController {
+KeyMappingConfigLocation KeyMappingConfigIndex::Find(const std::string &bundleName, int32_t deviceType) const
+{
+    if (!IsValidDeviceType(deviceType)) {
+        return KeyMappingConfigLocation();
+    }
+    auto iter = bundleIds_.find(bundleName);
+    if (iter == bundleIds_.end()) {
+        return KeyMappingConfigLocation();
+    }
+    return bundles_[iter->second].locations[static_cast<size_t>(deviceType)];
+}
+
+BundleKeyMappingLocations KeyMappingConfigIndex::GetBundle(const std::string &bundleName) const
+{
+    auto iter = bundleIds_.find(bundleName);
+    if (iter == bundleIds_.end()) {
+        return BundleKeyMappingLocations();
+    }
+    return bundles_[iter->second].locations;
+}
+
+bool KeyMappingConfigIndex::Set(const std::string &bundleName, int32_t deviceType,
+                                const KeyMappingConfigLocation &location)
+{
+    if (!IsValidDeviceType(deviceType)) {
+        return false;
+    }
+    BundleKeyMappingLocations locations = GetBundle(bundleName);
+    locations[static_cast<size_t>(deviceType)] = location;
+    SetBundle(bundleName, locations);
+    return true;
+}
+
+void KeyMappingConfigIndex::SetBundle(const std::string &bundleName, const BundleKeyMappingLocations &locations)
+{
+    size_t count = 0;
+    for (const auto &location: locations) {
+        if (location.IsValid()) {
+            count++;
+        }
+    }
+    auto iter = bundleIds_.find(bundleName);
+    if (count == 0) {
+        if (iter != bundleIds_.end()) {
+            ReleaseBundle(iter->second);
+            bundleIds_.erase(iter);
+        }
+        return;
+    }
+    uint32_t bundleId;
+    if (iter != bundleIds_.end()) {
+        bundleId = iter->second;
+    } else if (!freeBundleIds_.empty()) {
+        bundleId = freeBundleIds_.back();
+        freeBundleIds_.pop_back();
+        bundleIds_.emplace(bundleName, bundleId);
+    } else {
+        bundleId = static_cast<uint32_t>(bundles_.size());
+        bundles_.emplace_back();
+        bundleIds_.emplace(bundleName, bundleId);
+    }
+    BundleEntry &entry = bundles_[bundleId];
+    configCount_ = configCount_ - entry.count + count;
+    entry.locations = locations;
+    entry.count = count;
+}
+
+void KeyMappingConfigIndex::EraseBundle(const std::string &bundleName)
+{
+    auto iter = bundleIds_.find(bundleName);
+    if (iter == bundleIds_.end()) {
+        return;
+    }
+    ReleaseBundle(iter->second);
+    bundleIds_.erase(iter);
+}
+
+void KeyMappingConfigIndex::Clear()
+{
+    bundleIds_.clear();
+    bundles_.clear();
+    freeBundleIds_.clear();
+    configCount_ = 0;
+}
+
+void KeyMappingConfigIndex::ReleaseBundle(uint32_t bundleId)
+{
+    BundleEntry &entry = bundles_[bundleId];
+    configCount_ -= entry.count;
+    entry.locations = BundleKeyMappingLocations();
+    entry.count = 0;
+    freeBundleIds_.push_back(bundleId);
+}
+}
+}
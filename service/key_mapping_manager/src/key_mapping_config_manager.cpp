@@ -44,6 +44,17 @@ const char* FIELD_DOWN = "down";
 const char* FIELD_LEFT = "left";
 const char* FIELD_RIGHT = "right";
 const char* FIELD_DELAY_TIME = "delayTime";
+const char* FIELD_TAP_INTERVAL = "tapInterval";
+const char* FIELD_TAP_DUTY_CYCLE = "tapDutyCycle";
+const char* FIELD_DEAD_ZONE = "deadZone";
+const char* FIELD_REFERENCE_WIDTH = "referenceWidth";
+const char* FIELD_REFERENCE_HEIGHT = "referenceHeight";
+const char* FIELD_RESPONSE_CURVE = "responseCurve";
+const char* FIELD_CURVE_TYPE = "type";
+const char* FIELD_EXPONENT = "exponent";
+const char* FIELD_POINTS = "points";
+const char* FIELD_INPUT = "input";
+const char* FIELD_OUTPUT = "output";
 const char* DEFAULT_KEY_MAPPING_CONFIG = "default_key_mapping.json";
 const char* CUSTOM_KEY_MAPPING_CONFIG = "custom_key_mapping.json";
 }
@@ -77,6 +88,9 @@ KeyMapping::KeyMapping(const json &jsonObj)
     xStep = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_X_STEP, 0);
     yStep = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_Y_STEP, 0);
     delayTime = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_DELAY_TIME, 0);
+    tapInterval = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_TAP_INTERVAL, 0);
+    tapDutyCycle = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_TAP_DUTY_CYCLE, 0);
+    deadZone = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_DEAD_ZONE, 0);
 
     if (jsonObj.contains(FIELD_COMBINATION_KEYS) && jsonObj.at(FIELD_COMBINATION_KEYS).is_array()) {
         combinationKeys = jsonObj.at(FIELD_COMBINATION_KEYS).get<std::vector<int32_t>>();
@@ -99,6 +113,9 @@ json KeyMapping::ConvertToJson() const
     jsonContent[FIELD_X_STEP] = this->xStep;
     jsonContent[FIELD_Y_STEP] = this->yStep;
     jsonContent[FIELD_DELAY_TIME] = this->delayTime;
+    jsonContent[FIELD_TAP_INTERVAL] = this->tapInterval;
+    jsonContent[FIELD_TAP_DUTY_CYCLE] = this->tapDutyCycle;
+    jsonContent[FIELD_DEAD_ZONE] = this->deadZone;
     jsonContent[FIELD_DPAD] = this->dpadInfo.ConvertToJson();
     jsonContent[FIELD_COMBINATION_KEYS] = combinationKeys;
     return jsonContent;
@@ -116,6 +133,25 @@ KeyMappingInfoConfig::KeyMappingInfoConfig(const json &jsonObj, const bool isCus
         this->deviceType = jsonObj.at(FIELD_DEVICE_TYPE).get<int32_t>();
     }
 
+    TemplateResolution resolution;
+    resolution.width = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_REFERENCE_WIDTH, 0);
+    resolution.height = JsonUtils::GetJsonInt32Value(jsonObj, FIELD_REFERENCE_HEIGHT, 0);
+    if (!resolution.CheckParamValid()) {
+        HILOGW("the reference resolution of [%{public}s] is invalid.", this->bundleName.c_str());
+        resolution = TemplateResolution();
+    }
+    ResponseCurve responseCurve;
+    if (jsonObj.contains(FIELD_RESPONSE_CURVE)) {
+        responseCurve = ParseResponseCurve(jsonObj.at(FIELD_RESPONSE_CURVE));
+    }
+    if (isCustom) {
+        this->customResolution = resolution;
+        this->customResponseCurve = responseCurve;
+    } else {
+        this->defaultResolution = resolution;
+        this->defaultResponseCurve = responseCurve;
+    }
+
     if (!jsonObj.contains(FIELD_KEY_MAPPING) || !jsonObj.at(FIELD_KEY_MAPPING).is_array()) {
         HILOGW("keyMapping is not json array.");
         return;
@@ -144,6 +180,15 @@ json KeyMappingInfoConfig::ConvertToJson(const bool isCustom) const
     json jsonContent;
     jsonContent[FIELD_BUNDLE_NAME] = this->bundleName;
     jsonContent[FIELD_DEVICE_TYPE] = this->deviceType;
+    const TemplateResolution &resolution = isCustom ? this->customResolution : this->defaultResolution;
+    if (resolution.IsValid()) {
+        jsonContent[FIELD_REFERENCE_WIDTH] = resolution.width;
+        jsonContent[FIELD_REFERENCE_HEIGHT] = resolution.height;
+    }
+    const ResponseCurve &responseCurve = isCustom ? this->customResponseCurve : this->defaultResponseCurve;
+    if (responseCurve.type != RESPONSE_CURVE_LINEAR) {
+        jsonContent[FIELD_RESPONSE_CURVE] = ConvertResponseCurveToJson(responseCurve);
+    }
     if (isCustom) {
         for (const auto &mapping: this->customKeyMappings) {
             jsonContent[FIELD_KEY_MAPPING].push_back(mapping.ConvertToJson());
@@ -156,94 +201,90 @@ json KeyMappingInfoConfig::ConvertToJson(const bool isCustom) const
     return jsonContent;
 }
 
-KeyMappingConfigManager::~KeyMappingConfigManager()
+ResponseCurve KeyMappingInfoConfig::ParseResponseCurve(const json &jsonObj)
 {
+    ResponseCurve responseCurve;
+    if (!jsonObj.is_object()) {
+        return responseCurve;
+    }
+    responseCurve.type = static_cast<ResponseCurveTypeEnum>(
+        JsonUtils::GetJsonInt32Value(jsonObj, FIELD_CURVE_TYPE, RESPONSE_CURVE_LINEAR));
+    if (jsonObj.contains(FIELD_EXPONENT) && jsonObj.at(FIELD_EXPONENT).is_number()) {
+        responseCurve.exponent = jsonObj.at(FIELD_EXPONENT).get<double>();
+    }
+    if (jsonObj.contains(FIELD_POINTS) && jsonObj.at(FIELD_POINTS).is_array()) {
+        for (const auto &pointJson: jsonObj.at(FIELD_POINTS)) {
+            if (!pointJson.is_object() || !pointJson.contains(FIELD_INPUT) || !pointJson.contains(FIELD_OUTPUT) ||
+                !pointJson.at(FIELD_INPUT).is_number() || !pointJson.at(FIELD_OUTPUT).is_number()) {
+                continue;
+            }
+            ResponseCurvePoint point;
+            point.input = pointJson.at(FIELD_INPUT).get<double>();
+            point.output = pointJson.at(FIELD_OUTPUT).get<double>();
+            responseCurve.points.push_back(point);
+        }
+    }
+    if (!responseCurve.CheckParamValid()) {
+        HILOGW("the response curve is invalid, use the linear one.");
+        return ResponseCurve();
+    }
+    return responseCurve;
 }
 
-KeyMappingConfigManager::KeyMappingConfigManager()
+json KeyMappingInfoConfig::ConvertResponseCurveToJson(const ResponseCurve &responseCurve)
 {
-    LoadConfigFromJsonFile();
+    json jsonContent;
+    jsonContent[FIELD_CURVE_TYPE] = static_cast<int32_t>(responseCurve.type);
+    if (responseCurve.type == RESPONSE_CURVE_POWER) {
+        jsonContent[FIELD_EXPONENT] = responseCurve.exponent;
+    }
+    if (responseCurve.type == RESPONSE_CURVE_TABLE) {
+        jsonContent[FIELD_POINTS] = json::array();
+        for (const auto &point: responseCurve.points) {
+            json pointJson;
+            pointJson[FIELD_INPUT] = point.input;
+            pointJson[FIELD_OUTPUT] = point.output;
+            jsonContent[FIELD_POINTS].push_back(pointJson);
+        }
+    }
+    return jsonContent;
 }
 
-bool KeyMappingConfigManager::SaveToConfigFile(const std::unordered_map<std::string, KeyMappingInfoConfig> &configMap,
-                                               const std::string &filePath, const bool isCustom)
+KeyMappingConfigManager::~KeyMappingConfigManager()
 {
-    json jsonContent = json::array();
-    for (const auto &config: configMap) {
-        jsonContent.push_back(config.second.ConvertToJson(isCustom));
-    }
-    return JsonUtils::WriteFileFromJson(filePath, jsonContent);
 }
 
-void KeyMappingConfigManager::LoadConfigFromJsonFile()
+KeyMappingConfigManager::KeyMappingConfigManager()
+    : defaultKeyMappingConfigStore_(GAME_CONTROLLER_SERVICE_ROOT + DEFAULT_KEY_MAPPING_CONFIG, false),
+      customKeyMappingConfigStore_(GAME_CONTROLLER_SERVICE_ROOT + CUSTOM_KEY_MAPPING_CONFIG, true)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    bool isLoadConfig = true;
-    if (!JsonUtils::IsFileExist(GAME_CONTROLLER_SERVICE_ROOT + DEFAULT_KEY_MAPPING_CONFIG)) {
-        HILOGI("[%{public}s] does not exist in service directory.", DEFAULT_KEY_MAPPING_CONFIG);
-        if (!JsonUtils::CopyFile(GAME_CONTROLLER_ETC_ROOT + DEFAULT_KEY_MAPPING_CONFIG,
-                                 GAME_CONTROLLER_SERVICE_ROOT + DEFAULT_KEY_MAPPING_CONFIG,
-                                 false)) {
-            HILOGE("[%{public}s] copy to service directory failed.", DEFAULT_KEY_MAPPING_CONFIG);
-            isLoadConfig = false;
-        }
-    }
-
-    if (isLoadConfig) {
-        std::unordered_map<std::string, KeyMappingInfoConfig> defaultConfigMap = LoadConfigFromJsonFile(
-            GAME_CONTROLLER_SERVICE_ROOT + DEFAULT_KEY_MAPPING_CONFIG, false);
-        defaultKeyMappingInfoConfigMap_.clear();
-        defaultKeyMappingInfoConfigMap_.insert(defaultConfigMap.begin(), defaultConfigMap.end());
-        HILOGI("default_key_mapping size is [%{public}d].", static_cast<int>(defaultConfigMap.size()));
-    }
+    LoadConfigFromJsonFile();
+}
 
-    isLoadConfig = true;
-    if (!JsonUtils::IsFileExist(GAME_CONTROLLER_SERVICE_ROOT + CUSTOM_KEY_MAPPING_CONFIG)) {
-        HILOGI("[%{public}s] does not exist in service directory.", CUSTOM_KEY_MAPPING_CONFIG);
-        if (!JsonUtils::CopyFile(GAME_CONTROLLER_ETC_ROOT + CUSTOM_KEY_MAPPING_CONFIG,
-                                 GAME_CONTROLLER_SERVICE_ROOT + CUSTOM_KEY_MAPPING_CONFIG,
-                                 false)) {
-            HILOGE("[%{public}s] copy to service directory failed.", CUSTOM_KEY_MAPPING_CONFIG);
-            isLoadConfig = false;
-        }
+void KeyMappingConfigManager::LoadConfigFromJsonFile()
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    if (PrepareConfigFile(DEFAULT_KEY_MAPPING_CONFIG)) {
+        size_t size = defaultKeyMappingConfigStore_.Load();
+        HILOGI("default_key_mapping size is [%{public}zu].", size);
     }
-    if (isLoadConfig) {
-        std::unordered_map<std::string, KeyMappingInfoConfig> customConfigMap = LoadConfigFromJsonFile(
-            GAME_CONTROLLER_SERVICE_ROOT + CUSTOM_KEY_MAPPING_CONFIG, true);
-        customKeyMappingInfoConfigMap_.clear();
-        customKeyMappingInfoConfigMap_.insert(customConfigMap.begin(), customConfigMap.end());
-        HILOGI("custom_key_mapping size is [%{public}d].", static_cast<int>(customConfigMap.size()));
+    if (PrepareConfigFile(CUSTOM_KEY_MAPPING_CONFIG)) {
+        size_t size = customKeyMappingConfigStore_.Load();
+        HILOGI("custom_key_mapping size is [%{public}zu].", size);
     }
 }
 
-std::unordered_map<std::string, KeyMappingInfoConfig> KeyMappingConfigManager::LoadConfigFromJsonFile(
-    const std::string &filePath, const bool isCustom)
+bool KeyMappingConfigManager::PrepareConfigFile(const std::string &fileName)
 {
-    std::unordered_map<std::string, KeyMappingInfoConfig> configMap;
-    std::pair<bool, json> ret = JsonUtils::ReadJsonFromFile(filePath);
-    if (!ret.first) {
-        HILOGW("load [%{public}s] file failed.", filePath.c_str());
-        return configMap;
-    }
-    HILOGI("load [%{public}s] file success.", filePath.c_str());
-    json config = ret.second;
-    if (config.empty()) {
-        HILOGW("[%{public}s] no config.", filePath.c_str());
-        return configMap;
-    }
-    if (!config.is_array()) {
-        HILOGW("[%{public}s]'s not json.", filePath.c_str());
-        return configMap;
-    }
-    for (const auto &jsonObj: config) {
-        KeyMappingInfoConfig keyMappingInfoConfig(jsonObj, isCustom);
-        if (isCustom) {
-            configMap.insert(make_pair(keyMappingInfoConfig.GetKeyForCustomKeyMapping(), keyMappingInfoConfig));
-        } else {
-            configMap.insert(make_pair(keyMappingInfoConfig.GetKeyForDefaultKeyMapping(), keyMappingInfoConfig));
-        }
+    if (JsonUtils::IsFileExist(GAME_CONTROLLER_SERVICE_ROOT + fileName)) {
+        return true;
     }
-    return configMap;
+    HILOGI("[%{public}s] does not exist in service directory.", fileName.c_str());
+    if (!JsonUtils::CopyFile(GAME_CONTROLLER_ETC_ROOT + fileName, GAME_CONTROLLER_SERVICE_ROOT + fileName, false)) {
+        HILOGE("[%{public}s] copy to service directory failed.", fileName.c_str());
+        return false;
+    }
+    return true;
 }
 
 int32_t KeyMappingConfigManager::SetDefaultGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfoForConst)
@@ -253,23 +294,14 @@ int32_t KeyMappingConfigManager::SetDefaultGameKeyMappingConfig(const GameKeyMap
         HILOGE("CheckParamValidForSetDefault failed");
         return GAME_ERR_ARGUMENT_INVALID;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::unordered_map<std::string, KeyMappingInfoConfig> configMap;
-    configMap.insert(defaultKeyMappingInfoConfigMap_.begin(), defaultKeyMappingInfoConfigMap_.end());
-    KeyMappingInfoConfig config(gameKeyMappingInfo);
-    std::string key = config.GetKeyForDefaultKeyMapping();
+    BundleKeyMappingChange change;
     bool isDelByBundleName = gameKeyMappingInfo.IsDelByBundleNameWhenSetDefault();
-    if (gameKeyMappingInfo.isOprDelete) {
-        DelFromMap(configMap, key, isDelByBundleName);
-    } else {
-        configMap[key] = config;
+    if (!ApplyToBundle(change, gameKeyMappingInfo, isDelByBundleName)) {
+        HILOGE("the deviceType [%{public}d] is invalid", static_cast<int32_t>(gameKeyMappingInfo.deviceType));
+        return GAME_ERR_ARGUMENT_INVALID;
     }
-    if (SaveToConfigFile(configMap, GAME_CONTROLLER_SERVICE_ROOT + DEFAULT_KEY_MAPPING_CONFIG, false)) {
-        if (gameKeyMappingInfo.isOprDelete) {
-            DelFromMap(defaultKeyMappingInfoConfigMap_, key, isDelByBundleName);
-        } else {
-            defaultKeyMappingInfoConfigMap_[key] = config;
-        }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    if (defaultKeyMappingConfigStore_.Update(gameKeyMappingInfo.bundleName, change)) {
         if (!isDelByBundleName) {
             DelayedSingleton<EventPublisher>::GetInstance()->SendGameKeyMappingConfigChangeNotify(gameKeyMappingInfo);
         }
@@ -280,24 +312,27 @@ int32_t KeyMappingConfigManager::SetDefaultGameKeyMappingConfig(const GameKeyMap
     return GAME_ERR_FAIL;
 }
 
-void KeyMappingConfigManager::DelFromMap(std::unordered_map<std::string, KeyMappingInfoConfig> &configMap,
-                                         const std::string &key,
-                                         bool isDelByBundleName)
+bool KeyMappingConfigManager::ApplyToBundle(BundleKeyMappingChange &change,
+                                            const GameKeyMappingInfo &gameKeyMappingInfo,
+                                            bool isDelByBundleName)
 {
     if (isDelByBundleName) {
-        std::vector<std::string> keys;
-        for (const auto &config: configMap) {
-            if (config.first.find(key) == 0) {
-                keys.push_back(config.first);
-            }
-        }
-        for (const auto &keyInfo: keys) {
-            configMap.erase(keyInfo);
-        }
-        return;
+        change.isChanged.fill(true);
+        change.configs.fill(nullptr);
+        return true;
     }
-
-    configMap.erase(key);
+    int32_t deviceType = static_cast<int32_t>(gameKeyMappingInfo.deviceType);
+    if (!KeyMappingConfigIndex::IsValidDeviceType(deviceType)) {
+        return false;
+    }
+    change.isChanged[static_cast<size_t>(deviceType)] = true;
+    if (gameKeyMappingInfo.isOprDelete) {
+        change.configs[static_cast<size_t>(deviceType)] = nullptr;
+    } else {
+        change.configs[static_cast<size_t>(deviceType)] = std::make_shared<const KeyMappingInfoConfig>(
+            gameKeyMappingInfo);
+    }
+    return true;
 }
 
 int32_t KeyMappingConfigManager::SetCustomGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfoForConst)
@@ -307,23 +342,14 @@ int32_t KeyMappingConfigManager::SetCustomGameKeyMappingConfig(const GameKeyMapp
         HILOGE("CheckParamValidForSetCustom failed");
         return GAME_ERR_ARGUMENT_INVALID;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::unordered_map<std::string, KeyMappingInfoConfig> configMap;
-    configMap.insert(customKeyMappingInfoConfigMap_.begin(), customKeyMappingInfoConfigMap_.end());
-    KeyMappingInfoConfig config(gameKeyMappingInfo);
-    std::string key = config.GetKeyForCustomKeyMapping();
+    BundleKeyMappingChange change;
     bool isDelByBundleName = gameKeyMappingInfo.IsDelByBundleNameWhenSetCustom();
-    if (gameKeyMappingInfo.isOprDelete) {
-        DelFromMap(configMap, key, isDelByBundleName);
-    } else {
-        configMap[key] = config;
+    if (!ApplyToBundle(change, gameKeyMappingInfo, isDelByBundleName)) {
+        HILOGE("the deviceType [%{public}d] is invalid", static_cast<int32_t>(gameKeyMappingInfo.deviceType));
+        return GAME_ERR_ARGUMENT_INVALID;
     }
-    if (SaveToConfigFile(configMap, GAME_CONTROLLER_SERVICE_ROOT + CUSTOM_KEY_MAPPING_CONFIG, true)) {
-        if (gameKeyMappingInfo.isOprDelete) {
-            DelFromMap(customKeyMappingInfoConfigMap_, key, isDelByBundleName);
-        } else {
-            customKeyMappingInfoConfigMap_[key] = config;
-        }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    if (customKeyMappingConfigStore_.Update(gameKeyMappingInfo.bundleName, change)) {
         if (!isDelByBundleName) {
             DelayedSingleton<EventPublisher>::GetInstance()->SendGameKeyMappingConfigChangeNotify(gameKeyMappingInfo);
         }
@@ -334,6 +360,47 @@ int32_t KeyMappingConfigManager::SetCustomGameKeyMappingConfig(const GameKeyMapp
     return GAME_ERR_FAIL;
 }
 
+int32_t KeyMappingConfigManager::SetCustomGameKeyMappingConfigs(
+    const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    if (gameKeyMappingInfos.empty() || gameKeyMappingInfos.size() > static_cast<size_t>(MAX_BATCH_KEY_MAPPING_SIZE)) {
+        HILOGE("the size of gameKeyMappingInfos [%{public}zu] is invalid", gameKeyMappingInfos.size());
+        return GAME_ERR_ARGUMENT_INVALID;
+    }
+    std::vector<GameKeyMappingInfo> infos = gameKeyMappingInfos;
+    const std::string bundleName = infos.front().bundleName;
+    for (auto &gameKeyMappingInfo: infos) {
+        if (!gameKeyMappingInfo.CheckParamValidForSetCustom() || !JsonUtils::IsUtf8(gameKeyMappingInfo.bundleName) ||
+            gameKeyMappingInfo.bundleName != bundleName) {
+            HILOGE("CheckParamValidForSetCustom failed");
+            return GAME_ERR_ARGUMENT_INVALID;
+        }
+    }
+    BundleKeyMappingChange change;
+    std::vector<int32_t> changedDeviceTypes;
+    for (const auto &gameKeyMappingInfo: infos) {
+        bool isDelByBundleName = gameKeyMappingInfo.IsDelByBundleNameWhenSetCustom();
+        if (!ApplyToBundle(change, gameKeyMappingInfo, isDelByBundleName)) {
+            HILOGE("the deviceType [%{public}d] is invalid", static_cast<int32_t>(gameKeyMappingInfo.deviceType));
+            return GAME_ERR_ARGUMENT_INVALID;
+        }
+        if (!isDelByBundleName) {
+            changedDeviceTypes.push_back(static_cast<int32_t>(gameKeyMappingInfo.deviceType));
+        }
+    }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    if (!customKeyMappingConfigStore_.Update(bundleName, change)) {
+        HILOGE("save custom GameKeyMappingConfigs failed");
+        return GAME_ERR_FAIL;
+    }
+    if (!changedDeviceTypes.empty()) {
+        DelayedSingleton<EventPublisher>::GetInstance()->SendGameKeyMappingConfigChangeNotify(bundleName,
+                                                                                             changedDeviceTypes);
+    }
+    HILOGI("save custom GameKeyMappingConfigs success. size is [%{public}zu]", infos.size());
+    return GAME_CONTROLLER_SUCCESS;
+}
+
 int32_t KeyMappingConfigManager::GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
                                                          GameKeyMappingInfo &gameKeyMappingInfo)
 {
@@ -341,26 +408,57 @@ int32_t KeyMappingConfigManager::GetGameKeyMappingConfig(const GetGameKeyMapping
         HILOGE("CheckParamValidForGetGameKeyMappingConfig failed");
         return GAME_ERR_ARGUMENT_INVALID;
     }
-    KeyMappingInfoConfig config;
-    config.bundleName = param.bundleName;
-    config.deviceType = static_cast<int32_t>(param.deviceType);
-
-    std::lock_guard<std::mutex> lock(mutex_);
+    int32_t deviceType = static_cast<int32_t>(param.deviceType);
+    FillGameKeyMappingInfo(defaultKeyMappingConfigStore_.Find(param.bundleName, deviceType),
+                           customKeyMappingConfigStore_.Find(param.bundleName, deviceType), gameKeyMappingInfo);
+    return GAME_CONTROLLER_SUCCESS;
+}
 
-    // get the default config by bundleName and deviceType
-    std::string defaultKey = config.GetKeyForDefaultKeyMapping();
-    if (defaultKeyMappingInfoConfigMap_.find(defaultKey) != defaultKeyMappingInfoConfigMap_.end()) {
-        KeyMappingInfoConfig defaultConfig = defaultKeyMappingInfoConfigMap_.at(defaultKey);
-        gameKeyMappingInfo.defaultKeyToTouchMappings = defaultConfig.ConvertToDefaultKeyToTouchMapping();
+int32_t KeyMappingConfigManager::GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                                          std::vector<GameKeyMappingInfo> &gameKeyMappingInfos)
+{
+    if (params.empty() || params.size() > static_cast<size_t>(MAX_BATCH_KEY_MAPPING_SIZE)) {
+        HILOGE("the size of params [%{public}zu] is invalid", params.size());
+        return GAME_ERR_ARGUMENT_INVALID;
+    }
+    for (const auto &param: params) {
+        if (!param.CheckParamValid()) {
+            HILOGE("CheckParamValidForGetGameKeyMappingConfigs failed");
+            return GAME_ERR_ARGUMENT_INVALID;
+        }
     }
+    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> defaultConfigs =
+        defaultKeyMappingConfigStore_.Find(params);
+    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> customConfigs =
+        customKeyMappingConfigStore_.Find(params);
+    gameKeyMappingInfos.clear();
+    gameKeyMappingInfos.reserve(params.size());
+    for (size_t idx = 0; idx < params.size(); idx++) {
+        GameKeyMappingInfo gameKeyMappingInfo;
+        gameKeyMappingInfo.bundleName = params[idx].bundleName;
+        gameKeyMappingInfo.isOprDelete = false;
+        gameKeyMappingInfo.deviceType = params[idx].deviceType;
+        FillGameKeyMappingInfo(defaultConfigs[idx], customConfigs[idx], gameKeyMappingInfo);
+        gameKeyMappingInfos.push_back(std::move(gameKeyMappingInfo));
+    }
+    return GAME_CONTROLLER_SUCCESS;
+}
 
-    std::string customKey = config.GetKeyForCustomKeyMapping();
-    if (customKeyMappingInfoConfigMap_.find(customKey) != customKeyMappingInfoConfigMap_.end()) {
-        KeyMappingInfoConfig customConfig = customKeyMappingInfoConfigMap_.at(customKey);
-        gameKeyMappingInfo.customKeyToTouchMappings = customConfig.ConvertToCustomKeyToTouchMapping();
+void KeyMappingConfigManager::FillGameKeyMappingInfo(const std::shared_ptr<const KeyMappingInfoConfig> &defaultConfig,
+                                                     const std::shared_ptr<const KeyMappingInfoConfig> &customConfig,
+                                                     GameKeyMappingInfo &gameKeyMappingInfo)
+{
+    if (defaultConfig != nullptr) {
+        gameKeyMappingInfo.defaultKeyToTouchMappings = defaultConfig->ConvertToDefaultKeyToTouchMapping();
+        gameKeyMappingInfo.defaultResolution = defaultConfig->defaultResolution;
+        gameKeyMappingInfo.defaultResponseCurve = defaultConfig->defaultResponseCurve;
     }
 
-    return GAME_CONTROLLER_SUCCESS;
+    if (customConfig != nullptr) {
+        gameKeyMappingInfo.customKeyToTouchMappings = customConfig->ConvertToCustomKeyToTouchMapping();
+        gameKeyMappingInfo.customResolution = customConfig->customResolution;
+        gameKeyMappingInfo.customResponseCurve = customConfig->customResponseCurve;
+    }
+}
 }
 }
-}
\ No newline at end of file
@@ -0,0 +1,473 @@
+/*
+ *  Copyright (c) 2025 Huawei Device Co., Ltd.
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <cstdlib>
+#include <limits>
+#include <unistd.h>
+#include "key_mapping_config_store.h"
+#include "key_mapping_config_manager.h"
+#include "gamecontroller_log.h"
+#include "json_utils.h"
+
+using json = nlohmann::json;
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const char* KEY_BUNDLE_NAME = "\"bundleName\"";
+const char* KEY_DEVICE_TYPE = "\"deviceType\"";
+const int32_t DECIMAL = 10;
+
+/**
+ * The top-level fields of one template in the configuration file.
+ */
+struct ScannedConfig {
+    std::string bundleName;
+    int32_t deviceType = 0;
+    KeyMappingConfigLocation location;
+};
+
+size_t SkipWhitespace(const std::string &content, size_t pos)
+{
+    while (pos < content.size() && (content[pos] == ' ' || content[pos] == '\t' || content[pos] == '\n' ||
+                                    content[pos] == '\r')) {
+        pos++;
+    }
+    return pos;
+}
+
+/**
+ * Skip the string starting at pos.
+ * @return the position after the closing quote, std::string::npos means it's not closed
+ */
+size_t SkipString(const std::string &content, size_t pos)
+{
+    for (pos++; pos < content.size(); pos++) {
+        if (content[pos] == '\\') {
+            pos++;
+        } else if (content[pos] == '"') {
+            return pos + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+/**
+ * Same as JsonUtils::GetJsonInt32Value, a value which is not an int32 integer is 0.
+ */
+int32_t ParseInt32(const std::string &content, size_t pos)
+{
+    size_t end = pos;
+    if (end < content.size() && content[end] == '-') {
+        end++;
+    }
+    size_t digitStart = end;
+    while (end < content.size() && content[end] >= '0' && content[end] <= '9') {
+        end++;
+    }
+    if (end == digitStart || (end < content.size() && (content[end] == '.' || content[end] == 'e' ||
+                                                       content[end] == 'E'))) {
+        return 0;
+    }
+    long long value = std::strtoll(content.c_str() + pos, nullptr, DECIMAL);
+    if (value < std::numeric_limits<int32_t>::min() || value > std::numeric_limits<int32_t>::max()) {
+        return 0;
+    }
+    return static_cast<int32_t>(value);
+}
+
+/**
+ * Find the end of the object starting at pos, and read its bundleName and deviceType.
+ * The nested values are skipped without being decoded.
+ * @param pos the position of '{', it's moved after the matched '}'
+ * @return false means the object is not closed
+ */
+bool ScanObject(const std::string &content, size_t &pos, ScannedConfig &config)
+{
+    size_t begin = pos;
+    int32_t depth = 0;
+    bool isExpectKey = false;
+    std::string key;
+    while (pos < content.size()) {
+        char c = content[pos];
+        if (c == '"') {
+            size_t end = SkipString(content, pos);
+            if (end == std::string::npos) {
+                return false;
+            }
+            if (depth == 1 && isExpectKey) {
+                key = content.substr(pos, end - pos);
+                isExpectKey = false;
+            } else if (depth == 1 && key == KEY_BUNDLE_NAME) {
+                json value = json::parse(content.substr(pos, end - pos), nullptr, false);
+                if (value.is_string()) {
+                    config.bundleName = value.get<std::string>();
+                }
+            }
+            pos = end;
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+            isExpectKey = depth == 1;
+        } else if (c == '}' || c == ']') {
+            depth--;
+            if (depth == 0) {
+                pos++;
+                config.location.offset = static_cast<uint32_t>(begin);
+                config.location.length = static_cast<uint32_t>(pos - begin);
+                return true;
+            }
+        } else if (c == ',' && depth == 1) {
+            isExpectKey = true;
+            key.clear();
+        } else if (c == ':' && depth == 1 && key == KEY_DEVICE_TYPE) {
+            config.deviceType = ParseInt32(content, SkipWhitespace(content, pos + 1));
+        }
+        pos++;
+    }
+    return false;
+}
+
+/**
+ * Find every template of the configuration file, which is a JSON array of objects.
+ * @return false means it's not a JSON array of objects
+ */
+bool ScanConfigFile(const std::string &content, std::vector<ScannedConfig> &configs)
+{
+    if (content.size() > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    size_t pos = SkipWhitespace(content, 0);
+    if (pos >= content.size() || content[pos] != '[') {
+        return false;
+    }
+    pos++;
+    while (true) {
+        pos = SkipWhitespace(content, pos);
+        if (pos >= content.size()) {
+            return false;
+        }
+        if (content[pos] == ']') {
+            return SkipWhitespace(content, pos + 1) == content.size();
+        }
+        if (content[pos] != '{') {
+            return false;
+        }
+        ScannedConfig config;
+        if (!ScanObject(content, pos, config)) {
+            return false;
+        }
+        configs.push_back(std::move(config));
+        pos = SkipWhitespace(content, pos);
+        if (pos < content.size() && content[pos] == ',') {
+            pos++;
+        }
+    }
+}
+
+void AppendConfig(std::string &content, KeyMappingConfigIndex &index, const std::string &bundleName,
+                  int32_t deviceType, const char* configText, size_t length)
+{
+    if (content.size() > 1) {
+        content += ',';
+    }
+    KeyMappingConfigLocation location;
+    location.offset = static_cast<uint32_t>(content.size());
+    location.length = static_cast<uint32_t>(length);
+    content.append(configText, length);
+    index.Set(bundleName, deviceType, location);
+}
+}
+
+std::shared_ptr<const KeyMappingInfoConfig> KeyMappingConfigCache::Get(const std::string &bundleName,
+                                                                       int32_t deviceType)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entryIndex_.find(CacheKey{bundleName, deviceType});
+    if (iter == entryIndex_.end()) {
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return iter->second->second;
+}
+
+void KeyMappingConfigCache::Put(const std::string &bundleName, int32_t deviceType,
+                                const std::shared_ptr<const KeyMappingInfoConfig> &config)
+{
+    if (capacity_ == 0) {
+        return;
+    }
+    CacheKey key{bundleName, deviceType};
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entryIndex_.find(key);
+    if (iter != entryIndex_.end()) {
+        iter->second->second = config;
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        return;
+    }
+    if (entries_.size() >= capacity_) {
+        entryIndex_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(key, config);
+    entryIndex_.emplace(std::move(key), entries_.begin());
+}
+
+void KeyMappingConfigCache::Erase(const std::string &bundleName, int32_t deviceType)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entryIndex_.find(CacheKey{bundleName, deviceType});
+    if (iter == entryIndex_.end()) {
+        return;
+    }
+    entries_.erase(iter->second);
+    entryIndex_.erase(iter);
+}
+
+void KeyMappingConfigCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entryIndex_.clear();
+    entries_.clear();
+}
+
+size_t KeyMappingConfigCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+KeyMappingConfigStore::KeyMappingConfigStore(const std::string &filePath, bool isCustom)
+    : filePath_(filePath), isCustom_(isCustom)
+{
+}
+
+size_t KeyMappingConfigStore::Load()
+{
+    KeyMappingConfigIndex index;
+    std::string content;
+    std::vector<ScannedConfig> configs;
+    if (!JsonUtils::ReadFile(filePath_, content)) {
+        HILOGW("load [%{public}s] file failed.", filePath_.c_str());
+    } else if (!ScanConfigFile(content, configs)) {
+        HILOGW("[%{public}s]'s not json array.", filePath_.c_str());
+        configs.clear();
+    }
+    for (const auto &config: configs) {
+        if (index.Find(config.bundleName, config.deviceType).IsValid()) {
+            // the first one wins if the file has duplicates
+            continue;
+        }
+        if (!index.Set(config.bundleName, config.deviceType, config.location)) {
+            HILOGW("the deviceType [%{public}d] of [%{public}s] is invalid.", config.deviceType,
+                   config.bundleName.c_str());
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_ = std::move(index);
+    cache_.Clear();
+    generation_++;
+    return index_.Size();
+}
+
+std::shared_ptr<const KeyMappingInfoConfig> KeyMappingConfigStore::Find(const std::string &bundleName,
+                                                                        int32_t deviceType)
+{
+    std::shared_ptr<const KeyMappingInfoConfig> config = cache_.Get(bundleName, deviceType);
+    if (config != nullptr) {
+        return config;
+    }
+    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> configs(1);
+    std::vector<PendingConfig> pendingConfigs;
+    int32_t fd = -1;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FindLocked(bundleName, deviceType, 0, configs, pendingConfigs);
+        if (!pendingConfigs.empty()) {
+            fd = JsonUtils::OpenFile(filePath_);
+            generation = generation_;
+        }
+    }
+    DecodePendingConfigs(fd, generation, pendingConfigs, configs);
+    return configs[0];
+}
+
+std::vector<std::shared_ptr<const KeyMappingInfoConfig>> KeyMappingConfigStore::Find(
+    const std::vector<GetGameKeyMappingInfoParam> &params)
+{
+    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> configs(params.size());
+    std::vector<PendingConfig> pendingConfigs;
+    int32_t fd = -1;
+    uint64_t generation = 0;
+    {
+        // The locations and the file are taken at once, so no update is applied in the middle of them.
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t idx = 0; idx < params.size(); idx++) {
+            FindLocked(params[idx].bundleName, static_cast<int32_t>(params[idx].deviceType), idx, configs,
+                       pendingConfigs);
+        }
+        if (!pendingConfigs.empty()) {
+            fd = JsonUtils::OpenFile(filePath_);
+            generation = generation_;
+        }
+    }
+    DecodePendingConfigs(fd, generation, pendingConfigs, configs);
+    return configs;
+}
+
+void KeyMappingConfigStore::FindLocked(const std::string &bundleName, int32_t deviceType, size_t slot,
+                                       std::vector<std::shared_ptr<const KeyMappingInfoConfig>> &configs,
+                                       std::vector<PendingConfig> &pendingConfigs)
+{
+    // another reader may have decoded it while waiting for the lock
+    configs[slot] = cache_.Get(bundleName, deviceType);
+    if (configs[slot] != nullptr) {
+        return;
+    }
+    KeyMappingConfigLocation location = index_.Find(bundleName, deviceType);
+    if (!location.IsValid()) {
+        return;
+    }
+    PendingConfig pendingConfig;
+    pendingConfig.slot = slot;
+    pendingConfig.bundleName = bundleName;
+    pendingConfig.deviceType = deviceType;
+    pendingConfig.location = location;
+    pendingConfigs.push_back(std::move(pendingConfig));
+}
+
+void KeyMappingConfigStore::DecodePendingConfigs(int32_t fd, uint64_t generation,
+                                                 const std::vector<PendingConfig> &pendingConfigs,
+                                                 std::vector<std::shared_ptr<const KeyMappingInfoConfig>> &configs)
+{
+    if (fd < 0) {
+        return;
+    }
+    // The file opened with the lock is still the old one after it's replaced, so it matches the locations.
+    for (const auto &pendingConfig: pendingConfigs) {
+        std::string configText;
+        if (!JsonUtils::ReadFileRange(fd, pendingConfig.location.offset, pendingConfig.location.length,
+                                      configText)) {
+            continue;
+        }
+        json jsonObj = json::parse(configText, nullptr, false);
+        if (jsonObj.is_discarded() || !jsonObj.is_object()) {
+            HILOGE("the template of [%{public}s] in [%{public}s] is invalid.", pendingConfig.bundleName.c_str(),
+                   filePath_.c_str());
+            continue;
+        }
+        configs[pendingConfig.slot] = std::make_shared<const KeyMappingInfoConfig>(jsonObj, isCustom_);
+    }
+    close(fd);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_) {
+        return;
+    }
+    for (const auto &pendingConfig: pendingConfigs) {
+        if (configs[pendingConfig.slot] != nullptr) {
+            cache_.Put(pendingConfig.bundleName, pendingConfig.deviceType, configs[pendingConfig.slot]);
+        }
+    }
+}
+
+bool KeyMappingConfigStore::Update(const std::string &bundleName, const BundleKeyMappingChange &change)
+{
+    // Only the writer changes index_ and the file, so they're read without the lock here.
+    std::string oldContent;
+    if (index_.Size() > 0 && !JsonUtils::ReadFile(filePath_, oldContent)) {
+        return false;
+    }
+    KeyMappingConfigIndex index;
+    std::string content = "[";
+    bool isOutOfFile = false;
+    index_.ForEach([&bundleName, &change, &oldContent, &content, &index, &isOutOfFile](
+        const std::string &name, const BundleKeyMappingLocations &locations) {
+        for (size_t deviceType = 0; deviceType < DEVICE_TYPE_SLOT_COUNT; deviceType++) {
+            const KeyMappingConfigLocation &location = locations[deviceType];
+            if (!location.IsValid() || (name == bundleName && change.isChanged[deviceType])) {
+                continue;
+            }
+            if (static_cast<size_t>(location.offset) + location.length > oldContent.size()) {
+                HILOGE("the template of [%{public}s] is out of the file.", name.c_str());
+                isOutOfFile = true;
+                continue;
+            }
+            AppendConfig(content, index, name, static_cast<int32_t>(deviceType), oldContent.data() + location.offset,
+                         location.length);
+        }
+    });
+    if (isOutOfFile) {
+        // The file was changed by someone else, so it's not rewritten to avoid dropping the templates.
+        return false;
+    }
+    for (size_t deviceType = 0; deviceType < DEVICE_TYPE_SLOT_COUNT; deviceType++) {
+        if (change.isChanged[deviceType] && change.configs[deviceType] != nullptr) {
+            std::string configText = change.configs[deviceType]->ConvertToJson(isCustom_).dump();
+            AppendConfig(content, index, bundleName, static_cast<int32_t>(deviceType), configText.data(),
+                         configText.size());
+        }
+    }
+    content += "]";
+    if (content.size() > std::numeric_limits<uint32_t>::max()) {
+        HILOGE("[%{public}s] is too large.", filePath_.c_str());
+        return false;
+    }
+
+    // The new file is written and flushed without the lock, and the readers only wait for the rename
+    // and the swap of index_.
+    std::string tempPath;
+    if (!JsonUtils::WriteTempFile(filePath_, content, tempPath)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!JsonUtils::RenameFile(tempPath, filePath_)) {
+            return false;
+        }
+        index_ = std::move(index);
+        generation_++;
+        for (size_t deviceType = 0; deviceType < DEVICE_TYPE_SLOT_COUNT; deviceType++) {
+            if (!change.isChanged[deviceType]) {
+                continue;
+            }
+            if (change.configs[deviceType] != nullptr) {
+                cache_.Put(bundleName, static_cast<int32_t>(deviceType), change.configs[deviceType]);
+            } else {
+                cache_.Erase(bundleName, static_cast<int32_t>(deviceType));
+            }
+        }
+    }
+    JsonUtils::SyncDirectory(filePath_);
+    return true;
+}
+
+size_t KeyMappingConfigStore::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.Size();
+}
+
+void KeyMappingConfigStore::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.Clear();
+    cache_.Clear();
+    generation_++;
+}
+}
+}
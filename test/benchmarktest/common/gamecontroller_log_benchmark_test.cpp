@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include "gamecontroller_client_model.h"
+#include "gamecontroller_log.h"
+#include "gamecontroller_utils.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const char* UNIQ = "a1:b2:c3:d4:e5:f6";
+const int32_t DEVICE_ID = 3;
+const int32_t OTHER_DEVICE_ID = 4;
+
+DeviceInfo BuildDeviceInfo()
+{
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = UNIQ;
+    deviceInfo.anonymizationUniq = StringUtils::AnonymizationUniq(deviceInfo.uniq);
+    deviceInfo.name = "game keyboard";
+    deviceInfo.phys = "usb-0000:00:14.0-1/input0";
+    deviceInfo.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    deviceInfo.ids = {DEVICE_ID, OTHER_DEVICE_ID};
+    deviceInfo.sourceTypeSet = {InputSourceTypeEnum::KEYBOARD, InputSourceTypeEnum::MOUSE};
+    return deviceInfo;
+}
+}
+
+/**
+ * A debug line with a formatted argument, which is built even though the debug level is disabled.
+ */
+static void BM_Log_DisabledEager(benchmark::State &state)
+{
+    DeviceInfo deviceInfo = BuildDeviceInfo();
+    for (auto _: state) {
+        HILOGD("deviceInfo is %{public}s", deviceInfo.GetDeviceInfoDesc().c_str());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Log_DisabledEager);
+
+/**
+ * The same line when the level is checked first.
+ */
+static void BM_Log_DisabledLimit(benchmark::State &state)
+{
+    DeviceInfo deviceInfo = BuildDeviceInfo();
+    for (auto _: state) {
+        HILOGD_LIMIT("deviceInfo is %{public}s", deviceInfo.GetDeviceInfoDesc().c_str());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Log_DisabledLimit);
+
+/**
+ * An enabled line of a call site which is over its burst.
+ */
+static void BM_Log_SuppressedLimit(benchmark::State &state)
+{
+    DeviceInfo deviceInfo = BuildDeviceInfo();
+    for (auto _: state) {
+        HILOGW_LIMIT("deviceInfo is %{public}s", deviceInfo.GetDeviceInfoDesc().c_str());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Log_SuppressedLimit);
+
+static void BM_AnonymizationUniq(benchmark::State &state)
+{
+    std::string uniq = UNIQ;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(StringUtils::AnonymizationUniq(uniq));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AnonymizationUniq);
+}
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <benchmark/benchmark.h>
+#include <message_parcel.h>
+#include "gamecontroller_client_model.h"
+#include "gamecontroller_keymapping_model.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t DEVICE_ID = 3;
+const int32_t OTHER_DEVICE_ID = 4;
+const int32_t COMBINATION_FIRST_KEY = 2072;
+const int32_t COMBINATION_LAST_KEY = 2017;
+
+GameKeyMappingInfo BuildGameKeyMappingInfo()
+{
+    GameKeyMappingInfo info;
+    info.bundleName = "com.test.game";
+    info.isOprDelete = false;
+    info.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    for (int32_t idx = 0; idx < MAX_KEY_MAPPING_SIZE; idx++) {
+        KeyToTouchMappingInfo keyMapping;
+        keyMapping.keyCode = idx;
+        keyMapping.xValue = idx;
+        keyMapping.yValue = idx;
+        keyMapping.mappingType = MappingTypeEnum::COMBINATION_KEY_TO_TOUCH;
+        keyMapping.combinationKeys = {COMBINATION_FIRST_KEY, COMBINATION_LAST_KEY};
+        info.customKeyToTouchMappings.push_back(keyMapping);
+        info.defaultKeyToTouchMappings.push_back(keyMapping);
+    }
+    return info;
+}
+
+DeviceInfo BuildDeviceInfo()
+{
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = "a1:b2:c3:d4:e5:f6";
+    deviceInfo.name = "game keyboard";
+    deviceInfo.phys = "usb-0000:00:14.0-1/input0";
+    deviceInfo.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    deviceInfo.ids = {DEVICE_ID, OTHER_DEVICE_ID};
+    deviceInfo.names = {"game keyboard", "game keyboard consumer control"};
+    deviceInfo.sourceTypeSet = {InputSourceTypeEnum::KEYBOARD, InputSourceTypeEnum::MOUSE};
+    return deviceInfo;
+}
+
+/**
+ * Per-field encoding used before the packed block, kept as the baseline.
+ */
+bool WriteKeyMappingsPerField(Parcel &parcel, const std::vector<KeyToTouchMappingInfo> &keyMappings)
+{
+    if (!parcel.WriteInt32(static_cast<int32_t>(keyMappings.size()))) {
+        return false;
+    }
+    for (const auto &keyMapping: keyMappings) {
+        if (!parcel.WriteParcelable(&keyMapping)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadKeyMappingsPerField(Parcel &parcel, std::vector<KeyToTouchMappingInfo> &keyMappings)
+{
+    int32_t size = parcel.ReadInt32();
+    for (int32_t idx = 0; idx < size; idx++) {
+        std::unique_ptr<KeyToTouchMappingInfo> keyMapping(parcel.ReadParcelable<KeyToTouchMappingInfo>());
+        if (keyMapping == nullptr) {
+            return false;
+        }
+        keyMappings.push_back(*keyMapping);
+    }
+    return true;
+}
+}
+
+static void BM_GameKeyMappingInfo_PerField(benchmark::State &state)
+{
+    GameKeyMappingInfo info = BuildGameKeyMappingInfo();
+    for (auto _: state) {
+        MessageParcel parcel;
+        WriteKeyMappingsPerField(parcel, info.customKeyToTouchMappings);
+        WriteKeyMappingsPerField(parcel, info.defaultKeyToTouchMappings);
+        std::vector<KeyToTouchMappingInfo> customMappings;
+        std::vector<KeyToTouchMappingInfo> defaultMappings;
+        ReadKeyMappingsPerField(parcel, customMappings);
+        ReadKeyMappingsPerField(parcel, defaultMappings);
+        benchmark::DoNotOptimize(defaultMappings.data());
+    }
+}
+BENCHMARK(BM_GameKeyMappingInfo_PerField);
+
+static void BM_GameKeyMappingInfo_Packed(benchmark::State &state)
+{
+    GameKeyMappingInfo info = BuildGameKeyMappingInfo();
+    for (auto _: state) {
+        MessageParcel parcel;
+        info.Marshalling(parcel);
+        std::unique_ptr<GameKeyMappingInfo> result(GameKeyMappingInfo::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result.get());
+    }
+}
+BENCHMARK(BM_GameKeyMappingInfo_Packed);
+
+static void BM_DeviceInfo_Packed(benchmark::State &state)
+{
+    DeviceInfo deviceInfo = BuildDeviceInfo();
+    for (auto _: state) {
+        MessageParcel parcel;
+        deviceInfo.Marshalling(parcel);
+        std::unique_ptr<DeviceInfo> result(DeviceInfo::Unmarshalling(parcel));
+        benchmark::DoNotOptimize(result.get());
+    }
+}
+BENCHMARK(BM_DeviceInfo_Packed);
+}
+}
+
+BENCHMARK_MAIN();
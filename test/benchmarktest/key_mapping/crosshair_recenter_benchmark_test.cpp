@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "crosshair_key_to_touch_handler.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t MAX_WIDTH = 2720;
+const int32_t MAX_HEIGHT = 1260;
+const int32_t CROSSHAIR_X = 2045;
+const int32_t CROSSHAIR_Y = 863;
+const int32_t CROSSHAIR_STEP = 20;
+const int32_t CROSSHAIR_POINTER_ID = 3;
+const int32_t MOUSE_START_X = 1360;
+const int32_t MOUSE_START_Y = 630;
+
+/**
+ * A flick: the mouse moves 40px every millisecond. The flicks have different lengths and directions.
+ */
+const std::vector<int32_t> FLICK_EVENTS = {6, 10, 14, 8, 12, 6};
+const std::vector<int32_t> FLICK_DIRECTIONS = {1, 1, -1, 1, -1, -1};
+const int32_t FLICK_DELTA = 40;
+const int64_t FLICK_INTERVAL = 1000;
+
+/**
+ * The aim after a flick: the mouse moves 1px every 8 milliseconds.
+ */
+const int32_t AIM_EVENTS = 30;
+const int32_t AIM_DELTA = 1;
+const int64_t AIM_INTERVAL = 8000;
+
+const int64_t PAUSE_TIME = 300000;
+const int32_t FLICK_COUNT = 32;
+
+struct MouseMove {
+    int32_t x = 0;
+    int32_t y = 0;
+    int64_t actionTime = 0;
+};
+
+/**
+ * Flicks to the right and to the left, each followed by a pause and a slow aim.
+ */
+std::vector<MouseMove> BuildFlickTrace()
+{
+    std::vector<MouseMove> trace;
+    MouseMove move;
+    move.x = MOUSE_START_X;
+    move.y = MOUSE_START_Y;
+    for (int32_t flick = 0; flick < FLICK_COUNT; flick++) {
+        int32_t direction = FLICK_DIRECTIONS[flick % FLICK_DIRECTIONS.size()];
+        for (int32_t idx = 0; idx < FLICK_EVENTS[flick % FLICK_EVENTS.size()]; idx++) {
+            move.x += direction * FLICK_DELTA;
+            move.y += direction;
+            move.actionTime += FLICK_INTERVAL;
+            trace.push_back(move);
+        }
+        move.actionTime += PAUSE_TIME;
+        for (int32_t idx = 0; idx < AIM_EVENTS; idx++) {
+            move.x += direction * AIM_DELTA;
+            move.actionTime += AIM_INTERVAL;
+            trace.push_back(move);
+        }
+    }
+    return trace;
+}
+
+/**
+ * Counts the touch events instead of injecting them.
+ */
+class CountingCrosshairHandler : public CrosshairKeyToTouchHandler {
+public:
+    void BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context,
+                                  const TouchEntity &touchEntity) override
+    {
+        injectedCount_++;
+        if (touchEntity.pointerAction == PointerEvent::POINTER_ACTION_UP) {
+            context->pointerItems.erase(touchEntity.pointerId);
+            return;
+        }
+        PointerEvent::PointerItem pointerItem;
+        pointerItem.SetPointerId(touchEntity.pointerId);
+        pointerItem.SetWindowX(touchEntity.xValue);
+        pointerItem.SetWindowY(touchEntity.yValue);
+        context->pointerItems[touchEntity.pointerId] = pointerItem;
+    }
+
+public:
+    int64_t injectedCount_{0};
+};
+
+std::shared_ptr<InputToTouchContext> BuildCrosshairContext()
+{
+    std::shared_ptr<InputToTouchContext> context = std::make_shared<InputToTouchContext>();
+    context->windowInfoEntity.maxWidth = MAX_WIDTH;
+    context->windowInfoEntity.maxHeight = MAX_HEIGHT;
+    KeyToTouchMappingInfo mappingInfo;
+    mappingInfo.mappingType = MappingTypeEnum::CROSSHAIR_KEY_TO_TOUCH;
+    mappingInfo.xValue = CROSSHAIR_X;
+    mappingInfo.yValue = CROSSHAIR_Y;
+    mappingInfo.xStep = CROSSHAIR_STEP;
+    mappingInfo.yStep = CROSSHAIR_STEP;
+    context->SetCurrentCrosshairInfo(mappingInfo, CROSSHAIR_POINTER_ID);
+    context->isEnterCrosshairInfo = true;
+    return context;
+}
+}
+
+/**
+ * Replay the flick trace through the crosshair.
+ * arg 0: 0 is the mode recentered by the distance, 1 is the trackball mode
+ */
+static void BM_Crosshair_ReplayFlicks(benchmark::State &state)
+{
+    std::vector<MouseMove> trace = BuildFlickTrace();
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_MOUSE);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    int64_t injectedCount = 0;
+    int64_t recenterCount = 0;
+    int64_t predictiveRecenterCount = 0;
+    for (auto _: state) {
+        state.PauseTiming();
+        CountingCrosshairHandler handler;
+        handler.SetTrackballMode(state.range(0) != 0);
+        std::shared_ptr<InputToTouchContext> context = BuildCrosshairContext();
+        state.ResumeTiming();
+        for (const auto &move: trace) {
+            PointerEvent::PointerItem mouseItem;
+            mouseItem.SetWindowX(move.x);
+            mouseItem.SetWindowY(move.y);
+            pointerEvent->RemoveAllPointerItems();
+            pointerEvent->AddPointerItem(mouseItem);
+            pointerEvent->SetActionTime(move.actionTime);
+            handler.HandlePointerEvent(context, pointerEvent, context->currentCrosshairInfo);
+        }
+        injectedCount += handler.injectedCount_;
+        recenterCount += handler.GetRecenterStats().recenterCount;
+        predictiveRecenterCount += handler.GetRecenterStats().predictiveRecenterCount;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(trace.size()));
+    state.counters["injected"] = benchmark::Counter(static_cast<double>(injectedCount),
+                                                    benchmark::Counter::kAvgIterations);
+    state.counters["recenters"] = benchmark::Counter(static_cast<double>(recenterCount),
+                                                     benchmark::Counter::kAvgIterations);
+    state.counters["predictive"] = benchmark::Counter(static_cast<double>(predictiveRecenterCount),
+                                                      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_Crosshair_ReplayFlicks)->Arg(0)->Arg(1);
+}
+}
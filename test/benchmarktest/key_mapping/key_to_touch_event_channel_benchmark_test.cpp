@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "key_to_touch_event_channel.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const int64_t NS_PER_SECOND = 1000000000;
+const double NS_PER_US = 1000.0;
+const double P50 = 0.5;
+const double P99 = 0.99;
+
+/**
+ * The number of the key events of a chord, and of the pointer events of a fast mouse or a macro keyboard.
+ */
+const int64_t CHORD_SIZE = 4;
+const int64_t BURST_SIZE = 64;
+const int64_t DEFAULT_MAX_BATCH_SIZE = static_cast<int64_t>(KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE);
+
+int64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * The latency of every event, from sending it until it's handled.
+ * The latencies are only written on the handle queue, and read after the events are all handled.
+ */
+class LatencyRecorder {
+public:
+    void OnHandled(int64_t sendTime)
+    {
+        int64_t now = Now();
+        latencies_.push_back(now - sendTime);
+        handledTime_ = now;
+        handledCount_.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * Wait until count events are handled since the last call.
+     * @return the time when the last one is handled
+     */
+    int64_t WaitHandled(int64_t count)
+    {
+        expectedCount_ += count;
+        while (handledCount_.load(std::memory_order_acquire) < expectedCount_) {
+            std::this_thread::yield();
+        }
+        return handledTime_;
+    }
+
+    void Report(benchmark::State &state)
+    {
+        if (latencies_.empty()) {
+            return;
+        }
+        std::sort(latencies_.begin(), latencies_.end());
+        state.counters["p50_us"] = GetPercentile(P50) / NS_PER_US;
+        state.counters["p99_us"] = GetPercentile(P99) / NS_PER_US;
+        state.counters["max_us"] = static_cast<double>(latencies_.back()) / NS_PER_US;
+    }
+
+private:
+    double GetPercentile(double percentile) const
+    {
+        size_t index = static_cast<size_t>(percentile * static_cast<double>(latencies_.size() - 1));
+        return static_cast<double>(latencies_[index]);
+    }
+
+private:
+    std::vector<int64_t> latencies_;
+    int64_t handledTime_{0};
+    std::atomic<int64_t> handledCount_{0};
+    int64_t expectedCount_{0};
+};
+
+KeyInputSample BuildSample(int64_t sendTime)
+{
+    KeyInputSample sample = KeyInputSample::Build(nullptr, GAME_KEY_BOARD, 0);
+    sample.actionTime = sendTime;
+    return sample;
+}
+}
+
+/**
+ * The previous path: one task per event on the handle queue.
+ * arg 0: the number of the events sent at once
+ */
+static void BM_KeyToTouchEvent_TaskPerEvent(benchmark::State &state)
+{
+    LatencyRecorder recorder;
+    std::unique_ptr<GameControllerQueue> handleQueue =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("key-to-touch-task-benchmark");
+    std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+    for (auto _: state) {
+        int64_t sendTime = Now();
+        for (int64_t idx = 0; idx < state.range(0); idx++) {
+            KeyInputSample sample = BuildSample(Now());
+            handleQueue->submit([keyEvent, sample, &recorder] {
+                benchmark::DoNotOptimize(keyEvent.get());
+                recorder.OnHandled(sample.actionTime);
+            });
+        }
+        int64_t handledTime = recorder.WaitHandled(state.range(0));
+        state.SetIterationTime(static_cast<double>(handledTime - sendTime) / NS_PER_SECOND);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    recorder.Report(state);
+}
+BENCHMARK(BM_KeyToTouchEvent_TaskPerEvent)->Arg(1)->Arg(CHORD_SIZE)->Arg(BURST_SIZE)->UseManualTime();
+
+/**
+ * The event channel: the events are queued in the slots and handled by one drain task per batch.
+ * arg 0: the number of the events sent at once, arg 1: the max batch size
+ */
+static void BM_KeyToTouchEvent_BatchedDrain(benchmark::State &state)
+{
+    LatencyRecorder recorder;
+    std::unique_ptr<GameControllerQueue> handleQueue =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("key-to-touch-channel-benchmark");
+    KeyToTouchEventChannel channel(handleQueue.get(), KEY_TO_TOUCH_EVENT_CHANNEL_CAPACITY,
+                                   [&recorder](const KeyToTouchEvent &event) {
+                                       benchmark::DoNotOptimize(event.keyEvent.get());
+                                       recorder.OnHandled(event.sample.actionTime);
+                                   });
+    channel.SetMaxBatchSize(static_cast<size_t>(state.range(1)));
+    std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+    for (auto _: state) {
+        int64_t sendTime = Now();
+        for (int64_t idx = 0; idx < state.range(0); idx++) {
+            KeyToTouchEvent event;
+            event.type = KEY_TO_TOUCH_KEY_EVENT;
+            event.sample = BuildSample(Now());
+            event.keyEvent = keyEvent;
+            channel.Send(std::move(event));
+        }
+        int64_t handledTime = recorder.WaitHandled(state.range(0));
+        state.SetIterationTime(static_cast<double>(handledTime - sendTime) / NS_PER_SECOND);
+    }
+    channel.WaitIdle();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    recorder.Report(state);
+    BatchedChannelStats stats = channel.GetStats();
+    state.counters["mean_batch"] = stats.batchCount == 0 ? 0.0 :
+        static_cast<double>(stats.eventCount) / static_cast<double>(stats.batchCount);
+}
+BENCHMARK(BM_KeyToTouchEvent_BatchedDrain)
+    ->ArgsProduct({{1, CHORD_SIZE, BURST_SIZE}, {DEFAULT_MAX_BATCH_SIZE, BURST_SIZE}})
+    ->UseManualTime();
+}
+}
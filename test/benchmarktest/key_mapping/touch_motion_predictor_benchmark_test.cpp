@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "touch_motion_predictor.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+/**
+ * The hand sweeps 400px to each side twice a second, and the mouse reports every millisecond.
+ */
+const double SWEEP_AMPLITUDE = 400.0;
+const double SWEEP_FREQUENCY = 2.0;
+const int64_t SAMPLE_INTERVAL = 1000;
+const int64_t TRACE_DURATION = 2000000;
+const double US_PER_SECOND = 1000000.0;
+const double TWO_PI = 2.0 * M_PI;
+
+/**
+ * The latency from the mouse move to the injected touch.
+ */
+const int64_t PIPELINE_LATENCY = 12000;
+
+double GetHandPosition(int64_t time)
+{
+    return SWEEP_AMPLITUDE * std::sin(TWO_PI * SWEEP_FREQUENCY * time / US_PER_SECOND);
+}
+
+double GetHandSpeed(int64_t time)
+{
+    return std::abs(SWEEP_AMPLITUDE * TWO_PI * SWEEP_FREQUENCY / US_PER_SECOND *
+        std::cos(TWO_PI * SWEEP_FREQUENCY * time / US_PER_SECOND));
+}
+}
+
+/**
+ * Replay the sweeps and compare the injected touch with the hand when the touch is injected.
+ * The effective latency is the distance between them divided by the speed of the hand.
+ * arg 0: 0 injects the positions of the mouse, 1 injects the predicted positions
+ */
+static void BM_MotionPrediction_Replay(benchmark::State &state)
+{
+    double totalError = 0.0;
+    double totalSpeed = 0.0;
+    for (auto _: state) {
+        TouchMotionPredictor predictor;
+        predictor.SetEnabled(state.range(0) != 0);
+        for (int64_t time = 0; time < TRACE_DURATION; time += SAMPLE_INTERVAL) {
+            double x = std::round(GetHandPosition(time));
+            double y = 0.0;
+            if (predictor.IsEnabled()) {
+                predictor.AddSample(x, y, time);
+                predictor.Predict(x, y);
+                predictor.UpdateLatency(PIPELINE_LATENCY);
+            }
+            benchmark::DoNotOptimize(x);
+            int64_t injectTime = time + PIPELINE_LATENCY;
+            totalError += std::abs(GetHandPosition(injectTime) - x);
+            totalSpeed += GetHandSpeed(injectTime);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (TRACE_DURATION / SAMPLE_INTERVAL));
+    state.counters["pipeline_latency_us"] = static_cast<double>(PIPELINE_LATENCY);
+    state.counters["effective_latency_us"] = totalSpeed > 0.0 ? totalError / totalSpeed : 0.0;
+}
+BENCHMARK(BM_MotionPrediction_Replay)->Arg(0)->Arg(1);
+}
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "plugin_input_channel.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const std::string BUNDLE_NAME = "com.test.game";
+
+/**
+ * Keeps the CPUs busy while the events are injected.
+ */
+class CpuLoad {
+public:
+    explicit CpuLoad(int64_t threadCount)
+    {
+        for (int64_t idx = 0; idx < threadCount; idx++) {
+            threads_.emplace_back([this] {
+                while (!isStopped_.load(std::memory_order_relaxed)) {
+                    benchmark::DoNotOptimize(counter_++);
+                }
+            });
+        }
+    }
+
+    ~CpuLoad()
+    {
+        isStopped_.store(true);
+        for (auto &thread: threads_) {
+            thread.join();
+        }
+    }
+
+private:
+    std::atomic<bool> isStopped_{false};
+    uint64_t counter_{0};
+    std::vector<std::thread> threads_;
+};
+
+int64_t GetLoadThreadCount()
+{
+    return static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+/**
+ * The time from sending the events until the handler gets the last one.
+ */
+class DeliveryClock {
+public:
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void OnDelivered()
+    {
+        deliveredTime_.store(Now(), std::memory_order_relaxed);
+        deliveredCount_.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * Wait until count events are delivered since the last call.
+     * @return the time when the last one is delivered
+     */
+    int64_t WaitDelivered(int64_t count)
+    {
+        expectedCount_ += count;
+        while (deliveredCount_.load(std::memory_order_acquire) < expectedCount_) {
+            std::this_thread::yield();
+        }
+        return deliveredTime_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> deliveredTime_{0};
+    std::atomic<int64_t> deliveredCount_{0};
+    int64_t expectedCount_{0};
+};
+
+const int64_t NS_PER_SECOND = 1000000000;
+
+/**
+ * The number of the pointer events of a touch move burst.
+ */
+const int64_t BURST_SIZE = 16;
+}
+
+/**
+ * The plugin input channel: the events are written into the slots and delivered on the user-interactive queue.
+ * arg 0: the number of the busy threads, arg 1: the number of the events sent at once
+ */
+static void BM_PluginInput_Channel(benchmark::State &state)
+{
+    DeliveryClock clock;
+    PluginInputChannel channel("plugin-input-benchmark", PLUGIN_INPUT_CHANNEL_CAPACITY,
+                               [&clock](const PluginInputEvent &) {
+                                   clock.OnDelivered();
+                               });
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+    CpuLoad load(state.range(0));
+    for (auto _: state) {
+        int64_t sendTime = DeliveryClock::Now();
+        for (int64_t idx = 0; idx < state.range(1); idx++) {
+            channel.Send(BUNDLE_NAME, pointerEvent, true);
+        }
+        int64_t deliveredTime = clock.WaitDelivered(state.range(1));
+        state.SetIterationTime(static_cast<double>(deliveredTime - sendTime) / NS_PER_SECOND);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_PluginInput_Channel)->ArgsProduct({{0, GetLoadThreadCount()}, {1, BURST_SIZE}})->UseManualTime();
+
+/**
+ * The previous path: one task per event on the background queue shared with the window operations.
+ */
+static void BM_PluginInput_BackgroundQueue(benchmark::State &state)
+{
+    DeliveryClock clock;
+    ffrt::queue callbackQueue("plugin-callback-benchmark", ffrt::queue_attr().qos(ffrt::qos_background));
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+    std::string bundleName = BUNDLE_NAME;
+    CpuLoad load(state.range(0));
+    for (auto _: state) {
+        int64_t sendTime = DeliveryClock::Now();
+        for (int64_t idx = 0; idx < state.range(1); idx++) {
+            callbackQueue.submit([bundleName, pointerEvent, &clock] {
+                benchmark::DoNotOptimize(bundleName.data());
+                clock.OnDelivered();
+            });
+        }
+        int64_t deliveredTime = clock.WaitDelivered(state.range(1));
+        state.SetIterationTime(static_cast<double>(deliveredTime - sendTime) / NS_PER_SECOND);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_PluginInput_BackgroundQueue)->ArgsProduct({{0, GetLoadThreadCount()}, {1, BURST_SIZE}})
+    ->UseManualTime();
+}
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "device_manager.h"
+#include "game_support_key_mapping_manager.h"
+#include "key_mapping_config_manager.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+/**
+ * The benchmark threads simulate the binder threads of the service reading the configurations.
+ */
+const int32_t MIN_BINDER_THREADS = 2;
+const int32_t MAX_BINDER_THREADS = 8;
+const int32_t WRITER_THREAD_INDEX = 0;
+const int32_t GAME_COUNT = 200;
+const int32_t DEVICE_COUNT = 100;
+const int32_t KEY_MAPPING_SIZE = 20;
+const int32_t VENDOR_BASE = 9000;
+const int32_t PRODUCT_BASE = 30000;
+const char* BUNDLE_NAME = "com.test.benchmark";
+
+GameKeyMappingInfo BuildCustomKeyMappingInfo(int32_t xValue)
+{
+    GameKeyMappingInfo info;
+    info.bundleName = BUNDLE_NAME;
+    info.isOprDelete = false;
+    info.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    for (int32_t idx = 0; idx < KEY_MAPPING_SIZE; idx++) {
+        KeyToTouchMappingInfo keyMapping;
+        keyMapping.keyCode = idx;
+        keyMapping.xValue = xValue;
+        keyMapping.yValue = idx;
+        keyMapping.mappingType = MappingTypeEnum::SINGE_KEY_TO_TOUCH;
+        info.customKeyToTouchMappings.push_back(keyMapping);
+    }
+    return info;
+}
+
+std::vector<GameInfo> BuildGameInfos()
+{
+    std::vector<GameInfo> gameInfos;
+    for (int32_t idx = 0; idx < GAME_COUNT; idx++) {
+        GameInfo gameInfo;
+        gameInfo.bundleName = std::string(BUNDLE_NAME) + std::to_string(idx);
+        gameInfo.version = "1.0." + std::to_string(idx);
+        gameInfo.isSupportKeyMapping = true;
+        gameInfo.supportedDeviceTypes = {DeviceTypeEnum::GAME_KEY_BOARD, DeviceTypeEnum::HOVER_TOUCH_PAD};
+        gameInfos.push_back(gameInfo);
+    }
+    return gameInfos;
+}
+
+std::vector<IdentifiedDeviceInfo> BuildIdentifiedDeviceInfos()
+{
+    std::vector<IdentifiedDeviceInfo> deviceInfos;
+    for (int32_t idx = 0; idx < DEVICE_COUNT; idx++) {
+        IdentifiedDeviceInfo deviceInfo;
+        deviceInfo.deviceType = DeviceTypeEnum::GAME_PAD;
+        deviceInfo.vendor = VENDOR_BASE + idx;
+        deviceInfo.product = PRODUCT_BASE + idx;
+        deviceInfo.name = "benchmark gamepad " + std::to_string(idx);
+        deviceInfos.push_back(deviceInfo);
+    }
+    return deviceInfos;
+}
+
+DeviceInfo BuildDeviceInfo()
+{
+    DeviceInfo deviceInfo;
+    deviceInfo.name = "unknown device";
+    deviceInfo.vendor = VENDOR_BASE + DEVICE_COUNT - 1;
+    deviceInfo.product = PRODUCT_BASE + DEVICE_COUNT - 1;
+    return deviceInfo;
+}
+
+/**
+ * Every benchmark thread runs the same number of iterations, so the writer runs on its own thread
+ * instead of one of the benchmark threads. Otherwise the readers would be paced by the disk writes.
+ * It's started and stopped by the thread 0 around the measured loop.
+ */
+template<typename ReadFunc, typename WriteFunc>
+void RunContention(benchmark::State &state, bool isMixed, ReadFunc readFunc, WriteFunc writeFunc)
+{
+    static std::atomic<bool> isWriterRunning{false};
+    static std::atomic<int64_t> writeCount{0};
+    static std::thread writer;
+    bool isWriterOwner = isMixed && state.thread_index() == WRITER_THREAD_INDEX;
+    if (isWriterOwner) {
+        writeCount = 0;
+        isWriterRunning = true;
+        writer = std::thread([writeFunc]() mutable {
+            while (isWriterRunning) {
+                writeFunc(writeCount.fetch_add(1));
+            }
+        });
+    }
+    for (auto _: state) {
+        readFunc();
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (isWriterOwner) {
+        isWriterRunning = false;
+        writer.join();
+        state.counters["writes"] = benchmark::Counter(static_cast<double>(writeCount), benchmark::Counter::kIsRate);
+    }
+}
+
+void GameKeyMappingConfigContention(benchmark::State &state, bool isMixed)
+{
+    std::shared_ptr<KeyMappingConfigManager> manager = DelayedSingleton<KeyMappingConfigManager>::GetInstance();
+    if (state.thread_index() == WRITER_THREAD_INDEX) {
+        manager->SetCustomGameKeyMappingConfig(BuildCustomKeyMappingInfo(0));
+    }
+    GetGameKeyMappingInfoParam param;
+    param.bundleName = BUNDLE_NAME;
+    param.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    RunContention(state, isMixed, [&manager, &param]() {
+        GameKeyMappingInfo gameKeyMappingInfo;
+        manager->GetGameKeyMappingConfig(param, gameKeyMappingInfo);
+        benchmark::DoNotOptimize(gameKeyMappingInfo.customKeyToTouchMappings.data());
+    }, [&manager](int64_t count) {
+        manager->SetCustomGameKeyMappingConfig(BuildCustomKeyMappingInfo(static_cast<int32_t>(count)));
+    });
+}
+
+void SupportKeyMappingContention(benchmark::State &state, bool isMixed)
+{
+    std::shared_ptr<GameSupportKeyMappingManager> manager =
+        DelayedSingleton<GameSupportKeyMappingManager>::GetInstance();
+    std::vector<GameInfo> gameInfos = BuildGameInfos();
+    if (state.thread_index() == WRITER_THREAD_INDEX) {
+        manager->SyncSupportKeyMappingGames(true, gameInfos);
+    }
+    GameInfo gameInfo;
+    gameInfo.bundleName = gameInfos.back().bundleName;
+    RunContention(state, isMixed, [&manager, &gameInfo]() {
+        GameInfo result;
+        manager->IsSupportGameKeyMapping(gameInfo, result);
+        benchmark::DoNotOptimize(result.isSupportKeyMapping);
+    }, [&manager, &gameInfos](int64_t count) {
+        gameInfos.front().version = std::to_string(count);
+        manager->SyncSupportKeyMappingGames(true, gameInfos);
+    });
+}
+
+void DeviceIdentifyContention(benchmark::State &state, bool isMixed)
+{
+    std::shared_ptr<DeviceManager> manager = DelayedSingleton<DeviceManager>::GetInstance();
+    std::vector<IdentifiedDeviceInfo> identifiedDeviceInfos = BuildIdentifiedDeviceInfos();
+    if (state.thread_index() == WRITER_THREAD_INDEX) {
+        manager->SyncIdentifiedDeviceInfos(identifiedDeviceInfos);
+    }
+    std::vector<DeviceInfo> deviceInfos = {BuildDeviceInfo()};
+    RunContention(state, isMixed, [&manager, &deviceInfos]() {
+        std::vector<DeviceInfo> result;
+        manager->DeviceIdentify(deviceInfos, result);
+        benchmark::DoNotOptimize(result.data());
+    }, [&manager, &identifiedDeviceInfos](int64_t count) {
+        identifiedDeviceInfos.front().name = "benchmark gamepad " + std::to_string(count);
+        manager->SyncIdentifiedDeviceInfos(identifiedDeviceInfos);
+    });
+}
+}
+
+static void BM_GetGameKeyMappingConfig_ReadOnly(benchmark::State &state)
+{
+    GameKeyMappingConfigContention(state, false);
+}
+BENCHMARK(BM_GetGameKeyMappingConfig_ReadOnly)->ThreadRange(MIN_BINDER_THREADS, MAX_BINDER_THREADS)->UseRealTime();
+
+static void BM_GetGameKeyMappingConfig_Mixed(benchmark::State &state)
+{
+    GameKeyMappingConfigContention(state, true);
+}
+BENCHMARK(BM_GetGameKeyMappingConfig_Mixed)->ThreadRange(MIN_BINDER_THREADS, MAX_BINDER_THREADS)->UseRealTime();
+
+static void BM_IsSupportGameKeyMapping_ReadOnly(benchmark::State &state)
+{
+    SupportKeyMappingContention(state, false);
+}
+BENCHMARK(BM_IsSupportGameKeyMapping_ReadOnly)->ThreadRange(MIN_BINDER_THREADS, MAX_BINDER_THREADS)->UseRealTime();
+
+static void BM_IsSupportGameKeyMapping_Mixed(benchmark::State &state)
+{
+    SupportKeyMappingContention(state, true);
+}
+BENCHMARK(BM_IsSupportGameKeyMapping_Mixed)->ThreadRange(MIN_BINDER_THREADS, MAX_BINDER_THREADS)->UseRealTime();
+
+static void BM_DeviceIdentify_ReadOnly(benchmark::State &state)
+{
+    DeviceIdentifyContention(state, false);
+}
+BENCHMARK(BM_DeviceIdentify_ReadOnly)->ThreadRange(MIN_BINDER_THREADS, MAX_BINDER_THREADS)->UseRealTime();
+
+static void BM_DeviceIdentify_Mixed(benchmark::State &state)
+{
+    DeviceIdentifyContention(state, true);
+}
+BENCHMARK(BM_DeviceIdentify_Mixed)->ThreadRange(MIN_BINDER_THREADS, MAX_BINDER_THREADS)->UseRealTime();
+}
+}
+
+BENCHMARK_MAIN();
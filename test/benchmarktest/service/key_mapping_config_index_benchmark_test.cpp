@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "json_utils.h"
+#include "key_mapping_config_index.h"
+#include "key_mapping_config_manager.h"
+#include "key_mapping_config_store.h"
+
+namespace OHOS {
+namespace GameController {
+namespace {
+/**
+ * The index is filled with BUNDLE_COUNT bundles, and every bundle has a keyboard and a hover touch pad template.
+ */
+const int32_t BUNDLE_COUNT = 2000;
+const int32_t KEY_MAPPING_SIZE = 20;
+const char* BUNDLE_NAME = "com.test.benchmark";
+const std::string STORE_FILE = GAME_CONTROLLER_SERVICE_ROOT + "key_mapping_config_benchmark.json";
+
+std::string GetBundleName(int32_t idx)
+{
+    return std::string(BUNDLE_NAME) + std::to_string(idx);
+}
+
+KeyMappingInfoConfig BuildConfig(const std::string &bundleName, int32_t deviceType)
+{
+    KeyMappingInfoConfig config;
+    config.bundleName = bundleName;
+    config.deviceType = deviceType;
+    for (int32_t idx = 0; idx < KEY_MAPPING_SIZE; idx++) {
+        KeyMapping keyMapping;
+        keyMapping.keyCode = idx;
+        keyMapping.xValue = idx;
+        keyMapping.yValue = idx;
+        keyMapping.mappingType = MappingTypeEnum::SINGE_KEY_TO_TOUCH;
+        config.customKeyMappings.push_back(keyMapping);
+    }
+    return config;
+}
+
+KeyMappingConfigLocation BuildLocation(int32_t idx)
+{
+    KeyMappingConfigLocation location;
+    location.offset = static_cast<uint32_t>(idx);
+    location.length = 1;
+    return location;
+}
+
+KeyMappingConfigIndex BuildIndex()
+{
+    KeyMappingConfigIndex index;
+    for (int32_t idx = 0; idx < BUNDLE_COUNT; idx++) {
+        std::string bundleName = GetBundleName(idx);
+        index.Set(bundleName, DeviceTypeEnum::GAME_KEY_BOARD, BuildLocation(idx));
+        index.Set(bundleName, DeviceTypeEnum::HOVER_TOUCH_PAD, BuildLocation(idx));
+    }
+    return index;
+}
+
+/**
+ * Write the configuration file of all the bundles, the same as the custom configuration file.
+ */
+void WriteStoreFile()
+{
+    nlohmann::json content = nlohmann::json::array();
+    for (int32_t idx = 0; idx < BUNDLE_COUNT; idx++) {
+        std::string bundleName = GetBundleName(idx);
+        content.push_back(BuildConfig(bundleName, DeviceTypeEnum::GAME_KEY_BOARD).ConvertToJson(true));
+        content.push_back(BuildConfig(bundleName, DeviceTypeEnum::HOVER_TOUCH_PAD).ConvertToJson(true));
+    }
+    std::ofstream file(STORE_FILE);
+    file << content;
+}
+}
+
+static void BM_KeyMappingConfigIndex_Find(benchmark::State &state)
+{
+    KeyMappingConfigIndex index = BuildIndex();
+    std::string bundleName = GetBundleName(BUNDLE_COUNT - 1);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(index.Find(bundleName, DeviceTypeEnum::GAME_KEY_BOARD));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigIndex_Find);
+
+/**
+ * The writer path: take the bundle, replace one device type and put the bundle back.
+ */
+static void BM_KeyMappingConfigIndex_SetBundle(benchmark::State &state)
+{
+    KeyMappingConfigIndex index = BuildIndex();
+    std::string bundleName = GetBundleName(BUNDLE_COUNT - 1);
+    KeyMappingConfigLocation location = BuildLocation(BUNDLE_COUNT);
+    for (auto _: state) {
+        BundleKeyMappingLocations locations = index.GetBundle(bundleName);
+        locations[DeviceTypeEnum::GAME_KEY_BOARD] = location;
+        index.SetBundle(bundleName, locations);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigIndex_SetBundle);
+
+/**
+ * Delete a bundle and add it back, so every iteration deletes from a full index.
+ */
+static void BM_KeyMappingConfigIndex_EraseBundle(benchmark::State &state)
+{
+    KeyMappingConfigIndex index = BuildIndex();
+    std::string bundleName = GetBundleName(BUNDLE_COUNT - 1);
+    BundleKeyMappingLocations locations = index.GetBundle(bundleName);
+    for (auto _: state) {
+        index.EraseBundle(bundleName);
+        index.SetBundle(bundleName, locations);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigIndex_EraseBundle);
+
+/**
+ * The cold start: only the template locations are loaded.
+ */
+static void BM_KeyMappingConfigStore_Load(benchmark::State &state)
+{
+    WriteStoreFile();
+    KeyMappingConfigStore store(STORE_FILE, true);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(store.Load());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigStore_Load)->Unit(benchmark::kMillisecond);
+
+/**
+ * The same file fully decoded, as every template used to be at the start.
+ */
+static void BM_KeyMappingConfigStore_DecodeAll(benchmark::State &state)
+{
+    WriteStoreFile();
+    for (auto _: state) {
+        std::pair<bool, nlohmann::json> ret = JsonUtils::ReadJsonFromFile(STORE_FILE);
+        std::vector<KeyMappingInfoConfig> configs;
+        for (const auto &jsonObj: ret.second) {
+            configs.emplace_back(jsonObj, true);
+        }
+        benchmark::DoNotOptimize(configs.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigStore_DecodeAll)->Unit(benchmark::kMillisecond);
+
+/**
+ * The first request of a template: it's read from the file and decoded.
+ * The bundles are requested in turn, so the cache never holds the next one.
+ */
+static void BM_KeyMappingConfigStore_FindMiss(benchmark::State &state)
+{
+    WriteStoreFile();
+    KeyMappingConfigStore store(STORE_FILE, true);
+    store.Load();
+    std::vector<std::string> bundleNames;
+    for (int32_t idx = 0; idx < BUNDLE_COUNT; idx++) {
+        bundleNames.push_back(GetBundleName(idx));
+    }
+    size_t idx = 0;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(store.Find(bundleNames[idx], DeviceTypeEnum::GAME_KEY_BOARD));
+        idx = (idx + 1) % bundleNames.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigStore_FindMiss);
+
+static void BM_KeyMappingConfigStore_FindHit(benchmark::State &state)
+{
+    WriteStoreFile();
+    KeyMappingConfigStore store(STORE_FILE, true);
+    store.Load();
+    std::string bundleName = GetBundleName(BUNDLE_COUNT - 1);
+    store.Find(bundleName, DeviceTypeEnum::GAME_KEY_BOARD);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(store.Find(bundleName, DeviceTypeEnum::GAME_KEY_BOARD));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_KeyMappingConfigStore_FindHit);
+}
+}
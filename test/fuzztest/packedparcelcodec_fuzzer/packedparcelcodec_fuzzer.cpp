@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdint>
+#include <memory>
+#include <message_parcel.h>
+#include "packedparcelcodec_fuzzer.h"
+#include "gamecontroller_client_model.h"
+#include "gamecontroller_keymapping_model.h"
+#include "gamecontroller_packed_codec.h"
+
+namespace OHOS {
+namespace GameController {
+void UnmarshallingPackedBlock(const uint8_t* rawData, size_t size)
+{
+    MessageParcel keyMappingParcel;
+    keyMappingParcel.WriteBuffer(rawData, size);
+    std::unique_ptr<GameKeyMappingInfo> gameKeyMappingInfo(GameKeyMappingInfo::Unmarshalling(keyMappingParcel));
+
+    MessageParcel deviceParcel;
+    deviceParcel.WriteBuffer(rawData, size);
+    std::unique_ptr<DeviceInfo> deviceInfo(DeviceInfo::Unmarshalling(deviceParcel));
+
+    // Put a valid header in front so that the record and string table checks are reached.
+    PackedBlockHeader header;
+    header.kind = (size % PACKED_KIND_DEVICE_INFO) == 0 ? PACKED_KIND_DEVICE_INFO : PACKED_KIND_KEY_MAPPING;
+    header.recordSize = header.kind == PACKED_KIND_DEVICE_INFO ? sizeof(PackedDeviceRecord)
+                                                                : sizeof(PackedKeyMappingRecord);
+    header.recordCount = static_cast<uint32_t>(size / header.recordSize);
+    header.stringTableSize = static_cast<uint32_t>(size % header.recordSize);
+    MessageParcel blockParcel;
+    blockParcel.WriteBuffer(&header, sizeof(header));
+    blockParcel.WriteBuffer(rawData, size);
+    if (header.kind == PACKED_KIND_DEVICE_INFO) {
+        DeviceInfo info;
+        PackedParcelCodec::ReadDeviceInfo(blockParcel, info);
+    } else {
+        std::vector<KeyToTouchMappingInfo> customMappings;
+        std::vector<KeyToTouchMappingInfo> defaultMappings;
+        PackedParcelCodec::ReadKeyMappings(blockParcel, customMappings, defaultMappings);
+    }
+}
+}
+}
+
+/* Fuzzer entry point */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    /* Run your code on data */
+    OHOS::GameController::UnmarshallingPackedBlock(data, size);
+    return 0;
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_PACKED_PARCEL_CODEC_FUZZER_H
+#define GAME_CONTROLLER_PACKED_PARCEL_CODEC_FUZZER_H
+
+#define FUZZ_PROJECT_NAME "packedparcelcodec_fuzzer"
+
+#endif //GAME_CONTROLLER_PACKED_PARCEL_CODEC_FUZZER_H
\ No newline at end of file
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_SERVER_CLIENT_PROXY_MOCK_H
+#define GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_SERVER_CLIENT_PROXY_MOCK_H
+
+#include "gamecontroller_server_client_proxy.h"
+#include <gmock/gmock.h>
+
+namespace OHOS {
+namespace GameController {
+class GameControllerServerClientProxyMock : public GameControllerServerClientProxy {
+public:
+    MOCK_METHOD0(CheckSystemAbility, sptr<IRemoteObject>());
+    MOCK_METHOD1(LoadSystemAbility, int32_t(const sptr<GameControllerSaLoadCallback> &loadCallback));
+};
+}
+}
+#endif //GAME_CONTROLLER_FRAMEWORK_GAMECONTROLLER_SERVER_CLIENT_PROXY_MOCK_H
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+
+#define private public
+
+#include "gamecontroller_batched_channel.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const std::string QUEUE_NAME = "batched-channel-test";
+const size_t CAPACITY = 4;
+const size_t MAX_BATCH_SIZE = 2;
+const int32_t EVENT_COUNT = 10;
+const std::string LONG_NAME = "com.example.a.bundle.name.longer.than.the.small.string";
+}
+
+/**
+ * An event which keeps its name buffer in the slot, and drops its reference when it's released.
+ */
+struct TestEvent {
+    int32_t id{0};
+    std::string name;
+    std::shared_ptr<int32_t> reference{nullptr};
+
+    void Release()
+    {
+        reference = nullptr;
+    }
+};
+
+class GameControllerBatchedChannelTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        handleQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(QUEUE_NAME);
+    }
+
+public:
+    std::unique_ptr<GameControllerQueue> handleQueue_;
+};
+
+/**
+ * @tc.name: Emplace_001
+ * @tc.desc: The events written in place are handled in order, and the slots keep their buffers
+ * but drop the references after they are handled
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerBatchedChannelTest, Emplace_001, TestSize.Level0)
+{
+    std::vector<int32_t> ids;
+    BatchedChannel<TestEvent> channel(handleQueue_.get(), CAPACITY, [&ids](const TestEvent &event) {
+        ids.push_back(event.id);
+    });
+    std::shared_ptr<int32_t> reference = std::make_shared<int32_t>(0);
+    std::vector<int32_t> expectedIds;
+    for (int32_t idx = 0; idx < EVENT_COUNT; idx++) {
+        channel.Emplace([idx, &reference](TestEvent &slot) {
+            slot.id = idx;
+            slot.name = LONG_NAME;
+            slot.reference = reference;
+        });
+        expectedIds.push_back(idx);
+    }
+    channel.WaitIdle();
+    ASSERT_EQ(expectedIds, ids);
+    ASSERT_EQ(1, reference.use_count());
+    for (const auto &slot: channel.slots_) {
+        ASSERT_EQ(nullptr, slot.reference);
+        ASSERT_GE(slot.name.capacity(), LONG_NAME.size());
+    }
+}
+
+/**
+ * @tc.name: SetMaxBatchSize_001
+ * @tc.desc: The max batch size is unlimited by default, and 0 means the default of the channel
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerBatchedChannelTest, SetMaxBatchSize_001, TestSize.Level0)
+{
+    BatchedChannel<TestEvent> channel(handleQueue_.get(), CAPACITY, [](const TestEvent &) {});
+    ASSERT_EQ(BATCHED_CHANNEL_UNLIMITED_BATCH_SIZE, channel.GetMaxBatchSize());
+    BatchedChannel<TestEvent> limitedChannel(handleQueue_.get(), CAPACITY, [](const TestEvent &) {}, MAX_BATCH_SIZE);
+    ASSERT_EQ(MAX_BATCH_SIZE, limitedChannel.GetMaxBatchSize());
+    limitedChannel.SetMaxBatchSize(CAPACITY);
+    ASSERT_EQ(CAPACITY, limitedChannel.GetMaxBatchSize());
+    limitedChannel.SetMaxBatchSize(0);
+    ASSERT_EQ(MAX_BATCH_SIZE, limitedChannel.GetMaxBatchSize());
+}
+
+/**
+ * @tc.name: GetBucket_001
+ * @tc.desc: The batch sizes are counted in the buckets of the powers of 2, and the big ones in the last bucket
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerBatchedChannelTest, GetBucket_001, TestSize.Level0)
+{
+    ASSERT_EQ(0, BatchedChannelStats::GetBucket(1));
+    ASSERT_EQ(1, BatchedChannelStats::GetBucket(2));
+    ASSERT_EQ(2, BatchedChannelStats::GetBucket(3));
+    ASSERT_EQ(2, BatchedChannelStats::GetBucket(4));
+    ASSERT_EQ(3, BatchedChannelStats::GetBucket(5));
+    ASSERT_EQ(6, BatchedChannelStats::GetBucket(64));
+    ASSERT_EQ(BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT - 1, BatchedChannelStats::GetBucket(65));
+    ASSERT_EQ(BATCHED_CHANNEL_BATCH_SIZE_BUCKET_COUNT - 1, BatchedChannelStats::GetBucket(1000));
+}
+}
+}
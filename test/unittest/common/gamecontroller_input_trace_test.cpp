@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include "gamecontroller_keymapping_model.h"
+#include "gamecontroller_input_trace.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const char* TRACE_PATH = "/data/local/tmp/gamecontroller_input_trace_test.trace";
+const int32_t DEVICE_ID = 3;
+const int32_t KEY_CODE = 2017;
+const int32_t KEY_ACTION_DOWN = 2;
+const int32_t POINTER_ACTION_DOWN = 2;
+const int32_t POINTER_ACTION_MOVE = 3;
+const int32_t POINTER_ACTION_UP = 4;
+const int32_t POINTER_ID = 3;
+const int32_t WINDOW_ID = 10;
+const int32_t X_VALUE = 100;
+const int32_t Y_VALUE = 200;
+const int64_t ELAPSED_TIME = 1000;
+const int32_t COMBINATION_FIRST_KEY = 2072;
+const int32_t COMBINATION_LAST_KEY = 2017;
+const size_t TRUNCATED_SIZE = 4;
+const int32_t TAP_INTERVAL = 100;
+}
+
+class GameControllerInputTraceTest : public testing::Test {
+};
+
+static InputTraceRecord BuildTouchRecord(int32_t pointerAction, int32_t xValue)
+{
+    InputTraceTouchRecord touchRecord;
+    touchRecord.pointerAction = pointerAction;
+    touchRecord.pointerId = POINTER_ID;
+    touchRecord.windowId = WINDOW_ID;
+    touchRecord.touchItemCount = 1;
+    touchRecord.touchItems[0].pointerId = POINTER_ID;
+    touchRecord.touchItems[0].windowX = xValue;
+    touchRecord.touchItems[0].windowY = Y_VALUE;
+    InputTraceRecord record;
+    record.header.kind = INPUT_TRACE_TOUCH;
+    record.header.payloadSize = sizeof(touchRecord);
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(&touchRecord);
+    record.payload.assign(begin, begin + sizeof(touchRecord));
+    return record;
+}
+
+static std::vector<uint8_t> BuildTrace()
+{
+    InputTraceFileHeader fileHeader;
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(&fileHeader);
+    std::vector<uint8_t> buffer(begin, begin + sizeof(fileHeader));
+
+    KeyToTouchMappingInfo mappingInfo;
+    mappingInfo.keyCode = KEY_CODE;
+    mappingInfo.xValue = X_VALUE;
+    mappingInfo.yValue = Y_VALUE;
+    mappingInfo.mappingType = MappingTypeEnum::COMBINATION_KEY_TO_TOUCH;
+    mappingInfo.combinationKeys = {COMBINATION_FIRST_KEY, COMBINATION_LAST_KEY};
+    std::vector<uint8_t> templatePayload;
+    InputTraceCodec::BuildTemplatePayload(DeviceTypeEnum::GAME_KEY_BOARD, {mappingInfo}, templatePayload);
+    InputTraceRecordHeader templateHeader;
+    templateHeader.kind = INPUT_TRACE_TEMPLATE;
+    InputTraceCodec::AppendRecord(buffer, templateHeader, templatePayload.data(),
+                                  static_cast<uint32_t>(templatePayload.size()));
+
+    InputTraceKeyRecord keyRecord;
+    keyRecord.deviceId = DEVICE_ID;
+    keyRecord.keyCode = KEY_CODE;
+    keyRecord.keyAction = KEY_ACTION_DOWN;
+    InputTraceRecordHeader keyHeader;
+    keyHeader.kind = INPUT_TRACE_KEY;
+    keyHeader.flags = INPUT_TRACE_FLAG_DISPATCHED;
+    keyHeader.elapsedTime = ELAPSED_TIME;
+    InputTraceCodec::AppendRecord(buffer, keyHeader, &keyRecord, sizeof(keyRecord));
+
+    InputTraceRecord touch = BuildTouchRecord(POINTER_ACTION_DOWN, X_VALUE);
+    InputTraceCodec::AppendRecord(buffer, touch.header, touch.payload.data(),
+                                  static_cast<uint32_t>(touch.payload.size()));
+    return buffer;
+}
+
+/**
+* @tc.name: Parse_001
+* @tc.desc: the records appended to a trace can be decoded in order
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerInputTraceTest, Parse_001, TestSize.Level0)
+{
+    std::vector<uint8_t> buffer = BuildTrace();
+    InputTraceFileHeader fileHeader;
+    std::vector<InputTraceRecord> records;
+    ASSERT_TRUE(InputTraceCodec::Parse(buffer.data(), buffer.size(), fileHeader, records));
+    ASSERT_EQ(records.size(), 3);
+    ASSERT_EQ(records[0].header.kind, INPUT_TRACE_TEMPLATE);
+    ASSERT_EQ(records[1].header.kind, INPUT_TRACE_KEY);
+    ASSERT_EQ(records[1].header.flags, INPUT_TRACE_FLAG_DISPATCHED);
+    ASSERT_EQ(records[1].header.elapsedTime, ELAPSED_TIME);
+    ASSERT_EQ(records[2].header.kind, INPUT_TRACE_TOUCH);
+
+    int32_t deviceType = 0;
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    ASSERT_TRUE(InputTraceCodec::ParseTemplatePayload(records[0].payload, deviceType, mappingInfos));
+    ASSERT_EQ(deviceType, DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_EQ(mappingInfos.size(), 1);
+    ASSERT_EQ(mappingInfos[0].keyCode, KEY_CODE);
+    ASSERT_EQ(mappingInfos[0].xValue, X_VALUE);
+    ASSERT_EQ(mappingInfos[0].combinationKeys.size(), MAX_COMBINATION_KEYS);
+
+    InputTraceKeyRecord keyRecord;
+    ASSERT_EQ(records[1].payload.size(), sizeof(keyRecord));
+    memcpy(&keyRecord, records[1].payload.data(), sizeof(keyRecord));
+    ASSERT_EQ(keyRecord.deviceId, DEVICE_ID);
+    ASSERT_EQ(keyRecord.keyCode, KEY_CODE);
+}
+
+/**
+* @tc.name: Parse_002
+* @tc.desc: the trace with invalid header or truncated record is rejected
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerInputTraceTest, Parse_002, TestSize.Level0)
+{
+    std::vector<uint8_t> buffer = BuildTrace();
+    InputTraceFileHeader fileHeader;
+    std::vector<InputTraceRecord> records;
+    ASSERT_FALSE(InputTraceCodec::Parse(buffer.data(), buffer.size() - TRUNCATED_SIZE, fileHeader, records));
+
+    std::vector<uint8_t> invalidMagic = buffer;
+    invalidMagic[0] = 0;
+    records.clear();
+    ASSERT_FALSE(InputTraceCodec::Parse(invalidMagic.data(), invalidMagic.size(), fileHeader, records));
+
+    std::vector<uint8_t> invalidPayload = buffer;
+    InputTraceRecordHeader header;
+    memcpy(&header, invalidPayload.data() + sizeof(InputTraceFileHeader), sizeof(header));
+    header.payloadSize = MAX_INPUT_TRACE_PAYLOAD_SIZE + 1;
+    memcpy(invalidPayload.data() + sizeof(InputTraceFileHeader), &header, sizeof(header));
+    records.clear();
+    ASSERT_FALSE(InputTraceCodec::Parse(invalidPayload.data(), invalidPayload.size(), fileHeader, records));
+}
+
+/**
+* @tc.name: ParseTemplatePayload_001
+* @tc.desc: the template captured with the records of the first layout can still be parsed,
+*           and the payload which isn't made of whole records is rejected
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerInputTraceTest, ParseTemplatePayload_001, TestSize.Level0)
+{
+    KeyToTouchMappingInfo mappingInfo;
+    mappingInfo.keyCode = KEY_CODE;
+    mappingInfo.xValue = X_VALUE;
+    mappingInfo.tapInterval = TAP_INTERVAL;
+    std::vector<uint8_t> payload;
+    InputTraceCodec::BuildTemplatePayload(DeviceTypeEnum::GAME_KEY_BOARD, {mappingInfo, mappingInfo}, payload);
+
+    int32_t deviceType = 0;
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    ASSERT_TRUE(InputTraceCodec::ParseTemplatePayload(payload, deviceType, mappingInfos));
+    ASSERT_EQ(mappingInfos.size(), 2);
+    ASSERT_EQ(mappingInfos[1].tapInterval, TAP_INTERVAL);
+
+    // drop the tap fields of every record
+    std::vector<uint8_t> legacyPayload(payload.begin(), payload.begin() + sizeof(InputTraceTemplateRecord));
+    for (size_t idx = 0; idx < mappingInfos.size(); idx++) {
+        auto begin = payload.begin() + sizeof(InputTraceTemplateRecord) + idx * sizeof(PackedKeyMappingRecord);
+        legacyPayload.insert(legacyPayload.end(), begin, begin + PACKED_KEY_MAPPING_RECORD_MIN_SIZE);
+    }
+    mappingInfos.clear();
+    ASSERT_TRUE(InputTraceCodec::ParseTemplatePayload(legacyPayload, deviceType, mappingInfos));
+    ASSERT_EQ(mappingInfos.size(), 2);
+    ASSERT_EQ(mappingInfos[1].keyCode, KEY_CODE);
+    ASSERT_EQ(mappingInfos[1].xValue, X_VALUE);
+    ASSERT_EQ(mappingInfos[1].tapInterval, 0);
+
+    legacyPayload.pop_back();
+    mappingInfos.clear();
+    ASSERT_FALSE(InputTraceCodec::ParseTemplatePayload(legacyPayload, deviceType, mappingInfos));
+}
+
+/**
+* @tc.name: CompareTouchStream_001
+* @tc.desc: the touch streams are the same when only the keep-alive moves and the non-touch records differ
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerInputTraceTest, CompareTouchStream_001, TestSize.Level0)
+{
+    std::vector<InputTraceRecord> expected;
+    expected.push_back(BuildTouchRecord(POINTER_ACTION_DOWN, X_VALUE));
+    expected.push_back(BuildTouchRecord(POINTER_ACTION_MOVE, X_VALUE + 1));
+    expected.push_back(BuildTouchRecord(POINTER_ACTION_MOVE, X_VALUE + 1));
+    expected.push_back(BuildTouchRecord(POINTER_ACTION_UP, X_VALUE + 1));
+
+    std::vector<InputTraceRecord> actual;
+    InputTraceRecord keyRecord;
+    keyRecord.header.kind = INPUT_TRACE_KEY;
+    actual.push_back(keyRecord);
+    actual.push_back(BuildTouchRecord(POINTER_ACTION_DOWN, X_VALUE));
+    actual.push_back(BuildTouchRecord(POINTER_ACTION_MOVE, X_VALUE + 1));
+    actual.push_back(BuildTouchRecord(POINTER_ACTION_UP, X_VALUE + 1));
+    actual[1].header.elapsedTime = ELAPSED_TIME;
+
+    InputTraceCompareResult result = InputTraceCodec::CompareTouchStream(expected, actual);
+    ASSERT_TRUE(result.isSame);
+    ASSERT_EQ(result.expectedCount, 3);
+    ASSERT_EQ(result.actualCount, 3);
+}
+
+/**
+* @tc.name: CompareTouchStream_002
+* @tc.desc: the first different touch and the missing up are reported
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerInputTraceTest, CompareTouchStream_002, TestSize.Level0)
+{
+    std::vector<InputTraceRecord> expected;
+    expected.push_back(BuildTouchRecord(POINTER_ACTION_DOWN, X_VALUE));
+    expected.push_back(BuildTouchRecord(POINTER_ACTION_UP, X_VALUE));
+
+    std::vector<InputTraceRecord> moved;
+    moved.push_back(BuildTouchRecord(POINTER_ACTION_DOWN, X_VALUE + 1));
+    moved.push_back(BuildTouchRecord(POINTER_ACTION_UP, X_VALUE));
+    InputTraceCompareResult result = InputTraceCodec::CompareTouchStream(expected, moved);
+    ASSERT_FALSE(result.isSame);
+    ASSERT_EQ(result.firstMismatchIndex, 0);
+
+    std::vector<InputTraceRecord> stuckDown;
+    stuckDown.push_back(BuildTouchRecord(POINTER_ACTION_DOWN, X_VALUE));
+    result = InputTraceCodec::CompareTouchStream(expected, stuckDown);
+    ASSERT_FALSE(result.isSame);
+    ASSERT_EQ(result.firstMismatchIndex, 1);
+    ASSERT_EQ(result.actualCount, 1);
+}
+
+/**
+* @tc.name: InputTraceWriter_001
+* @tc.desc: the trace written by InputTraceWriter can be read back
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerInputTraceTest, InputTraceWriter_001, TestSize.Level0)
+{
+    std::vector<uint8_t> buffer = BuildTrace();
+    InputTraceFileHeader fileHeader;
+    fileHeader.startRealTime = ELAPSED_TIME;
+    std::vector<uint8_t> records(buffer.begin() + sizeof(InputTraceFileHeader), buffer.end());
+    InputTraceWriter writer;
+    ASSERT_TRUE(writer.Open(TRACE_PATH, fileHeader));
+    ASSERT_TRUE(writer.Write(records));
+    writer.Close();
+    ASSERT_FALSE(writer.IsOpen());
+
+    InputTraceFileHeader readHeader;
+    std::vector<InputTraceRecord> readRecords;
+    ASSERT_TRUE(InputTraceCodec::ReadFile(TRACE_PATH, readHeader, readRecords));
+    ASSERT_EQ(readHeader.startRealTime, ELAPSED_TIME);
+    ASSERT_EQ(readRecords.size(), 3);
+    (void)remove(TRACE_PATH);
+}
+}
+}
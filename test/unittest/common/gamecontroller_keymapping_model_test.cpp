@@ -40,6 +40,8 @@ const int32_t KEYBOARD_OBSERVATION_LEFT = 2017;
 const int32_t KEYBOARD_OBSERVATION_RIGHT = 2020;
 const size_t MAX_SINGLE_KEY_SIZE_FOR_HOVER_TOUCH_PAD = 2;
 const int32_t MAX_DELAY_TIME = 5;
+const int32_t TAP_INTERVAL = 100;
+const int32_t TAP_DUTY_CYCLE = 30;
 }
 
 class GameControllerKeymappingModeTest : public testing::Test {
@@ -559,6 +561,102 @@ HWTEST_F(GameControllerKeymappingModeTest, GameKeyMappingInfo_CheckKeyMapping_00
     ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos));
 }
 
+/**
+* @tc.name: GameKeyMappingInfo_CheckKeyMapping_008
+* @tc.desc: tapInterval and tapDutyCycle must be 0 or in the range for the fire and click mappings,
+*           and they are reset for the other mappings
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerKeymappingModeTest, GameKeyMappingInfo_CheckKeyMapping_008, TestSize.Level0)
+{
+    GameKeyMappingInfo config;
+    std::vector<KeyToTouchMappingInfo> testKeyMappingInfos;
+    KeyToTouchMappingInfo info = BuildKeyMapping(MOUSE_LEFT_FIRE_TO_TOUCH);
+    info.tapInterval = TAP_INTERVAL;
+    info.tapDutyCycle = TAP_DUTY_CYCLE;
+    testKeyMappingInfos.push_back(info);
+    ASSERT_TRUE(config.CheckKeyMapping(testKeyMappingInfos));
+    ASSERT_EQ(TAP_INTERVAL, testKeyMappingInfos[0].tapInterval);
+    ASSERT_EQ(TAP_DUTY_CYCLE, testKeyMappingInfos[0].tapDutyCycle);
+
+    info.tapInterval = MIN_TAP_INTERVAL - 1;
+    testKeyMappingInfos.clear();
+    testKeyMappingInfos.push_back(info);
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos));
+
+    info = BuildKeyMapping(MOUSE_RIGHT_KEY_CLICK_TO_TOUCH);
+    info.tapInterval = MAX_TAP_INTERVAL;
+    info.tapDutyCycle = MAX_TAP_DUTY_CYCLE + 1;
+    testKeyMappingInfos.clear();
+    testKeyMappingInfos.push_back(info);
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos));
+
+    info = BuildKeyMapping(SINGE_KEY_TO_TOUCH);
+    info.tapInterval = TAP_INTERVAL;
+    info.tapDutyCycle = TAP_DUTY_CYCLE;
+    testKeyMappingInfos.clear();
+    testKeyMappingInfos.push_back(info);
+    ASSERT_TRUE(config.CheckKeyMapping(testKeyMappingInfos));
+    ASSERT_EQ(0, testKeyMappingInfos[0].tapInterval);
+    ASSERT_EQ(0, testKeyMappingInfos[0].tapDutyCycle);
+}
+
+/**
+* @tc.name: GameKeyMappingInfo_CheckKeyMapping_009
+* @tc.desc: the axis mappings are only supported by GAME_PAD, each axis is mapped once,
+*           and the dead zone must be in the range. GAME_PAD still accepts the other key mappings
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerKeymappingModeTest, GameKeyMappingInfo_CheckKeyMapping_009, TestSize.Level0)
+{
+    GameKeyMappingInfo config;
+    std::vector<KeyToTouchMappingInfo> testKeyMappingInfos;
+    KeyToTouchMappingInfo stick = BuildKeyMapping(GAMEPAD_STICK_TO_TOUCH);
+    stick.keyCode = GamePadAxisSourceTypeEnum::LeftThumbstick;
+    stick.radius = 1;
+    stick.deadZone = MAX_AXIS_DEAD_ZONE;
+    KeyToTouchMappingInfo trigger = BuildKeyMapping(GAMEPAD_TRIGGER_TO_TOUCH);
+    trigger.keyCode = GamePadAxisSourceTypeEnum::RightTriggerAxis;
+    trigger.radius = 1;
+    testKeyMappingInfos.push_back(stick);
+    testKeyMappingInfos.push_back(trigger);
+    testKeyMappingInfos.push_back(BuildKeyMapping(DPAD_UP, 0, 0));
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos));
+    ASSERT_TRUE(config.CheckKeyMapping(testKeyMappingInfos, true));
+    ASSERT_EQ(MAX_AXIS_DEAD_ZONE, testKeyMappingInfos[0].deadZone);
+    ASSERT_EQ(0, testKeyMappingInfos[1].radius);
+
+    // the observation needs the steps, and the left thumbstick is mapped already
+    KeyToTouchMappingInfo observation = BuildKeyMapping(GAMEPAD_STICK_OBSERVATION_TO_TOUCH);
+    observation.keyCode = GamePadAxisSourceTypeEnum::LeftThumbstick;
+    testKeyMappingInfos.push_back(observation);
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos, true));
+    testKeyMappingInfos.back().xStep = 1;
+    testKeyMappingInfos.back().yStep = 1;
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos, true));
+    testKeyMappingInfos.back().keyCode = GamePadAxisSourceTypeEnum::RightThumbstick;
+    ASSERT_TRUE(config.CheckKeyMapping(testKeyMappingInfos, true));
+
+    testKeyMappingInfos[1].keyCode = GamePadAxisSourceTypeEnum::Dpad;
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos, true));
+    testKeyMappingInfos[1].keyCode = GamePadAxisSourceTypeEnum::RightTriggerAxis;
+    testKeyMappingInfos[1].deadZone = MAX_AXIS_DEAD_ZONE + 1;
+    ASSERT_FALSE(config.CheckKeyMapping(testKeyMappingInfos, true));
+
+    // the stored templates of GAME_PAD keep their key mappings, and the dead zone of the others is reset
+    testKeyMappingInfos.clear();
+    testKeyMappingInfos.push_back(BuildKeyMapping(SKILL_KEY_TO_TOUCH));
+    testKeyMappingInfos.push_back(BuildKeyMapping(MOUSE_LEFT_FIRE_TO_TOUCH));
+    ASSERT_TRUE(config.CheckKeyMapping(testKeyMappingInfos, true));
+    testKeyMappingInfos.clear();
+    testKeyMappingInfos.push_back(BuildKeyMapping(DPAD_UP, 0, 0));
+    testKeyMappingInfos[0].deadZone = MAX_AXIS_DEAD_ZONE;
+    ASSERT_TRUE(config.CheckKeyMapping(testKeyMappingInfos, true));
+    ASSERT_EQ(0, testKeyMappingInfos[0].deadZone);
+}
+
 /**
 * @tc.name: GameKeyMappingInfo_CheckKeyMappingForHoverTouchPad_001
 * @tc.desc: HoverTouchPad only support 2 SINGE_KEY_TO_TOUCH key mappings
@@ -599,5 +697,73 @@ HWTEST_F(GameControllerKeymappingModeTest, GameKeyMappingInfo_CheckKeyMappingFor
     testKeyMappingInfos.back().keyCode = 0;
     ASSERT_FALSE(config.CheckKeyMappingForHoverTouchPad(testKeyMappingInfos));
 }
+
+/**
+* @tc.name: GameKeyMappingInfo_CheckParamValidForSetDefault_002
+* @tc.desc: the reference resolution must be zero or positive in both dimensions and not over the max
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerKeymappingModeTest, GameKeyMappingInfo_CheckParamValidForSetDefault_002, TestSize.Level0)
+{
+    GameKeyMappingInfo config = BuildDefaultKeyMappingConfig();
+    config.defaultKeyToTouchMappings.clear();
+    ASSERT_TRUE(config.CheckParamValidForSetDefault());
+
+    config.defaultResolution.width = 1920;
+    config.defaultResolution.height = 1080;
+    ASSERT_TRUE(config.CheckParamValidForSetDefault());
+
+    config.defaultResolution.height = 0;
+    ASSERT_FALSE(config.CheckParamValidForSetDefault());
+
+    config.defaultResolution.height = -1080;
+    ASSERT_FALSE(config.CheckParamValidForSetDefault());
+
+    config.defaultResolution.height = MAX_TEMPLATE_RESOLUTION + 1;
+    ASSERT_FALSE(config.CheckParamValidForSetDefault());
+
+    config.defaultResolution = TemplateResolution();
+    config.customResolution.width = MAX_TEMPLATE_RESOLUTION;
+    config.customResolution.height = MAX_TEMPLATE_RESOLUTION;
+    ASSERT_TRUE(config.CheckParamValidForSetCustom());
+}
+/**
+* @tc.name: GameKeyMappingInfo_CheckParamValidForSetDefault_003
+* @tc.desc: the exponent of the power curve and the points of the table curve must be in range
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerKeymappingModeTest, GameKeyMappingInfo_CheckParamValidForSetDefault_003, TestSize.Level0)
+{
+    GameKeyMappingInfo config = BuildDefaultKeyMappingConfig();
+    config.defaultKeyToTouchMappings.clear();
+    config.defaultResponseCurve.type = RESPONSE_CURVE_POWER;
+    config.defaultResponseCurve.exponent = MAX_RESPONSE_CURVE_EXPONENT;
+    ASSERT_TRUE(config.CheckParamValidForSetDefault());
+
+    config.defaultResponseCurve.exponent = MIN_RESPONSE_CURVE_EXPONENT / 2;
+    ASSERT_FALSE(config.CheckParamValidForSetDefault());
+
+    config.defaultResponseCurve = ResponseCurve();
+    config.customResponseCurve.type = RESPONSE_CURVE_TABLE;
+    ASSERT_FALSE(config.CheckParamValidForSetCustom());
+
+    config.customResponseCurve.points = {{0.5, 0.25}, {1.0, MAX_RESPONSE_CURVE_OUTPUT}};
+    ASSERT_TRUE(config.CheckParamValidForSetCustom());
+
+    config.customResponseCurve.points = {{0.5, 0.25}, {0.5, 1.0}};
+    ASSERT_FALSE(config.CheckParamValidForSetCustom());
+
+    config.customResponseCurve.points = {{0.5, -0.25}};
+    ASSERT_FALSE(config.CheckParamValidForSetCustom());
+
+    config.customResponseCurve.points = std::vector<ResponseCurvePoint>(MAX_RESPONSE_CURVE_POINTS + 1);
+    ASSERT_FALSE(config.CheckParamValidForSetCustom());
+
+    config.customResponseCurve = ResponseCurve();
+    config.customResponseCurve.type = static_cast<ResponseCurveTypeEnum>(RESPONSE_CURVE_TABLE + 1);
+    ASSERT_FALSE(config.CheckParamValidForSetCustom());
+}
+}
 }
-}
\ No newline at end of file
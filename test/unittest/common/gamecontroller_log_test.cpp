@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "gamecontroller_log.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const uint32_t BURST = 3;
+const uint32_t SUPPRESSED_COUNT = 2;
+const int64_t INTERVAL_MS = 50;
+}
+
+class GameControllerLogTest : public testing::Test {
+};
+
+/**
+* @tc.name: LogRateLimiter_001
+* @tc.desc: The lines over the burst are suppressed and counted
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerLogTest, LogRateLimiter_001, TestSize.Level0)
+{
+    LogRateLimiter limiter(BURST, INTERVAL_MS);
+    uint64_t totalSuppressedCount = LogRateLimiter::GetTotalSuppressedCount();
+    uint32_t suppressedCount = 1;
+    for (uint32_t idx = 0; idx < BURST; idx++) {
+        ASSERT_TRUE(limiter.TryAcquire(suppressedCount));
+        ASSERT_EQ(0, suppressedCount);
+    }
+    for (uint32_t idx = 0; idx < SUPPRESSED_COUNT; idx++) {
+        ASSERT_FALSE(limiter.TryAcquire(suppressedCount));
+    }
+    ASSERT_EQ(totalSuppressedCount + SUPPRESSED_COUNT, LogRateLimiter::GetTotalSuppressedCount());
+}
+
+/**
+* @tc.name: LogRateLimiter_002
+* @tc.desc: The first line of the next interval is printed with the number of the suppressed ones
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerLogTest, LogRateLimiter_002, TestSize.Level0)
+{
+    LogRateLimiter limiter(BURST, INTERVAL_MS);
+    uint32_t suppressedCount = 0;
+    for (uint32_t idx = 0; idx < BURST + SUPPRESSED_COUNT; idx++) {
+        limiter.TryAcquire(suppressedCount);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(INTERVAL_MS + INTERVAL_MS));
+    ASSERT_TRUE(limiter.TryAcquire(suppressedCount));
+    ASSERT_EQ(SUPPRESSED_COUNT, suppressedCount);
+    ASSERT_TRUE(limiter.TryAcquire(suppressedCount));
+    ASSERT_EQ(0, suppressedCount);
+}
+
+/**
+* @tc.name: HILOG_LIMIT_001
+* @tc.desc: The arguments are not evaluated when the level is disabled
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerLogTest, HILOG_LIMIT_001, TestSize.Level0)
+{
+    int32_t evaluatedCount = 0;
+    auto evaluate = [&evaluatedCount]() {
+        evaluatedCount++;
+        return evaluatedCount;
+    };
+    for (uint32_t idx = 0; idx < LOG_LIMIT_BURST + BURST; idx++) {
+        HILOGW_LIMIT("value is %{public}d", evaluate());
+    }
+    if (HILOG_IS_LOGGABLE(LOG_WARN)) {
+        ASSERT_EQ(LOG_LIMIT_BURST, evaluatedCount);
+    } else {
+        ASSERT_EQ(0, evaluatedCount);
+    }
+}
+}
+}
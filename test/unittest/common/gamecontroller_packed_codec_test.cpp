@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include <message_parcel.h>
+#include "gamecontroller_keymapping_model.h"
+#include "gamecontroller_packed_codec.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t VENDOR = 12;
+const int32_t PRODUCT = 13;
+const int32_t VERSION = 14;
+const int32_t DEVICE_ID = 3;
+const int32_t OTHER_DEVICE_ID = 4;
+const int32_t COMBINATION_FIRST_KEY = 2072;
+const int32_t COMBINATION_LAST_KEY = 2017;
+const int32_t DPAD_UP = 2012;
+const int32_t DPAD_DOWN = 2013;
+const int32_t DPAD_LEFT = 2014;
+const int32_t DPAD_RIGHT = 2015;
+const uint32_t INVALID_VERSION = 99;
+const uint32_t INVALID_OFFSET = 1000;
+const int32_t KEY_CODE = 2017;
+const int32_t TAP_INTERVAL = 100;
+}
+
+class GameControllerPackedCodecTest : public testing::Test {
+};
+
+static KeyToTouchMappingInfo BuildKeyMapping(int32_t index)
+{
+    KeyToTouchMappingInfo keyMapping;
+    keyMapping.keyCode = index;
+    keyMapping.xValue = index + 1;
+    keyMapping.yValue = index + 2;
+    keyMapping.mappingType = MappingTypeEnum::COMBINATION_KEY_TO_TOUCH;
+    keyMapping.radius = index + 3;
+    keyMapping.skillRange = index + 4;
+    keyMapping.xStep = index + 5;
+    keyMapping.yStep = index + 6;
+    keyMapping.delayTime = index + 7;
+    keyMapping.tapInterval = index + 8;
+    keyMapping.tapDutyCycle = index + 9;
+    keyMapping.deadZone = index + 10;
+    keyMapping.combinationKeys = {COMBINATION_FIRST_KEY, COMBINATION_LAST_KEY};
+    keyMapping.dpadKeyCodeEntity.up = DPAD_UP;
+    keyMapping.dpadKeyCodeEntity.down = DPAD_DOWN;
+    keyMapping.dpadKeyCodeEntity.left = DPAD_LEFT;
+    keyMapping.dpadKeyCodeEntity.right = DPAD_RIGHT;
+    return keyMapping;
+}
+
+static GameKeyMappingInfo BuildGameKeyMappingInfo()
+{
+    GameKeyMappingInfo info;
+    info.bundleName = "com.test.game";
+    info.isOprDelete = false;
+    info.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    for (int32_t idx = 0; idx < MAX_KEY_MAPPING_SIZE; idx++) {
+        info.customKeyToTouchMappings.push_back(BuildKeyMapping(idx));
+        info.defaultKeyToTouchMappings.push_back(BuildKeyMapping(idx + MAX_KEY_MAPPING_SIZE));
+    }
+    return info;
+}
+
+static DeviceInfo BuildDeviceInfo()
+{
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = "a1:b2:c3:d4:e5:f6";
+    deviceInfo.name = "game keyboard";
+    deviceInfo.phys = "usb-0000:00:14.0-1/input0";
+    deviceInfo.vendor = VENDOR;
+    deviceInfo.product = PRODUCT;
+    deviceInfo.version = VERSION;
+    deviceInfo.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    deviceInfo.status = 1;
+    deviceInfo.ids = {DEVICE_ID, OTHER_DEVICE_ID};
+    deviceInfo.names = {"game keyboard", "game keyboard consumer control"};
+    deviceInfo.sourceTypeSet = {InputSourceTypeEnum::KEYBOARD, InputSourceTypeEnum::MOUSE};
+    return deviceInfo;
+}
+
+static void CheckKeyMappingEqual(const KeyToTouchMappingInfo &expected, const KeyToTouchMappingInfo &actual)
+{
+    ASSERT_EQ(expected.keyCode, actual.keyCode);
+    ASSERT_EQ(expected.xValue, actual.xValue);
+    ASSERT_EQ(expected.yValue, actual.yValue);
+    ASSERT_EQ(expected.mappingType, actual.mappingType);
+    ASSERT_EQ(expected.radius, actual.radius);
+    ASSERT_EQ(expected.skillRange, actual.skillRange);
+    ASSERT_EQ(expected.xStep, actual.xStep);
+    ASSERT_EQ(expected.yStep, actual.yStep);
+    ASSERT_EQ(expected.delayTime, actual.delayTime);
+    ASSERT_EQ(expected.tapInterval, actual.tapInterval);
+    ASSERT_EQ(expected.tapDutyCycle, actual.tapDutyCycle);
+    ASSERT_EQ(expected.deadZone, actual.deadZone);
+    ASSERT_EQ(expected.combinationKeys, actual.combinationKeys);
+    ASSERT_EQ(expected.dpadKeyCodeEntity.up, actual.dpadKeyCodeEntity.up);
+    ASSERT_EQ(expected.dpadKeyCodeEntity.down, actual.dpadKeyCodeEntity.down);
+    ASSERT_EQ(expected.dpadKeyCodeEntity.left, actual.dpadKeyCodeEntity.left);
+    ASSERT_EQ(expected.dpadKeyCodeEntity.right, actual.dpadKeyCodeEntity.right);
+}
+
+/**
+* @tc.name: GameKeyMappingInfo_Marshalling_001
+* @tc.desc: GameKeyMappingInfo with the max key mappings can be unmarshalled from the packed block
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, GameKeyMappingInfo_Marshalling_001, TestSize.Level0)
+{
+    GameKeyMappingInfo info = BuildGameKeyMappingInfo();
+    info.customResolution.width = 2560;
+    info.customResolution.height = 1600;
+    info.defaultResponseCurve.type = RESPONSE_CURVE_TABLE;
+    info.defaultResponseCurve.points = {{0.5, 0.25}, {1.0, 1.0}};
+    Parcel parcel;
+    ASSERT_TRUE(info.Marshalling(parcel));
+    std::unique_ptr<GameKeyMappingInfo> result(GameKeyMappingInfo::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(info.bundleName, result->bundleName);
+    ASSERT_EQ(info.deviceType, result->deviceType);
+    ASSERT_TRUE(info.customResolution == result->customResolution);
+    ASSERT_FALSE(result->defaultResolution.IsValid());
+    ASSERT_TRUE(info.defaultResponseCurve == result->defaultResponseCurve);
+    ASSERT_TRUE(result->customResponseCurve.IsLinear());
+    ASSERT_EQ(info.customKeyToTouchMappings.size(), result->customKeyToTouchMappings.size());
+    ASSERT_EQ(info.defaultKeyToTouchMappings.size(), result->defaultKeyToTouchMappings.size());
+    for (size_t idx = 0; idx < info.customKeyToTouchMappings.size(); idx++) {
+        CheckKeyMappingEqual(info.customKeyToTouchMappings[idx], result->customKeyToTouchMappings[idx]);
+        CheckKeyMappingEqual(info.defaultKeyToTouchMappings[idx], result->defaultKeyToTouchMappings[idx]);
+    }
+}
+
+/**
+* @tc.name: GameKeyMappingInfo_Marshalling_002
+* @tc.desc: GameKeyMappingInfo without key mappings can be unmarshalled from the packed block
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, GameKeyMappingInfo_Marshalling_002, TestSize.Level0)
+{
+    GameKeyMappingInfo info;
+    info.bundleName = "com.test.game";
+    info.isOprDelete = true;
+    info.deviceType = DeviceTypeEnum::UNKNOWN;
+    MessageParcel parcel;
+    ASSERT_TRUE(info.Marshalling(parcel));
+    std::unique_ptr<GameKeyMappingInfo> result(GameKeyMappingInfo::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    ASSERT_TRUE(result->isOprDelete);
+    ASSERT_TRUE(result->customKeyToTouchMappings.empty());
+    ASSERT_TRUE(result->defaultKeyToTouchMappings.empty());
+}
+
+/**
+* @tc.name: GameKeyMappingInfo_Marshalling_003
+* @tc.desc: the key mappings over the limit can't be marshalled or unmarshalled
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, GameKeyMappingInfo_Marshalling_003, TestSize.Level0)
+{
+    GameKeyMappingInfo info = BuildGameKeyMappingInfo();
+    info.customKeyToTouchMappings.push_back(BuildKeyMapping(0));
+    info.defaultKeyToTouchMappings.pop_back();
+    Parcel parcel;
+    ASSERT_TRUE(info.Marshalling(parcel));
+    ASSERT_EQ(GameKeyMappingInfo::Unmarshalling(parcel), nullptr);
+
+    info.defaultKeyToTouchMappings.push_back(BuildKeyMapping(0));
+    Parcel overLimitParcel;
+    ASSERT_FALSE(info.Marshalling(overLimitParcel));
+}
+
+/**
+* @tc.name: ReadKeyMappings_001
+* @tc.desc: the packed block with invalid header or record is rejected
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, ReadKeyMappings_001, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> custom;
+    std::vector<KeyToTouchMappingInfo> defaults;
+    PackedBlockHeader header;
+    header.kind = PACKED_KIND_KEY_MAPPING;
+    header.recordSize = sizeof(PackedKeyMappingRecord);
+    header.recordCount = 1;
+    PackedKeyMappingRecord record;
+
+    header.version = INVALID_VERSION;
+    Parcel versionParcel;
+    versionParcel.WriteBuffer(&header, sizeof(header));
+    versionParcel.WriteBuffer(&record, sizeof(record));
+    ASSERT_FALSE(PackedParcelCodec::ReadKeyMappings(versionParcel, custom, defaults));
+
+    header.version = PACKED_VERSION;
+    header.kind = PACKED_KIND_DEVICE_INFO;
+    Parcel kindParcel;
+    kindParcel.WriteBuffer(&header, sizeof(header));
+    kindParcel.WriteBuffer(&record, sizeof(record));
+    ASSERT_FALSE(PackedParcelCodec::ReadKeyMappings(kindParcel, custom, defaults));
+
+    header.kind = PACKED_KIND_KEY_MAPPING;
+    record.combinationKeyCount = PACKED_MAX_COMBINATION_KEYS + 1;
+    Parcel recordParcel;
+    recordParcel.WriteBuffer(&header, sizeof(header));
+    recordParcel.WriteBuffer(&record, sizeof(record));
+    ASSERT_FALSE(PackedParcelCodec::ReadKeyMappings(recordParcel, custom, defaults));
+
+    record.combinationKeyCount = 0;
+    Parcel truncatedParcel;
+    truncatedParcel.WriteBuffer(&header, sizeof(header));
+    ASSERT_FALSE(PackedParcelCodec::ReadKeyMappings(truncatedParcel, custom, defaults));
+
+    Parcel validParcel;
+    validParcel.WriteBuffer(&header, sizeof(header));
+    validParcel.WriteBuffer(&record, sizeof(record));
+    ASSERT_TRUE(PackedParcelCodec::ReadKeyMappings(validParcel, custom, defaults));
+    ASSERT_EQ(0, custom.size());
+    ASSERT_EQ(1, defaults.size());
+}
+
+/**
+* @tc.name: ReadKeyMappings_002
+* @tc.desc: the records of the first layout, without the tap fields, can still be read
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, ReadKeyMappings_002, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> custom;
+    std::vector<KeyToTouchMappingInfo> defaults;
+    PackedBlockHeader header;
+    header.version = PACKED_VERSION;
+    header.kind = PACKED_KIND_KEY_MAPPING;
+    header.recordSize = PACKED_KEY_MAPPING_RECORD_MIN_SIZE;
+    header.recordCount = 1;
+    header.firstGroupCount = 1;
+    PackedKeyMappingRecord record;
+    record.keyCode = KEY_CODE;
+    record.tapInterval = TAP_INTERVAL;
+
+    Parcel shortParcel;
+    shortParcel.WriteBuffer(&header, sizeof(header));
+    shortParcel.WriteBuffer(&record, PACKED_KEY_MAPPING_RECORD_MIN_SIZE);
+    ASSERT_TRUE(PackedParcelCodec::ReadKeyMappings(shortParcel, custom, defaults));
+    ASSERT_EQ(1, custom.size());
+    ASSERT_EQ(KEY_CODE, custom[0].keyCode);
+    ASSERT_EQ(0, custom[0].tapInterval);
+
+    header.recordSize = PACKED_KEY_MAPPING_RECORD_MIN_SIZE - 1;
+    Parcel invalidParcel;
+    invalidParcel.WriteBuffer(&header, sizeof(header));
+    invalidParcel.WriteBuffer(&record, sizeof(record));
+    ASSERT_FALSE(PackedParcelCodec::ReadKeyMappings(invalidParcel, custom, defaults));
+}
+
+/**
+* @tc.name: DeviceInfo_Marshalling_001
+* @tc.desc: DeviceInfo can be unmarshalled from the packed block
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, DeviceInfo_Marshalling_001, TestSize.Level0)
+{
+    DeviceInfo deviceInfo = BuildDeviceInfo();
+    MessageParcel parcel;
+    ASSERT_TRUE(deviceInfo.Marshalling(parcel));
+    ASSERT_TRUE(deviceInfo.Marshalling(parcel));
+    for (int32_t idx = 0; idx < 2; idx++) {
+        std::unique_ptr<DeviceInfo> result(DeviceInfo::Unmarshalling(parcel));
+        ASSERT_NE(result, nullptr);
+        ASSERT_EQ(deviceInfo.uniq, result->uniq);
+        ASSERT_EQ(deviceInfo.name, result->name);
+        ASSERT_EQ(deviceInfo.phys, result->phys);
+        ASSERT_EQ(deviceInfo.vendor, result->vendor);
+        ASSERT_EQ(deviceInfo.product, result->product);
+        ASSERT_EQ(deviceInfo.version, result->version);
+        ASSERT_EQ(deviceInfo.deviceType, result->deviceType);
+        ASSERT_EQ(deviceInfo.status, result->status);
+        ASSERT_EQ(deviceInfo.ids, result->ids);
+        ASSERT_EQ(deviceInfo.names, result->names);
+        ASSERT_EQ(deviceInfo.sourceTypeSet, result->sourceTypeSet);
+    }
+}
+
+/**
+* @tc.name: DeviceInfo_Marshalling_002
+* @tc.desc: DeviceInfo with too many ids can't be marshalled
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, DeviceInfo_Marshalling_002, TestSize.Level0)
+{
+    DeviceInfo deviceInfo = BuildDeviceInfo();
+    for (int32_t idx = 0; idx <= MAX_SIZE; idx++) {
+        deviceInfo.ids.insert(idx + DEVICE_ID);
+    }
+    Parcel parcel;
+    ASSERT_FALSE(deviceInfo.Marshalling(parcel));
+}
+
+/**
+* @tc.name: ReadDeviceInfo_001
+* @tc.desc: the string reference out of the string table is rejected
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerPackedCodecTest, ReadDeviceInfo_001, TestSize.Level0)
+{
+    PackedBlockHeader header;
+    header.kind = PACKED_KIND_DEVICE_INFO;
+    header.recordSize = sizeof(PackedDeviceRecord);
+    header.recordCount = 1;
+    header.stringTableSize = 0;
+    PackedDeviceRecord record;
+    record.uniq.offset = INVALID_OFFSET;
+    record.uniq.length = 1;
+    Parcel parcel;
+    parcel.WriteBuffer(&header, sizeof(header));
+    parcel.WriteBuffer(&record, sizeof(record));
+    DeviceInfo deviceInfo;
+    ASSERT_FALSE(PackedParcelCodec::ReadDeviceInfo(parcel, deviceInfo));
+
+    record.uniq.offset = 0;
+    record.uniq.length = 0;
+    record.idCount = PACKED_MAX_DEVICE_ITEMS + 1;
+    Parcel countParcel;
+    countParcel.WriteBuffer(&header, sizeof(header));
+    countParcel.WriteBuffer(&record, sizeof(record));
+    ASSERT_FALSE(PackedParcelCodec::ReadDeviceInfo(countParcel, deviceInfo));
+}
+}
+}
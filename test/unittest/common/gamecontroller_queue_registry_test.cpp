@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include "gamecontroller_client_model.h"
+#include "gamecontroller_queue_registry.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t TASK_COUNT = 3;
+const int64_t DELAY_TIME = 1000000;
+}
+
+class GameControllerQueueRegistryTest : public testing::Test {
+};
+
+static QueueStats GetQueueStats(const std::string &name)
+{
+    QueueStats stats;
+    DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->GetStats(name, stats);
+    return stats;
+}
+
+/**
+* @tc.name: GetQos_001
+* @tc.desc: the input queues are user-interactive, including the key mapping queue of every device class,
+*           and the configuration queues are in the background
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerQueueRegistryTest, GetQos_001, TestSize.Level0)
+{
+    for (int32_t deviceType: {DeviceTypeEnum::GAME_PAD, DeviceTypeEnum::HOVER_TOUCH_PAD,
+                              DeviceTypeEnum::GAME_KEY_BOARD}) {
+        std::string queueName =
+            GameControllerQueueRegistry::GetDeviceQueueName(KEY_TO_TOUCH_HANDLE_QUEUE_NAME, deviceType);
+        ASSERT_EQ(ffrt::qos_user_interactive, GameControllerQueueRegistry::GetQos(queueName));
+    }
+    ASSERT_EQ(ffrt::qos_user_interactive, GameControllerQueueRegistry::GetQos("inputEventCallbackQueue"));
+    ASSERT_EQ(ffrt::qos_background, GameControllerQueueRegistry::GetQos(KEY_TO_TOUCH_HANDLE_QUEUE_NAME));
+    ASSERT_EQ(ffrt::qos_background, GameControllerQueueRegistry::GetQos("InputTraceWriteQueue"));
+}
+
+/**
+* @tc.name: GetQos_002
+* @tc.desc: the queue which isn't declared, or isn't named for a device class, has the default QoS class
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerQueueRegistryTest, GetQos_002, TestSize.Level0)
+{
+    ASSERT_EQ(ffrt::qos_default, GameControllerQueueRegistry::GetQos("queue-registry-test-undeclared"));
+    std::string sharedName = KEY_TO_TOUCH_HANDLE_QUEUE_NAME;
+    ASSERT_EQ(ffrt::qos_default, GameControllerQueueRegistry::GetQos(sharedName + "-"));
+    ASSERT_EQ(ffrt::qos_default, GameControllerQueueRegistry::GetQos(sharedName + "X1"));
+    std::unique_ptr<GameControllerQueue> queue =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue("queue-registry-test-undeclared");
+    ASSERT_EQ(ffrt::qos_default, queue->GetQos());
+}
+
+/**
+* @tc.name: CreateQueue_001
+* @tc.desc: the tasks run on the created queue are counted
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerQueueRegistryTest, CreateQueue_001, TestSize.Level0)
+{
+    const std::string name = "queue-registry-test-run";
+    std::unique_ptr<GameControllerQueue> queue =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(name);
+    ffrt::mutex mutex;
+    std::unique_lock<ffrt::mutex> lock(mutex);
+    queue->submit([&mutex] {
+        std::lock_guard<ffrt::mutex> taskLock(mutex);
+    });
+    ffrt::task_handle handle = nullptr;
+    for (int32_t idx = 1; idx < TASK_COUNT; idx++) {
+        handle = queue->submit_h([] {});
+    }
+    lock.unlock();
+    queue->wait(handle);
+
+    QueueStats stats = GetQueueStats(name);
+    ASSERT_EQ(name, stats.name);
+    ASSERT_EQ(ffrt::qos_default, stats.qos);
+    ASSERT_EQ(0, stats.depth);
+    ASSERT_TRUE(stats.maxDepth >= 1);
+    ASSERT_EQ(static_cast<uint64_t>(TASK_COUNT), stats.taskCount);
+    ASSERT_TRUE(stats.maxWaitTime >= stats.GetMeanWaitTime());
+}
+
+/**
+* @tc.name: CreateQueue_002
+* @tc.desc: the cancelled task and the task dropped with its queue aren't counted in the depth
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerQueueRegistryTest, CreateQueue_002, TestSize.Level0)
+{
+    const std::string name = "queue-registry-test-cancel";
+    std::unique_ptr<GameControllerQueue> queue =
+        DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(name);
+    ffrt::task_handle handle = queue->submit_h([] {}, ffrt::task_attr().delay(DELAY_TIME));
+    queue->submit([] {}, ffrt::task_attr().delay(DELAY_TIME));
+    ASSERT_EQ(2, GetQueueStats(name).depth);
+
+    ASSERT_EQ(0, queue->cancel(handle));
+    ASSERT_EQ(1, GetQueueStats(name).depth);
+
+    queue = nullptr;
+    QueueStats stats = GetQueueStats(name);
+    ASSERT_EQ(0, stats.depth);
+    ASSERT_EQ(2, stats.maxDepth);
+    ASSERT_EQ(0, stats.taskCount);
+}
+
+/**
+* @tc.name: GetStats_001
+* @tc.desc: the queues with the same name share the stats, and the name not created has none
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerQueueRegistryTest, GetStats_001, TestSize.Level0)
+{
+    const std::string name = "queue-registry-test-shared";
+    auto registry = DelayedSingleton<GameControllerQueueRegistry>::GetInstance();
+    std::unique_ptr<GameControllerQueue> firstQueue = registry->CreateQueue(name);
+    std::unique_ptr<GameControllerQueue> secondQueue = registry->CreateQueue(name);
+    firstQueue->wait(firstQueue->submit_h([] {}));
+    secondQueue->wait(secondQueue->submit_h([] {}));
+    ASSERT_EQ(2, GetQueueStats(name).taskCount);
+
+    std::vector<QueueStats> allStats = registry->GetAllStats();
+    size_t count = std::count_if(allStats.begin(), allStats.end(), [&name](const QueueStats &stats) {
+        return stats.name == name;
+    });
+    ASSERT_EQ(1, count);
+
+    QueueStats stats;
+    ASSERT_FALSE(registry->GetStats("queue-registry-test-not-created", stats));
+}
+}
+}
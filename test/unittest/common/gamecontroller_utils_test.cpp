@@ -53,5 +53,19 @@ HWTEST_F(GameControllerUtilsTest, StringUtils_AnonymizationUniq_001, TestSize.Le
     ASSERT_EQ("11:22:**:**", StringUtils::AnonymizationUniq("11:22:33:44"));
     ASSERT_EQ("11:22:**:**:55", StringUtils::AnonymizationUniq("11:22:33:44:55"));
 }
+
+/**
+* @tc.name: StringUtils_AnonymizationUniq_002
+* @tc.desc: Empty fields are kept, and a trailing delimiter doesn't add a field
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(GameControllerUtilsTest, StringUtils_AnonymizationUniq_002, TestSize.Level0)
+{
+    ASSERT_EQ("**", StringUtils::AnonymizationUniq(""));
+    ASSERT_EQ("**", StringUtils::AnonymizationUniq("11:22:"));
+    ASSERT_EQ("11:22:**", StringUtils::AnonymizationUniq("11:22:33:"));
+    ASSERT_EQ("11::**:**:55", StringUtils::AnonymizationUniq("11::33:44:55"));
+}
 }
 }
\ No newline at end of file
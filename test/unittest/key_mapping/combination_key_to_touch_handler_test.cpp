@@ -42,18 +42,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        CombinationKeyToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        CombinationKeyToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                     const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        CombinationKeyToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        CombinationKeyToTouchHandler::HandleKeyUp(context, sample);
     }
 
 public:
@@ -90,12 +88,17 @@ public:
     int32_t SendFirstDownTouch()
     {
         keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-        handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+        handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
         std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_COMBINATION);
         int32_t pointerId = pair.second;
         return pointerId;
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<CombinationKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -136,7 +139,7 @@ HWTEST_F(CombinationKeyToTouchHandlerTest, HandleKeyDown_002, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     mappingInfo_.combinationKeys.push_back(1);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_COMBINATION);
     ASSERT_FALSE(pair.first);
 }
@@ -153,7 +156,7 @@ HWTEST_F(CombinationKeyToTouchHandlerTest, HandleKeyDown_003, TestSize.Level1)
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     context_->isCombinationKeyOperating = true;
     context_->currentCombinationKey.combinationKeys.clear();
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_COMBINATION);
     ASSERT_FALSE(pair.first);
     ASSERT_EQ(handler_->touchEntity_.xValue, 0);
@@ -170,7 +173,7 @@ HWTEST_F(CombinationKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
 {
     int32_t pointerId = SendFirstDownTouch();
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_FALSE(context_->isCombinationKeyOperating);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
@@ -192,7 +195,7 @@ HWTEST_F(CombinationKeyToTouchHandlerTest, HandleKeyUp_002, TestSize.Level1)
 
     context_->isCombinationKeyOperating = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
 }
 
@@ -210,7 +213,7 @@ HWTEST_F(CombinationKeyToTouchHandlerTest, HandleKeyUp_003, TestSize.Level1)
 
     keyEvent_->SetKeyCode(FIRST_KEY_CODE);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->isCombinationKeyOperating);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
@@ -230,7 +233,7 @@ HWTEST_F(CombinationKeyToTouchHandlerTest, HandleKeyUp_004, TestSize.Level1)
 
     context_->currentCombinationKey.combinationKeys.push_back(1);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->isCombinationKeyOperating);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
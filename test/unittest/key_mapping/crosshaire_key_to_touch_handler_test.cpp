@@ -40,6 +40,13 @@ const int32_t MAX_HEIGHT = 1260;
 const int32_t X_STEP = 1;
 const int32_t Y_STEP = 1;
 const int32_t MOUSE_MOVE_DISTANCE = 10;
+const int32_t FLICK_STEP = 100;
+const int32_t FLICK_COUNT = 6;
+const int32_t FAR_DISTANCE = 400;
+const int64_t ACTION_TIME = 1000000;
+const int64_t FAST_MOVE_INTERVAL = 1000;
+const int64_t SLOW_MOVE_INTERVAL = 100000;
+const int64_t ONE_MINUTE = 60000000;
 }
 class CrosshairKeyToTouchHandlerEx : public CrosshairKeyToTouchHandler {
 public:
@@ -50,6 +57,7 @@ public:
         BaseKeyToTouchHandler::BuildAndSendPointerEvent(context_, touchEntity);
         if (touchEntity.pointerAction == PointerEvent::POINTER_ACTION_UP) {
             touchUpEntity_ = touchEntity;
+            upCount_++;
         }
         if (touchEntity.pointerAction == PointerEvent::POINTER_ACTION_DOWN) {
             touchDownEntity_ = touchEntity;
@@ -60,18 +68,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo,
-                       const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        CrosshairKeyToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        CrosshairKeyToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                     const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        CrosshairKeyToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        CrosshairKeyToTouchHandler::HandleKeyUp(context, sample);
     }
 
 public:
@@ -79,6 +85,7 @@ public:
     TouchEntity touchDownEntity_;
     TouchEntity touchMoveEntity_;
     bool hasTouchEvent_{false};
+    int32_t upCount_{0};
 };
 
 class CrosshairKeyToTouchHandlerTest : public testing::Test {
@@ -128,12 +135,31 @@ public:
     int32_t SendTouchDown()
     {
         keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-        handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+        handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
         std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
         int32_t pointerId = pair.second;
         return pointerId;
     }
 
+    void SendMouseMove(int32_t xVal, int32_t yVal, int64_t actionTime)
+    {
+        pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+        pointerEvent_->SetActionTime(actionTime);
+        pointerEvent_->RemoveAllPointerItems();
+        pointerEvent_->AddPointerItem(BuildPointerItem(xVal, yVal));
+        handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    }
+
+    int32_t EnterTrackballMode()
+    {
+        handler_->SetTrackballMode(true);
+        int32_t pointerId = SendTouchDown();
+        keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
+        handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
+        context_->lastMousePointer = BuildPointerItem(MOUSE_X_VALUE, MOUSE_Y_VALUE);
+        return pointerId;
+    }
+
     void SendUpTouchWhenMoveToEdge(int32_t pointerId, int32_t width, int32_t height)
     {
         PointerEvent::PointerItem lastMovePoint;
@@ -153,6 +179,11 @@ public:
         ASSERT_TRUE(handler_->isSendDownTouch_);
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<CrosshairKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -195,7 +226,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandleKeyDown_002, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     context_->isCrosshairMode = true;
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     ASSERT_TRUE(context_->isCrosshairMode);
     ASSERT_EQ(context_->currentCrosshairInfo.mappingType, 0);
     ASSERT_TRUE(handler_->isSendDownTouch_);
@@ -214,7 +245,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
     context_->isCrosshairMode = true;
     context_->isEnterCrosshairInfo = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->isEnterCrosshairInfo);
     ASSERT_FALSE(handler_->hasTouchEvent_);
@@ -236,14 +267,14 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandleKeyUp_002, TestSize.Level0)
     ASSERT_FALSE(context_->isEnterCrosshairInfo);
     ASSERT_FALSE(handler_->isSendDownTouch_);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
     ASSERT_TRUE(context_->isCrosshairMode);
     ASSERT_TRUE(context_->isEnterCrosshairInfo);
 
     // second key up, it will exit crosshair status
     context_->pointerItems[pointerId] = BuildPointerItem(X_VALUE, Y_VALUE);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
     ASSERT_FALSE(context_->isCrosshairMode);
@@ -268,7 +299,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandleKeyUp_003, TestSize.Level0)
     context_->isEnterCrosshairInfo = true;
     context_->currentCrosshairInfo = mappingInfo_;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_FALSE(context_->isCrosshairMode);
     ASSERT_FALSE(context_->isEnterCrosshairInfo);
@@ -286,7 +317,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandleKeyUp_004, TestSize.Level0)
 {
     context_->isCrosshairMode = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_CROSSHAIR);
     ASSERT_FALSE(pair.first);
     ASSERT_FALSE(context_->isEnterCrosshairInfo);
@@ -343,7 +374,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandlePointerEvent_004, TestSize.Level0
 {
     int32_t pointerId = SendTouchDown();
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     PointerEvent::PointerItem lastMovePoint;
     lastMovePoint.SetWindowX(X_VALUE);
@@ -376,7 +407,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandlePointerEvent_005, TestSize.Level0
 {
     int32_t pointerId = SendTouchDown();
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
     handler_->isSendDownTouch_ = true;
 
     pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
@@ -403,7 +434,7 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandlePointerEvent_006, TestSize.Level0
 {
     int32_t pointerId = SendTouchDown();
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
     ASSERT_FALSE(handler_->isSendDownTouch_);
 
     SendUpTouchWhenMoveToEdge(pointerId, MAX_WIDTH, Y_VALUE);
@@ -417,5 +448,69 @@ HWTEST_F(CrosshairKeyToTouchHandlerTest, HandlePointerEvent_006, TestSize.Level0
 
     SendUpTouchWhenMoveToEdge(pointerId, X_VALUE, 0);
 }
+
+/**
+ * @tc.name: HandlePointerEvent_007
+ * @tc.desc: In the trackball mode, a flick moves the touch in the region without any up touch,
+ * and the touch is recentered before it leaves the region. The mouse move of that event is moved from the center.
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(CrosshairKeyToTouchHandlerTest, HandlePointerEvent_007, TestSize.Level0)
+{
+    mappingInfo_.xStep = FLICK_STEP;
+    int32_t pointerId = EnterTrackballMode();
+
+    // the region reaches a quarter of the width to the left, so the touch is moved 600px without an up touch
+    int64_t actionTime = ACTION_TIME;
+    for (int32_t idx = 1; idx <= FLICK_COUNT; idx++) {
+        actionTime += FAST_MOVE_INTERVAL;
+        SendMouseMove(MOUSE_X_VALUE - idx * FLICK_STEP, MOUSE_Y_VALUE, actionTime);
+    }
+    ASSERT_EQ(0, handler_->upCount_);
+    ASSERT_EQ(X_VALUE - FLICK_COUNT * FLICK_STEP, context_->pointerItems[pointerId].GetWindowX());
+
+    // the next move is out of the region, so it's recentered first
+    actionTime += FAST_MOVE_INTERVAL;
+    SendMouseMove(MOUSE_X_VALUE - (FLICK_COUNT + 1) * FLICK_STEP, MOUSE_Y_VALUE, actionTime);
+    ASSERT_EQ(1, handler_->upCount_);
+    ASSERT_EQ(X_VALUE - FLICK_COUNT * FLICK_STEP, handler_->touchUpEntity_.xValue);
+    ASSERT_EQ(X_VALUE, handler_->touchDownEntity_.xValue);
+    ASSERT_EQ(X_VALUE - FLICK_STEP, handler_->touchMoveEntity_.xValue);
+    ASSERT_EQ(Y_VALUE, handler_->touchMoveEntity_.yValue);
+    ASSERT_FALSE(handler_->isSendDownTouch_);
+    ASSERT_EQ(1, handler_->GetRecenterStats().recenterCount);
+    ASSERT_EQ(0, handler_->GetRecenterStats().predictiveRecenterCount);
+}
+
+/**
+ * @tc.name: HandlePointerEvent_008
+ * @tc.desc: In the trackball mode, the touch far from the center is recentered when the mouse moves slowly,
+ * and the recenter cycles of the last minute are kept
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(CrosshairKeyToTouchHandlerTest, HandlePointerEvent_008, TestSize.Level0)
+{
+    int32_t pointerId = EnterTrackballMode();
+    context_->pointerItems[pointerId].SetWindowX(X_VALUE + FAR_DISTANCE);
+    handler_->lastMoveTime_ = ACTION_TIME;
+
+    SendMouseMove(MOUSE_X_VALUE + MOUSE_MOVE_DISTANCE, MOUSE_Y_VALUE, ACTION_TIME + FAST_MOVE_INTERVAL);
+    ASSERT_EQ(0, handler_->upCount_);
+    ASSERT_EQ(X_VALUE + FAR_DISTANCE + X_STEP, handler_->touchMoveEntity_.xValue);
+
+    SendMouseMove(MOUSE_X_VALUE + MOUSE_MOVE_DISTANCE + 1, MOUSE_Y_VALUE,
+                  ACTION_TIME + FAST_MOVE_INTERVAL + SLOW_MOVE_INTERVAL);
+    ASSERT_EQ(1, handler_->upCount_);
+    ASSERT_EQ(X_VALUE + FAR_DISTANCE + X_STEP, handler_->touchUpEntity_.xValue);
+    ASSERT_EQ(X_VALUE + X_STEP, handler_->touchMoveEntity_.xValue);
+    ASSERT_EQ(1, handler_->GetRecenterStats().predictiveRecenterCount);
+
+    handler_->CountRecenter(handler_->GetRecenterStats().periodStartTime + ONE_MINUTE, false);
+    ASSERT_EQ(1, handler_->GetRecenterStats().lastMinuteRecenterCount);
+    ASSERT_EQ(1, handler_->GetRecenterStats().recenterCount);
+    ASSERT_EQ(0, handler_->GetRecenterStats().predictiveRecenterCount);
+}
+}
 }
-}
\ No newline at end of file
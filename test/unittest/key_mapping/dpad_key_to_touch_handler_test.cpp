@@ -56,16 +56,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo, const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        DpadKeyToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        DpadKeyToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        DpadKeyToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        DpadKeyToTouchHandler::HandleKeyUp(context, sample);
     }
 
 public:
@@ -126,6 +126,11 @@ public:
         ASSERT_EQ(handler_->touchMoveEntity_.pointerId, pair.second);
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<DpadKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -145,7 +150,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_001, TestSize.Level0)
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     keyEvent_->SetKeyCode(KEY_UP_CODE);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_WALK);
     ASSERT_TRUE(pair.first);
     int32_t pointerId = pair.second;
@@ -176,7 +181,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_002, TestSize.Level1)
     context_->currentWalking.mappingType = MOUSE_RIGHT_KEY_WALKING_TO_TOUCH;
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(context_->currentWalking, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
     ASSERT_FALSE(handler_->hasTouchEvent_);
@@ -196,7 +201,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_003, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -219,7 +224,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_004, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_DOWN_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -242,7 +247,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_005, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_LEFT_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -265,7 +270,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_006, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_RIGHT_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -293,7 +298,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_007, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -323,7 +328,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_008, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -353,7 +358,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_009, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -383,7 +388,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_010, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -411,7 +416,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_011, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -441,7 +446,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_012, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -469,7 +474,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_013, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -499,7 +504,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_014, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentWalking(mappingInfo_, pointerId);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
@@ -518,7 +523,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyDown_014, TestSize.Level0)
 HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_WALK);
     ASSERT_TRUE(pair.first);
     int32_t pointerId = pair.second;
@@ -528,7 +533,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
     keyItem.SetDeviceId(OTHER_DEVICE_ID);
     keyEvent_->AddKeyItem(keyItem);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE, true));
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_FALSE(context_->isWalking);
     ASSERT_EQ(context_->currentWalking.xValue, 0);
@@ -547,13 +552,13 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
 HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_002, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_WALK);
     ASSERT_TRUE(pair.first);
     int32_t pointerId = pair.second;
     context_->isWalking = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
 }
@@ -569,12 +574,12 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_002, TestSize.Level1)
 HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_003, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_WALK);
     int32_t pointerId = pair.second;
     context_->currentWalking.mappingType = MOUSE_LEFT_FIRE_TO_TOUCH;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->isWalking);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
@@ -593,7 +598,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_004, TestSize.Level0)
 {
     keyEvent_->SetKeyCode(KEY_LEFT_CODE);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_WALK);
     int32_t pointerId = pair.second;
 
@@ -602,7 +607,7 @@ HWTEST_F(DpadKeyToTouchHandlerTest, HandleKeyUp_004, TestSize.Level0)
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_UP_CODE, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_LEFT_CODE, false));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_RIGHT_CODE, true));
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
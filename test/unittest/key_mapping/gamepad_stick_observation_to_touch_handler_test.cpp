@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include "gamepad_stick_observation_to_touch_handler.h"
+#include "refbase.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t X_VALUE = 500;
+const int32_t Y_VALUE = 600;
+const int32_t EDGE_X_VALUE = 990;
+const int32_t MAX_WIDTH = 1000;
+const int32_t MAX_HEIGHT = 1000;
+const int32_t X_STEP = 20;
+const int32_t Y_STEP = 10;
+const int32_t MAX_STEP_COUNT = 4;
+const int64_t STEP_TIME = 50000;
+const double FULL_VALUE = 1.0;
+}
+class GamePadStickObservationToTouchHandlerEx : public GamePadStickObservationToTouchHandler {
+public:
+    using GamePadStickObservationToTouchHandler::RunTick;
+
+    void BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context_,
+                                  const TouchEntity &touchEntity) override
+    {
+        BaseKeyToTouchHandler::BuildAndSendPointerEvent(context_, touchEntity);
+        touchEntities_.push_back(touchEntity);
+    }
+
+public:
+    std::vector<TouchEntity> touchEntities_;
+};
+
+class GamePadStickObservationToTouchHandlerTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        handler_ = std::make_shared<GamePadStickObservationToTouchHandlerEx>();
+        mappingInfo_.mappingType = MappingTypeEnum::GAMEPAD_STICK_OBSERVATION_TO_TOUCH;
+        mappingInfo_.keyCode = GamePadAxisSourceTypeEnum::RightThumbstick;
+        mappingInfo_.xValue = X_VALUE;
+        mappingInfo_.yValue = Y_VALUE;
+        mappingInfo_.xStep = X_STEP;
+        mappingInfo_.yStep = Y_STEP;
+        WindowInfoEntity windowInfo;
+        windowInfo.maxWidth = MAX_WIDTH;
+        windowInfo.maxHeight = MAX_HEIGHT;
+        context_ = std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_PAD, windowInfo,
+                                                         std::vector<KeyToTouchMappingInfo>{mappingInfo_});
+    }
+
+    void TearDown() override
+    {
+        context_->ResetTempVariables();
+    }
+
+    void SendAxisEvent(double xValue, double yValue)
+    {
+        std::shared_ptr<MMI::PointerEvent> pointerEvent = PointerEvent::Create();
+        pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_JOYSTICK);
+        pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_AXIS_UPDATE);
+        pointerEvent->SetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_Z, xValue);
+        pointerEvent->SetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_RZ, yValue);
+        handler_->HandlePointerEvent(context_, pointerEvent, mappingInfo_);
+    }
+
+    GamePadAxisEntity &GetEntity()
+    {
+        return context_->gamePadAxes[mappingInfo_.keyCode];
+    }
+
+public:
+    std::shared_ptr<GamePadStickObservationToTouchHandlerEx> handler_;
+    std::shared_ptr<InputToTouchContext> context_;
+    KeyToTouchMappingInfo mappingInfo_;
+};
+
+/**
+ * @tc.name: HandlePointerEvent_001
+ * @tc.desc: the touch is pressed at the start point, and dragged by the steps times the held time,
+ *           the late ticks are capped
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadStickObservationToTouchHandlerTest, HandlePointerEvent_001, TestSize.Level0)
+{
+    SendAxisEvent(FULL_VALUE, 0.0);
+    ASSERT_EQ(handler_->touchEntities_.size(), 1);
+    ASSERT_EQ(handler_->touchEntities_.back().pointerAction, PointerEvent::POINTER_ACTION_DOWN);
+    ASSERT_EQ(handler_->touchEntities_.back().xValue, X_VALUE);
+    ASSERT_EQ(handler_->touchEntities_.back().yValue, Y_VALUE);
+
+    handler_->RunTick(context_, mappingInfo_.keyCode, GetEntity().sequence, GetEntity().lastAdvanceTime + STEP_TIME);
+    ASSERT_EQ(handler_->touchEntities_.back().pointerAction, PointerEvent::POINTER_ACTION_MOVE);
+    ASSERT_EQ(handler_->touchEntities_.back().xValue, X_VALUE + X_STEP);
+    ASSERT_EQ(handler_->touchEntities_.back().yValue, Y_VALUE);
+
+    handler_->RunTick(context_, mappingInfo_.keyCode, GetEntity().sequence,
+                      GetEntity().lastAdvanceTime + STEP_TIME * MAX_STEP_COUNT * 2);
+    ASSERT_EQ(handler_->touchEntities_.back().xValue, X_VALUE + X_STEP * (MAX_STEP_COUNT + 1));
+
+    // the tick of another observation is ignored
+    size_t sendCount = handler_->touchEntities_.size();
+    handler_->RunTick(context_, mappingInfo_.keyCode, GetEntity().sequence + 1,
+                      GetEntity().lastAdvanceTime + STEP_TIME);
+    ASSERT_EQ(handler_->touchEntities_.size(), sendCount);
+}
+
+/**
+ * @tc.name: HandlePointerEvent_002
+ * @tc.desc: the drag is pressed again at the start point when it reaches the edge of the window
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadStickObservationToTouchHandlerTest, HandlePointerEvent_002, TestSize.Level0)
+{
+    mappingInfo_.xValue = EDGE_X_VALUE;
+    SendAxisEvent(FULL_VALUE, 0.0);
+    int32_t pointerId = handler_->touchEntities_.back().pointerId;
+
+    handler_->RunTick(context_, mappingInfo_.keyCode, GetEntity().sequence, GetEntity().lastAdvanceTime + STEP_TIME);
+
+    ASSERT_EQ(handler_->touchEntities_.size(), 3);
+    ASSERT_EQ(handler_->touchEntities_[1].pointerAction, PointerEvent::POINTER_ACTION_UP);
+    ASSERT_EQ(handler_->touchEntities_[2].pointerAction, PointerEvent::POINTER_ACTION_DOWN);
+    ASSERT_EQ(handler_->touchEntities_[2].xValue, EDGE_X_VALUE);
+    ASSERT_EQ(handler_->touchEntities_[2].pointerId, pointerId);
+}
+
+/**
+ * @tc.name: HandlePointerEvent_003
+ * @tc.desc: the touch is released when the thumbstick goes back to the dead zone
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadStickObservationToTouchHandlerTest, HandlePointerEvent_003, TestSize.Level0)
+{
+    SendAxisEvent(0.0, FULL_VALUE);
+    int32_t pointerId = handler_->touchEntities_.back().pointerId;
+
+    SendAxisEvent(0.0, 0.0);
+
+    ASSERT_EQ(handler_->touchEntities_.back().pointerAction, PointerEvent::POINTER_ACTION_UP);
+    ASSERT_EQ(handler_->touchEntities_.back().pointerId, pointerId);
+    ASSERT_TRUE(context_->gamePadAxes.empty());
+    ASSERT_FALSE(context_->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + mappingInfo_.keyCode).first);
+}
+}
+}
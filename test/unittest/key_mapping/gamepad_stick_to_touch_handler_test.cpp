@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include "gamepad_stick_to_touch_handler.h"
+#include "refbase.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t X_VALUE = 500;
+const int32_t Y_VALUE = 600;
+const int32_t RADIUS = 100;
+const int32_t DEAD_ZONE = 10;
+const int32_t DIAGONAL_OFFSET = 71;
+const double IN_DEAD_ZONE_VALUE = 0.05;
+const double FULL_VALUE = 1.0;
+}
+class GamePadStickToTouchHandlerEx : public GamePadStickToTouchHandler {
+public:
+    void BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context_,
+                                  const TouchEntity &touchEntity) override
+    {
+        BaseKeyToTouchHandler::BuildAndSendPointerEvent(context_, touchEntity);
+        touchEntity_ = touchEntity;
+        sendCount_++;
+    }
+
+public:
+    TouchEntity touchEntity_;
+    int32_t sendCount_{0};
+};
+
+class GamePadStickToTouchHandlerTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        handler_ = std::make_shared<GamePadStickToTouchHandlerEx>();
+        mappingInfo_ = BuildKeyToTouchMappingInfo();
+        context_ = std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_PAD, WindowInfoEntity(),
+                                                         std::vector<KeyToTouchMappingInfo>{mappingInfo_});
+    }
+
+    void TearDown() override
+    {
+        context_->ResetTempVariables();
+    }
+
+    static KeyToTouchMappingInfo BuildKeyToTouchMappingInfo()
+    {
+        KeyToTouchMappingInfo info;
+        info.mappingType = MappingTypeEnum::GAMEPAD_STICK_TO_TOUCH;
+        info.keyCode = GamePadAxisSourceTypeEnum::LeftThumbstick;
+        info.xValue = X_VALUE;
+        info.yValue = Y_VALUE;
+        info.radius = RADIUS;
+        info.deadZone = DEAD_ZONE;
+        return info;
+    }
+
+    void SendAxisEvent(const std::vector<std::pair<PointerEvent::AxisType, double>> &axisValues)
+    {
+        std::shared_ptr<MMI::PointerEvent> pointerEvent = PointerEvent::Create();
+        pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_JOYSTICK);
+        pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_AXIS_UPDATE);
+        for (const auto &axisValue: axisValues) {
+            pointerEvent->SetAxisValue(axisValue.first, axisValue.second);
+        }
+        handler_->HandlePointerEvent(context_, pointerEvent, mappingInfo_);
+    }
+
+public:
+    std::shared_ptr<GamePadStickToTouchHandlerEx> handler_;
+    std::shared_ptr<InputToTouchContext> context_;
+    KeyToTouchMappingInfo mappingInfo_;
+};
+
+/**
+ * @tc.name: HandlePointerEvent_001
+ * @tc.desc: the thumbstick in the dead zone sends nothing
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadStickToTouchHandlerTest, HandlePointerEvent_001, TestSize.Level0)
+{
+    SendAxisEvent({{PointerEvent::AxisType::AXIS_TYPE_ABS_X, IN_DEAD_ZONE_VALUE}});
+
+    ASSERT_EQ(handler_->sendCount_, 0);
+    ASSERT_FALSE(context_->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + mappingInfo_.keyCode).first);
+}
+
+/**
+ * @tc.name: HandlePointerEvent_002
+ * @tc.desc: the touch is pressed at the center and moved by the radius in the direction of the thumbstick,
+ *           and the axis missed in the event keeps its last value
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadStickToTouchHandlerTest, HandlePointerEvent_002, TestSize.Level0)
+{
+    SendAxisEvent({{PointerEvent::AxisType::AXIS_TYPE_ABS_X, FULL_VALUE},
+                   {PointerEvent::AxisType::AXIS_TYPE_ABS_Y, 0.0}});
+
+    std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + mappingInfo_.keyCode);
+    ASSERT_TRUE(pair.first);
+    ASSERT_EQ(handler_->sendCount_, 2);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_MOVE);
+    ASSERT_EQ(handler_->touchEntity_.xValue, X_VALUE + RADIUS);
+    ASSERT_EQ(handler_->touchEntity_.yValue, Y_VALUE);
+
+    SendAxisEvent({{PointerEvent::AxisType::AXIS_TYPE_ABS_Y, FULL_VALUE}});
+    ASSERT_EQ(handler_->touchEntity_.xValue, X_VALUE + DIAGONAL_OFFSET);
+    ASSERT_EQ(handler_->touchEntity_.yValue, Y_VALUE + DIAGONAL_OFFSET);
+
+    // the same point isn't sent again
+    SendAxisEvent({{PointerEvent::AxisType::AXIS_TYPE_ABS_Y, FULL_VALUE}});
+    ASSERT_EQ(handler_->sendCount_, 3);
+}
+
+/**
+ * @tc.name: HandlePointerEvent_003
+ * @tc.desc: the touch is released when the thumbstick goes back to the dead zone
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadStickToTouchHandlerTest, HandlePointerEvent_003, TestSize.Level0)
+{
+    SendAxisEvent({{PointerEvent::AxisType::AXIS_TYPE_ABS_X, FULL_VALUE}});
+    int32_t pointerId = context_->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + mappingInfo_.keyCode).second;
+
+    SendAxisEvent({{PointerEvent::AxisType::AXIS_TYPE_ABS_X, 0.0},
+                   {PointerEvent::AxisType::AXIS_TYPE_ABS_Y, 0.0}});
+
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+    ASSERT_EQ(handler_->touchEntity_.pointerId, pointerId);
+    ASSERT_FALSE(context_->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + mappingInfo_.keyCode).first);
+    ASSERT_TRUE(context_->gamePadAxes.empty());
+}
+}
+}
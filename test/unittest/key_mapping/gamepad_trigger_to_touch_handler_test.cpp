@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include "gamepad_trigger_to_touch_handler.h"
+#include "refbase.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t X_VALUE = 1800;
+const int32_t Y_VALUE = 700;
+const int32_t DEAD_ZONE = 20;
+const double IN_DEAD_ZONE_VALUE = 0.15;
+const double PRESSED_VALUE = 0.3;
+const double RELEASED_VALUE = 0.05;
+}
+class GamePadTriggerToTouchHandlerEx : public GamePadTriggerToTouchHandler {
+public:
+    void BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context_,
+                                  const TouchEntity &touchEntity) override
+    {
+        BaseKeyToTouchHandler::BuildAndSendPointerEvent(context_, touchEntity);
+        touchEntity_ = touchEntity;
+        sendCount_++;
+    }
+
+public:
+    TouchEntity touchEntity_;
+    int32_t sendCount_{0};
+};
+
+class GamePadTriggerToTouchHandlerTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        handler_ = std::make_shared<GamePadTriggerToTouchHandlerEx>();
+        mappingInfo_.mappingType = MappingTypeEnum::GAMEPAD_TRIGGER_TO_TOUCH;
+        mappingInfo_.keyCode = GamePadAxisSourceTypeEnum::RightTriggerAxis;
+        mappingInfo_.xValue = X_VALUE;
+        mappingInfo_.yValue = Y_VALUE;
+        mappingInfo_.deadZone = DEAD_ZONE;
+        context_ = std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_PAD, WindowInfoEntity(),
+                                                         std::vector<KeyToTouchMappingInfo>{mappingInfo_});
+    }
+
+    void TearDown() override
+    {
+        context_->ResetTempVariables();
+    }
+
+    void SendTriggerEvent(double value)
+    {
+        std::shared_ptr<MMI::PointerEvent> pointerEvent = PointerEvent::Create();
+        pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_JOYSTICK);
+        pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_AXIS_UPDATE);
+        pointerEvent->SetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_GAS, value);
+        handler_->HandlePointerEvent(context_, pointerEvent, mappingInfo_);
+    }
+
+public:
+    std::shared_ptr<GamePadTriggerToTouchHandlerEx> handler_;
+    std::shared_ptr<InputToTouchContext> context_;
+    KeyToTouchMappingInfo mappingInfo_;
+};
+
+/**
+ * @tc.name: HandlePointerEvent_001
+ * @tc.desc: the trigger is pressed out of the dead zone, and released in the half of it,
+ *           so it doesn't chatter around the dead zone
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadTriggerToTouchHandlerTest, HandlePointerEvent_001, TestSize.Level0)
+{
+    SendTriggerEvent(IN_DEAD_ZONE_VALUE);
+    ASSERT_EQ(handler_->sendCount_, 0);
+
+    SendTriggerEvent(PRESSED_VALUE);
+    ASSERT_EQ(handler_->sendCount_, 1);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_DOWN);
+    ASSERT_EQ(handler_->touchEntity_.xValue, X_VALUE);
+    ASSERT_EQ(handler_->touchEntity_.yValue, Y_VALUE);
+    int32_t pointerId = handler_->touchEntity_.pointerId;
+
+    SendTriggerEvent(IN_DEAD_ZONE_VALUE);
+    ASSERT_EQ(handler_->sendCount_, 1);
+
+    SendTriggerEvent(RELEASED_VALUE);
+    ASSERT_EQ(handler_->sendCount_, 2);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+    ASSERT_EQ(handler_->touchEntity_.pointerId, pointerId);
+    ASSERT_FALSE(context_->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + mappingInfo_.keyCode).first);
+}
+
+/**
+ * @tc.name: HandlePointerEvent_002
+ * @tc.desc: the thumbstick mapped as a trigger is discarded
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GamePadTriggerToTouchHandlerTest, HandlePointerEvent_002, TestSize.Level0)
+{
+    mappingInfo_.keyCode = GamePadAxisSourceTypeEnum::LeftThumbstick;
+
+    SendTriggerEvent(PRESSED_VALUE);
+
+    ASSERT_EQ(handler_->sendCount_, 0);
+    ASSERT_TRUE(context_->gamePadAxes.empty());
+}
+}
+}
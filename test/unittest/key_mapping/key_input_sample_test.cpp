@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+#include "key_input_sample.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t DEVICE_ID = 11;
+const int32_t OTHER_DEVICE_ID = 12;
+const int32_t KEY_CODE = 2301;
+const int64_t ONLINE_TIME = 1000;
+const int64_t ACTION_TIME = 5000;
+}
+
+class KeyInputSampleTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        keyEvent_ = MMI::KeyEvent::Create();
+        keyEvent_->SetKeyCode(KEY_CODE);
+        keyEvent_->SetKeyAction(MMI::KeyEvent::KEY_ACTION_DOWN);
+        keyEvent_->SetDeviceId(DEVICE_ID);
+        keyEvent_->SetActionTime(ACTION_TIME);
+    }
+
+    void AddKeyItem(int32_t keyCode, int64_t downTime, bool isPressed = true, int32_t deviceId = DEVICE_ID)
+    {
+        MMI::KeyEvent::KeyItem keyItem;
+        keyItem.SetKeyCode(keyCode);
+        keyItem.SetDownTime(downTime);
+        keyItem.SetPressed(isPressed);
+        keyItem.SetDeviceId(deviceId);
+        keyEvent_->AddKeyItem(keyItem);
+    }
+
+public:
+    std::shared_ptr<MMI::KeyEvent> keyEvent_;
+};
+
+/**
+ * @tc.name: Build_001
+ * @tc.desc: only the keys pressed on the same device since it's online are kept, in the order they are pressed
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyInputSampleTest, Build_001, TestSize.Level0)
+{
+    AddKeyItem(KEY_CODE, ACTION_TIME);
+    AddKeyItem(KEY_CODE + 1, ONLINE_TIME + 2);
+    AddKeyItem(KEY_CODE + 2, ONLINE_TIME - 1);
+    AddKeyItem(KEY_CODE + 3, ONLINE_TIME + 1, false);
+    AddKeyItem(KEY_CODE + 4, ONLINE_TIME + 1, true, OTHER_DEVICE_ID);
+    AddKeyItem(KEY_CODE + 5, ONLINE_TIME + 1);
+
+    KeyInputSample sample = KeyInputSample::Build(keyEvent_, DeviceTypeEnum::GAME_KEY_BOARD, ONLINE_TIME);
+
+    ASSERT_EQ(sample.keyCode, KEY_CODE);
+    ASSERT_EQ(sample.actionTime, ACTION_TIME);
+    ASSERT_EQ(sample.deviceId, DEVICE_ID);
+    ASSERT_EQ(sample.deviceType, DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_TRUE(sample.IsKeyDown());
+    ASSERT_EQ(sample.pressedKeyCount, 3);
+    ASSERT_EQ(sample.pressedKeys[0].keyCode, KEY_CODE + 5);
+    ASSERT_EQ(sample.pressedKeys[1].keyCode, KEY_CODE + 1);
+    ASSERT_EQ(sample.pressedKeys[2].keyCode, KEY_CODE);
+}
+
+/**
+ * @tc.name: Build_002
+ * @tc.desc: the oldest keys are dropped when too many keys are pressed
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyInputSampleTest, Build_002, TestSize.Level0)
+{
+    int32_t keyCount = MAX_SAMPLE_PRESSED_KEYS + 2;
+    for (int32_t idx = keyCount - 1; idx >= 0; idx--) {
+        AddKeyItem(KEY_CODE + idx, ONLINE_TIME + idx);
+    }
+
+    KeyInputSample sample = KeyInputSample::Build(keyEvent_, DeviceTypeEnum::GAME_KEY_BOARD, ONLINE_TIME);
+
+    ASSERT_EQ(sample.pressedKeyCount, MAX_SAMPLE_PRESSED_KEYS);
+    ASSERT_EQ(sample.pressedKeys[0].keyCode, KEY_CODE + keyCount - MAX_SAMPLE_PRESSED_KEYS);
+    ASSERT_EQ(sample.pressedKeys[MAX_SAMPLE_PRESSED_KEYS - 1].keyCode, KEY_CODE + keyCount - 1);
+}
+
+/**
+ * @tc.name: Build_003
+ * @tc.desc: the cancel event is a key up event, and the null event is neither down nor up
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyInputSampleTest, Build_003, TestSize.Level0)
+{
+    keyEvent_->SetKeyAction(MMI::KeyEvent::KEY_ACTION_CANCEL);
+    ASSERT_TRUE(KeyInputSample::Build(keyEvent_, DeviceTypeEnum::GAME_KEY_BOARD, ONLINE_TIME).IsKeyUp());
+
+    KeyInputSample sample = KeyInputSample::Build(nullptr, DeviceTypeEnum::GAME_PAD, ONLINE_TIME);
+    ASSERT_FALSE(sample.IsKeyDown());
+    ASSERT_FALSE(sample.IsKeyUp());
+    ASSERT_EQ(sample.pressedKeyCount, 0);
+}
+}
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+
+#define private public
+
+#include "key_to_touch_event_channel.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const std::string QUEUE_NAME = "key-to-touch-event-channel-test";
+const size_t SMALL_CAPACITY = 2;
+const size_t NOT_POWER_OF_TWO_CAPACITY = 5;
+const size_t ROUNDED_CAPACITY = 8;
+const size_t SMALL_MAX_BATCH_SIZE = 4;
+const int32_t EVENT_COUNT = 10;
+const int32_t TASK_ID = 1000;
+const int32_t SENDER_COUNT = 4;
+const int32_t EVENT_COUNT_PER_SENDER = 500;
+const size_t BUCKET_OF_2 = 1;
+const size_t BUCKET_OF_4 = 2;
+const int32_t UNBLOCK_DELAY_TIME = 20;
+}
+
+class KeyToTouchEventChannelTest : public testing::Test {
+public:
+    void SetUp() override;
+
+    /**
+     * Records the id of every handled event. The ids of the pointer events are negative.
+     */
+    void OnEvent(const KeyToTouchEvent &event);
+
+    std::vector<int32_t> GetIds();
+
+    /**
+     * The handler waits in the first event until Unblock is called.
+     */
+    void BlockFirstEvent();
+
+    void WaitBlocked();
+
+    void Unblock();
+
+    static KeyToTouchEvent BuildKeyEvent(int32_t id);
+
+    static KeyToTouchEvent BuildPointerEvent(KeyToTouchEventTypeEnum type, int32_t id);
+
+public:
+    std::unique_ptr<GameControllerQueue> handleQueue_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<int32_t> ids_;
+    bool isBlocking_ = false;
+    bool isBlocked_ = false;
+};
+
+void KeyToTouchEventChannelTest::SetUp()
+{
+    handleQueue_ = DelayedSingleton<GameControllerQueueRegistry>::GetInstance()->CreateQueue(QUEUE_NAME);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ids_.clear();
+    isBlocking_ = false;
+    isBlocked_ = false;
+}
+
+void KeyToTouchEventChannelTest::OnEvent(const KeyToTouchEvent &event)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (isBlocking_ && ids_.empty()) {
+        isBlocked_ = true;
+        condition_.notify_all();
+        condition_.wait(lock, [this] { return !isBlocking_; });
+    }
+    if (event.keyEvent != nullptr) {
+        ids_.push_back(event.keyEvent->GetId());
+    } else if (event.pointerEvent != nullptr) {
+        ids_.push_back(-event.pointerEvent->GetId());
+    }
+}
+
+std::vector<int32_t> KeyToTouchEventChannelTest::GetIds()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ids_;
+}
+
+void KeyToTouchEventChannelTest::BlockFirstEvent()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    isBlocking_ = true;
+}
+
+void KeyToTouchEventChannelTest::WaitBlocked()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] { return isBlocked_; });
+}
+
+void KeyToTouchEventChannelTest::Unblock()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isBlocking_ = false;
+    }
+    condition_.notify_all();
+}
+
+KeyToTouchEvent KeyToTouchEventChannelTest::BuildKeyEvent(int32_t id)
+{
+    KeyToTouchEvent event;
+    event.type = KEY_TO_TOUCH_KEY_EVENT;
+    event.keyEvent = MMI::KeyEvent::Create();
+    event.keyEvent->SetId(id);
+    return event;
+}
+
+KeyToTouchEvent KeyToTouchEventChannelTest::BuildPointerEvent(KeyToTouchEventTypeEnum type, int32_t id)
+{
+    KeyToTouchEvent event;
+    event.type = type;
+    event.pointerEvent = MMI::PointerEvent::Create();
+    event.pointerEvent->SetId(id);
+    return event;
+}
+
+/**
+ * @tc.name: Send_001
+ * @tc.desc: The key events, pointer events and context tasks are handled in the order they're sent
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchEventChannelTest, Send_001, TestSize.Level0)
+{
+    KeyToTouchEventChannel channel(handleQueue_.get(), KEY_TO_TOUCH_EVENT_CHANNEL_CAPACITY,
+                                   [this](const KeyToTouchEvent &event) {
+                                       if (event.task != nullptr) {
+                                           event.task();
+                                       }
+                                       OnEvent(event);
+                                   });
+    std::vector<int32_t> expectedIds;
+    for (int32_t idx = 1; idx <= EVENT_COUNT; idx++) {
+        channel.Send(BuildKeyEvent(idx));
+        channel.Send(BuildPointerEvent(idx % 2 == 0 ? KEY_TO_TOUCH_MOUSE_EVENT : KEY_TO_TOUCH_GAME_PAD_AXIS_EVENT,
+                                       idx));
+        expectedIds.push_back(idx);
+        expectedIds.push_back(-idx);
+    }
+    KeyToTouchEvent taskEvent;
+    taskEvent.type = KEY_TO_TOUCH_CONTEXT_TASK;
+    taskEvent.task = [this] {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ids_.push_back(TASK_ID);
+    };
+    channel.Send(std::move(taskEvent));
+    expectedIds.push_back(TASK_ID);
+    channel.WaitIdle();
+    ASSERT_EQ(expectedIds, GetIds());
+
+    // the handled events are released from the slots
+    for (const auto &slot: channel.slots_) {
+        ASSERT_EQ(nullptr, slot.keyEvent);
+        ASSERT_EQ(nullptr, slot.pointerEvent);
+        ASSERT_EQ(nullptr, slot.task);
+    }
+}
+
+/**
+ * @tc.name: Send_002
+ * @tc.desc: When the ring is full, the events wait in the overflow list and are handled in order
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchEventChannelTest, Send_002, TestSize.Level0)
+{
+    KeyToTouchEventChannel channel(handleQueue_.get(), SMALL_CAPACITY, [this](const KeyToTouchEvent &event) {
+        OnEvent(event);
+    });
+    BlockFirstEvent();
+    std::vector<int32_t> expectedIds;
+    for (int32_t idx = 1; idx <= EVENT_COUNT; idx++) {
+        channel.Send(BuildKeyEvent(idx));
+        expectedIds.push_back(idx);
+    }
+    WaitBlocked();
+    Unblock();
+    channel.WaitIdle();
+    ASSERT_EQ(expectedIds, GetIds());
+    ASSERT_TRUE(channel.overflowEvents_.empty());
+    ASSERT_TRUE(channel.drainingEvents_.empty());
+    BatchedChannelStats stats = channel.GetStats();
+    ASSERT_GT(stats.overflowCount, 0);
+    ASSERT_EQ(EVENT_COUNT, stats.eventCount);
+}
+
+/**
+ * @tc.name: Send_003
+ * @tc.desc: The events of several senders are all handled, and the events of one sender keep their order
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchEventChannelTest, Send_003, TestSize.Level0)
+{
+    KeyToTouchEventChannel channel(handleQueue_.get(), SMALL_CAPACITY, [this](const KeyToTouchEvent &event) {
+        OnEvent(event);
+    });
+    channel.SetMaxBatchSize(SMALL_MAX_BATCH_SIZE);
+    std::vector<std::thread> senders;
+    for (int32_t sender = 0; sender < SENDER_COUNT; sender++) {
+        senders.emplace_back([&channel, sender] {
+            for (int32_t idx = 0; idx < EVENT_COUNT_PER_SENDER; idx++) {
+                channel.Send(BuildKeyEvent(sender * EVENT_COUNT_PER_SENDER + idx));
+            }
+        });
+    }
+    for (auto &sender: senders) {
+        sender.join();
+    }
+    channel.WaitIdle();
+
+    std::vector<int32_t> ids = GetIds();
+    ASSERT_EQ(SENDER_COUNT * EVENT_COUNT_PER_SENDER, ids.size());
+    std::vector<int32_t> lastIds(SENDER_COUNT, -1);
+    for (int32_t id: ids) {
+        int32_t sender = id / EVENT_COUNT_PER_SENDER;
+        ASSERT_LT(lastIds[sender], id);
+        lastIds[sender] = id;
+    }
+}
+
+/**
+ * @tc.name: Drain_001
+ * @tc.desc: The pending events are handled by one drain task up to the max batch size,
+ * and the rest are handled by the drain tasks after it
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchEventChannelTest, Drain_001, TestSize.Level0)
+{
+    KeyToTouchEventChannel channel(handleQueue_.get(), KEY_TO_TOUCH_EVENT_CHANNEL_CAPACITY,
+                                   [this](const KeyToTouchEvent &event) {
+                                       OnEvent(event);
+                                   });
+    channel.SetMaxBatchSize(SMALL_MAX_BATCH_SIZE);
+    BlockFirstEvent();
+    channel.Send(BuildKeyEvent(1));
+    WaitBlocked();
+
+    // 10 events are pending in the first drain task, so they are handled in the batches of 4, 4 and 2.
+    for (int32_t idx = 2; idx <= EVENT_COUNT; idx++) {
+        channel.Send(BuildKeyEvent(idx));
+    }
+    Unblock();
+    channel.WaitIdle();
+    ASSERT_EQ(EVENT_COUNT, GetIds().size());
+    BatchedChannelStats stats = channel.GetStats();
+    ASSERT_EQ(EVENT_COUNT, stats.eventCount);
+    ASSERT_EQ(3, stats.batchCount);
+    ASSERT_EQ(SMALL_MAX_BATCH_SIZE, stats.maxBatchSize);
+    ASSERT_EQ(2, stats.batchSizeHistogram[BUCKET_OF_4]);
+    ASSERT_EQ(1, stats.batchSizeHistogram[BUCKET_OF_2]);
+}
+
+/**
+ * @tc.name: Stop_001
+ * @tc.desc: The events sent before Stop are handled, and the ones sent after it are dropped without a drain task
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchEventChannelTest, Stop_001, TestSize.Level0)
+{
+    KeyToTouchEventChannel channel(handleQueue_.get(), KEY_TO_TOUCH_EVENT_CHANNEL_CAPACITY,
+                                   [this](const KeyToTouchEvent &event) {
+                                       OnEvent(event);
+                                   });
+    BlockFirstEvent();
+    channel.Send(BuildKeyEvent(1));
+    WaitBlocked();
+    channel.Send(BuildKeyEvent(2));
+    std::thread unblockThread([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(UNBLOCK_DELAY_TIME));
+        Unblock();
+    });
+
+    // It waits for the drain task which is blocked.
+    channel.Stop();
+    unblockThread.join();
+    ASSERT_EQ(std::vector<int32_t>({1, 2}), GetIds());
+
+    channel.Send(BuildKeyEvent(3));
+    handleQueue_->wait(handleQueue_->submit_h([] {}));
+    ASSERT_EQ(std::vector<int32_t>({1, 2}), GetIds());
+    ASSERT_TRUE(channel.isStopped_);
+}
+
+/**
+ * @tc.name: SetMaxBatchSize_001
+ * @tc.desc: 0 means the default max batch size, and the capacity is rounded up to a power of 2
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchEventChannelTest, SetMaxBatchSize_001, TestSize.Level0)
+{
+    KeyToTouchEventChannel channel(handleQueue_.get(), NOT_POWER_OF_TWO_CAPACITY, [](const KeyToTouchEvent &) {},
+                                   KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE);
+    ASSERT_EQ(ROUNDED_CAPACITY, channel.GetCapacity());
+    ASSERT_EQ(KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE, channel.GetMaxBatchSize());
+    channel.SetMaxBatchSize(SMALL_MAX_BATCH_SIZE);
+    ASSERT_EQ(SMALL_MAX_BATCH_SIZE, channel.GetMaxBatchSize());
+    channel.SetMaxBatchSize(0);
+    ASSERT_EQ(KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE, channel.GetMaxBatchSize());
+}
+}
+}
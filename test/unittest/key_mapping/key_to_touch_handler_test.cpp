@@ -20,12 +20,15 @@
 #include <gtest/gtest.h>
 
 #define private public
+#define protected public
 
 #include "key_to_touch_handler.h"
 
+#undef protected
 #undef private
 
 #include "refbase.h"
+#include "gamecontroller_utils.h"
 
 using ::testing::Return;
 using namespace testing::ext;
@@ -44,6 +47,14 @@ const int32_t MOUSE_LEFT_BUTTON_ID = 0;
 const int32_t MOUSE_RIGHT_BUTTON_ID = 1;
 const int32_t POINTER_ID_START = 3;
 const int32_t RADIUS = 100;
+const int32_t STEP = 10;
+const int32_t MOUSE_POSITION = 100;
+const int32_t MOUSE_DELTA = 32;
+const int64_t MOUSE_ACTION_TIME = 1000000;
+const double EPSILON = 1e-9;
+const int64_t MOVE_INTERVAL = 10000;
+const int64_t EXTRA_HORIZON = 10000;
+const int64_t FUTURE_TIME = 1000000000;
 }
 
 class TestKeyToTouchHandlerEx : public BaseKeyToTouchHandler {
@@ -58,16 +69,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo, const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        BaseKeyToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        BaseKeyToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        BaseKeyToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        BaseKeyToTouchHandler::HandleKeyUp(context, sample);
     }
 
     void HandlePointerEvent(std::shared_ptr<InputToTouchContext> &context,
@@ -138,6 +149,11 @@ public:
         return windowInfo;
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<TestKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -395,7 +411,7 @@ HWTEST_F(BaseKeyToTouchHandlerTest, HandleKeyEvent_001, TestSize.Level0)
 {
     std::shared_ptr<MMI::KeyEvent> nullKeyEvent = nullptr;
 
-    handler_->HandleKeyEvent(context_, nullKeyEvent, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(nullKeyEvent), mappingInfo_);
 
     ASSERT_EQ(handler_->touchEntity_.pointerId, 0);
 }
@@ -410,7 +426,7 @@ HWTEST_F(BaseKeyToTouchHandlerTest, HandleKeyEvent_002, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
 
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(handler_->touchEntity_.pointerId, 0);
 }
@@ -425,7 +441,7 @@ HWTEST_F(BaseKeyToTouchHandlerTest, HandleKeyEvent_003, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
 
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(handler_->touchEntity_.pointerId, 0);
 }
@@ -440,7 +456,7 @@ HWTEST_F(BaseKeyToTouchHandlerTest, HandleKeyEvent_004, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UNKNOWN);
 
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(handler_->touchEntity_.pointerId, 0);
 }
@@ -471,6 +487,202 @@ HWTEST_F(BaseKeyToTouchHandlerTest, ExitCrosshairKeyStatus_001, TestSize.Level0)
     ASSERT_EQ(handler_->touchEntity_.pointerId, 0);
 }
 
+/**
+ * @tc.name: ComputeTouchPointByMouseMoveEvent_001
+ * @tc.desc: the mouse moves are scaled by the response curve, and the fractions are added to the next move
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(BaseKeyToTouchHandlerTest, ComputeTouchPointByMouseMoveEvent_001, TestSize.Level0)
+{
+    ResponseCurve curve;
+    curve.type = RESPONSE_CURVE_POWER;
+    curve.exponent = 2.0;
+    context_->responseCurveTable = ResponseCurveTable(curve);
+    context_->windowInfoEntity = windowInfo_;
+    mappingInfo_.mappingType = MappingTypeEnum::MOUSE_OBSERVATION_TO_TOUCH;
+    mappingInfo_.xStep = STEP;
+    mappingInfo_.yStep = STEP;
+    int32_t pointerId = POINTER_ID_START;
+    PointerEvent::PointerItem lastMovePoint;
+    lastMovePoint.SetWindowX(X_VALUE);
+    lastMovePoint.SetWindowY(Y_VALUE);
+    context_->pointerItems[pointerId] = lastMovePoint;
+    context_->lastMousePointer.SetWindowX(MOUSE_POSITION);
+    context_->lastMousePointer.SetWindowY(MOUSE_POSITION);
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    PointerEvent::PointerItem mousePoint;
+    mousePoint.SetWindowY(MOUSE_POSITION);
+
+    // the speed of the move of 32 in 8 ms is 32, its gain is (32 / 128) ^ (2 - 1) = 0.25,
+    // so the touch moves 2.5 each time
+    mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA);
+    pointerEvent_->AddPointerItem(mousePoint);
+    pointerEvent_->SetActionTime(MOUSE_ACTION_TIME);
+    handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + 2);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowY(), Y_VALUE);
+
+    mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA * 2);
+    pointerEvent_->UpdatePointerItem(pointerEvent_->GetPointerId(), mousePoint);
+    pointerEvent_->SetActionTime(MOUSE_ACTION_TIME + RESPONSE_CURVE_SPEED_INTERVAL);
+    handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + 5);
+
+    // the fraction isn't kept when the direction is changed
+    mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA);
+    pointerEvent_->UpdatePointerItem(pointerEvent_->GetPointerId(), mousePoint);
+    pointerEvent_->SetActionTime(MOUSE_ACTION_TIME + RESPONSE_CURVE_SPEED_INTERVAL * 2);
+    handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + 3);
+    ASSERT_NEAR(context_->xMoveRemainder, -0.5, EPSILON);
+}
+
+/**
+ * @tc.name: ComputeTouchPointByMouseMoveEvent_002
+ * @tc.desc: the touch is extrapolated when the motion predictor is enabled, the next move starts from
+ * the position computed from the mouse, and the samples are dropped when the touch is moved by others
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(BaseKeyToTouchHandlerTest, ComputeTouchPointByMouseMoveEvent_002, TestSize.Level0)
+{
+    context_->windowInfoEntity = windowInfo_;
+    context_->motionPredictor.SetEnabled(true);
+    context_->motionPredictor.SetExtraHorizon(EXTRA_HORIZON);
+    mappingInfo_.mappingType = MappingTypeEnum::MOUSE_OBSERVATION_TO_TOUCH;
+    mappingInfo_.xStep = STEP;
+    mappingInfo_.yStep = STEP;
+    int32_t pointerId = POINTER_ID_START;
+    PointerEvent::PointerItem lastMovePoint;
+    lastMovePoint.SetWindowX(X_VALUE);
+    lastMovePoint.SetWindowY(Y_VALUE);
+    context_->pointerItems[pointerId] = lastMovePoint;
+    context_->lastMousePointer.SetWindowX(MOUSE_POSITION);
+    context_->lastMousePointer.SetWindowY(MOUSE_POSITION);
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    PointerEvent::PointerItem mousePoint;
+    mousePoint.SetWindowY(MOUSE_POSITION);
+    pointerEvent_->AddPointerItem(mousePoint);
+
+    // The action times are in the future, so no latency is measured and the horizon is the extra horizon.
+    int64_t actionTime = StringUtils::GetSysClockTime() + FUTURE_TIME;
+    std::vector<int32_t> expectedPositions = {X_VALUE + STEP, X_VALUE + STEP * 3, X_VALUE + STEP * 4};
+    for (size_t idx = 0; idx < expectedPositions.size(); idx++) {
+        mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA * static_cast<int32_t>(idx + 1));
+        pointerEvent_->UpdatePointerItem(pointerEvent_->GetPointerId(), mousePoint);
+        pointerEvent_->SetActionTime(actionTime + MOVE_INTERVAL * static_cast<int64_t>(idx));
+        handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+        ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), expectedPositions[idx]);
+    }
+    MotionSample lastSample;
+    ASSERT_TRUE(context_->motionPredictor.GetLastSample(lastSample));
+    ASSERT_NEAR(lastSample.x, X_VALUE + STEP * 3, EPSILON);
+
+    context_->pointerItems[pointerId] = lastMovePoint;
+    mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA * 4);
+    pointerEvent_->UpdatePointerItem(pointerEvent_->GetPointerId(), mousePoint);
+    pointerEvent_->SetActionTime(actionTime + MOVE_INTERVAL * 3);
+    handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + STEP);
+}
+
+/**
+ * @tc.name: ComputeTouchPointByMouseMoveEvent_003
+ * @tc.desc: the response curve takes the mouse speed, so the same move in a shorter time has a larger gain
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(BaseKeyToTouchHandlerTest, ComputeTouchPointByMouseMoveEvent_003, TestSize.Level0)
+{
+    ResponseCurve curve;
+    curve.type = RESPONSE_CURVE_POWER;
+    curve.exponent = 2.0;
+    context_->responseCurveTable = ResponseCurveTable(curve);
+    context_->windowInfoEntity = windowInfo_;
+    mappingInfo_.mappingType = MappingTypeEnum::MOUSE_OBSERVATION_TO_TOUCH;
+    mappingInfo_.xStep = STEP;
+    mappingInfo_.yStep = STEP;
+    int32_t pointerId = POINTER_ID_START;
+    PointerEvent::PointerItem lastMovePoint;
+    lastMovePoint.SetWindowX(X_VALUE);
+    lastMovePoint.SetWindowY(Y_VALUE);
+    context_->pointerItems[pointerId] = lastMovePoint;
+    context_->lastMousePointer.SetWindowX(MOUSE_POSITION);
+    context_->lastMousePointer.SetWindowY(MOUSE_POSITION);
+    context_->lastMouseActionTime = MOUSE_ACTION_TIME;
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    PointerEvent::PointerItem mousePoint;
+    mousePoint.SetWindowY(MOUSE_POSITION);
+
+    // the move of 32 in 2 ms is 128 per 8 ms, so its gain is 1 and the touch moves a full step
+    mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA);
+    pointerEvent_->AddPointerItem(mousePoint);
+    pointerEvent_->SetActionTime(MOUSE_ACTION_TIME + RESPONSE_CURVE_SPEED_INTERVAL / 4);
+    handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + STEP);
+    ASSERT_EQ(context_->lastMouseActionTime, MOUSE_ACTION_TIME + RESPONSE_CURVE_SPEED_INTERVAL / 4);
+
+    // a move after a pause is taken as one report, so it's not slowed down by the pause
+    mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA * 2);
+    pointerEvent_->UpdatePointerItem(pointerEvent_->GetPointerId(), mousePoint);
+    pointerEvent_->SetActionTime(MOUSE_ACTION_TIME + RESPONSE_CURVE_SPEED_INTERVAL * 100);
+    handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    ASSERT_NEAR(context_->xMoveRemainder, 0.5, EPSILON);
+}
+
+/**
+ * @tc.name: RunMotionSettle_001
+ * @tc.desc: the predicted touch is moved back to the last mouse position once the mouse stops
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(BaseKeyToTouchHandlerTest, RunMotionSettle_001, TestSize.Level0)
+{
+    context_->windowInfoEntity = windowInfo_;
+    context_->motionPredictor.SetEnabled(true);
+    context_->motionPredictor.SetExtraHorizon(EXTRA_HORIZON);
+    mappingInfo_.mappingType = MappingTypeEnum::MOUSE_OBSERVATION_TO_TOUCH;
+    mappingInfo_.xStep = STEP;
+    mappingInfo_.yStep = STEP;
+    int32_t pointerId = POINTER_ID_START;
+    PointerEvent::PointerItem lastMovePoint;
+    lastMovePoint.SetWindowX(X_VALUE);
+    lastMovePoint.SetWindowY(Y_VALUE);
+    context_->pointerItems[pointerId] = lastMovePoint;
+    context_->lastMousePointer.SetWindowX(MOUSE_POSITION);
+    context_->lastMousePointer.SetWindowY(MOUSE_POSITION);
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    PointerEvent::PointerItem mousePoint;
+    mousePoint.SetWindowY(MOUSE_POSITION);
+    pointerEvent_->AddPointerItem(mousePoint);
+    int64_t actionTime = StringUtils::GetSysClockTime() + FUTURE_TIME;
+    for (int32_t idx = 1; idx <= 3; idx++) {
+        mousePoint.SetWindowX(MOUSE_POSITION + MOUSE_DELTA * idx);
+        pointerEvent_->UpdatePointerItem(pointerEvent_->GetPointerId(), mousePoint);
+        pointerEvent_->SetActionTime(actionTime + MOVE_INTERVAL * (idx - 1));
+        handler_->ComputeTouchPointByMouseMoveEvent(context_, pointerEvent_, mappingInfo_, pointerId);
+    }
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + STEP * 4);
+    ASSERT_EQ(context_->motionSettlePointerId, pointerId);
+
+    // the mouse may still be moving
+    int64_t lastSampleTime = actionTime + MOVE_INTERVAL * 2;
+    handler_->RunMotionSettle(context_, lastSampleTime + MOVE_INTERVAL);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + STEP * 4);
+
+    // the mouse stops
+    handler_->RunMotionSettle(context_, lastSampleTime + TouchMotionPredictor::MAX_SAMPLE_GAP);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowX(), X_VALUE + STEP * 3);
+    ASSERT_EQ(context_->pointerItems[pointerId].GetWindowY(), Y_VALUE);
+    ASSERT_TRUE(context_->motionPredictor.IsInjectedPoint(X_VALUE + STEP * 3, Y_VALUE));
+
+    // the touch released in the meantime isn't moved
+    context_->pointerItems.erase(pointerId);
+    handler_->RunMotionSettle(context_, lastSampleTime + TouchMotionPredictor::MAX_SAMPLE_GAP * 2);
+    ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
+}
+
 class PointerManagerTest : public testing::Test {
 public:
     void SetUp() override
@@ -815,6 +1027,235 @@ HWTEST_F(InputToTouchContextTest, InputToTouchContext_Constructor_008, TestSize.
     ASSERT_TRUE(context->isMonitorMouse);
 }
 
+/**
+ * @tc.name: InputToTouchContext_Constructor_009
+ * @tc.desc: Constructor should scale the template from its reference resolution to the window
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, InputToTouchContext_Constructor_009, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    mappingInfos.push_back(BuildSingleKeyMappingInfo(KEY_CODE_B));
+    mappingInfos.push_back(BuildSkillKeyMappingInfo());
+    TemplateResolution resolution;
+    resolution.width = MAX_WIDTH / 2;
+    resolution.height = MAX_HEIGHT / 2;
+
+    std::shared_ptr<InputToTouchContext> context =
+        std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_KEY_BOARD, windowInfo_, mappingInfos, resolution);
+
+    ASSERT_EQ(context->singleKeyMappings.size(), 2);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_B].xValue, X_VALUE * 2);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_B].yValue, Y_VALUE * 2);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_A].radius, RADIUS * 2);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_A].skillRange, 2);
+    ASSERT_EQ(context->templateMappingInfos[0].xValue, X_VALUE);
+}
+
+/**
+ * @tc.name: InputToTouchContext_UpdateWindowInfo_001
+ * @tc.desc: UpdateWindowInfo should not rebuild the key mappings of a template in window pixels
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, InputToTouchContext_UpdateWindowInfo_001, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    mappingInfos.push_back(BuildSingleKeyMappingInfo(KEY_CODE_A));
+    std::shared_ptr<InputToTouchContext> context =
+        std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_KEY_BOARD, windowInfo_, mappingInfos);
+    WindowInfoEntity windowInfo = windowInfo_;
+    windowInfo.currentWidth = MAX_WIDTH / 2;
+    windowInfo.currentHeight = MAX_HEIGHT / 2;
+
+    bool result = context->UpdateWindowInfo(windowInfo);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(context->windowInfoEntity.currentWidth, MAX_WIDTH / 2);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_A].xValue, X_VALUE);
+}
+
+/**
+ * @tc.name: InputToTouchContext_UpdateWindowInfo_002
+ * @tc.desc: UpdateWindowInfo should rebuild the key mappings for the new window size and keep the pressed keys
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, InputToTouchContext_UpdateWindowInfo_002, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> mappingInfos;
+    mappingInfos.push_back(BuildSingleKeyMappingInfo(KEY_CODE_A));
+    mappingInfos.push_back(BuildCrosshairKeyMappingInfo());
+    mappingInfos[1].keyCode = KEY_CODE_B;
+    TemplateResolution resolution;
+    resolution.width = MAX_WIDTH;
+    resolution.height = MAX_HEIGHT;
+    std::shared_ptr<InputToTouchContext> context =
+        std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_KEY_BOARD, windowInfo_, mappingInfos, resolution);
+    context->SetCurrentSingleKeyInfo(context->singleKeyMappings[KEY_CODE_A], 1);
+    WindowInfoEntity windowInfo = windowInfo_;
+    windowInfo.currentWidth = MAX_WIDTH / 2;
+    windowInfo.currentHeight = MAX_HEIGHT;
+
+    ASSERT_FALSE(context->UpdateWindowInfo(windowInfo_));
+    ASSERT_TRUE(context->UpdateWindowInfo(windowInfo));
+
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_A].xValue, (X_VALUE + 1) / 2);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_A].yValue, Y_VALUE);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_B].xStep, 5);
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_B].yStep, 10);
+    ASSERT_TRUE(context->HasSingleKeyDown(KEY_CODE_A));
+    ASSERT_EQ(context->GetPointerIdByKeyCode(KEY_CODE_A).second, 1);
+}
+
+/**
+ * @tc.name: TemplateTransform_Apply_001
+ * @tc.desc: Apply should keep a positive length positive when the window is much smaller than the template
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, TemplateTransform_Apply_001, TestSize.Level0)
+{
+    TemplateResolution resolution;
+    resolution.width = MAX_WIDTH * 10;
+    resolution.height = MAX_HEIGHT * 10;
+    TemplateTransform transform(resolution, windowInfo_);
+    KeyToTouchMappingInfo mappingInfo = BuildSkillKeyMappingInfo();
+
+    KeyToTouchMappingInfo result = transform.Apply(mappingInfo);
+
+    ASSERT_FALSE(transform.isIdentity);
+    ASSERT_EQ(result.skillRange, 1);
+    ASSERT_EQ(result.radius, RADIUS / 10);
+    ASSERT_TRUE(TemplateTransform(TemplateResolution(), windowInfo_).isIdentity);
+}
+
+/**
+ * @tc.name: ResponseCurveTable_001
+ * @tc.desc: the gains of the power and table curves are sampled once, and the invalid curve is linear
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, ResponseCurveTable_001, TestSize.Level0)
+{
+    ResponseCurveTable linearTable;
+    ASSERT_DOUBLE_EQ(linearTable.GetGain(RESPONSE_CURVE_MAX_SPEED / 2), 1.0);
+
+    ResponseCurve curve;
+    curve.type = RESPONSE_CURVE_POWER;
+    curve.exponent = 2.0;
+    ResponseCurveTable powerTable(curve);
+    ASSERT_FALSE(powerTable.isLinear);
+    ASSERT_NEAR(powerTable.GetGain(RESPONSE_CURVE_MAX_SPEED / 4), 0.25, EPSILON);
+    ASSERT_NEAR(powerTable.GetGain(-RESPONSE_CURVE_MAX_SPEED / 2), 0.5, EPSILON);
+    ASSERT_NEAR(powerTable.GetGain(RESPONSE_CURVE_MAX_SPEED * 2), 1.0, EPSILON);
+
+    curve.type = RESPONSE_CURVE_TABLE;
+    curve.points = {{0.5, 0.25}, {1.0, 1.0}};
+    ResponseCurveTable table(curve);
+    ASSERT_NEAR(table.GetGain(RESPONSE_CURVE_MAX_SPEED / 4), 0.5, EPSILON);
+    ASSERT_NEAR(table.GetGain(RESPONSE_CURVE_MAX_SPEED / 2), 0.5, EPSILON);
+    ASSERT_NEAR(table.GetGain(RESPONSE_CURVE_MAX_SPEED * 3 / 4), 0.625 / 0.75, EPSILON);
+    ASSERT_NEAR(table.GetGain(RESPONSE_CURVE_MAX_SPEED), 1.0, EPSILON);
+
+    curve.points = {{1.0, 1.0}, {0.5, 0.25}};
+    ASSERT_TRUE(ResponseCurveTable(curve).isLinear);
+}
+
+/**
+ * @tc.name: AxisResponseTable_001
+ * @tc.desc: the deflection in the dead zone is 0, the rest is scaled to (0, 1] and follows the curve
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, AxisResponseTable_001, TestSize.Level0)
+{
+    ASSERT_DOUBLE_EQ(AxisResponseTable().GetOutput(1.0), 0.0);
+
+    AxisResponseTable linearTable(0, ResponseCurve());
+    ASSERT_DOUBLE_EQ(linearTable.deadZone, DEFAULT_AXIS_DEAD_ZONE / 100.0);
+    ASSERT_DOUBLE_EQ(linearTable.GetOutput(0.1), 0.0);
+    ASSERT_NEAR(linearTable.GetOutput(0.55), 0.5, 1e-3);
+    ASSERT_DOUBLE_EQ(linearTable.GetOutput(-1.0), 1.0);
+    ASSERT_DOUBLE_EQ(linearTable.GetOutput(2.0), 1.0);
+    ASSERT_DOUBLE_EQ(linearTable.GetOutput(std::nan("")), 0.0);
+
+    ResponseCurve curve;
+    curve.type = RESPONSE_CURVE_POWER;
+    curve.exponent = 2.0;
+    AxisResponseTable powerTable(0, curve);
+    ASSERT_NEAR(powerTable.GetOutput(0.55), 0.25, 1e-3);
+    ASSERT_DOUBLE_EQ(powerTable.GetOutput(1.0), 1.0);
+}
+
+/**
+ * @tc.name: InputToTouchContext_SwapTemplate_001
+ * @tc.desc: SwapTemplate should keep the operating skill key on the old key mapping until it's released
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, InputToTouchContext_SwapTemplate_001, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> mappingInfos = {BuildSkillKeyMappingInfo()};
+    std::shared_ptr<InputToTouchContext> context =
+        std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_KEY_BOARD, windowInfo_, mappingInfos);
+    context->SetCurrentSkillKeyInfo(context->singleKeyMappings[KEY_CODE_A], 1);
+    InputToTouchContext newContext(DeviceTypeEnum::GAME_KEY_BOARD, windowInfo_,
+                                   {BuildSingleKeyMappingInfo(KEY_CODE_A)});
+
+    context->SwapTemplate(newContext);
+
+    KeyToTouchMappingInfo mappingInfo;
+    ASSERT_EQ(context->singleKeyMappings[KEY_CODE_A].mappingType, MappingTypeEnum::SINGE_KEY_TO_TOUCH);
+    ASSERT_EQ(newContext.singleKeyMappings[KEY_CODE_A].mappingType, MappingTypeEnum::SKILL_KEY_TO_TOUCH);
+    ASSERT_TRUE(context->FindHeldKeyMapping(KEY_CODE_A, mappingInfo));
+    ASSERT_EQ(mappingInfo.mappingType, MappingTypeEnum::SKILL_KEY_TO_TOUCH);
+    ASSERT_TRUE(context->IsHeldMonitorMouse());
+    ASSERT_FALSE(context->PruneHeldKeyMappings());
+
+    context->ResetCurrentSkillKeyInfo();
+    ASSERT_FALSE(context->FindHeldKeyMapping(KEY_CODE_A, mappingInfo));
+    ASSERT_TRUE(context->PruneHeldKeyMappings());
+    ASSERT_TRUE(context->heldKeyMappings.empty());
+}
+
+/**
+ * @tc.name: InputToTouchContext_SwapTemplate_002
+ * @tc.desc: SwapTemplate should keep the held thumbstick on the old key mapping until it's released
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(InputToTouchContextTest, InputToTouchContext_SwapTemplate_002, TestSize.Level0)
+{
+    KeyToTouchMappingInfo stick;
+    stick.mappingType = MappingTypeEnum::GAMEPAD_STICK_TO_TOUCH;
+    stick.keyCode = GamePadAxisSourceTypeEnum::LeftThumbstick;
+    stick.radius = RADIUS;
+    std::shared_ptr<InputToTouchContext> context =
+        std::make_shared<InputToTouchContext>(DeviceTypeEnum::GAME_PAD, windowInfo_,
+                                              std::vector<KeyToTouchMappingInfo>{stick});
+    ASSERT_TRUE(context->IsMonitorGamePadAxis());
+    ASSERT_EQ(context->axisResponseTables.size(), 1);
+    int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
+    context->SetCurrentGamePadAxis(context->axisKeyMappings[stick.keyCode], pointerId);
+    InputToTouchContext newContext(DeviceTypeEnum::GAME_PAD, windowInfo_, {});
+
+    context->SwapTemplate(newContext);
+
+    KeyToTouchMappingInfo mappingInfo;
+    ASSERT_TRUE(context->axisKeyMappings.empty());
+    ASSERT_TRUE(context->FindAxisKeyMapping(stick.keyCode, mappingInfo));
+    ASSERT_EQ(mappingInfo.mappingType, MappingTypeEnum::GAMEPAD_STICK_TO_TOUCH);
+    ASSERT_FALSE(context->gamePadAxes[stick.keyCode].responseTable.outputs.empty());
+    ASSERT_TRUE(context->IsMonitorGamePadAxis());
+
+    context->ResetCurrentGamePadAxis(stick.keyCode);
+    ASSERT_FALSE(context->FindAxisKeyMapping(stick.keyCode, mappingInfo));
+    ASSERT_FALSE(context->IsMonitorGamePadAxis());
+    ASSERT_FALSE(context->GetPointerIdByKeyCode(KEY_CODE_GAMEPAD_AXIS + stick.keyCode).first);
+}
+
 /**
  * @tc.name: HasSingleKeyDown_001
  * @tc.desc: HasSingleKeyDown should return false when keyCode is not in currentSingleKeyMap
@@ -23,10 +23,12 @@
 
 #include "key_to_touch_manager.h"
 #include "multi_modal_input_mgt_service_mock.h"
+#include "gamecontroller_utils.h"
 
 #undef private
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "refbase.h"
 
 using ::testing::Return;
@@ -49,6 +51,14 @@ const int32_t DEVICE_TYPE_KEYBOARD = 3;
 const int32_t DEVICE_TYPE_HOVER_TOUCH_PAD = 2;
 const size_t MAX_SINGLE_KEY_SIZE_FOR_HOVER_TOUCH_PAD = 2;
 const int32_t SLEEP_TIME = 50;
+const int32_t STRESS_ROUNDS = 50;
+const char* STRESS_DEVICE_UNIQ = "stress-device";
+
+struct SimulatedDevice {
+    DeviceTypeEnum deviceType;
+    int32_t deviceId;
+    int32_t keyCode;
+};
 }
 
 class KeyToTouchManagerTest : public testing::Test {
@@ -159,8 +169,7 @@ void KeyToTouchManagerTest::CheckCombinationKey(const DeviceTypeEnum &deviceType
     testMappingInfos.push_back(BuildKeyMapping(MappingTypeEnum::COMBINATION_KEY_TO_TOUCH));
     handler_->HandleTemplateConfig(deviceType, testMappingInfos);
 
-    std::shared_ptr<InputToTouchContext> context =
-        deviceType == DeviceTypeEnum::GAME_KEY_BOARD ? handler_->gcKeyboardContext_ : handler_->hoverTouchPadContext_;
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(deviceType);
 
     ASSERT_FALSE(context == nullptr);
     ASSERT_EQ(context->combinationKeyMappings.size(), 1);
@@ -180,8 +189,7 @@ void KeyToTouchManagerTest::CheckDpadKeyAndKeyBoardObservation(const DeviceTypeE
     testMappingInfos.push_back(BuildKeyMapping(type));
     handler_->HandleTemplateConfig(deviceType, testMappingInfos);
 
-    std::shared_ptr<InputToTouchContext> context =
-        deviceType == DeviceTypeEnum::GAME_KEY_BOARD ? handler_->gcKeyboardContext_ : handler_->hoverTouchPadContext_;
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(deviceType);
 
     ASSERT_FALSE(context == nullptr);
     ASSERT_EQ(context->singleKeyMappings.size(), SINGLE_KEYMAPPING_RESULT_SIZE);
@@ -211,8 +219,7 @@ void KeyToTouchManagerTest::CheckMouseRightAndLeftButton(const DeviceTypeEnum &d
     testMappingInfos.push_back(BuildKeyMapping(type));
     handler_->HandleTemplateConfig(deviceType, testMappingInfos);
 
-    std::shared_ptr<InputToTouchContext> context =
-        deviceType == DeviceTypeEnum::GAME_KEY_BOARD ? handler_->gcKeyboardContext_ : handler_->hoverTouchPadContext_;
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(deviceType);
 
     ASSERT_FALSE(context == nullptr);
     ASSERT_EQ(context->mouseBtnKeyMappings.size(), 1);
@@ -234,8 +241,7 @@ void KeyToTouchManagerTest::CheckSingleKeyAndMouse(const DeviceTypeEnum &deviceT
     testMappingInfos.push_back(BuildKeyMapping(type));
     handler_->HandleTemplateConfig(deviceType, testMappingInfos);
 
-    std::shared_ptr<InputToTouchContext> context =
-        deviceType == DeviceTypeEnum::GAME_KEY_BOARD ? handler_->gcKeyboardContext_ : handler_->hoverTouchPadContext_;
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(deviceType);
 
     ASSERT_FALSE(context == nullptr);
     ASSERT_EQ(context->singleKeyMappings.size(), 1);
@@ -570,9 +576,52 @@ HWTEST_F(KeyToTouchManagerTest, DispatchPointerEvent_003, TestSize.Level0)
     ASSERT_FALSE(handler_->DispatchPointerEvent(pointerEvent_));
 }
 
+/**
+ * @tc.name: DispatchPointerEvent_004
+ * @tc.desc: the axis event of the gamepad is dispatched only when the gamepad template has the axis mappings
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchManagerTest, DispatchPointerEvent_004, TestSize.Level0)
+{
+    pointerEvent_->SetSourceType(PointerEvent::SOURCE_TYPE_JOYSTICK);
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_AXIS_UPDATE);
+    pointerEvent_->SetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_X, 1.0);
+    ASSERT_FALSE(handler_->DispatchPointerEvent(pointerEvent_));
+
+    handler_->isMonitorGamePadAxis_ = true;
+    ASSERT_TRUE(handler_->DispatchPointerEvent(pointerEvent_));
+    handler_->isSupportKeyMapping_ = false;
+    ASSERT_FALSE(handler_->DispatchPointerEvent(pointerEvent_));
+}
+
+/**
+ * @tc.name: GetEventChannelStats_001
+ * @tc.desc: the dispatched events are counted by the event channel of their device class
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchManagerTest, GetEventChannelStats_001, TestSize.Level0)
+{
+    ASSERT_EQ(0, handler_->GetEventChannelStats(DeviceTypeEnum::UNKNOWN).eventCount);
+    uint64_t eventCount = handler_->GetEventChannelStats(DeviceTypeEnum::GAME_PAD).eventCount;
+    pointerEvent_->SetSourceType(PointerEvent::SOURCE_TYPE_JOYSTICK);
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_AXIS_UPDATE);
+    pointerEvent_->SetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_X, 1.0);
+    handler_->isMonitorGamePadAxis_ = true;
+    ASSERT_TRUE(handler_->DispatchPointerEvent(pointerEvent_));
+    ASSERT_TRUE(handler_->DispatchPointerEvent(pointerEvent_));
+    handler_->WaitHandleQueueIdle();
+
+    BatchedChannelStats stats = handler_->GetEventChannelStats(DeviceTypeEnum::GAME_PAD);
+    ASSERT_EQ(eventCount + 2, stats.eventCount);
+    ASSERT_GT(stats.batchCount, 0);
+    ASSERT_EQ(KEY_TO_TOUCH_DEFAULT_MAX_BATCH_SIZE, stats.maxBatchSize);
+}
+
 /**
  * @tc.name: UpdateWindowInfo_001
- * @tc.desc: when bundleName is same with bundleName_, gcKeyboardContext_ and hoverTouchPadContext_ is  nullptr
+ * @tc.desc: when bundleName is same with bundleName_, the contexts of keyboard and hover touchpad is  nullptr
  * windowInfoEntity_ is set;
  * @tc.type: FUNC
  * @tc.require: issueNumber
@@ -588,14 +637,14 @@ HWTEST_F(KeyToTouchManagerTest, UpdateWindowInfo_001, TestSize.Level0)
 
     ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
     CheckWindowInfo(handler_->windowInfoEntity_, window);
-    ASSERT_EQ(handler_->gcKeyboardContext_, nullptr);
-    ASSERT_EQ(handler_->hoverTouchPadContext_, nullptr);
+    ASSERT_EQ(handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD), nullptr);
+    ASSERT_EQ(handler_->GetContext(DeviceTypeEnum::HOVER_TOUCH_PAD), nullptr);
 }
 
 /**
  * @tc.name: UpdateWindowInfo_002
- * @tc.desc:  when bundleName is same with bundleName_, gcKeyboardContext_ and hoverTouchPadContext_ is not nullptr,
- *  windowInfo is set to gcKeyboardContext_ and hoverTouchPadContext_
+ * @tc.desc:  when bundleName is same with bundleName_, the contexts of keyboard and hover touchpad is not nullptr,
+ *  windowInfo is set to the contexts of keyboard and hover touchpad
  * @tc.type: FUNC
  * @tc.require: issueNumber
  */
@@ -612,8 +661,8 @@ HWTEST_F(KeyToTouchManagerTest, UpdateWindowInfo_002, TestSize.Level0)
 
     ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
     CheckWindowInfo(handler_->windowInfoEntity_, window);
-    CheckWindowInfo(handler_->gcKeyboardContext_->windowInfoEntity, window);
-    CheckWindowInfo(handler_->hoverTouchPadContext_->windowInfoEntity, window);
+    CheckWindowInfo(handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD)->windowInfoEntity, window);
+    CheckWindowInfo(handler_->GetContext(DeviceTypeEnum::HOVER_TOUCH_PAD)->windowInfoEntity, window);
 }
 
 /**
@@ -652,6 +701,35 @@ HWTEST_F(KeyToTouchManagerTest, UpdateWindowInfo_005, TestSize.Level0)
     ASSERT_EQ(handler_->windowInfoEntity_.bundleName, window.bundleName);
 }
 
+/**
+ * @tc.name: UpdateWindowInfo_006
+ * @tc.desc: when the template has a reference resolution, the key mappings of the context are scaled to the window
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchManagerTest, UpdateWindowInfo_006, TestSize.Level0)
+{
+    std::vector<KeyToTouchMappingInfo> testMappingInfos;
+    testMappingInfos.push_back(BuildKeyMapping(MappingTypeEnum::SINGE_KEY_TO_TOUCH));
+    testMappingInfos[0].xValue = 10;
+    testMappingInfos[0].yValue = 20;
+    TemplateResolution resolution;
+    resolution.width = 50;
+    resolution.height = 50;
+    handler_->InitGcKeyboardContext(testMappingInfos, resolution);
+    WindowInfoEntity window = {"test", 1, 100, 100, 100, 100, 10, 10, true, 25, 25, 1, false};
+    handler_->bundleName_ = window.bundleName;
+
+    handler_->UpdateWindowInfo(window);
+
+    ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_NE(context, nullptr);
+    CheckWindowInfo(context->windowInfoEntity, window);
+    ASSERT_EQ(context->singleKeyMappings[0].xValue, 20);
+    ASSERT_EQ(context->singleKeyMappings[0].yValue, 40);
+}
+
 /**
  * @tc.name: EnableKeyMapping_001
  * @tc.desc: bundleName is same with bundleName_, isEnableKeyMapping_ is set
@@ -668,23 +746,24 @@ HWTEST_F(KeyToTouchManagerTest, EnableKeyMapping_001, TestSize.Level0)
     info.keyCode = KEY_CODE_UP;
     testMapping.push_back(info);
     handler_->InitGcKeyboardContext(testMapping);
-    handler_->gcKeyboardContext_->deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD);
+    context->deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
 
     // set current temp variables
-    handler_->gcKeyboardContext_->isCombinationKeyOperating = true;
-    handler_->gcKeyboardContext_->currentCombinationKey = BuildKeyMapping(MappingTypeEnum::COMBINATION_KEY_TO_TOUCH);
-    handler_->gcKeyboardContext_->isSkillOperating = true;
-    handler_->gcKeyboardContext_->currentSkillKeyInfo = BuildKeyMapping(MappingTypeEnum::SKILL_KEY_TO_TOUCH);
+    context->isCombinationKeyOperating = true;
+    context->currentCombinationKey = BuildKeyMapping(MappingTypeEnum::COMBINATION_KEY_TO_TOUCH);
+    context->isSkillOperating = true;
+    context->currentSkillKeyInfo = BuildKeyMapping(MappingTypeEnum::SKILL_KEY_TO_TOUCH);
 
     handler_->EnableKeyMapping(handler_->bundleName_, false);
 
     ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
     ASSERT_FALSE(handler_->isEnableKeyMapping_);
-    ASSERT_FALSE(handler_->gcKeyboardContext_->isCombinationKeyOperating);
-    ASSERT_EQ(handler_->gcKeyboardContext_->currentCombinationKey.combinationKeys.size(), 0);
-    ASSERT_FALSE(handler_->gcKeyboardContext_->isSkillOperating);
-    ASSERT_EQ(handler_->gcKeyboardContext_->currentSkillKeyInfo.skillRange, 0);
-    ASSERT_EQ(handler_->gcKeyboardContext_->currentSkillKeyInfo.radius, 0);
+    ASSERT_FALSE(context->isCombinationKeyOperating);
+    ASSERT_EQ(context->currentCombinationKey.combinationKeys.size(), 0);
+    ASSERT_FALSE(context->isSkillOperating);
+    ASSERT_EQ(context->currentSkillKeyInfo.skillRange, 0);
+    ASSERT_EQ(context->currentSkillKeyInfo.radius, 0);
 }
 
 /**
@@ -702,5 +781,203 @@ HWTEST_F(KeyToTouchManagerTest, EnableKeyMapping_002, TestSize.Level0)
     ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
     ASSERT_TRUE(handler_->isEnableKeyMapping_);
 }
+
+static void DispatchSimulatedKeyEvent(const std::shared_ptr<KeyToTouchManager> &handler,
+                                      const SimulatedDevice &device, int32_t keyAction)
+{
+    std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+    keyEvent->SetKeyCode(device.keyCode);
+    keyEvent->SetDeviceId(device.deviceId);
+    keyEvent->SetKeyAction(keyAction);
+    keyEvent->SetActionTime(StringUtils::GetSysClockTime());
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = STRESS_DEVICE_UNIQ + std::to_string(device.deviceId);
+    deviceInfo.deviceType = device.deviceType;
+    deviceInfo.ids.insert(device.deviceId);
+    handler->DispatchReplayKeyEvent(keyEvent, deviceInfo);
+}
+
+static void DispatchInParallel(const std::shared_ptr<KeyToTouchManager> &handler,
+                               const std::vector<SimulatedDevice> &devices, int32_t keyAction)
+{
+    std::vector<std::thread> threads;
+    for (const auto &device: devices) {
+        threads.emplace_back([handler, device, keyAction] {
+            DispatchSimulatedKeyEvent(handler, device, keyAction);
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    handler->WaitHandleQueueIdle();
+}
+
+/**
+ * @tc.name: DispatchKeyEvent_MultiDevice_001
+ * @tc.desc: when two keyboards and two hover touchpads press keys in parallel, the contexts are handled on their own
+ *           queues, every pressed key holds a unique pointerId, and all the pointers are released after the keys are up
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchManagerTest, DispatchKeyEvent_MultiDevice_001, TestSize.Level0)
+{
+    std::vector<SimulatedDevice> devices = {
+        {DeviceTypeEnum::GAME_KEY_BOARD, DEVICE_ID, KEY_CODE_UP},
+        {DeviceTypeEnum::GAME_KEY_BOARD, DEVICE_ID + 1, KEY_CODE_DOWN},
+        {DeviceTypeEnum::HOVER_TOUCH_PAD, DEVICE_ID + 2, KEY_CODE_LEFT},
+        {DeviceTypeEnum::HOVER_TOUCH_PAD, DEVICE_ID + 3, KEY_CODE_RIGHT},
+    };
+    std::unordered_map<DeviceTypeEnum, std::vector<KeyToTouchMappingInfo>> templates;
+    for (const auto &device: devices) {
+        KeyToTouchMappingInfo info = BuildKeyMapping(MappingTypeEnum::SINGE_KEY_TO_TOUCH);
+        info.keyCode = device.keyCode;
+        templates[device.deviceType].push_back(info);
+    }
+    handler_->bundleName_ = "test";
+    for (const auto &templatePair: templates) {
+        handler_->HandleTemplateConfig(templatePair.first, templatePair.second);
+    }
+    std::shared_ptr<InputToTouchContext> keyboardContext = handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD);
+    std::shared_ptr<InputToTouchContext> hoverContext = handler_->GetContext(DeviceTypeEnum::HOVER_TOUCH_PAD);
+    ASSERT_NE(keyboardContext, nullptr);
+    ASSERT_NE(hoverContext, nullptr);
+    std::shared_ptr<PointerManager> pointerManager = DelayedSingleton<PointerManager>::GetInstance();
+
+    for (int32_t round = 0; round < STRESS_ROUNDS; round++) {
+        DispatchInParallel(handler_, devices, MMI::KeyEvent::KEY_ACTION_DOWN);
+        ASSERT_EQ(keyboardContext->pointerItems.size(), templates[DeviceTypeEnum::GAME_KEY_BOARD].size());
+        ASSERT_EQ(hoverContext->pointerItems.size(), templates[DeviceTypeEnum::HOVER_TOUCH_PAD].size());
+        std::unordered_set<int32_t> pointerIds;
+        for (const auto &context: {keyboardContext, hoverContext}) {
+            for (const auto &pointerPair: context->pointerItems) {
+                pointerIds.insert(pointerPair.first);
+                ASSERT_EQ(pointerManager->pointerIdCacheSet_.count(pointerPair.first), 1);
+                ASSERT_EQ(pointerManager->activePointerItems_.count(pointerPair.first), 1);
+            }
+        }
+        ASSERT_EQ(pointerIds.size(), devices.size());
+
+        DispatchInParallel(handler_, devices, MMI::KeyEvent::KEY_ACTION_UP);
+        ASSERT_TRUE(keyboardContext->pointerItems.empty());
+        ASSERT_TRUE(hoverContext->pointerItems.empty());
+        for (const auto &pointerId: pointerIds) {
+            ASSERT_EQ(pointerManager->pointerIdCacheSet_.count(pointerId), 0);
+            ASSERT_EQ(pointerManager->activePointerItems_.count(pointerId), 0);
+        }
+    }
+}
+/**
+ * @tc.name: UpdateTemplateConfig_HeldKeys_001
+ * @tc.desc: when the template is replaced while keys are pressed, the context is kept, the pressed keys keep their
+ *           pointerIds and are released by the old key mappings, and the new key mappings are used for the new keys
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchManagerTest, UpdateTemplateConfig_HeldKeys_001, TestSize.Level0)
+{
+    const int32_t oldXValue = 10;
+    const int32_t newXValue = 20;
+    std::vector<KeyToTouchMappingInfo> oldTemplate;
+    for (int32_t keyCode: {KEY_CODE_UP, KEY_CODE_DOWN}) {
+        KeyToTouchMappingInfo info = BuildKeyMapping(MappingTypeEnum::SINGE_KEY_TO_TOUCH);
+        info.keyCode = keyCode;
+        info.xValue = oldXValue;
+        oldTemplate.push_back(info);
+    }
+    handler_->bundleName_ = "test";
+    handler_->HandleTemplateConfig(DeviceTypeEnum::GAME_KEY_BOARD, oldTemplate);
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_NE(context, nullptr);
+    SimulatedDevice upKey = {DeviceTypeEnum::GAME_KEY_BOARD, DEVICE_ID, KEY_CODE_UP};
+    SimulatedDevice downKey = {DeviceTypeEnum::GAME_KEY_BOARD, DEVICE_ID, KEY_CODE_DOWN};
+    DispatchSimulatedKeyEvent(handler_, upKey, MMI::KeyEvent::KEY_ACTION_DOWN);
+    handler_->WaitHandleQueueIdle();
+    std::pair<bool, int32_t> heldPointer = context->GetPointerIdByKeyCode(KEY_CODE_UP);
+    ASSERT_TRUE(heldPointer.first);
+
+    // the up key is removed and the down key is moved in the new template
+    std::vector<KeyToTouchMappingInfo> newTemplate = {oldTemplate.back()};
+    newTemplate.back().xValue = newXValue;
+    handler_->UpdateTemplateConfig(DeviceTypeEnum::GAME_KEY_BOARD, "test", newTemplate);
+    handler_->WaitHandleQueueIdle();
+
+    ASSERT_EQ(handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD), context);
+    ASSERT_EQ(context->singleKeyMappings.count(KEY_CODE_UP), 0);
+    ASSERT_EQ(context->heldKeyMappings.count(KEY_CODE_UP), 1);
+    ASSERT_EQ(context->pointerItems.count(heldPointer.second), 1);
+    ASSERT_EQ(handler_->allMonitorKeys_.count(KEY_CODE_UP), 1);
+
+    DispatchSimulatedKeyEvent(handler_, downKey, MMI::KeyEvent::KEY_ACTION_DOWN);
+    handler_->WaitHandleQueueIdle();
+    ASSERT_EQ(context->currentSingleKeyMap[KEY_CODE_DOWN].xValue, newXValue);
+    ASSERT_EQ(context->GetPointerIdByKeyCode(KEY_CODE_UP).second, heldPointer.second);
+
+    DispatchSimulatedKeyEvent(handler_, upKey, MMI::KeyEvent::KEY_ACTION_UP);
+    handler_->WaitHandleQueueIdle();
+    ASSERT_EQ(context->pointerItems.count(heldPointer.second), 0);
+    ASSERT_FALSE(context->GetPointerIdByKeyCode(KEY_CODE_UP).first);
+    ASSERT_TRUE(context->heldKeyMappings.empty());
+    ASSERT_EQ(handler_->allMonitorKeys_.count(KEY_CODE_UP), 0);
+
+    DispatchSimulatedKeyEvent(handler_, downKey, MMI::KeyEvent::KEY_ACTION_UP);
+    handler_->WaitHandleQueueIdle();
+    ASSERT_TRUE(context->pointerItems.empty());
+}
+
+/**
+ * @tc.name: UpdateTemplateConfig_HeldKeys_002
+ * @tc.desc: when the template is replaced while a combination key is pressed and the new template doesn't map it,
+ *           the last key is still monitored and its up event releases the touch of the old combination key
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyToTouchManagerTest, UpdateTemplateConfig_HeldKeys_002, TestSize.Level0)
+{
+    KeyToTouchMappingInfo combinationKey = BuildKeyMapping(MappingTypeEnum::COMBINATION_KEY_TO_TOUCH);
+    combinationKey.combinationKeys = {KEY_CODE_LEFT, KEY_CODE_RIGHT};
+    handler_->bundleName_ = "test";
+    handler_->HandleTemplateConfig(DeviceTypeEnum::GAME_KEY_BOARD, {combinationKey});
+    std::shared_ptr<InputToTouchContext> context = handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_NE(context, nullptr);
+
+    // the first key is pressed before the last one
+    int64_t actionTime = StringUtils::GetSysClockTime();
+    std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+    keyEvent->SetKeyCode(KEY_CODE_RIGHT);
+    keyEvent->SetDeviceId(DEVICE_ID);
+    keyEvent->SetKeyAction(MMI::KeyEvent::KEY_ACTION_DOWN);
+    keyEvent->SetActionTime(actionTime);
+    MMI::KeyEvent::KeyItem firstKeyItem;
+    firstKeyItem.SetKeyCode(KEY_CODE_LEFT);
+    firstKeyItem.SetDownTime(actionTime - 1);
+    firstKeyItem.SetDeviceId(DEVICE_ID);
+    firstKeyItem.SetPressed(true);
+    keyEvent->AddKeyItem(firstKeyItem);
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = STRESS_DEVICE_UNIQ;
+    deviceInfo.deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    deviceInfo.ids.insert(DEVICE_ID);
+    handler_->DispatchReplayKeyEvent(keyEvent, deviceInfo);
+    handler_->WaitHandleQueueIdle();
+    ASSERT_TRUE(context->isCombinationKeyOperating);
+    std::pair<bool, int32_t> heldPointer = context->GetPointerIdByKeyCode(KEY_CODE_COMBINATION);
+    ASSERT_TRUE(heldPointer.first);
+
+    std::vector<KeyToTouchMappingInfo> newTemplate = {BuildKeyMapping(MappingTypeEnum::SINGE_KEY_TO_TOUCH)};
+    handler_->UpdateTemplateConfig(DeviceTypeEnum::GAME_KEY_BOARD, "test", newTemplate);
+    handler_->WaitHandleQueueIdle();
+    ASSERT_EQ(handler_->GetContext(DeviceTypeEnum::GAME_KEY_BOARD), context);
+    ASSERT_TRUE(context->combinationKeyMappings.empty());
+    ASSERT_EQ(context->heldKeyMappings.count(KEY_CODE_RIGHT), 1);
+    ASSERT_EQ(handler_->allMonitorKeys_.count(KEY_CODE_RIGHT), 1);
+
+    SimulatedDevice lastKey = {DeviceTypeEnum::GAME_KEY_BOARD, DEVICE_ID, KEY_CODE_RIGHT};
+    DispatchSimulatedKeyEvent(handler_, lastKey, MMI::KeyEvent::KEY_ACTION_UP);
+    handler_->WaitHandleQueueIdle();
+    ASSERT_FALSE(context->isCombinationKeyOperating);
+    ASSERT_EQ(context->pointerItems.count(heldPointer.second), 0);
+    ASSERT_TRUE(context->heldKeyMappings.empty());
+    ASSERT_EQ(handler_->allMonitorKeys_.count(KEY_CODE_RIGHT), 0);
+}
 }
 }
\ No newline at end of file
@@ -46,6 +46,9 @@ const int32_t KEY_CODE_UP = 2301;
 const int32_t KEY_CODE_DOWN = 2302;
 const int32_t KEY_CODE_LEFT = 2303;
 const int32_t KEY_CODE_RIGHT = 2304;
+const int64_t HALF_STEP_TIME = 25000;
+const int64_t ONE_SECOND = 1000000;
+const uint32_t MIN_UPDATE_RATE = 20;
 }
 
 class KeyboardObservationToTouchHandlerExt : public KeyboardObservationToTouchHandler {
@@ -58,16 +61,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo, const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        KeyboardObservationToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        KeyboardObservationToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        KeyboardObservationToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        KeyboardObservationToTouchHandler::HandleKeyUp(context, sample);
     }
 
 public:
@@ -121,6 +124,11 @@ public:
         DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->StopTask();
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<KeyboardObservationToTouchHandlerExt> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -139,7 +147,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_001, TestSize.Leve
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     ASSERT_TRUE(pair.first);
     int32_t pointerId = pair.second;
@@ -173,11 +181,11 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_001, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_002, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_UP);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     // move to the edge of up
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_UP);
@@ -198,11 +206,11 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_002, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_003, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_DOWN);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     // move to the edge of down
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_DOWN);
@@ -223,11 +231,11 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_003, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_004, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_LEFT);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     // move to the edge of left
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_LEFT);
@@ -248,11 +256,11 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_004, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_005, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_RIGHT);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     // move to the edge of right
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_RIGHT);
@@ -275,14 +283,14 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_005, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_006, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_LEFT);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, false));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_LEFT);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -308,7 +316,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_006, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_007, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_LEFT);
     KeyEvent::KeyItem keyItem = BuildKeyItem(KEY_CODE_DOWN, true);
@@ -317,7 +325,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_007, TestSize.Leve
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_LEFT);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -345,14 +353,14 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_007, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_008, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_RIGHT);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_RIGHT);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -380,7 +388,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_008, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_009, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_RIGHT);
     KeyEvent::KeyItem keyItem = BuildKeyItem(KEY_CODE_DOWN, true);
@@ -389,7 +397,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_009, TestSize.Leve
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_RIGHT);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -417,14 +425,14 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_009, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_010, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_UP);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_UP);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -452,7 +460,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_010, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_011, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_UP);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
@@ -461,7 +469,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_011, TestSize.Leve
     keyItem.SetDownTime(1000);
     keyEvent_->AddKeyItem(keyItem);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_UP);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -489,14 +497,14 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_011, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_012, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_DOWN);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_DOWN);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -524,7 +532,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_012, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_013, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyCode(KEY_CODE_DOWN);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
@@ -533,7 +541,7 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_013, TestSize.Leve
     keyItem.SetDownTime(1000);
     keyEvent_->AddKeyItem(keyItem);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_DOWN);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -559,12 +567,12 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyDown_013, TestSize.Leve
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     ASSERT_TRUE(pair.first);
     int32_t pointerId = pair.second;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_FALSE(context_->isPerspectiveObserving);
     ASSERT_EQ(context_->currentPerspectiveObserving.mappingType, 0);
@@ -589,10 +597,10 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyUp_002, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     context_->isPerspectiveObserving = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->taskIsStarting_);
 }
@@ -608,13 +616,13 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyUp_002, TestSize.Level1
 HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyUp_003, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     ASSERT_TRUE(pair.first);
     int32_t pointerId = pair.second;
     context_->currentPerspectiveObserving.mappingType = OBSERVATION_KEY_TO_TOUCH;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
     ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_DOWN);
@@ -635,14 +643,14 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, HandleKeyUp_004, TestSize.Level0
 {
     keyEvent_->SetKeyCode(KEY_CODE_LEFT);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_DOWN, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_UP, true));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_LEFT, false));
     keyEvent_->AddKeyItem(BuildKeyItem(KEY_CODE_RIGHT, true));
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->currentKeyCode_, KEY_CODE_RIGHT);
     ASSERT_EQ(DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance()->context_, context_);
@@ -907,5 +915,58 @@ HWTEST_F(KeyboardObservationToTouchHandlerTest, ComputeAndSendMovePointer_009, T
     ASSERT_EQ(pointerItem.GetWindowX(), X_VALUE - X_STEP);
     ASSERT_EQ(pointerItem.GetWindowY(), Y_VALUE - Y_STEP);
 }
+/**
+ * @tc.name: Advance_001
+ * @tc.desc: the pointer is moved by the time the keys are held, and the fraction of the pixel is kept
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyboardObservationToTouchHandlerTest, Advance_001, TestSize.Level0)
+{
+    auto task = DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance();
+    int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
+    context_->SetCurrentObserving(mappingInfo_, pointerId);
+    task->context_ = context_;
+    task->dpadKeys_.push_back(BuildDpadKeyItem(KEY_CODE_RIGHT, DPAD_RIGHT));
+    task->dpadKeys_.push_back(BuildDpadKeyItem(KEY_CODE_DOWN, DPAD_DOWN));
+    task->currentKeyCode_ = KEY_CODE_RIGHT;
+    task->currentDpadKeyType_ = DPAD_RIGHT;
+    context_->pointerItems[pointerId] = BuildPointerItem();
+    int64_t startTime = task->lastAdvanceTime_;
+
+    // half a step moves half of X_STEP, which is less than one pixel
+    task->Advance(startTime + HALF_STEP_TIME);
+    PointerEvent::PointerItem pointerItem = context_->pointerItems[pointerId];
+    ASSERT_EQ(pointerItem.GetWindowX(), X_VALUE);
+    ASSERT_EQ(pointerItem.GetWindowY(), Y_VALUE + Y_STEP / 2);
+
+    task->Advance(startTime + HALF_STEP_TIME * 2);
+    pointerItem = context_->pointerItems[pointerId];
+    ASSERT_EQ(pointerItem.GetWindowX(), X_VALUE + X_STEP);
+    ASSERT_EQ(pointerItem.GetWindowY(), Y_VALUE + Y_STEP);
+
+    // the time doesn't go back
+    task->Advance(startTime);
+    pointerItem = context_->pointerItems[pointerId];
+    ASSERT_EQ(pointerItem.GetWindowX(), X_VALUE + X_STEP);
+    ASSERT_EQ(pointerItem.GetWindowY(), Y_VALUE + Y_STEP);
+}
+
+/**
+ * @tc.name: SetUpdateRate_001
+ * @tc.desc: the update rate is limited to the refresh rate of the display
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyboardObservationToTouchHandlerTest, SetUpdateRate_001, TestSize.Level0)
+{
+    auto task = DelayedSingleton<KeyboardObservationToTouchHandlerTask>::GetInstance();
+    task->SetUpdateRate(1);
+    ASSERT_EQ(ONE_SECOND / MIN_UPDATE_RATE, task->tickInterval_);
+
+    task->SetUpdateRate(UINT32_MAX);
+    uint32_t maxUpdateRate = std::max(KeyboardObservationToTouchHandlerTask::GetMaxUpdateRate(), MIN_UPDATE_RATE);
+    ASSERT_EQ(ONE_SECOND / maxUpdateRate, task->tickInterval_);
+}
+}
 }
-}
\ No newline at end of file
@@ -34,9 +34,15 @@ const int32_t MAX_HEIGHT = 1260;
 const int32_t X_STEP = 1;
 const int32_t Y_STEP = 2;
 const int32_t MOUSE_MOVE_DISTANCE = 10;
+const int32_t TAP_INTERVAL = 100;
+const int64_t START_TIME = 1000000;
+const int64_t TAP_INTERVAL_US = 100000;
+const int64_t PRESS_DURATION = 50000;
 }
 class MouseLeftFireToTouchHandlerEx : public MouseLeftFireToTouchHandler {
 public:
+    using BaseKeyToTouchHandler::RunRapidFireTick;
+
     void BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context_,
                                   const TouchEntity &touchEntity) override
     {
@@ -295,5 +301,73 @@ HWTEST_F(MouseLeftFireToTouchHandlerTest, HandlePointerEvent_009, TestSize.Level
     ASSERT_FALSE(pair.first);
 }
 
+/**
+ * @tc.name: RapidFire_001
+ * @tc.desc: when tapInterval is set, the touch is released and pressed again on the deadlines
+ *  while the button is held, and no extra up event is sent when the button is up after the touch is released
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(MouseLeftFireToTouchHandlerTest, RapidFire_001, TestSize.Level0)
+{
+    context_->isEnterCrosshairInfo = true;
+    mappingInfo_.tapInterval = TAP_INTERVAL;
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_DOWN);
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    int32_t pointerId = context_->GetPointerIdByKeyCode(KEY_CODE_MOUSE_LEFT).second;
+    ASSERT_TRUE(context_->rapidFires.find(KEY_CODE_MOUSE_LEFT) != context_->rapidFires.end());
+    RapidFireEntity &entity = context_->rapidFires[KEY_CODE_MOUSE_LEFT];
+    entity.scheduler.Start(START_TIME, TAP_INTERVAL_US, PRESS_DURATION);
+    uint64_t sequence = entity.sequence;
+
+    handler_->RunRapidFireTick(context_, KEY_CODE_MOUSE_LEFT, sequence, START_TIME + PRESS_DURATION);
+    ASSERT_EQ(handler_->touchEntity_.pointerId, pointerId);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+    ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
+
+    // the tick of an old rapid fire is ignored
+    handler_->RunRapidFireTick(context_, KEY_CODE_MOUSE_LEFT, sequence + 1, START_TIME + TAP_INTERVAL_US);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+    handler_->RunRapidFireTick(context_, KEY_CODE_MOUSE_LEFT, sequence, START_TIME + TAP_INTERVAL_US);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_DOWN);
+    ASSERT_EQ(handler_->touchEntity_.xValue, X_VALUE);
+    handler_->RunRapidFireTick(context_, KEY_CODE_MOUSE_LEFT, sequence,
+                               START_TIME + TAP_INTERVAL_US + PRESS_DURATION);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+
+    handler_->touchEntity_.pointerAction = PointerEvent::POINTER_ACTION_UNKNOWN;
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_UP);
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UNKNOWN);
+    ASSERT_FALSE(context_->isMouseLeftFireOperating);
+    ASSERT_TRUE(context_->rapidFires.empty());
+    ASSERT_EQ(context_->rapidFireStats.tickCount, 3);
+}
+
+/**
+ * @tc.name: RapidFire_002
+ * @tc.desc: when the button is up while the touch is pressed, the up event is sent,
+ *  and the rapid fire is stopped when the context is reset
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(MouseLeftFireToTouchHandlerTest, RapidFire_002, TestSize.Level0)
+{
+    context_->isEnterCrosshairInfo = true;
+    mappingInfo_.tapInterval = TAP_INTERVAL;
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_DOWN);
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_UP);
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+    ASSERT_TRUE(context_->rapidFires.empty());
+
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_DOWN);
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    ASSERT_FALSE(context_->rapidFires.empty());
+    context_->ResetTempVariables();
+    ASSERT_TRUE(context_->rapidFires.empty());
+}
+
+}
 }
-}
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 #include "refbase.h"
 #include "mouse_right_key_click_to_touch_handler.h"
+#include "gamecontroller_utils.h"
 
 using ::testing::Return;
 using namespace testing::ext;
@@ -34,9 +35,14 @@ const int32_t MAX_HEIGHT = 1260;
 const int32_t X_STEP = 1;
 const int32_t Y_STEP = 2;
 const int32_t MOUSE_MOVE_DISTANCE = 10;
+const int32_t TAP_INTERVAL = 200;
+const int32_t TAP_DUTY_CYCLE = 25;
+const int64_t PRESS_DURATION = 50000;
 }
 class MouseRightKeyClickToTouchHandlerEx : public MouseRightKeyClickToTouchHandler {
 public:
+    using BaseKeyToTouchHandler::RunRapidFireTick;
+
     void BuildAndSendPointerEvent(std::shared_ptr<InputToTouchContext> &context_,
                                   const TouchEntity &touchEntity) override
     {
@@ -230,5 +236,39 @@ HWTEST_F(MouseRightKeyClickToTouchHandlerTest, HandlePointerEvent_008, TestSize.
     ASSERT_FALSE(pair.first);
     ASSERT_FALSE(context_->isMouseRightClickOperating);
 }
+
+/**
+ * @tc.name: RapidFire_001
+ * @tc.desc: when tapInterval is set, the press duration is from the duty cycle,
+ *  and no extra up event is sent when the button is up after the touch is released
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(MouseRightKeyClickToTouchHandlerTest, RapidFire_001, TestSize.Level0)
+{
+    mappingInfo_.tapInterval = TAP_INTERVAL;
+    mappingInfo_.tapDutyCycle = TAP_DUTY_CYCLE;
+    int64_t beforeTime = StringUtils::GetSysClockTime();
+    int32_t pointerId = SendMouseRightDownEvent();
+    int64_t afterTime = StringUtils::GetSysClockTime();
+    ASSERT_TRUE(context_->rapidFires.find(KEY_CODE_MOUSE_RIGHT) != context_->rapidFires.end());
+    RapidFireEntity &entity = context_->rapidFires[KEY_CODE_MOUSE_RIGHT];
+    int64_t deadline = entity.scheduler.GetNextDeadline();
+    ASSERT_GE(deadline, beforeTime + PRESS_DURATION);
+    ASSERT_LE(deadline, afterTime + PRESS_DURATION);
+
+    handler_->RunRapidFireTick(context_, KEY_CODE_MOUSE_RIGHT, entity.sequence, deadline - 1);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_DOWN);
+    handler_->RunRapidFireTick(context_, KEY_CODE_MOUSE_RIGHT, entity.sequence, deadline);
+    ASSERT_EQ(handler_->touchEntity_.pointerId, pointerId);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
+
+    handler_->touchEntity_.pointerAction = PointerEvent::POINTER_ACTION_UNKNOWN;
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_UP);
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+    ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UNKNOWN);
+    ASSERT_FALSE(context_->isMouseRightClickOperating);
+    ASSERT_TRUE(context_->rapidFires.empty());
+}
+}
 }
-}
\ No newline at end of file
@@ -132,7 +132,7 @@ public:
 /**
  * @tc.name: HandlePointerEvent_001
  * @tc.desc: when it's mouse right-button down event and isWalking is false
- * and hasDelayTask_ is false, send down and move touch event
+ * and hasDelayTask is false, send down and move touch event
  * @tc.type: FUNC
  * @tc.require: issueNumber
  */
@@ -186,7 +186,7 @@ HWTEST_F(MouseRightKeyWalkingToTouchHandlerTest, HandlePointerEvent_003, TestSiz
     pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_UP);
     handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
 
-    ASSERT_FALSE(DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->hasDelayTask_);
+    ASSERT_FALSE(delayHandleTaskEx_->delayTasks_[context_->deviceType].hasDelayTask);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
     ASSERT_FALSE(context_->isWalking);
     ASSERT_EQ(context_->currentWalking.mappingType, 0);
@@ -290,9 +290,9 @@ HWTEST_F(MouseRightKeyWalkingToTouchHandlerTest, HandlePointerEvent_008, TestSiz
     handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
     ASSERT_FALSE(context_->isWalking);
     ASSERT_EQ(context_->currentWalking.mappingType, 0);
-    ASSERT_TRUE(DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->hasDelayTask_);
+    ASSERT_TRUE(delayHandleTaskEx_->delayTasks_[context_->deviceType].hasDelayTask);
     ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
-    ASSERT_FALSE(DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->hasDelayTask_);
+    ASSERT_FALSE(delayHandleTaskEx_->delayTasks_[context_->deviceType].hasDelayTask);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
     ASSERT_EQ(delayHandleTaskEx_->touchUpEntity_.pointerId, pointerId);
     ASSERT_EQ(delayHandleTaskEx_->touchUpEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
@@ -303,20 +303,20 @@ HWTEST_F(MouseRightKeyWalkingToTouchHandlerTest, HandlePointerEvent_008, TestSiz
 /**
  * @tc.name: HandlePointerEvent_009
  * @tc.desc: when it's mouse right-button down event and isWalking is false
- * and hasDelayTask_ is true, send up and down and move touch event
+ * and hasDelayTask is true, send up and down and move touch event
  * @tc.type: FUNC
  * @tc.require: issueNumber
  */
 HWTEST_F(MouseRightKeyWalkingToTouchHandlerTest, HandlePointerEvent_009, TestSize.Level0)
 {
-    DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->hasDelayTask_ = true;
+    delayHandleTaskEx_->delayTasks_[context_->deviceType].hasDelayTask = true;
     int32_t applyPointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     PointerEvent::PointerItem pointerItem;
     pointerItem.SetWindowX(X_VALUE);
     pointerItem.SetWindowY(Y_VALUE);
     context_->pointerItems[applyPointerId] = pointerItem;
     context_->pointerIdWithKeyCodeMap[KEY_CODE_WALK] = applyPointerId;
-    DelayedSingleton<MouseRightKeyWalkingDelayHandleTask>::GetInstance()->context_ = context_;
+    delayHandleTaskEx_->delayTasks_[context_->deviceType].context = context_;
 
     int32_t pointerId = SendMouseRightDownEvent();
 
@@ -338,5 +338,31 @@ HWTEST_F(MouseRightKeyWalkingToTouchHandlerTest, HandlePointerEvent_009, TestSiz
     ASSERT_EQ(handler_->touchMoveEntity_.xValue, MOVE_X_VALUE);
     ASSERT_EQ(handler_->touchMoveEntity_.yValue, MOVE_Y_VALUE);
 }
+
+/**
+ * @tc.name: CancelDelayHandle_001
+ * @tc.desc: the delayed up event of a device class is kept when another device class cancels its own
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(MouseRightKeyWalkingToTouchHandlerTest, CancelDelayHandle_001, TestSize.Level1)
+{
+    context_->deviceType = DeviceTypeEnum::GAME_KEY_BOARD;
+    int32_t pointerId = SendMouseRightDownEvent();
+    pointerEvent_->SetPointerAction(PointerEvent::POINTER_ACTION_BUTTON_UP);
+    context_->currentWalking.delayTime = 1;
+    handler_->HandlePointerEvent(context_, pointerEvent_, mappingInfo_);
+
+    std::shared_ptr<InputToTouchContext> otherContext = std::make_shared<InputToTouchContext>();
+    otherContext->deviceType = DeviceTypeEnum::HOVER_TOUCH_PAD;
+    ASSERT_FALSE(delayHandleTaskEx_->CancelDelayHandle(otherContext));
+    ASSERT_TRUE(delayHandleTaskEx_->delayTasks_[DeviceTypeEnum::GAME_KEY_BOARD].hasDelayTask);
+    ASSERT_EQ(delayHandleTaskEx_->delayTasks_[DeviceTypeEnum::GAME_KEY_BOARD].context, context_);
+
+    ASSERT_TRUE(delayHandleTaskEx_->CancelDelayHandle(context_));
+    ASSERT_FALSE(delayHandleTaskEx_->delayTasks_[DeviceTypeEnum::GAME_KEY_BOARD].hasDelayTask);
+    ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
+    ASSERT_EQ(delayHandleTaskEx_->touchUpEntity_.pointerId, pointerId);
+}
 }
 }
\ No newline at end of file
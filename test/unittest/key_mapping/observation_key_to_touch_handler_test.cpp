@@ -46,16 +46,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo, const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        ObservationKeyToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        ObservationKeyToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        ObservationKeyToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        ObservationKeyToTouchHandler::HandleKeyUp(context, sample);
     }
 
 public:
@@ -104,7 +104,7 @@ public:
     int32_t SendFirstDownEvent()
     {
         keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-        handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+        handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
         std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
         int32_t pointerId = pair.second;
         return pointerId;
@@ -115,6 +115,11 @@ public:
         context_->ResetCurrentObserving();
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<ObservationKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -157,7 +162,7 @@ HWTEST_F(ObservationKeyToTouchHandlerTest, HandleKeyDown_002, TestSize.Level1)
 {
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
     context_->isPerspectiveObserving = true;
-    handler_->HandleKeyDown(context_, keyEvent_, mappingInfo_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEvent_), mappingInfo_);
 
     std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_OBSERVATION);
     ASSERT_FALSE(pair.first);
@@ -178,7 +183,7 @@ HWTEST_F(ObservationKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
     context_->lastMousePointer.SetWindowX(X_VALUE);
     context_->lastMousePointer.SetWindowY(Y_VALUE);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_FALSE(context_->isPerspectiveObserving);
 
@@ -204,7 +209,7 @@ HWTEST_F(ObservationKeyToTouchHandlerTest, HandleKeyUp_002, TestSize.Level0)
 
     context_->isPerspectiveObserving = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
 }
@@ -222,7 +227,7 @@ HWTEST_F(ObservationKeyToTouchHandlerTest, HandleKeyUp_003, TestSize.Level0)
 
     keyEvent_->SetKeyCode(0);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEvent_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEvent_));
 
     ASSERT_TRUE(context_->isPerspectiveObserving);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+
+#define private public
+
+#include "rapid_fire_scheduler.h"
+
+#undef private
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int64_t START_TIME = 1000000;
+const int64_t INTERVAL = 100000;
+const int64_t PRESS_DURATION = 50000;
+const int64_t LATE_TIME = 3000;
+const int64_t SHORT_INTERVAL = 1000;
+const int64_t TAP_COUNT = 10;
+}
+
+class RapidFireSchedulerTest : public testing::Test {
+public:
+    RapidFireScheduler scheduler_;
+};
+
+/**
+ * @tc.name: OnTick_001
+ * @tc.desc: the taps are on the grid from the start time, and a late tick doesn't delay the taps after it
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(RapidFireSchedulerTest, OnTick_001, TestSize.Level0)
+{
+    scheduler_.Start(START_TIME, INTERVAL, PRESS_DURATION);
+    ASSERT_TRUE(scheduler_.IsRunning());
+    ASSERT_TRUE(scheduler_.IsPressed());
+    for (int64_t cycle = 0; cycle < TAP_COUNT; cycle++) {
+        int64_t pressTime = START_TIME + cycle * INTERVAL;
+        if (cycle > 0) {
+            ASSERT_EQ(pressTime, scheduler_.GetNextDeadline());
+            ASSERT_EQ(RAPID_FIRE_PRESS, scheduler_.OnTick(pressTime + LATE_TIME));
+        }
+        ASSERT_EQ(pressTime + PRESS_DURATION, scheduler_.GetNextDeadline());
+        ASSERT_EQ(RAPID_FIRE_RELEASE, scheduler_.OnTick(pressTime + PRESS_DURATION + LATE_TIME));
+        ASSERT_FALSE(scheduler_.IsPressed());
+    }
+    ASSERT_EQ(START_TIME + TAP_COUNT * INTERVAL, scheduler_.GetNextDeadline());
+    ASSERT_EQ(static_cast<uint32_t>(TAP_COUNT * 2 - 1), scheduler_.GetStats().tickCount);
+    ASSERT_EQ(LATE_TIME, scheduler_.GetStats().maxJitter);
+    ASSERT_EQ(LATE_TIME, scheduler_.GetStats().GetMeanJitter());
+    ASSERT_EQ(0, scheduler_.GetStats().skippedTapCount);
+}
+
+/**
+ * @tc.name: OnTick_002
+ * @tc.desc: nothing is done before the deadline
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(RapidFireSchedulerTest, OnTick_002, TestSize.Level0)
+{
+    scheduler_.Start(START_TIME, INTERVAL, PRESS_DURATION);
+    ASSERT_EQ(RAPID_FIRE_NONE, scheduler_.OnTick(START_TIME + PRESS_DURATION - 1));
+    ASSERT_TRUE(scheduler_.IsPressed());
+    ASSERT_EQ(0, scheduler_.GetStats().tickCount);
+
+    scheduler_.Stop();
+    ASSERT_EQ(RAPID_FIRE_NONE, scheduler_.OnTick(START_TIME + INTERVAL));
+    ASSERT_FALSE(scheduler_.IsPressed());
+}
+
+/**
+ * @tc.name: OnTick_003
+ * @tc.desc: the taps are skipped when the tick is too late for them, and they aren't sent in a burst
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(RapidFireSchedulerTest, OnTick_003, TestSize.Level0)
+{
+    scheduler_.Start(START_TIME, INTERVAL, PRESS_DURATION);
+
+    // released late, in the press of the third tap, so the second and the third taps are skipped
+    int64_t lateTime = START_TIME + INTERVAL * 2 + LATE_TIME;
+    ASSERT_EQ(RAPID_FIRE_RELEASE, scheduler_.OnTick(lateTime));
+    ASSERT_EQ(2, scheduler_.GetStats().skippedTapCount);
+    ASSERT_EQ(START_TIME + INTERVAL * 3, scheduler_.GetNextDeadline());
+
+    // the release of the fourth tap is due, so it's skipped too
+    lateTime = START_TIME + INTERVAL * 3 + PRESS_DURATION;
+    ASSERT_EQ(RAPID_FIRE_NONE, scheduler_.OnTick(lateTime));
+    ASSERT_EQ(3, scheduler_.GetStats().skippedTapCount);
+    ASSERT_EQ(START_TIME + INTERVAL * 4, scheduler_.GetNextDeadline());
+    ASSERT_EQ(RAPID_FIRE_PRESS, scheduler_.OnTick(START_TIME + INTERVAL * 4));
+}
+
+/**
+ * @tc.name: Start_001
+ * @tc.desc: the taps aren't started when the interval is too short, and the press duration is limited
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(RapidFireSchedulerTest, Start_001, TestSize.Level0)
+{
+    scheduler_.Start(START_TIME, SHORT_INTERVAL, PRESS_DURATION);
+    ASSERT_FALSE(scheduler_.IsRunning());
+    ASSERT_FALSE(scheduler_.IsPressed());
+
+    scheduler_.Start(START_TIME, INTERVAL, INTERVAL);
+    ASSERT_TRUE(scheduler_.IsRunning());
+    ASSERT_LT(scheduler_.GetNextDeadline(), START_TIME + INTERVAL);
+    scheduler_.Start(START_TIME, INTERVAL, 0);
+    ASSERT_GT(scheduler_.GetNextDeadline(), START_TIME);
+}
+}
+}
@@ -41,16 +41,16 @@ public:
     }
 
     void HandleKeyDown(std::shared_ptr<InputToTouchContext> &context,
-                       const std::shared_ptr<MMI::KeyEvent> &keyEvent,
-                       const KeyToTouchMappingInfo &mappingInfo, const DeviceInfo &deviceInfo) override
+                       const KeyInputSample &sample,
+                       const KeyToTouchMappingInfo &mappingInfo) override
     {
-        SingleKeyToTouchHandler::HandleKeyDown(context, keyEvent, mappingInfo, deviceInfo);
+        SingleKeyToTouchHandler::HandleKeyDown(context, sample, mappingInfo);
     }
 
     void HandleKeyUp(std::shared_ptr<InputToTouchContext> &context,
-                     const std::shared_ptr<MMI::KeyEvent> &keyEvent, const DeviceInfo &deviceInfo) override
+                     const KeyInputSample &sample) override
     {
-        SingleKeyToTouchHandler::HandleKeyUp(context, keyEvent, deviceInfo);
+        SingleKeyToTouchHandler::HandleKeyUp(context, sample);
     }
 
 public:
@@ -84,7 +84,7 @@ public:
     int32_t SendDownEventA()
     {
         keyEventA_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-        handler_->HandleKeyDown(context_, keyEventA_, mappingInfoA_, deviceInfo_);
+        handler_->HandleKeyDown(context_, BuildSample(keyEventA_), mappingInfoA_);
         std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_A);
         int32_t pointerId = pair.second;
         return pointerId;
@@ -93,7 +93,7 @@ public:
     int32_t SendDownEventB()
     {
         keyEventB_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-        handler_->HandleKeyDown(context_, keyEventB_, mappingInfoB_, deviceInfo_);
+        handler_->HandleKeyDown(context_, BuildSample(keyEventB_), mappingInfoB_);
         std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_B);
         int32_t pointerId = pair.second;
         return pointerId;
@@ -104,6 +104,11 @@ public:
         context_->ResetCurrentObserving();
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<SingleKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -145,7 +150,7 @@ HWTEST_F(SingleKeyToTouchHandlerTest, HandleKeyDown_002, TestSize.Level1)
 {
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentSingleKeyInfo(mappingInfoA_, pointerId);
-    handler_->HandleKeyDown(context_, keyEventA_, mappingInfoA_, deviceInfo_);
+    handler_->HandleKeyDown(context_, BuildSample(keyEventA_), mappingInfoA_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
     ASSERT_EQ(handler_->touchEntity_.xValue, 0);
@@ -176,14 +181,14 @@ HWTEST_F(SingleKeyToTouchHandlerTest, HandleKeyDown_003, TestSize.Level0)
     ASSERT_EQ(handler_->touchEntity_.pointerId, pointerIdB);
 
     keyEventA_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEventA_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEventA_));
     ASSERT_FALSE(context_->HasSingleKeyDown(KEY_CODE_A));
     ASSERT_TRUE(context_->pointerItems.find(pointerIdA) == context_->pointerItems.end());
     ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
     ASSERT_EQ(handler_->touchEntity_.pointerId, pointerIdA);
 
     keyEventB_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEventB_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEventB_));
     ASSERT_FALSE(context_->HasSingleKeyDown(KEY_CODE_B));
     ASSERT_TRUE(context_->pointerItems.find(pointerIdB) == context_->pointerItems.end());
     ASSERT_EQ(handler_->touchEntity_.pointerAction, PointerEvent::POINTER_ACTION_UP);
@@ -201,7 +206,7 @@ HWTEST_F(SingleKeyToTouchHandlerTest, HandleKeyUp_001, TestSize.Level0)
     int32_t pointerId = SendDownEventA();
     ASSERT_TRUE(context_->HasSingleKeyDown(mappingInfoA_.keyCode));
     keyEventA_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEventA_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEventA_));
 
     ASSERT_FALSE(context_->HasSingleKeyDown(mappingInfoA_.keyCode));
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
@@ -223,7 +228,7 @@ HWTEST_F(SingleKeyToTouchHandlerTest, HandleKeyUp_002, TestSize.Level0)
 
     keyEventA_->SetKeyCode(KEY_CODE_B);
     keyEventA_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyUp(context_, keyEventA_, deviceInfo_);
+    handler_->HandleKeyUp(context_, BuildSample(keyEventA_));
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
 }
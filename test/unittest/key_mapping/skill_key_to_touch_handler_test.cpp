@@ -79,7 +79,7 @@ public:
     int32_t SendDownEvent()
     {
         keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
-        handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+        handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
         std::pair<bool, int32_t> pair = context_->GetPointerIdByKeyCode(KEY_CODE_SKILL);
         int32_t pointerId = pair.second;
         return pointerId;
@@ -90,6 +90,11 @@ public:
         context_->ResetCurrentSkillKeyInfo();
     }
 
+    KeyInputSample BuildSample(const std::shared_ptr<MMI::KeyEvent> &keyEvent)
+    {
+        return KeyInputSample::Build(keyEvent, deviceInfo_.deviceType, deviceInfo_.onlineTime);
+    }
+
 public:
     std::shared_ptr<SkillKeyToTouchHandlerEx> handler_;
     std::shared_ptr<InputToTouchContext> context_;
@@ -107,7 +112,7 @@ public:
  */
 HWTEST_F(SkillKeyToTouchHandlerTest, HandleKeyEvent_001, TestSize.Level1)
 {
-    handler_->HandleKeyEvent(context_, nullptr, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(nullptr), mappingInfo_);
     ASSERT_FALSE(context_->isSkillOperating);
     ASSERT_EQ(handler_->touchEntity_.xValue, 0);
     ASSERT_EQ(handler_->touchEntity_.yValue, 0);
@@ -145,7 +150,7 @@ HWTEST_F(SkillKeyToTouchHandlerTest, HandleKeyEvent_003, TestSize.Level1)
 {
     int32_t pointerId = DelayedSingleton<PointerManager>::GetInstance()->ApplyPointerId();
     context_->SetCurrentSkillKeyInfo(mappingInfo_, pointerId);
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) == context_->pointerItems.end());
     ASSERT_EQ(handler_->touchEntity_.xValue, 0);
@@ -163,7 +168,7 @@ HWTEST_F(SkillKeyToTouchHandlerTest, HandleKeyEvent_004, TestSize.Level0)
     int32_t pointerId = SendDownEvent();
 
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_FALSE(context_->isSkillOperating);
     ASSERT_EQ(context_->currentSkillKeyInfo.mappingType, 0);
@@ -186,7 +191,7 @@ HWTEST_F(SkillKeyToTouchHandlerTest, HandleKeyEvent_005, TestSize.Level0)
 
     context_->isSkillOperating = false;
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
 }
@@ -204,7 +209,7 @@ HWTEST_F(SkillKeyToTouchHandlerTest, HandleKeyEvent_006, TestSize.Level0)
 
     keyEvent_->SetKeyCode(0);
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->isSkillOperating);
     ASSERT_TRUE(context_->pointerItems.find(pointerId) != context_->pointerItems.end());
@@ -223,7 +228,7 @@ HWTEST_F(SkillKeyToTouchHandlerTest, HandleKeyEvent_007, TestSize.Level0)
 
     keyEvent_->SetKeyAction(KeyEvent::KEY_ACTION_UP);
     context_->pointerItems.clear();
-    handler_->HandleKeyEvent(context_, keyEvent_, deviceInfo_, mappingInfo_);
+    handler_->HandleKeyEvent(context_, BuildSample(keyEvent_), mappingInfo_);
 
     ASSERT_TRUE(context_->isSkillOperating);
 }
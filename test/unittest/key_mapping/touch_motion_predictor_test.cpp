@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+#include <gtest/gtest.h>
+
+#define private public
+
+#include "touch_motion_predictor.h"
+
+#undef private
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const double X_VALUE = 1000.0;
+const double Y_VALUE = 500.0;
+const double STEP = 8.0;
+const int64_t START_TIME = 1000000;
+const int64_t SAMPLE_INTERVAL = 8000;
+const int64_t LATENCY = 16000;
+const int64_t EXTRA_HORIZON = 8000;
+const int64_t LONG_PAUSE = 100000;
+const int64_t MAX_HORIZON = 50000;
+const double MAX_OVERSHOOT = 64.0;
+const double EPSILON = 1e-6;
+}
+
+class TouchMotionPredictorTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        predictor_.SetEnabled(true);
+    }
+
+    /**
+     * Add the samples moved by step every SAMPLE_INTERVAL from X_VALUE.
+     * @return the time of the last sample
+     */
+    int64_t AddSamples(size_t count, double step)
+    {
+        int64_t time = START_TIME;
+        for (size_t idx = 0; idx < count; idx++) {
+            time = START_TIME + SAMPLE_INTERVAL * static_cast<int64_t>(idx);
+            predictor_.AddSample(X_VALUE + step * idx, Y_VALUE, time);
+        }
+        return time;
+    }
+
+public:
+    TouchMotionPredictor predictor_;
+};
+
+/**
+ * @tc.name: Predict_001
+ * @tc.desc: the last sample is moved ahead by the velocity multiplied by the latency
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(TouchMotionPredictorTest, Predict_001, TestSize.Level0)
+{
+    double x = 0.0;
+    double y = 0.0;
+    ASSERT_FALSE(predictor_.Predict(x, y));
+    AddSamples(1, STEP);
+    ASSERT_FALSE(predictor_.Predict(x, y));
+    ASSERT_NEAR(X_VALUE, x, EPSILON);
+
+    predictor_.UpdateLatency(LATENCY);
+    AddSamples(TouchMotionPredictor::SAMPLE_CAPACITY + 1, STEP);
+    ASSERT_TRUE(predictor_.Predict(x, y));
+    double lastX = X_VALUE + STEP * TouchMotionPredictor::SAMPLE_CAPACITY;
+    ASSERT_NEAR(lastX + STEP * LATENCY / SAMPLE_INTERVAL, x, EPSILON);
+    ASSERT_NEAR(Y_VALUE, y, EPSILON);
+}
+
+/**
+ * @tc.name: Predict_002
+ * @tc.desc: the overshoot is limited, and the last velocity is used when the hand slows down
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(TouchMotionPredictorTest, Predict_002, TestSize.Level0)
+{
+    predictor_.UpdateLatency(LATENCY);
+    double step = MAX_OVERSHOOT;
+    int64_t time = AddSamples(3, step);
+    double x = 0.0;
+    double y = 0.0;
+    ASSERT_TRUE(predictor_.Predict(x, y));
+    ASSERT_NEAR(X_VALUE + step * 2 + MAX_OVERSHOOT, x, EPSILON);
+
+    predictor_.AddSample(X_VALUE + step * 2 + 1.0, Y_VALUE, time + SAMPLE_INTERVAL);
+    ASSERT_TRUE(predictor_.Predict(x, y));
+    ASSERT_NEAR(X_VALUE + step * 2 + 1.0 + static_cast<double>(LATENCY) / SAMPLE_INTERVAL, x, EPSILON);
+}
+
+/**
+ * @tc.name: AddSample_001
+ * @tc.desc: the samples before a long pause are dropped
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(TouchMotionPredictorTest, AddSample_001, TestSize.Level0)
+{
+    predictor_.UpdateLatency(LATENCY);
+    int64_t time = AddSamples(3, STEP);
+    predictor_.SetInjectedPoint(static_cast<int32_t>(X_VALUE), static_cast<int32_t>(Y_VALUE));
+    predictor_.AddSample(X_VALUE, Y_VALUE, time + LONG_PAUSE);
+    ASSERT_EQ(1, predictor_.count_);
+    ASSERT_FALSE(predictor_.IsInjectedPoint(static_cast<int32_t>(X_VALUE), static_cast<int32_t>(Y_VALUE)));
+    double x = 0.0;
+    double y = 0.0;
+    ASSERT_FALSE(predictor_.Predict(x, y));
+}
+
+/**
+ * @tc.name: UpdateLatency_001
+ * @tc.desc: the latency is smoothed and the invalid ones are ignored, and the horizon is limited
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(TouchMotionPredictorTest, UpdateLatency_001, TestSize.Level0)
+{
+    predictor_.SetExtraHorizon(EXTRA_HORIZON);
+    ASSERT_EQ(EXTRA_HORIZON, predictor_.GetHorizon());
+    predictor_.UpdateLatency(-1);
+    predictor_.UpdateLatency(LATENCY);
+    ASSERT_EQ(LATENCY + EXTRA_HORIZON, predictor_.GetHorizon());
+    predictor_.UpdateLatency(LATENCY * 9);
+    ASSERT_EQ(LATENCY * 2 + EXTRA_HORIZON, predictor_.GetHorizon());
+    predictor_.UpdateLatency(LONG_PAUSE * 10);
+    ASSERT_EQ(LATENCY * 2 + EXTRA_HORIZON, predictor_.GetHorizon());
+
+    predictor_.SetExtraHorizon(MAX_HORIZON);
+    ASSERT_EQ(MAX_HORIZON, predictor_.GetHorizon());
+}
+}
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+
+#define private public
+
+#include "device_identify_cache.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const char* GENERATION_PATH = "/data/local/tmp/gamecontroller_device_rule_generation_test.json";
+const char* CACHE_PATH = "/data/local/tmp/gamecontroller_device_identify_cache_test.json";
+const size_t CAPACITY = 2;
+const int64_t GENERATION = 1000;
+const int64_t GENERATION_2 = 1001;
+const int32_t VENDOR = 9354;
+const int32_t PRODUCT = 33382;
+const char* DEVICE_NAME = "BEITONG_A1N2";
+}
+
+class DeviceIdentifyCacheTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        std::remove(GENERATION_PATH);
+        std::remove(CACHE_PATH);
+    }
+
+    void TearDown() override
+    {
+        std::remove(GENERATION_PATH);
+        std::remove(CACHE_PATH);
+    }
+
+    static void WriteFile(const std::string &path, const std::string &content)
+    {
+        std::ofstream file(path);
+        file << content;
+        file.close();
+    }
+
+    static DeviceInfo BuildDeviceInfo(int32_t vendor, int32_t product, const std::string &name)
+    {
+        DeviceInfo deviceInfo;
+        deviceInfo.vendor = vendor;
+        deviceInfo.product = product;
+        deviceInfo.name = name;
+        return deviceInfo;
+    }
+};
+
+/**
+ * @tc.name: ReadRuleGeneration_001
+ * @tc.desc: The generation is read only when the service published it
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(DeviceIdentifyCacheTest, ReadRuleGeneration_001, TestSize.Level0)
+{
+    DeviceIdentifyCache cache(GENERATION_PATH, CACHE_PATH, CAPACITY);
+    int64_t generation = 0;
+    ASSERT_FALSE(cache.ReadRuleGeneration(generation));
+    WriteFile(GENERATION_PATH, "{\"generation\":\"1000\"}");
+    ASSERT_FALSE(cache.ReadRuleGeneration(generation));
+    WriteFile(GENERATION_PATH, "{\"generation\":1000}");
+    ASSERT_TRUE(cache.ReadRuleGeneration(generation));
+    ASSERT_EQ(GENERATION, generation);
+}
+
+/**
+ * @tc.name: Find_001
+ * @tc.desc: The device type is found by the same vendor, product and name under the same generation
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(DeviceIdentifyCacheTest, Find_001, TestSize.Level0)
+{
+    DeviceIdentifyCache cache(GENERATION_PATH, CACHE_PATH, CAPACITY);
+    DeviceInfo deviceInfo = BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME);
+    DeviceTypeEnum deviceType = DeviceTypeEnum::UNKNOWN;
+    ASSERT_FALSE(cache.Find(deviceInfo, GENERATION, deviceType));
+
+    cache.Put(deviceInfo, GENERATION, DeviceTypeEnum::GAME_PAD);
+    deviceInfo.uniq = "another_uniq";
+    ASSERT_TRUE(cache.Find(deviceInfo, GENERATION, deviceType));
+    ASSERT_EQ(DeviceTypeEnum::GAME_PAD, deviceType);
+    ASSERT_FALSE(cache.Find(BuildDeviceInfo(VENDOR, PRODUCT, "another_name"), GENERATION, deviceType));
+    ASSERT_FALSE(cache.Find(deviceInfo, GENERATION_2, deviceType));
+
+    // the devices without vendor and product are never cached
+    DeviceInfo virtualDevice = BuildDeviceInfo(0, 0, DEVICE_NAME);
+    cache.Put(virtualDevice, GENERATION, DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_FALSE(cache.Find(virtualDevice, GENERATION, deviceType));
+    ASSERT_EQ(1, cache.Size());
+}
+
+/**
+ * @tc.name: Put_001
+ * @tc.desc: The devices of the old generation are dropped, and the oldest device is dropped when it's full
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(DeviceIdentifyCacheTest, Put_001, TestSize.Level0)
+{
+    DeviceIdentifyCache cache(GENERATION_PATH, CACHE_PATH, CAPACITY);
+    DeviceTypeEnum deviceType = DeviceTypeEnum::UNKNOWN;
+    cache.Put(BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME), GENERATION, DeviceTypeEnum::GAME_PAD);
+    cache.Put(BuildDeviceInfo(VENDOR, PRODUCT + 1, DEVICE_NAME), GENERATION, DeviceTypeEnum::UNKNOWN);
+    cache.Put(BuildDeviceInfo(VENDOR, PRODUCT + 2, DEVICE_NAME), GENERATION, DeviceTypeEnum::GAME_MOUSE);
+    ASSERT_EQ(CAPACITY, cache.Size());
+    ASSERT_FALSE(cache.Find(BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME), GENERATION, deviceType));
+    ASSERT_TRUE(cache.Find(BuildDeviceInfo(VENDOR, PRODUCT + 1, DEVICE_NAME), GENERATION, deviceType));
+    ASSERT_EQ(DeviceTypeEnum::UNKNOWN, deviceType);
+
+    cache.Put(BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME), GENERATION_2, DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_EQ(1, cache.Size());
+    ASSERT_TRUE(cache.Find(BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME), GENERATION_2, deviceType));
+    ASSERT_EQ(DeviceTypeEnum::GAME_KEY_BOARD, deviceType);
+    ASSERT_FALSE(cache.Find(BuildDeviceInfo(VENDOR, PRODUCT + 1, DEVICE_NAME), GENERATION, deviceType));
+}
+
+/**
+ * @tc.name: Save_001
+ * @tc.desc: The saved devices are loaded by another cache, and a broken file is ignored
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(DeviceIdentifyCacheTest, Save_001, TestSize.Level0)
+{
+    DeviceIdentifyCache cache(GENERATION_PATH, CACHE_PATH, CAPACITY);
+    cache.Put(BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME), GENERATION, DeviceTypeEnum::HOVER_TOUCH_PAD);
+    cache.Save();
+    ASSERT_FALSE(cache.isChanged_);
+
+    DeviceIdentifyCache loadedCache(GENERATION_PATH, CACHE_PATH, CAPACITY);
+    DeviceTypeEnum deviceType = DeviceTypeEnum::UNKNOWN;
+    ASSERT_TRUE(loadedCache.Find(BuildDeviceInfo(VENDOR, PRODUCT, DEVICE_NAME), GENERATION, deviceType));
+    ASSERT_EQ(DeviceTypeEnum::HOVER_TOUCH_PAD, deviceType);
+    ASSERT_FALSE(loadedCache.isChanged_);
+
+    WriteFile(CACHE_PATH, "{\"generation\":1000,\"devices\":[{\"vendor\":9354");
+    DeviceIdentifyCache brokenCache(GENERATION_PATH, CACHE_PATH, CAPACITY);
+    ASSERT_EQ(0, brokenCache.Size());
+}
+}
+}
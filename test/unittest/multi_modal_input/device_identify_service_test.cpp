@@ -28,6 +28,8 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <cstdio>
+#include <fstream>
 #include <string>
 #include "refbase.h"
 #include "gamecontroller_errors.h"
@@ -45,11 +47,17 @@ const int32_t DEVICE_ID5 = 5;
 const int32_t ALPHABETIC_KEYBOARD_TYPE = 2; // Full keyboard
 const int32_t INVALID_KEYBOARD_TYPE = 3;
 const int32_t TOTAL_RESULT = 4;
+const char* GENERATION_PATH = "/data/local/tmp/gamecontroller_device_rule_generation_test.json";
+const char* CACHE_PATH = "/data/local/tmp/gamecontroller_device_identify_cache_test.json";
+const int32_t VENDOR = 9354;
+const int32_t PRODUCT = 33382;
 }
 class ServerClientMock : public GameControllerServerClient {
 public:
     int32_t IdentifyDevice(const std::vector<DeviceInfo> &deviceInfos, std::vector<DeviceInfo> &identifyResult) override
     {
+        identifyCount_++;
+        requestDevices_ = deviceInfos;
         for (const DeviceInfo &deviceInfo: identifyResult_) {
             identifyResult.push_back(deviceInfo);
         }
@@ -59,12 +67,15 @@ public:
 public:
     int32_t result_;
     std::vector<DeviceInfo> identifyResult_;
+    int32_t identifyCount_ = 0;
+    std::vector<DeviceInfo> requestDevices_;
 };
 
 class DeviceInfoMock : public DeviceInfoService {
 public:
     std::pair<int32_t, int32_t> GetKeyBoardType(int32_t id) override
     {
+        keyBoardTypeCount_++;
         if (keyBoardTypeMap_.count(id)) {
             return keyBoardTypeMap_[id];
         }
@@ -74,6 +85,7 @@ public:
 
 public:
     std::unordered_map<int32_t, std::pair<int32_t, int32_t>> keyBoardTypeMap_;
+    int32_t keyBoardTypeCount_ = 0;
 };
 
 class DeviceIdentifyServiceTest : public testing::Test {
@@ -93,6 +105,10 @@ void DeviceIdentifyServiceTest::SetUp()
     GameControllerServerClient::instance_ = serverClientMock_;
     deviceInfoServiceMock_ = std::make_shared<DeviceInfoMock>();
     DeviceInfoService::instance_ = deviceInfoServiceMock_;
+    std::remove(GENERATION_PATH);
+    std::remove(CACHE_PATH);
+    DelayedSingleton<DeviceIdentifyService>::GetInstance()->identifyCache_ = DeviceIdentifyCache(
+        GENERATION_PATH, CACHE_PATH, DEVICE_IDENTIFY_CACHE_CAPACITY);
 }
 
 void DeviceIdentifyServiceTest::TearDown()
@@ -101,6 +117,8 @@ void DeviceIdentifyServiceTest::TearDown()
     GameControllerServerClient::instance_ = nullptr;
     deviceInfoServiceMock_.reset();
     DeviceInfoService::instance_ = nullptr;
+    std::remove(GENERATION_PATH);
+    std::remove(CACHE_PATH);
 }
 
 /**
@@ -195,5 +213,90 @@ HWTEST_F(DeviceIdentifyServiceTest, IdentifyDeviceType_002, TestSize.Level0)
     ASSERT_EQ(TOTAL_RESULT, deviceResult.size());
     CheckResult(deviceResult);
 }
+/**
+* @tc.name: IdentifyDeviceType_003
+* @tc.desc: The devices identified before are found in the cache without the request to the service,
+*           until the generation of the rules is changed
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(DeviceIdentifyServiceTest, IdentifyDeviceType_003, TestSize.Level0)
+{
+    std::ofstream file(GENERATION_PATH);
+    file << "{\"generation\":1000}";
+    file.close();
+
+    DeviceInfo gamePad = BuildDeviceInfo(DEVICE_ID1, InputSourceTypeEnum::JOYSTICK);
+    gamePad.vendor = VENDOR;
+    gamePad.product = PRODUCT;
+    DeviceInfo keyboard = BuildDeviceInfo(DEVICE_ID2, InputSourceTypeEnum::KEYBOARD);
+    keyboard.vendor = VENDOR;
+    keyboard.product = PRODUCT + 1;
+    deviceInfoServiceMock_->keyBoardTypeMap_[DEVICE_ID2] = std::pair<int32_t, int32_t>(GAME_CONTROLLER_SUCCESS,
+                                                                                       ALPHABETIC_KEYBOARD_TYPE);
+    DeviceInfo result1 = gamePad;
+    result1.deviceType = DeviceTypeEnum::GAME_PAD;
+    serverClientMock_->identifyResult_ = {result1, keyboard};
+    std::shared_ptr<DeviceIdentifyService> service = DelayedSingleton<DeviceIdentifyService>::GetInstance();
+    ASSERT_EQ(2, service->IdentifyDeviceType({gamePad, keyboard}).size());
+    ASSERT_EQ(1, serverClientMock_->identifyCount_);
+
+    // reconnected with other ids
+    gamePad = BuildDeviceInfo(DEVICE_ID3, InputSourceTypeEnum::JOYSTICK);
+    gamePad.vendor = VENDOR;
+    gamePad.product = PRODUCT;
+    keyboard = BuildDeviceInfo(DEVICE_ID4, InputSourceTypeEnum::KEYBOARD);
+    keyboard.vendor = VENDOR;
+    keyboard.product = PRODUCT + 1;
+    deviceInfoServiceMock_->keyBoardTypeMap_[DEVICE_ID4] = std::pair<int32_t, int32_t>(GAME_CONTROLLER_SUCCESS,
+                                                                                       ALPHABETIC_KEYBOARD_TYPE);
+    std::vector<DeviceInfo> result = service->IdentifyDeviceType({gamePad, keyboard});
+    ASSERT_EQ(1, serverClientMock_->identifyCount_);
+    ASSERT_EQ(2, result.size());
+    ASSERT_EQ(DeviceTypeEnum::GAME_PAD, result[0].deviceType);
+    ASSERT_EQ(1, result[0].idSourceTypeMap.count(DEVICE_ID3));
+    ASSERT_EQ(DeviceTypeEnum::UNKNOWN, result[1].deviceType);
+    ASSERT_TRUE(result[1].hasFullKeyBoard);
+
+    // the rules are changed, so the devices are requested again
+    file.open(GENERATION_PATH);
+    file << "{\"generation\":1001}";
+    file.close();
+    serverClientMock_->identifyResult_.clear();
+    service->IdentifyDeviceType({gamePad, keyboard});
+    ASSERT_EQ(2, serverClientMock_->identifyCount_);
+    ASSERT_EQ(2, serverClientMock_->requestDevices_.size());
+}
+/**
+* @tc.name: IdentifyDeviceType_004
+* @tc.desc: The keyboard type is queried once for each device id until the device is removed,
+*           and a failed query is tried again
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(DeviceIdentifyServiceTest, IdentifyDeviceType_004, TestSize.Level0)
+{
+    DeviceInfo keyboard = BuildDeviceInfo(DEVICE_ID1, InputSourceTypeEnum::KEYBOARD);
+    DeviceInfo failedKeyboard = BuildDeviceInfo(DEVICE_ID2, InputSourceTypeEnum::KEYBOARD);
+    DeviceInfo mouse = BuildDeviceInfo(DEVICE_ID3, InputSourceTypeEnum::MOUSE);
+    deviceInfoServiceMock_->keyBoardTypeMap_[DEVICE_ID1] = std::pair<int32_t, int32_t>(GAME_CONTROLLER_SUCCESS,
+                                                                                       ALPHABETIC_KEYBOARD_TYPE);
+    serverClientMock_->identifyResult_ = {keyboard, failedKeyboard, mouse};
+    std::shared_ptr<DeviceIdentifyService> service = DelayedSingleton<DeviceIdentifyService>::GetInstance();
+    std::vector<DeviceInfo> result = service->IdentifyDeviceType({keyboard, failedKeyboard, mouse});
+    ASSERT_EQ(3, result.size());
+    ASSERT_TRUE(result[0].hasFullKeyBoard);
+    ASSERT_FALSE(result[1].hasFullKeyBoard);
+    ASSERT_EQ(2, deviceInfoServiceMock_->keyBoardTypeCount_);
+
+    result = service->IdentifyDeviceType({keyboard, failedKeyboard, mouse});
+    ASSERT_TRUE(result[0].hasFullKeyBoard);
+    ASSERT_EQ(3, deviceInfoServiceMock_->keyBoardTypeCount_);
+
+    deviceInfoServiceMock_->RemoveDeviceCapability(DEVICE_ID1);
+    serverClientMock_->identifyResult_ = {keyboard};
+    service->IdentifyDeviceType({keyboard});
+    ASSERT_EQ(4, deviceInfoServiceMock_->keyBoardTypeCount_);
+}
+}
 }
-}
\ No newline at end of file
@@ -27,8 +27,14 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <string>
+#include <thread>
 #include "refbase.h"
+#include "gamecontroller_errors.h"
+#include "gamecontroller_utils.h"
 
 using ::testing::Return;
 using namespace testing::ext;
@@ -36,6 +42,13 @@ namespace OHOS {
 namespace GameController {
 namespace {
 const int32_t CACHE_DEVICE_ID = 100;
+const int32_t BURST_DEVICE_COUNT = 50;
+const int64_t BURST_EVENT_INTERVAL = 1000;
+const int64_t MAX_DELAY_TIME = 100 * 1000;
+const int64_t QUIET_TIME = 10 * 1000;
+const int64_t FAKE_START_TIME = 1000 * 1000;
+const int64_t SETTLE_TIMEOUT = 2000 * 1000;
+const int32_t ALPHABETIC_KEYBOARD_TYPE = 2;
 }
 
 class MultiModalInputMgtServiceTest : public testing::Test {
@@ -67,6 +80,7 @@ static void ClearDeviceCache()
 {
     DelayedSingleton<MultiModalInputMgtService>::GetInstance()->deviceIdUniqMap_.clear();
     DelayedSingleton<MultiModalInputMgtService>::GetInstance()->deviceInfoByUniqMap_.clear();
+    DelayedSingleton<MultiModalInputMgtService>::GetInstance()->uniqsByDeviceType_.clear();
 }
 
 void MultiModalInputMgtServiceTest::SetUp()
@@ -86,6 +100,25 @@ void MultiModalInputMgtServiceTest::TearDown()
     ClearDeviceCache();
 }
 
+/**
+ * Wait until the count of the devices is reached.
+ * @return the time since startTime in microseconds, or -1 when it's timeout
+ */
+static int64_t WaitDeviceCount(size_t deviceCount, int64_t startTime)
+{
+    std::shared_ptr<MultiModalInputMgtService> service = DelayedSingleton<MultiModalInputMgtService>::GetInstance();
+    while (StringUtils::GetSysClockTime() - startTime < SETTLE_TIMEOUT) {
+        {
+            std::lock_guard<ffrt::mutex> lock(service->deviceChangeEventMutex_);
+            if (service->deviceInfoByUniqMap_.size() >= deviceCount && service->needStartDelayHandle_) {
+                return StringUtils::GetSysClockTime() - startTime;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(BURST_EVENT_INTERVAL));
+    }
+    return -1;
+}
+
 static void InitDeviceCache()
 {
     DeviceInfo deviceInfo;
@@ -669,5 +702,123 @@ HWTEST_F(MultiModalInputMgtServiceTest, HandleDeviceChangeEvent_009, TestSize.Le
     ASSERT_EQ(0, DelayedSingleton<MultiModalInputMgtService>::GetInstance()->deviceChangeEventCache_.size());
 }
 
+/**
+* @tc.name: DelayHandleDeviceChangeEvent_001
+* @tc.desc: A lone device change event is handled at once, without the fixed delay.
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(MultiModalInputMgtServiceTest, DelayHandleDeviceChangeEvent_001, TestSize.Level0)
+{
+    std::shared_ptr<MultiModalInputMgtService> service = DelayedSingleton<MultiModalInputMgtService>::GetInstance();
+    service->lastDeviceChangeTime_ = 0;
+    std::pair<int32_t, InputDeviceInfo> pair;
+    pair.first = GAME_CONTROLLER_SUCCESS;
+    pair.second = MultiModalInputMgtServiceTest::CreateInputDeviceInfo(1);
+    EXPECT_CALL(*(deviceInfoServiceMock_.get()), GetInputDeviceInfo(1)).WillOnce(Return(pair));
+    EXPECT_CALL(*(gameControllerServerClientMock_.get()), IdentifyDevice(testing::_, testing::_)).WillOnce(Return(1));
+
+    int64_t startTime = StringUtils::GetSysClockTime();
+    DeviceChangeEvent event;
+    event.deviceChangeType = DeviceChangeType::ADD;
+    event.deviceId = 1;
+    service->DelayHandleDeviceChangeEvent(event);
+    int64_t settleTime = WaitDeviceCount(1, startTime);
+    RecordProperty("settleTimeUs", std::to_string(settleTime));
+    ASSERT_GE(settleTime, 0);
+    ASSERT_LT(settleTime, MAX_DELAY_TIME);
+    ASSERT_FALSE(service->isBurstBatch_);
+}
+
+/**
+* @tc.name: DelayHandleDeviceChangeEvent_002
+* @tc.desc: A burst of 50 devices, such as a USB hub, is aggregated into one batch once it's quiet.
+ * The debounce is driven by a fake clock, and the task queue is held until the burst ends.
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(MultiModalInputMgtServiceTest, DelayHandleDeviceChangeEvent_002, TestSize.Level0)
+{
+    std::shared_ptr<MultiModalInputMgtService> service = DelayedSingleton<MultiModalInputMgtService>::GetInstance();
+    service->lastDeviceChangeTime_ = 0;
+    std::atomic<int64_t> fakeTime{FAKE_START_TIME};
+    service->debounceClock_ = [&fakeTime] { return fakeTime.load(); };
+    EXPECT_CALL(*(deviceInfoServiceMock_.get()), GetInputDeviceInfo(testing::_))
+        .Times(BURST_DEVICE_COUNT)
+        .WillRepeatedly(testing::Invoke([](int32_t deviceId) {
+            return std::pair<int32_t, InputDeviceInfo>(GAME_CONTROLLER_SUCCESS,
+                MultiModalInputMgtServiceTest::CreateInputDeviceInfo(deviceId));
+        }));
+    EXPECT_CALL(*(gameControllerServerClientMock_.get()), IdentifyDevice(testing::_, testing::_))
+        .WillOnce(Return(1));
+
+    // The task of the first event waits behind this one until the burst is over.
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    service->deviceTaskQueue_->submit([released] { released.wait(); });
+    for (int32_t deviceId = 1; deviceId <= BURST_DEVICE_COUNT; deviceId++) {
+        DeviceChangeEvent event;
+        event.deviceChangeType = DeviceChangeType::ADD;
+        event.deviceId = deviceId;
+        service->DelayHandleDeviceChangeEvent(event);
+        fakeTime += BURST_EVENT_INTERVAL;
+    }
+    EXPECT_TRUE(service->isBurstBatch_);
+    fakeTime += QUIET_TIME;
+    release.set_value();
+    service->deviceTaskQueue_->wait(service->deviceTaskQueue_->submit_h([] {}));
+    service->debounceClock_ = StringUtils::GetSysClockTime;
+
+    ASSERT_EQ(BURST_DEVICE_COUNT, service->deviceIdUniqMap_.size());
+    ASSERT_EQ(0, service->deviceChangeEventCache_.size());
+    ASSERT_FALSE(service->isBurstBatch_);
+    ASSERT_TRUE(service->needStartDelayHandle_);
+}
+
+/**
+ * @tc.name: GetOneDeviceByDeviceType_001
+ * @tc.desc: The device is found by the index of the device type, and it's not found after it goes offline.
+ * The keyboard type is queried once.
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(MultiModalInputMgtServiceTest, GetOneDeviceByDeviceType_001, TestSize.Level0)
+{
+    std::pair<int32_t, std::vector<InputDeviceInfo>> pair;
+    pair.first = GAME_CONTROLLER_SUCCESS;
+    InputDeviceInfo gamePad = MultiModalInputMgtServiceTest::CreateInputDeviceInfo(1);
+    gamePad.sourceTypeSet = {InputSourceTypeEnum::JOYSTICK, InputSourceTypeEnum::KEYBOARD};
+    InputDeviceInfo keyboard = MultiModalInputMgtServiceTest::CreateInputDeviceInfo(2);
+    keyboard.sourceTypeSet = {InputSourceTypeEnum::KEYBOARD};
+    pair.second = {gamePad, keyboard};
+    EXPECT_CALL(*(deviceInfoServiceMock_.get()), GetAllDeviceInfos()).WillRepeatedly(Return(pair));
+    EXPECT_CALL(*(deviceInfoServiceMock_.get()), GetKeyBoardType(gamePad.id)).Times(1)
+        .WillOnce(Return(std::make_pair(GAME_CONTROLLER_SUCCESS, 0)));
+    EXPECT_CALL(*(deviceInfoServiceMock_.get()), GetKeyBoardType(keyboard.id)).Times(1)
+        .WillOnce(Return(std::make_pair(GAME_CONTROLLER_SUCCESS, ALPHABETIC_KEYBOARD_TYPE)));
+    EXPECT_CALL(*(gameControllerServerClientMock_.get()), IdentifyDevice(testing::_, testing::_))
+        .WillRepeatedly(Return(1));
+    std::shared_ptr<MultiModalInputMgtService> service = DelayedSingleton<MultiModalInputMgtService>::GetInstance();
+    service->GetAllDeviceInfos();
+    service->GetAllDeviceInfos();
+
+    std::pair<bool, DeviceInfo> result = service->GetOneDeviceByDeviceType(DeviceTypeEnum::GAME_PAD);
+    ASSERT_TRUE(result.first);
+    ASSERT_EQ(gamePad.uniq, result.second.uniq);
+    result = service->GetOneDeviceByDeviceType(DeviceTypeEnum::GAME_KEY_BOARD);
+    ASSERT_TRUE(result.first);
+    ASSERT_EQ(keyboard.uniq, result.second.uniq);
+    ASSERT_FALSE(service->GetOneDeviceByDeviceType(DeviceTypeEnum::GAME_MOUSE).first);
+
+    service->needStartDelayHandle_ = false;
+    DeviceChangeEvent event;
+    event.deviceChangeType = DeviceChangeType::REMOVE;
+    event.deviceId = gamePad.id;
+    service->deviceChangeEventCache_.push_back(event);
+    service->HandleDeviceChangeEvent();
+    ASSERT_FALSE(service->GetOneDeviceByDeviceType(DeviceTypeEnum::GAME_PAD).first);
+    ASSERT_TRUE(service->GetOneDeviceByDeviceType(DeviceTypeEnum::GAME_KEY_BOARD).first);
+    ASSERT_EQ(0, service->uniqsByDeviceType_.count(DeviceTypeEnum::GAME_PAD));
+}
+}
 }
-}
\ No newline at end of file
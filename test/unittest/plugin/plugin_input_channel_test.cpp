@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+
+#define private public
+
+#include "plugin_input_channel.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const std::string BUNDLE_NAME = "com.test.game";
+const std::string QUEUE_NAME = "plugin-input-test";
+const size_t SMALL_CAPACITY = 2;
+const size_t NOT_POWER_OF_TWO_CAPACITY = 5;
+const size_t ROUNDED_CAPACITY = 8;
+const int32_t EVENT_COUNT = 10;
+const int32_t SENDER_COUNT = 4;
+const int32_t EVENT_COUNT_PER_SENDER = 500;
+}
+
+class PluginInputChannelTest : public testing::Test {
+public:
+    void SetUp() override;
+
+    /**
+     * Records the id of every delivered event, and the ids of pointer events are negative.
+     */
+    void OnEvent(const PluginInputEvent &event);
+
+    std::vector<int32_t> GetIds();
+
+public:
+    std::mutex mutex_;
+    std::vector<int32_t> ids_;
+};
+
+void PluginInputChannelTest::SetUp()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ids_.clear();
+}
+
+void PluginInputChannelTest::OnEvent(const PluginInputEvent &event)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (event.keyEvent != nullptr) {
+        ids_.push_back(event.keyEvent->GetId());
+    } else if (event.pointerEvent != nullptr) {
+        ids_.push_back(-event.pointerEvent->GetId());
+    }
+}
+
+std::vector<int32_t> PluginInputChannelTest::GetIds()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ids_;
+}
+
+/**
+ * @tc.name: Send_001
+ * @tc.desc: The key events and pointer events are delivered in the order they're sent
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(PluginInputChannelTest, Send_001, TestSize.Level0)
+{
+    PluginInputChannel channel(QUEUE_NAME, PLUGIN_INPUT_CHANNEL_CAPACITY, [this](const PluginInputEvent &event) {
+        OnEvent(event);
+    });
+    std::vector<int32_t> expectedIds;
+    for (int32_t idx = 1; idx <= EVENT_COUNT; idx++) {
+        std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+        keyEvent->SetId(idx);
+        channel.Send(BUNDLE_NAME, keyEvent, false);
+        std::shared_ptr<MMI::PointerEvent> pointerEvent = MMI::PointerEvent::Create();
+        pointerEvent->SetId(idx);
+        channel.Send(BUNDLE_NAME, pointerEvent, true);
+        expectedIds.push_back(idx);
+        expectedIds.push_back(-idx);
+    }
+    channel.WaitIdle();
+    ASSERT_EQ(expectedIds, GetIds());
+
+    // the delivered events are released from the slots
+    for (const auto &slot: channel.channel_->slots_) {
+        ASSERT_EQ(nullptr, slot.keyEvent);
+        ASSERT_EQ(nullptr, slot.pointerEvent);
+    }
+}
+
+/**
+ * @tc.name: Send_002
+ * @tc.desc: When the ring is full, the events wait in the overflow list and are delivered in order
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(PluginInputChannelTest, Send_002, TestSize.Level0)
+{
+    std::mutex blockMutex;
+    std::condition_variable blockCondition;
+    bool isBlocked = true;
+    PluginInputChannel channel(QUEUE_NAME, SMALL_CAPACITY, [&, this](const PluginInputEvent &event) {
+        std::unique_lock<std::mutex> lock(blockMutex);
+        blockCondition.wait(lock, [&isBlocked] { return !isBlocked; });
+        OnEvent(event);
+    });
+    std::vector<int32_t> expectedIds;
+    for (int32_t idx = 1; idx <= EVENT_COUNT; idx++) {
+        std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+        keyEvent->SetId(idx);
+        channel.Send(BUNDLE_NAME, keyEvent, false);
+        expectedIds.push_back(idx);
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(channel.channel_->producerMutex_);
+        ASSERT_FALSE(channel.channel_->overflowEvents_.empty());
+    }
+    {
+        std::lock_guard<std::mutex> lock(blockMutex);
+        isBlocked = false;
+    }
+    blockCondition.notify_all();
+    channel.WaitIdle();
+    ASSERT_EQ(expectedIds, GetIds());
+    ASSERT_TRUE(channel.channel_->overflowEvents_.empty());
+}
+
+/**
+ * @tc.name: Send_003
+ * @tc.desc: The events of several senders are all delivered, and the events of one sender keep their order
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(PluginInputChannelTest, Send_003, TestSize.Level0)
+{
+    PluginInputChannel channel(QUEUE_NAME, SMALL_CAPACITY, [this](const PluginInputEvent &event) {
+        OnEvent(event);
+    });
+    std::vector<std::thread> senders;
+    for (int32_t sender = 0; sender < SENDER_COUNT; sender++) {
+        senders.emplace_back([&channel, sender] {
+            for (int32_t idx = 0; idx < EVENT_COUNT_PER_SENDER; idx++) {
+                std::shared_ptr<MMI::KeyEvent> keyEvent = MMI::KeyEvent::Create();
+                keyEvent->SetId(sender * EVENT_COUNT_PER_SENDER + idx);
+                channel.Send(BUNDLE_NAME, keyEvent, false);
+            }
+        });
+    }
+    for (auto &sender: senders) {
+        sender.join();
+    }
+    channel.WaitIdle();
+
+    std::vector<int32_t> ids = GetIds();
+    ASSERT_EQ(SENDER_COUNT * EVENT_COUNT_PER_SENDER, ids.size());
+    std::vector<int32_t> lastIds(SENDER_COUNT, -1);
+    for (int32_t id: ids) {
+        int32_t sender = id / EVENT_COUNT_PER_SENDER;
+        ASSERT_LT(lastIds[sender], id);
+        lastIds[sender] = id;
+    }
+}
+
+/**
+ * @tc.name: GetCapacity_001
+ * @tc.desc: The capacity is rounded up to a power of 2
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(PluginInputChannelTest, GetCapacity_001, TestSize.Level0)
+{
+    PluginInputChannel channel(QUEUE_NAME, NOT_POWER_OF_TWO_CAPACITY, [](const PluginInputEvent &) {});
+    ASSERT_EQ(ROUNDED_CAPACITY, channel.GetCapacity());
+}
+}
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/hwext/gtest-ext.h>
+#include <gtest/hwext/gtest-tag.h>
+
+#define private public
+
+#include "gamecontroller_server_client_proxy.h"
+#include "gamecontroller_server_client_proxy_mock.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "game_controller_server_interface_stub.h"
+#include "gamecontroller_errors.h"
+
+using ::testing::Return;
+using namespace testing::ext;
+namespace OHOS {
+namespace GameController {
+namespace {
+const int32_t CALL_COUNT = 10;
+}
+
+/**
+ * The SA in the same process. Every call of the proxy is counted as one binder call.
+ */
+class GameControllerServerFake : public GameControllerServerInterfaceStub {
+public:
+    int32_t IdentifyDevice(const std::vector<DeviceInfo> &deviceInfos,
+                           std::vector<DeviceInfo> &identifyResult) override
+    {
+        return Call();
+    }
+
+    int32_t SyncIdentifiedDeviceInfos(const std::vector<IdentifiedDeviceInfo> &deviceInfos) override
+    {
+        return Call();
+    }
+
+    int32_t SyncSupportKeyMappingGames(bool isSyncAll, const std::vector<GameInfo> &gameInfos) override
+    {
+        return Call();
+    }
+
+    int32_t GetGameKeyMappingConfig(const GetGameKeyMappingInfoParam &param,
+                                    GameKeyMappingInfo &gameKeyMappingInfo) override
+    {
+        return Call();
+    }
+
+    int32_t GetGameKeyMappingConfigs(const std::vector<GetGameKeyMappingInfoParam> &params,
+                                     std::vector<GameKeyMappingInfo> &gameKeyMappingInfos) override
+    {
+        return Call();
+    }
+
+    int32_t SetCustomGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfo) override
+    {
+        return Call();
+    }
+
+    int32_t SetCustomGameKeyMappingConfigs(const std::vector<GameKeyMappingInfo> &gameKeyMappingInfos) override
+    {
+        return Call();
+    }
+
+    int32_t SetDefaultGameKeyMappingConfig(const GameKeyMappingInfo &gameKeyMappingInfo) override
+    {
+        return Call();
+    }
+
+    int32_t BroadcastDeviceInfo(const GameInfo &gameInfo, const DeviceInfo &deviceInfo) override
+    {
+        return Call();
+    }
+
+    int32_t BroadcastOpenTemplateConfig(const GameInfo &gameInfo, const DeviceInfo &deviceInfo) override
+    {
+        return Call();
+    }
+
+    int32_t EnableGameKeyMapping(const GameInfo &gameInfo, bool isEnable) override
+    {
+        return Call();
+    }
+
+    bool IsObjectDead() const override
+    {
+        return isDead_;
+    }
+
+private:
+    int32_t Call()
+    {
+        callCount_++;
+        return result_;
+    }
+
+public:
+    int32_t callCount_ = 0;
+    int32_t result_ = GAME_CONTROLLER_SUCCESS;
+    bool isDead_ = false;
+};
+
+class GameControllerServerClientProxyTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        // The lookups of the samgr are counted by the mock.
+        proxyMock_ = std::make_shared<GameControllerServerClientProxyMock>();
+        DelayedSingleton<GameControllerServerClientProxy>::instance_ = proxyMock_;
+        serverFake_ = sptr<GameControllerServerFake>::MakeSptr();
+        std::lock_guard<std::mutex> lock(GetProxy()->loadServiceLock_);
+        GetProxy()->SetServiceProxy(serverFake_);
+    }
+
+    void TearDown() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(GetProxy()->loadServiceLock_);
+            GetProxy()->ReleaseServiceProxy();
+        }
+        serverFake_ = nullptr;
+        DelayedSingleton<GameControllerServerClientProxy>::instance_ = nullptr;
+        proxyMock_.reset();
+    }
+
+    static std::shared_ptr<GameControllerServerClientProxy> GetProxy()
+    {
+        return DelayedSingleton<GameControllerServerClientProxy>::GetInstance();
+    }
+
+    static bool IsCached(const sptr<IRemoteObject> &remoteObject)
+    {
+        std::shared_ptr<const sptr<IGameControllerServerInterface>> cachedServiceProxy =
+            std::atomic_load(&GetProxy()->cachedServiceProxy_);
+        return cachedServiceProxy != nullptr && (*cachedServiceProxy)->AsObject() == remoteObject;
+    }
+
+public:
+    std::shared_ptr<GameControllerServerClientProxyMock> proxyMock_;
+    sptr<GameControllerServerFake> serverFake_;
+};
+
+/**
+ * @tc.name: GetServiceProxy_001
+ * @tc.desc: The cached proxy is used by every call, so each call costs one binder call
+ * and the system ability manager isn't asked again
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerServerClientProxyTest, GetServiceProxy_001, TestSize.Level0)
+{
+    EXPECT_CALL(*proxyMock_, CheckSystemAbility()).Times(0);
+    EXPECT_CALL(*proxyMock_, LoadSystemAbility(testing::_)).Times(0);
+    std::vector<DeviceInfo> identifyResult;
+    GameInfo gameInfo;
+    for (int32_t idx = 0; idx < CALL_COUNT; idx++) {
+        ASSERT_EQ(GAME_CONTROLLER_SUCCESS, GetProxy()->IdentifyDevice({}, identifyResult));
+    }
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, GetProxy()->EnableGameKeyMapping(gameInfo, true));
+    ASSERT_EQ(CALL_COUNT + 1, serverFake_->callCount_);
+    ASSERT_TRUE(IsCached(serverFake_));
+}
+
+/**
+ * @tc.name: GetServiceProxy_002
+ * @tc.desc: The system ability manager is asked once by the first call, and the later calls use the cached proxy
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerServerClientProxyTest, GetServiceProxy_002, TestSize.Level0)
+{
+    {
+        std::lock_guard<std::mutex> lock(GetProxy()->loadServiceLock_);
+        GetProxy()->ReleaseServiceProxy();
+    }
+    EXPECT_CALL(*proxyMock_, CheckSystemAbility()).WillOnce(Return(sptr<IRemoteObject>(serverFake_)));
+    EXPECT_CALL(*proxyMock_, LoadSystemAbility(testing::_)).Times(0);
+
+    std::vector<DeviceInfo> identifyResult;
+    for (int32_t idx = 0; idx < CALL_COUNT; idx++) {
+        ASSERT_EQ(GAME_CONTROLLER_SUCCESS, GetProxy()->IdentifyDevice({}, identifyResult));
+    }
+    ASSERT_EQ(CALL_COUNT, serverFake_->callCount_);
+    ASSERT_TRUE(IsCached(serverFake_));
+}
+
+/**
+ * @tc.name: OnRemoteSaDead_001
+ * @tc.desc: The cached proxy is released when the SA is dead, and the death of another object is ignored.
+ * The next call asks the system ability manager again.
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerServerClientProxyTest, OnRemoteSaDead_001, TestSize.Level0)
+{
+    sptr<GameControllerServerFake> oldServerFake = sptr<GameControllerServerFake>::MakeSptr();
+    GetProxy()->OnRemoteSaDead(oldServerFake);
+    ASSERT_TRUE(IsCached(serverFake_));
+
+    GetProxy()->OnRemoteSaDead(serverFake_);
+    ASSERT_EQ(nullptr, std::atomic_load(&GetProxy()->cachedServiceProxy_));
+    ASSERT_TRUE(GetProxy()->gamecontrollerServerProxy_ == nullptr);
+
+    sptr<GameControllerServerFake> newServerFake = sptr<GameControllerServerFake>::MakeSptr();
+    EXPECT_CALL(*proxyMock_, CheckSystemAbility()).WillOnce(Return(sptr<IRemoteObject>(newServerFake)));
+    std::vector<DeviceInfo> identifyResult;
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, GetProxy()->IdentifyDevice({}, identifyResult));
+    ASSERT_EQ(1, newServerFake->callCount_);
+    ASSERT_TRUE(IsCached(newServerFake));
+}
+
+/**
+ * @tc.name: ReleaseServiceProxyIfDead_001
+ * @tc.desc: The cached proxy is kept when a call fails for other reasons,
+ * and it's released when a call fails because the SA is dead
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(GameControllerServerClientProxyTest, ReleaseServiceProxyIfDead_001, TestSize.Level0)
+{
+    GameKeyMappingInfo gameKeyMappingInfo;
+    serverFake_->result_ = GAME_ERR_ARGUMENT_INVALID;
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, GetProxy()->SetDefaultGameKeyMappingConfig(gameKeyMappingInfo));
+    ASSERT_TRUE(IsCached(serverFake_));
+
+    serverFake_->isDead_ = true;
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, GetProxy()->SetDefaultGameKeyMappingConfig(gameKeyMappingInfo));
+    ASSERT_EQ(nullptr, std::atomic_load(&GetProxy()->cachedServiceProxy_));
+    ASSERT_TRUE(GetProxy()->gamecontrollerServerProxy_ == nullptr);
+}
+}
+}
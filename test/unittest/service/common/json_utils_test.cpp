@@ -305,6 +305,23 @@ HWTEST_F(JsonUtilsTest, ReadJsonFromFile_001, TestSize.Level0)
     ASSERT_TRUE(*it == "value");
 }
 
+/**
+* @tc.name: WriteFile_001
+* @tc.desc: the file is replaced by the new content and no temporary file is left
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(JsonUtilsTest, WriteFile_001, TestSize.Level0)
+{
+    std::string path = "./" + TEST_FILE_NAME;
+    ASSERT_TRUE(JsonUtils::WriteFile(path, "old content"));
+    ASSERT_TRUE(JsonUtils::WriteFile(path, "new"));
+    std::string content;
+    ASSERT_TRUE(JsonUtils::ReadFile(path, content));
+    ASSERT_EQ("new", content);
+    ASSERT_FALSE(JsonUtils::IsFileExist(path + ".tmp"));
+}
+
 /**
 * @tc.name: IsFileExist_001
 * @tc.desc: return true when file exit
@@ -28,6 +28,7 @@
 #include <gtest/gtest.h>
 #include <string>
 #include "refbase.h"
+#include "json_utils.h"
 
 using namespace testing::ext;
 using namespace std;
@@ -37,6 +38,17 @@ namespace OHOS {
 namespace GameController {
 namespace {
 const int32_t MAX_DEVICE_NUMBER = 10000;
+const char* RULE_GENERATION_PATH =
+    "/data/service/el1/public/for-all-app/gamecontroller_server/device_rule_generation.json";
+
+int64_t ReadRuleGeneration()
+{
+    std::pair<bool, json> ret = JsonUtils::ReadJsonFromFile(RULE_GENERATION_PATH);
+    if (!ret.first || !ret.second.contains("generation")) {
+        return 0;
+    }
+    return ret.second.at("generation").get<int64_t>();
+}
 }
 class DeviceManagerTest : public testing::Test {
 public:
@@ -49,7 +61,7 @@ public:
 
 void DeviceManagerTest::SetUp()
 {
-    DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.clear();
+    DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Publish({});
 }
 
 void DeviceManagerTest::TearDown()
@@ -61,7 +73,7 @@ void DeviceManagerTest::LoadTestCache()
     std::string content = "{\"GamePad\":[{\"NamePrefix\":\"BEITONG_A1N2\",\"Product\":33382,\"Vendor\":9354}]}";
     json js = json::parse(content);
     DelayedSingleton<GameController::DeviceManager>::GetInstance()->LoadFromJson(js);
-    ASSERT_FALSE(DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.empty());
+    ASSERT_FALSE(DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->empty());
 }
 
 /**
@@ -280,7 +292,7 @@ HWTEST_F(DeviceManagerTest, LoadFromJson_001, TestSize.Level0)
                           "\"Vendor\":9354}]}";
     json js = json::parse(content);
     DelayedSingleton<GameController::DeviceManager>::GetInstance()->LoadFromJson(js);
-    EXPECT_EQ(1, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
+    EXPECT_EQ(1, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
 }
 
 /**
@@ -296,7 +308,7 @@ HWTEST_F(DeviceManagerTest, LoadFromJson_002, TestSize.Level0)
                           "\"Product\":45083,\"Vendor\":1133}]}";
     json js = json::parse(content);
     DelayedSingleton<GameController::DeviceManager>::GetInstance()->LoadFromJson(js);
-    EXPECT_EQ(2, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
+    EXPECT_EQ(2, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
 }
 
 /**
@@ -310,7 +322,7 @@ HWTEST_F(DeviceManagerTest, LoadFromJson_003, TestSize.Level0)
     std::string content = "{}";
     json js = json::parse(content);
     DelayedSingleton<GameController::DeviceManager>::GetInstance()->LoadFromJson(js);
-    EXPECT_EQ(0, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
+    EXPECT_EQ(0, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
 }
 
 static bool IsSameIdentifyDeviceInfo(const IdentifiedDeviceInfo &info, const IdentifyDeviceInfo &target)
@@ -347,12 +359,12 @@ HWTEST_F(DeviceManagerTest, SyncIdentifiedDeviceInfos_001, TestSize.Level0)
     list.push_back(identifyDeviceInfo3);
     int32_t result = DelayedSingleton<GameController::DeviceManager>::GetInstance()->SyncIdentifiedDeviceInfos(list);
     EXPECT_EQ(result, GAME_CONTROLLER_SUCCESS);
-    EXPECT_EQ(2, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
-    DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.clear();
+    EXPECT_EQ(2, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
+    DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Publish({});
     DelayedSingleton<GameController::DeviceManager>::GetInstance()->LoadDeviceCacheFile();
-    EXPECT_EQ(2, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
+    EXPECT_EQ(2, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
     for (auto identifyDeviceInfo:
-        DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_) {
+        *DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()) {
         EXPECT_TRUE(IsSameIdentifyDeviceInfo(identifyDeviceInfo1, identifyDeviceInfo) ||
                         IsSameIdentifyDeviceInfo(identifyDeviceInfo2, identifyDeviceInfo));
     }
@@ -397,10 +409,10 @@ HWTEST_F(DeviceManagerTest, SyncIdentifiedDeviceInfos_003, TestSize.Level0)
     std::vector<IdentifiedDeviceInfo> list;
     int32_t result = DelayedSingleton<GameController::DeviceManager>::GetInstance()->SyncIdentifiedDeviceInfos(list);
     EXPECT_EQ(result, GAME_CONTROLLER_SUCCESS);
-    EXPECT_EQ(0, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
-    DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.clear();
+    EXPECT_EQ(0, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
+    DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Publish({});
     DelayedSingleton<GameController::DeviceManager>::GetInstance()->LoadDeviceCacheFile();
-    EXPECT_EQ(0, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.size());
+    EXPECT_EQ(0, DelayedSingleton<GameController::DeviceManager>::GetInstance()->identifiedDevices_.Load()->size());
 }
 
 /**
@@ -421,5 +433,33 @@ HWTEST_F(DeviceManagerTest, SyncIdentifiedDeviceInfos_004, TestSize.Level0)
     int32_t result = DelayedSingleton<GameController::DeviceManager>::GetInstance()->SyncIdentifiedDeviceInfos(list);
     EXPECT_EQ(result, GAME_ERR_ARGUMENT_INVALID);
 }
+
+/**
+* @tc.name: SyncIdentifiedDeviceInfos_005
+* @tc.desc: A new rule generation is published when the rules are changed, and it's kept when they are reloaded
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(DeviceManagerTest, SyncIdentifiedDeviceInfos_005, TestSize.Level0)
+{
+    std::vector<IdentifiedDeviceInfo> list;
+    IdentifiedDeviceInfo identifyDeviceInfo1;
+    identifyDeviceInfo1.deviceType = DeviceTypeEnum::GAME_PAD;
+    identifyDeviceInfo1.vendor = 93541;
+    identifyDeviceInfo1.product = 333821;
+    identifyDeviceInfo1.name = "BEITONG_A1N22";
+    list.push_back(identifyDeviceInfo1);
+    std::shared_ptr<DeviceManager> deviceManager = DelayedSingleton<GameController::DeviceManager>::GetInstance();
+    int64_t generation = ReadRuleGeneration();
+    EXPECT_EQ(GAME_CONTROLLER_SUCCESS, deviceManager->SyncIdentifiedDeviceInfos(list));
+    int64_t newGeneration = ReadRuleGeneration();
+    EXPECT_GT(newGeneration, generation);
+    EXPECT_EQ(newGeneration, deviceManager->ruleGeneration_);
+
+    deviceManager->identifiedDevices_.Publish({});
+    deviceManager->LoadDeviceCacheFile();
+    EXPECT_EQ(newGeneration, ReadRuleGeneration());
+    EXPECT_EQ(newGeneration, deviceManager->ruleGeneration_);
+}
 } // namespace GameController
 } // namespace OHOS
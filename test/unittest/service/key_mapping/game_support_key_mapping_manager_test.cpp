@@ -68,6 +68,14 @@ static GameSupportKeyMappingConfig BuildGameConfig(const std::string &bundleName
     return gameConfig;
 }
 
+static void AddGameConfig(const GameSupportKeyMappingConfig &gameConfig)
+{
+    GameSupportKeyMappingConfigMap configMap =
+        *DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Load();
+    configMap[gameConfig.bundleName] = gameConfig;
+    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Publish(std::move(configMap));
+}
+
 void GameSupportKeyMappingManagerTest::SetUp()
 {
     ClearCache();
@@ -80,7 +88,7 @@ void GameSupportKeyMappingManagerTest::TearDown()
 
 void GameSupportKeyMappingManagerTest::ClearCache()
 {
-    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.clear();
+    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Publish({});
 }
 
 /**
@@ -126,7 +134,7 @@ HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_001, TestS
     ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, rtn);
 }
 
-static void CheckGameConfig(GameInfo &gameInfo, GameSupportKeyMappingConfig &gameConfig)
+static void CheckGameConfig(const GameInfo &gameInfo, const GameSupportKeyMappingConfig &gameConfig)
 {
     ASSERT_EQ(gameInfo.bundleName, gameConfig.bundleName);
     ASSERT_EQ(gameInfo.version, gameConfig.version);
@@ -146,7 +154,7 @@ static void CheckGameConfig(GameInfo &gameInfo, GameSupportKeyMappingConfig &gam
 HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_002, TestSize.Level0)
 {
     GameSupportKeyMappingConfig gameConfig = BuildGameConfig("0", "00");
-    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_[gameConfig.bundleName] = gameConfig;
+    AddGameConfig(gameConfig);
     std::vector<GameInfo> gameInfos;
     GameInfo gameInfo1 = BuildGameInfo("1", "11", true);
     gameInfos.push_back(gameInfo1);
@@ -161,11 +169,11 @@ HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_002, TestS
 
     // check data
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
-    ASSERT_EQ(2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.size());
+    ASSERT_EQ(2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Load()->size());
     CheckGameConfig(gameInfo1, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()
-        ->configMap_[gameInfo1.bundleName]);
+        ->configMap_.Load()->at(gameInfo1.bundleName));
     CheckGameConfig(gameInfo2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()
-        ->configMap_[gameInfo2.bundleName]);
+        ->configMap_.Load()->at(gameInfo2.bundleName));
 }
 
 /**
@@ -177,9 +185,9 @@ HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_002, TestS
 HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_003, TestSize.Level0)
 {
     GameSupportKeyMappingConfig gameConfig1 = BuildGameConfig("0", "00");
-    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_[gameConfig1.bundleName] = gameConfig1;
+    AddGameConfig(gameConfig1);
     GameSupportKeyMappingConfig gameConfig2 = BuildGameConfig("2", "22");
-    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_[gameConfig2.bundleName] = gameConfig2;
+    AddGameConfig(gameConfig2);
     std::vector<GameInfo> gameInfos;
     GameInfo gameInfo1 = BuildGameInfo("0", "11", true);
     gameInfos.push_back(gameInfo1);
@@ -194,11 +202,11 @@ HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_003, TestS
 
     // check data
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
-    ASSERT_EQ(2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.size());
+    ASSERT_EQ(2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Load()->size());
     CheckGameConfig(gameInfo1, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()
-        ->configMap_[gameInfo1.bundleName]);
+        ->configMap_.Load()->at(gameInfo1.bundleName));
     CheckGameConfig(gameInfo3, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()
-        ->configMap_[gameInfo3.bundleName]);
+        ->configMap_.Load()->at(gameInfo3.bundleName));
 }
 
 /**
@@ -210,7 +218,7 @@ HWTEST_F(GameSupportKeyMappingManagerTest, SyncSupportKeyMappingGames_003, TestS
 HWTEST_F(GameSupportKeyMappingManagerTest, IsSupportGameKeyMapping_001, TestSize.Level0)
 {
     GameSupportKeyMappingConfig gameConfig = BuildGameConfig("0", "00");
-    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_[gameConfig.bundleName] = gameConfig;
+    AddGameConfig(gameConfig);
     GameInfo gameInfo = BuildGameInfo("0", "11", true);
     GameInfo result;
 
@@ -257,17 +265,17 @@ HWTEST_F(GameSupportKeyMappingManagerTest, LoadConfigFromJsonFile_001, TestSize.
     GameInfo gameInfo2 = BuildGameInfo("2", "22", true);
     gameInfos.push_back(gameInfo2);
     DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->SyncSupportKeyMappingGames(true, gameInfos);
-    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.clear();
+    DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Publish({});
 
     // execute
     DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->LoadConfigFromJsonFile();
 
     // check data
-    ASSERT_EQ(2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.size());
+    ASSERT_EQ(2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()->configMap_.Load()->size());
     CheckGameConfig(gameInfo1, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()
-        ->configMap_[gameInfo1.bundleName]);
+        ->configMap_.Load()->at(gameInfo1.bundleName));
     CheckGameConfig(gameInfo2, DelayedSingleton<GameSupportKeyMappingManager>::GetInstance()
-        ->configMap_[gameInfo2.bundleName]);
+        ->configMap_.Load()->at(gameInfo2.bundleName));
 }
 }
 }
\ No newline at end of file
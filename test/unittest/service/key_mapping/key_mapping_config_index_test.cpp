@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/hwext/gtest-ext.h"
+#include "gtest/hwext/gtest-tag.h"
+
+#define private public
+
+#include "key_mapping_config_index.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing::ext;
+using namespace std;
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const std::string BUNDLE_NAME = "test.pkg";
+const std::string BUNDLE_NAME_WITH_PREFIX = "test.pkg_3";
+const std::string BUNDLE_NAME_NOT_EXIST = "notexist.pkg";
+const int32_t INVALID_DEVICE_TYPE = 100;
+const uint32_t OFFSET = 10;
+}
+
+class KeyMappingConfigIndexTest : public testing::Test {
+public:
+    void SetUp() {};
+
+    void TearDown() {};
+
+    static KeyMappingConfigLocation BuildLocation(uint32_t offset);
+};
+
+KeyMappingConfigLocation KeyMappingConfigIndexTest::BuildLocation(uint32_t offset)
+{
+    KeyMappingConfigLocation location;
+    location.offset = offset;
+    location.length = 1;
+    return location;
+}
+
+/**
+ * @tc.name: Set_001
+ * @tc.desc: The templates are stored by the bundle name and the device type
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigIndexTest, Set_001, TestSize.Level0)
+{
+    KeyMappingConfigIndex index;
+    ASSERT_TRUE(index.Set(BUNDLE_NAME, GAME_KEY_BOARD, BuildLocation(0)));
+    ASSERT_TRUE(index.Set(BUNDLE_NAME, HOVER_TOUCH_PAD, BuildLocation(0)));
+    ASSERT_TRUE(index.Set(BUNDLE_NAME_WITH_PREFIX, UNKNOWN, BuildLocation(0)));
+    ASSERT_FALSE(index.Set(BUNDLE_NAME, INVALID_DEVICE_TYPE, BuildLocation(0)));
+    ASSERT_EQ(3, index.Size());
+    ASSERT_EQ(2, index.BundleCount());
+
+    // replace in place
+    ASSERT_TRUE(index.Set(BUNDLE_NAME, GAME_KEY_BOARD, BuildLocation(OFFSET)));
+    ASSERT_EQ(3, index.Size());
+    ASSERT_EQ(OFFSET, index.Find(BUNDLE_NAME, GAME_KEY_BOARD).offset);
+    ASSERT_TRUE(index.Find(BUNDLE_NAME_WITH_PREFIX, UNKNOWN).IsValid());
+    ASSERT_FALSE(index.Find(BUNDLE_NAME, GAME_PAD).IsValid());
+    ASSERT_FALSE(index.Find(BUNDLE_NAME, INVALID_DEVICE_TYPE).IsValid());
+    ASSERT_FALSE(index.Find(BUNDLE_NAME_NOT_EXIST, GAME_KEY_BOARD).IsValid());
+}
+
+/**
+ * @tc.name: EraseBundle_001
+ * @tc.desc: Only the templates of the bundle are deleted, and its slot is reused by the next bundle
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigIndexTest, EraseBundle_001, TestSize.Level0)
+{
+    KeyMappingConfigIndex index;
+    index.Set(BUNDLE_NAME, GAME_KEY_BOARD, BuildLocation(0));
+    index.Set(BUNDLE_NAME, HOVER_TOUCH_PAD, BuildLocation(0));
+    index.Set(BUNDLE_NAME_WITH_PREFIX, GAME_KEY_BOARD, BuildLocation(0));
+
+    index.EraseBundle(BUNDLE_NAME);
+    ASSERT_EQ(1, index.Size());
+    ASSERT_EQ(1, index.BundleCount());
+    ASSERT_FALSE(index.Find(BUNDLE_NAME, GAME_KEY_BOARD).IsValid());
+    ASSERT_TRUE(index.Find(BUNDLE_NAME_WITH_PREFIX, GAME_KEY_BOARD).IsValid());
+
+    index.Set(BUNDLE_NAME, GAME_PAD, BuildLocation(0));
+    ASSERT_EQ(2, index.bundles_.size());
+    ASSERT_TRUE(index.freeBundleIds_.empty());
+    ASSERT_EQ(2, index.Size());
+}
+
+/**
+ * @tc.name: SetBundle_001
+ * @tc.desc: The bundle is released when all of its templates are removed
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigIndexTest, SetBundle_001, TestSize.Level0)
+{
+    KeyMappingConfigIndex index;
+    index.Set(BUNDLE_NAME, GAME_KEY_BOARD, BuildLocation(0));
+    index.Set(BUNDLE_NAME, HOVER_TOUCH_PAD, BuildLocation(0));
+
+    BundleKeyMappingLocations locations = index.GetBundle(BUNDLE_NAME);
+    locations[GAME_KEY_BOARD] = KeyMappingConfigLocation();
+    index.SetBundle(BUNDLE_NAME, locations);
+    ASSERT_EQ(1, index.Size());
+    ASSERT_FALSE(index.Find(BUNDLE_NAME, GAME_KEY_BOARD).IsValid());
+
+    locations[HOVER_TOUCH_PAD] = KeyMappingConfigLocation();
+    index.SetBundle(BUNDLE_NAME, locations);
+    ASSERT_EQ(0, index.Size());
+    ASSERT_EQ(0, index.BundleCount());
+    ASSERT_EQ(1, index.freeBundleIds_.size());
+}
+}
+}
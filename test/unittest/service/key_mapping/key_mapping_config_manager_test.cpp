@@ -95,8 +95,8 @@ void KeyMappingConfigManagerTest::TearDown()
 
 void KeyMappingConfigManagerTest::ClearCache()
 {
-    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.clear();
-    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.clear();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingConfigStore_.Clear();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingConfigStore_.Clear();
 }
 
 static KeyToTouchMappingInfo BuildMouseRightWalking()
@@ -164,6 +164,7 @@ static GameKeyMappingInfo BuildCustomKeyMappingConfig()
 {
     GameKeyMappingInfo keyMappingInfoConfig;
     keyMappingInfoConfig.bundleName = BUNDLE_NAME;
+    keyMappingInfoConfig.isOprDelete = false;
     keyMappingInfoConfig.deviceType = GAME_KEY_BOARD;
     keyMappingInfoConfig.customKeyToTouchMappings.push_back(
         BuildSkillKeyMapping(CUSTOM_KEYCODE_A, CUSTOM_KEYCODE_A_X_VALUE, CUSTOM_KEYCODE_A_Y_VALUE));
@@ -179,6 +180,7 @@ static GameKeyMappingInfo BuildDefaultKeyMappingConfig()
 {
     GameKeyMappingInfo keyMappingInfoConfig;
     keyMappingInfoConfig.bundleName = BUNDLE_NAME;
+    keyMappingInfoConfig.isOprDelete = false;
     keyMappingInfoConfig.deviceType = GAME_KEY_BOARD;
     keyMappingInfoConfig.defaultKeyToTouchMappings.push_back(
         BuildSkillKeyMapping(DEFAULT_KEYCODE_C, DEFAULT_KEYCODE_D_X_VALUE, DEFAULT_KEYCODE_D_Y_VALUE));
@@ -190,6 +192,17 @@ static GameKeyMappingInfo BuildDefaultKeyMappingConfig()
     return keyMappingInfoConfig;
 }
 
+static GameKeyMappingInfo BuildHoverTouchPadKeyMappingConfig()
+{
+    GameKeyMappingInfo keyMappingInfoConfig;
+    keyMappingInfoConfig.bundleName = BUNDLE_NAME;
+    keyMappingInfoConfig.isOprDelete = false;
+    keyMappingInfoConfig.deviceType = HOVER_TOUCH_PAD;
+    keyMappingInfoConfig.customKeyToTouchMappings.push_back(
+        BuildSingleKeyMapping(CUSTOM_KEYCODE_B, CUSTOM_KEYCODE_B_X_VALUE, CUSTOM_KEYCODE_B_Y_VALUE));
+    return keyMappingInfoConfig;
+}
+
 static void CheckKeyMapping(const std::vector<KeyToTouchMappingInfo> &exceptConfig,
                             const std::vector<KeyMapping> &resultConfig)
 {
@@ -235,10 +248,10 @@ HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfig_001, TestSiz
         keyMappingInfoConfig);
 
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
-    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
-    KeyMappingInfoConfig result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->customKeyMappingInfoConfigMap_.at(keyMappingInfoConfig.bundleName + "_"
-        + std::to_string(keyMappingInfoConfig.deviceType));
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig result = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Find(keyMappingInfoConfig.bundleName, keyMappingInfoConfig.deviceType);
     ASSERT_EQ(keyMappingInfoConfig.bundleName, result.bundleName);
     ASSERT_EQ(GAME_KEY_BOARD, result.deviceType);
     ASSERT_EQ(KEY_MAPPING_SIZE, result.customKeyMappings.size());
@@ -261,7 +274,8 @@ HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfig_002, TestSiz
     keyMappingInfoConfigNew.bundleName = BUNDLE_NAME_2;
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfig(
         keyMappingInfoConfigNew);
-    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
 
     // delete config
     keyMappingInfoConfig.isOprDelete = true;
@@ -269,10 +283,10 @@ HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfig_002, TestSiz
         keyMappingInfoConfig);
 
     // check delete result
-    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
-    KeyMappingInfoConfig result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->customKeyMappingInfoConfigMap_.at(keyMappingInfoConfigNew.bundleName + "_"
-        + std::to_string(keyMappingInfoConfigNew.deviceType));
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig result = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Find(keyMappingInfoConfigNew.bundleName, keyMappingInfoConfigNew.deviceType);
     ASSERT_EQ(keyMappingInfoConfigNew.deviceType, result.deviceType);
 }
 
@@ -289,13 +303,15 @@ HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfig_003, TestSiz
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfig(
         keyMappingInfoConfig);
     GameKeyMappingInfo keyMappingInfoConfigNew;
+    keyMappingInfoConfigNew.isOprDelete = false;
     keyMappingInfoConfigNew.deviceType = HOVER_TOUCH_PAD;
     keyMappingInfoConfigNew.bundleName = BUNDLE_NAME;
     keyMappingInfoConfigNew.customKeyToTouchMappings.push_back(
         BuildSingleKeyMapping(CUSTOM_KEYCODE_B, CUSTOM_KEYCODE_B_X_VALUE, CUSTOM_KEYCODE_B_Y_VALUE));
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfig(
         keyMappingInfoConfigNew);
-    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
 
     // delete config
     keyMappingInfoConfig.isOprDelete = true;
@@ -304,9 +320,11 @@ HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfig_003, TestSiz
         keyMappingInfoConfig);
 
     // check delete result
-    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
-    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
 }
 
 /**
@@ -340,9 +358,10 @@ HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_001, TestSi
         keyMappingInfoConfig);
 
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
-    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.size());
-    KeyMappingInfoConfig result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->defaultKeyMappingInfoConfigMap_.at(BUNDLE_NAME + "_" + std::to_string(keyMappingInfoConfig.deviceType));
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig result = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Find(BUNDLE_NAME, keyMappingInfoConfig.deviceType);
     ASSERT_EQ(keyMappingInfoConfig.bundleName, result.bundleName);
     ASSERT_EQ(GAME_KEY_BOARD, result.deviceType);
     ASSERT_EQ(KEY_MAPPING_SIZE, result.defaultKeyMappings.size());
@@ -365,7 +384,8 @@ HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_002, TestSi
     keyMappingInfoConfigNew.bundleName = BUNDLE_NAME_2;
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
         keyMappingInfoConfigNew);
-    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
 
     // delete config
     keyMappingInfoConfig.isOprDelete = true;
@@ -374,9 +394,10 @@ HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_002, TestSi
 
     // check delete result
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
-    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.size());
-    KeyMappingInfoConfig result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->defaultKeyMappingInfoConfigMap_.at(keyMappingInfoConfigNew.bundleName + "_3");
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig result = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Find(keyMappingInfoConfigNew.bundleName, GAME_KEY_BOARD);
     ASSERT_EQ(GAME_KEY_BOARD, result.deviceType);
 }
 
@@ -393,6 +414,7 @@ HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_003, TestSi
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
         keyMappingInfoConfig);
     GameKeyMappingInfo keyMappingInfoConfigNew;
+    keyMappingInfoConfigNew.isOprDelete = false;
     keyMappingInfoConfigNew.deviceType = HOVER_TOUCH_PAD;
     keyMappingInfoConfigNew.bundleName = BUNDLE_NAME;
     keyMappingInfoConfigNew.customKeyToTouchMappings.push_back(
@@ -408,9 +430,11 @@ HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_003, TestSi
 
     // check delete result
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
-    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
-    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.size());
+    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
 }
 
 /**
@@ -451,20 +475,139 @@ HWTEST_F(KeyMappingConfigManagerTest, LoadConfigFromJsonFile_001, TestSize.Level
     DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
 
     // check data
-    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->defaultKeyMappingInfoConfigMap_.size());
-    KeyMappingInfoConfig defaultResult = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->defaultKeyMappingInfoConfigMap_.at(defaultKeyMappingInfoConfig.bundleName + "_3");
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig defaultResult = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Find(defaultKeyMappingInfoConfig.bundleName, GAME_KEY_BOARD);
     ASSERT_EQ(KEY_MAPPING_SIZE, defaultResult.defaultKeyMappings.size());
     CheckKeyMapping(defaultKeyMappingInfoConfig.defaultKeyToTouchMappings, defaultResult.defaultKeyMappings);
 
-    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()->customKeyMappingInfoConfigMap_.size());
-    KeyMappingInfoConfig customResult = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->customKeyMappingInfoConfigMap_.at(
-        customKeyMappingInfoConfig.bundleName + "_" + std::to_string(customKeyMappingInfoConfig.deviceType));
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig customResult = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Find(
+        customKeyMappingInfoConfig.bundleName, customKeyMappingInfoConfig.deviceType);
     ASSERT_EQ(KEY_MAPPING_SIZE, customResult.customKeyMappings.size());
     CheckKeyMapping(customKeyMappingInfoConfig.customKeyToTouchMappings, customResult.customKeyMappings);
 }
 
+/**
+ * @tc.name: LoadConfigFromJsonFile_002
+ * @tc.desc: The reference resolution of the template is saved and loaded with the key mappings
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, LoadConfigFromJsonFile_002, TestSize.Level0)
+{
+    // add data
+    GameKeyMappingInfo defaultKeyMappingInfoConfig = BuildDefaultKeyMappingConfig();
+    defaultKeyMappingInfoConfig.defaultResolution.width = 1920;
+    defaultKeyMappingInfoConfig.defaultResolution.height = 1080;
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
+        defaultKeyMappingInfoConfig);
+    GameKeyMappingInfo customKeyMappingInfoConfig = BuildCustomKeyMappingConfig();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfig(
+        customKeyMappingInfoConfig);
+    this->ClearCache();
+
+    // load data
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
+
+    // check data
+    GetGameKeyMappingInfoParam param;
+    param.bundleName = defaultKeyMappingInfoConfig.bundleName;
+    param.deviceType = defaultKeyMappingInfoConfig.deviceType;
+    GameKeyMappingInfo gameKeyMappingInfo;
+    int32_t result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->GetGameKeyMappingConfig(param, gameKeyMappingInfo);
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, result);
+    ASSERT_TRUE(gameKeyMappingInfo.defaultResolution == defaultKeyMappingInfoConfig.defaultResolution);
+    ASSERT_FALSE(gameKeyMappingInfo.customResolution.IsValid());
+}
+
+/**
+ * @tc.name: LoadConfigFromJsonFile_003
+ * @tc.desc: The response curves of the templates are saved and loaded with the key mappings
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, LoadConfigFromJsonFile_003, TestSize.Level0)
+{
+    // add data
+    GameKeyMappingInfo defaultKeyMappingInfoConfig = BuildDefaultKeyMappingConfig();
+    defaultKeyMappingInfoConfig.defaultResponseCurve.type = RESPONSE_CURVE_POWER;
+    defaultKeyMappingInfoConfig.defaultResponseCurve.exponent = 1.5;
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
+        defaultKeyMappingInfoConfig);
+    GameKeyMappingInfo customKeyMappingInfoConfig = BuildCustomKeyMappingConfig();
+    customKeyMappingInfoConfig.customResponseCurve.type = RESPONSE_CURVE_TABLE;
+    customKeyMappingInfoConfig.customResponseCurve.points = {{0.25, 0.1}, {1.0, 1.0}};
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfig(
+        customKeyMappingInfoConfig);
+    this->ClearCache();
+
+    // load data
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
+
+    // check data
+    GetGameKeyMappingInfoParam param;
+    param.bundleName = defaultKeyMappingInfoConfig.bundleName;
+    param.deviceType = defaultKeyMappingInfoConfig.deviceType;
+    GameKeyMappingInfo gameKeyMappingInfo;
+    int32_t result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->GetGameKeyMappingConfig(param, gameKeyMappingInfo);
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, result);
+    ASSERT_TRUE(gameKeyMappingInfo.defaultResponseCurve == defaultKeyMappingInfoConfig.defaultResponseCurve);
+    ASSERT_TRUE(gameKeyMappingInfo.customResponseCurve == customKeyMappingInfoConfig.customResponseCurve);
+}
+
+/**
+ * @tc.name: SetDefaultGameKeyMappingConfig_005
+ * @tc.desc: The reference resolution is invalid
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_005, TestSize.Level0)
+{
+    GameKeyMappingInfo keyMappingInfoConfig = BuildDefaultKeyMappingConfig();
+    keyMappingInfoConfig.defaultResolution.width = 1920;
+
+    int32_t rtn = DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
+        keyMappingInfoConfig);
+
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, rtn);
+}
+
+/**
+ * @tc.name: SetDefaultGameKeyMappingConfig_006
+ * @tc.desc: Deleting by bundleName keeps the bundle whose name starts with the deleted one
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, SetDefaultGameKeyMappingConfig_006, TestSize.Level0)
+{
+    GameKeyMappingInfo keyMappingInfoConfig = BuildDefaultKeyMappingConfig();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(keyMappingInfoConfig);
+    GameKeyMappingInfo prefixKeyMappingInfoConfig = BuildDefaultKeyMappingConfig();
+    prefixKeyMappingInfoConfig.bundleName = BUNDLE_NAME + "_" + std::to_string(GAME_KEY_BOARD);
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
+        prefixKeyMappingInfoConfig);
+
+    keyMappingInfoConfig.isOprDelete = true;
+    keyMappingInfoConfig.deviceType = UNKNOWN;
+    int32_t rtn = DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
+        keyMappingInfoConfig);
+
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
+    ASSERT_EQ(1, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Size());
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
+    ASSERT_NE(nullptr, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Find(prefixKeyMappingInfoConfig.bundleName, GAME_KEY_BOARD));
+    ASSERT_EQ(nullptr, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Find(BUNDLE_NAME, GAME_KEY_BOARD));
+}
+
 /**
  * @tc.name: GetGameKeyMappingConfig_001
  * @tc.desc: Only query default config by bundleName and deviceType
@@ -493,8 +636,8 @@ HWTEST_F(KeyMappingConfigManagerTest, GetGameKeyMappingConfig_001, TestSize.Leve
     ASSERT_EQ(GAME_CONTROLLER_SUCCESS, result);
     ASSERT_EQ(KEY_MAPPING_SIZE, gameKeyMappingInfo.defaultKeyToTouchMappings.size());
     ASSERT_EQ(0, gameKeyMappingInfo.customKeyToTouchMappings.size());
-    KeyMappingInfoConfig defaultConfig = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->defaultKeyMappingInfoConfigMap_.at(param.bundleName + "_3");
+    KeyMappingInfoConfig defaultConfig = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->defaultKeyMappingConfigStore_.Find(param.bundleName, GAME_KEY_BOARD);
     CheckKeyMapping(gameKeyMappingInfo.defaultKeyToTouchMappings, defaultConfig.defaultKeyMappings);
 }
 
@@ -523,8 +666,8 @@ HWTEST_F(KeyMappingConfigManagerTest, GetGameKeyMappingConfig_002, TestSize.Leve
     // check data
     ASSERT_EQ(KEY_MAPPING_SIZE, gameKeyMappingInfo.defaultKeyToTouchMappings.size());
     ASSERT_EQ(KEY_MAPPING_SIZE, gameKeyMappingInfo.customKeyToTouchMappings.size());
-    KeyMappingInfoConfig customConfig = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
-        ->customKeyMappingInfoConfigMap_.at(param.bundleName + "_" + std::to_string(param.deviceType));
+    KeyMappingInfoConfig customConfig = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Find(param.bundleName, param.deviceType);
     CheckKeyMapping(gameKeyMappingInfo.customKeyToTouchMappings, customConfig.customKeyMappings);
 }
 
@@ -554,5 +697,103 @@ HWTEST_F(KeyMappingConfigManagerTest, GetGameKeyMappingConfig_003, TestSize.Leve
     // check data
     ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, result);
 }
+
+/**
+ * @tc.name: SetCustomGameKeyMappingConfigs_001
+ * @tc.desc: Succeeded in setting several customized configurations of one game at once.
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfigs_001, TestSize.Level0)
+{
+    GameKeyMappingInfo keyboardConfig = BuildCustomKeyMappingConfig();
+    GameKeyMappingInfo hoverTouchPadConfig = BuildHoverTouchPadKeyMappingConfig();
+
+    int32_t rtn = DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfigs(
+        {keyboardConfig, hoverTouchPadConfig});
+
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, rtn);
+    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
+    this->ClearCache();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->LoadConfigFromJsonFile();
+    ASSERT_EQ(2, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
+    KeyMappingInfoConfig result = *DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Find(BUNDLE_NAME, HOVER_TOUCH_PAD);
+    CheckKeyMapping(hoverTouchPadConfig.customKeyToTouchMappings, result.customKeyMappings);
+}
+
+/**
+ * @tc.name: SetCustomGameKeyMappingConfigs_002
+ * @tc.desc: Nothing is applied if one of the configurations is invalid.
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, SetCustomGameKeyMappingConfigs_002, TestSize.Level0)
+{
+    GameKeyMappingInfo keyboardConfig = BuildCustomKeyMappingConfig();
+    GameKeyMappingInfo otherGameConfig = BuildCustomKeyMappingConfig();
+    otherGameConfig.bundleName = BUNDLE_NAME_2;
+
+    int32_t rtn = DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfigs(
+        {keyboardConfig, otherGameConfig});
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, rtn);
+
+    GameKeyMappingInfo invalidConfig = BuildCustomKeyMappingConfig();
+    invalidConfig.deviceType = UNKNOWN;
+    rtn = DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfigs(
+        {keyboardConfig, invalidConfig});
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, rtn);
+
+    std::vector<GameKeyMappingInfo> overLimitConfigs(MAX_BATCH_KEY_MAPPING_SIZE + 1, keyboardConfig);
+    rtn = DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfigs(
+        overLimitConfigs);
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, rtn);
+    ASSERT_EQ(0, DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->customKeyMappingConfigStore_.Size());
+}
+
+/**
+ * @tc.name: GetGameKeyMappingConfigs_001
+ * @tc.desc: Query the configurations of several device types at once
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigManagerTest, GetGameKeyMappingConfigs_001, TestSize.Level0)
+{
+    // add data
+    GameKeyMappingInfo defaultKeyMappingInfoConfig = BuildDefaultKeyMappingConfig();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetDefaultGameKeyMappingConfig(
+        defaultKeyMappingInfoConfig);
+    GameKeyMappingInfo hoverTouchPadConfig = BuildHoverTouchPadKeyMappingConfig();
+    DelayedSingleton<KeyMappingConfigManager>::GetInstance()->SetCustomGameKeyMappingConfig(hoverTouchPadConfig);
+
+    // get data
+    GetGameKeyMappingInfoParam keyboardParam;
+    keyboardParam.bundleName = BUNDLE_NAME;
+    keyboardParam.deviceType = GAME_KEY_BOARD;
+    GetGameKeyMappingInfoParam hoverTouchPadParam;
+    hoverTouchPadParam.bundleName = BUNDLE_NAME;
+    hoverTouchPadParam.deviceType = HOVER_TOUCH_PAD;
+    std::vector<GameKeyMappingInfo> gameKeyMappingInfos;
+    int32_t result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->GetGameKeyMappingConfigs({keyboardParam, hoverTouchPadParam}, gameKeyMappingInfos);
+
+    // check data
+    ASSERT_EQ(GAME_CONTROLLER_SUCCESS, result);
+    ASSERT_EQ(2, gameKeyMappingInfos.size());
+    ASSERT_EQ(GAME_KEY_BOARD, gameKeyMappingInfos[0].deviceType);
+    ASSERT_EQ(KEY_MAPPING_SIZE, gameKeyMappingInfos[0].defaultKeyToTouchMappings.size());
+    ASSERT_EQ(0, gameKeyMappingInfos[0].customKeyToTouchMappings.size());
+    ASSERT_EQ(HOVER_TOUCH_PAD, gameKeyMappingInfos[1].deviceType);
+    ASSERT_EQ(0, gameKeyMappingInfos[1].defaultKeyToTouchMappings.size());
+    ASSERT_EQ(1, gameKeyMappingInfos[1].customKeyToTouchMappings.size());
+
+    hoverTouchPadParam.bundleName = "";
+    result = DelayedSingleton<KeyMappingConfigManager>::GetInstance()
+        ->GetGameKeyMappingConfigs({keyboardParam, hoverTouchPadParam}, gameKeyMappingInfos);
+    ASSERT_EQ(GAME_ERR_ARGUMENT_INVALID, result);
+}
 }
 }
\ No newline at end of file
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/hwext/gtest-ext.h"
+#include "gtest/hwext/gtest-tag.h"
+
+#define private public
+
+#include "key_mapping_config_store.h"
+#include "key_mapping_config_manager.h"
+
+#undef private
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "json_utils.h"
+
+using namespace testing::ext;
+using namespace std;
+using json = nlohmann::json;
+
+namespace OHOS {
+namespace GameController {
+namespace {
+const std::string STORE_FILE = GAME_CONTROLLER_SERVICE_ROOT + "key_mapping_config_store_test.json";
+const std::string BUNDLE_NAME = "test.pkg";
+const std::string BUNDLE_NAME_WITH_ESCAPE = "test\"pkg";
+const std::string BUNDLE_NAME_2 = "newtest.pkg";
+const int32_t KEY_CODE = 2017;
+const int32_t KEY_CODE_2 = 2018;
+const int32_t JSON_INDENT = 4;
+const size_t CACHE_CAPACITY = 2;
+}
+
+class KeyMappingConfigStoreTest : public testing::Test {
+public:
+    void SetUp() {};
+
+    void TearDown() {};
+
+    static void WriteStoreFile(const std::string &content);
+
+    static KeyMappingInfoConfig BuildConfig(const std::string &bundleName, int32_t deviceType, int32_t keyCode);
+};
+
+void KeyMappingConfigStoreTest::WriteStoreFile(const std::string &content)
+{
+    std::ofstream file(STORE_FILE);
+    file << content;
+    file.close();
+}
+
+KeyMappingInfoConfig KeyMappingConfigStoreTest::BuildConfig(const std::string &bundleName, int32_t deviceType,
+                                                            int32_t keyCode)
+{
+    KeyMappingInfoConfig config;
+    config.bundleName = bundleName;
+    config.deviceType = deviceType;
+    KeyMapping keyMapping;
+    keyMapping.mappingType = SINGE_KEY_TO_TOUCH;
+    keyMapping.keyCode = keyCode;
+    keyMapping.combinationKeys = {keyCode, keyCode};
+    config.customKeyMappings.push_back(keyMapping);
+    return config;
+}
+
+/**
+ * @tc.name: Load_001
+ * @tc.desc: Only the locations are loaded, and the template is decoded and cached when it's requested
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigStoreTest, Load_001, TestSize.Level0)
+{
+    json content = json::array();
+    content.push_back(BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE).ConvertToJson(true));
+    content.push_back(BuildConfig(BUNDLE_NAME_WITH_ESCAPE, HOVER_TOUCH_PAD, KEY_CODE).ConvertToJson(true));
+    content.push_back(BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE_2).ConvertToJson(true));
+    WriteStoreFile(content.dump(JSON_INDENT));
+
+    KeyMappingConfigStore store(STORE_FILE, true);
+    ASSERT_EQ(2, store.Load());
+    ASSERT_EQ(0, store.cache_.Size());
+
+    std::shared_ptr<const KeyMappingInfoConfig> config = store.Find(BUNDLE_NAME, GAME_KEY_BOARD);
+    ASSERT_NE(nullptr, config);
+    ASSERT_EQ(1, config->customKeyMappings.size());
+    ASSERT_EQ(KEY_CODE, config->customKeyMappings[0].keyCode);
+    ASSERT_EQ(1, store.cache_.Size());
+    ASSERT_EQ(config, store.Find(BUNDLE_NAME, GAME_KEY_BOARD));
+
+    config = store.Find(BUNDLE_NAME_WITH_ESCAPE, HOVER_TOUCH_PAD);
+    ASSERT_NE(nullptr, config);
+    ASSERT_EQ(BUNDLE_NAME_WITH_ESCAPE, config->bundleName);
+    ASSERT_EQ(nullptr, store.Find(BUNDLE_NAME, HOVER_TOUCH_PAD));
+}
+
+/**
+ * @tc.name: Load_002
+ * @tc.desc: Nothing is loaded from a file which is not a JSON array
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigStoreTest, Load_002, TestSize.Level0)
+{
+    KeyMappingConfigStore store(STORE_FILE, true);
+    WriteStoreFile("{\"bundleName\":\"test.pkg\"}");
+    ASSERT_EQ(0, store.Load());
+    WriteStoreFile("[{\"bundleName\":\"test.pkg\"");
+    ASSERT_EQ(0, store.Load());
+}
+
+/**
+ * @tc.name: Update_001
+ * @tc.desc: The untouched templates are kept when one bundle is updated
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigStoreTest, Update_001, TestSize.Level0)
+{
+    json content = json::array();
+    content.push_back(BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE).ConvertToJson(true));
+    content.push_back(BuildConfig(BUNDLE_NAME, HOVER_TOUCH_PAD, KEY_CODE).ConvertToJson(true));
+    content.push_back(BuildConfig(BUNDLE_NAME_2, GAME_KEY_BOARD, KEY_CODE).ConvertToJson(true));
+    WriteStoreFile(content.dump(JSON_INDENT));
+    KeyMappingConfigStore store(STORE_FILE, true);
+    store.Load();
+
+    BundleKeyMappingChange change;
+    change.isChanged[GAME_KEY_BOARD] = true;
+    change.configs[GAME_KEY_BOARD] = std::make_shared<const KeyMappingInfoConfig>(
+        BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE_2));
+    ASSERT_TRUE(store.Update(BUNDLE_NAME, change));
+    ASSERT_EQ(3, store.Size());
+    ASSERT_EQ(KEY_CODE_2, store.Find(BUNDLE_NAME, GAME_KEY_BOARD)->customKeyMappings[0].keyCode);
+
+    // the rewritten file is a valid JSON array, and the locations still match it
+    std::pair<bool, json> ret = JsonUtils::ReadJsonFromFile(STORE_FILE);
+    ASSERT_TRUE(ret.first);
+    ASSERT_EQ(3, ret.second.size());
+    ASSERT_EQ(KEY_CODE, store.Find(BUNDLE_NAME, HOVER_TOUCH_PAD)->customKeyMappings[0].keyCode);
+    ASSERT_EQ(BUNDLE_NAME_2, store.Find(BUNDLE_NAME_2, GAME_KEY_BOARD)->bundleName);
+
+    change.isChanged.fill(true);
+    change.configs.fill(nullptr);
+    ASSERT_TRUE(store.Update(BUNDLE_NAME, change));
+    ASSERT_EQ(1, store.Size());
+    ASSERT_EQ(nullptr, store.Find(BUNDLE_NAME, GAME_KEY_BOARD));
+    ASSERT_EQ(1, store.Load());
+    ASSERT_NE(nullptr, store.Find(BUNDLE_NAME_2, GAME_KEY_BOARD));
+}
+
+/**
+ * @tc.name: Update_002
+ * @tc.desc: The old file and the old locations are kept when the new file can't be written
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigStoreTest, Update_002, TestSize.Level0)
+{
+    json content = json::array();
+    content.push_back(BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE).ConvertToJson(true));
+    WriteStoreFile(content.dump(JSON_INDENT));
+    KeyMappingConfigStore store(STORE_FILE, true);
+    store.Load();
+    std::string oldContent;
+    ASSERT_TRUE(JsonUtils::ReadFile(STORE_FILE, oldContent));
+
+    // the temporary file can't be created while a directory has its name
+    const std::string tempPath = STORE_FILE + ".tmp";
+    ASSERT_TRUE(std::filesystem::create_directory(tempPath));
+    BundleKeyMappingChange change;
+    change.isChanged[GAME_KEY_BOARD] = true;
+    change.configs[GAME_KEY_BOARD] = std::make_shared<const KeyMappingInfoConfig>(
+        BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE_2));
+    bool ret = store.Update(BUNDLE_NAME, change);
+    std::filesystem::remove(tempPath);
+    ASSERT_FALSE(ret);
+
+    std::string newContent;
+    ASSERT_TRUE(JsonUtils::ReadFile(STORE_FILE, newContent));
+    ASSERT_EQ(oldContent, newContent);
+    store.cache_.Clear();
+    ASSERT_EQ(KEY_CODE, store.Find(BUNDLE_NAME, GAME_KEY_BOARD)->customKeyMappings[0].keyCode);
+}
+
+/**
+ * @tc.name: Find_001
+ * @tc.desc: The template is read from the file opened before it's replaced, and it's not cached after the update
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigStoreTest, Find_001, TestSize.Level0)
+{
+    json content = json::array();
+    content.push_back(BuildConfig(BUNDLE_NAME_2, GAME_KEY_BOARD, KEY_CODE).ConvertToJson(true));
+    content.push_back(BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE).ConvertToJson(true));
+    WriteStoreFile(content.dump(JSON_INDENT));
+    KeyMappingConfigStore store(STORE_FILE, true);
+    store.Load();
+
+    // a reader takes the location and the file with the lock
+    std::vector<std::shared_ptr<const KeyMappingInfoConfig>> configs(1);
+    std::vector<KeyMappingConfigStore::PendingConfig> pendingConfigs;
+    int32_t fd = -1;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(store.mutex_);
+        store.FindLocked(BUNDLE_NAME, GAME_KEY_BOARD, 0, configs, pendingConfigs);
+        fd = JsonUtils::OpenFile(STORE_FILE);
+        generation = store.generation_;
+    }
+    ASSERT_EQ(1, pendingConfigs.size());
+    ASSERT_GE(fd, 0);
+
+    // the writer replaces the file before the reader reads it, and the template of the reader is moved
+    BundleKeyMappingChange change;
+    change.isChanged[GAME_KEY_BOARD] = true;
+    change.configs[GAME_KEY_BOARD] = std::make_shared<const KeyMappingInfoConfig>(
+        BuildConfig(BUNDLE_NAME_2, GAME_KEY_BOARD, KEY_CODE_2));
+    ASSERT_TRUE(store.Update(BUNDLE_NAME_2, change));
+
+    store.DecodePendingConfigs(fd, generation, pendingConfigs, configs);
+    ASSERT_NE(nullptr, configs[0]);
+    ASSERT_EQ(BUNDLE_NAME, configs[0]->bundleName);
+    ASSERT_EQ(KEY_CODE, configs[0]->customKeyMappings[0].keyCode);
+    ASSERT_EQ(nullptr, store.cache_.Get(BUNDLE_NAME, GAME_KEY_BOARD));
+    ASSERT_EQ(KEY_CODE, store.Find(BUNDLE_NAME, GAME_KEY_BOARD)->customKeyMappings[0].keyCode);
+    ASSERT_EQ(KEY_CODE_2, store.Find(BUNDLE_NAME_2, GAME_KEY_BOARD)->customKeyMappings[0].keyCode);
+}
+
+/**
+ * @tc.name: KeyMappingConfigCache_001
+ * @tc.desc: The least recently used template is dropped when the cache is full
+ * @tc.type: FUNC
+ * @tc.require: issueNumber
+ */
+HWTEST_F(KeyMappingConfigStoreTest, KeyMappingConfigCache_001, TestSize.Level0)
+{
+    KeyMappingConfigCache cache(CACHE_CAPACITY);
+    auto config = std::make_shared<const KeyMappingInfoConfig>(BuildConfig(BUNDLE_NAME, GAME_KEY_BOARD, KEY_CODE));
+    cache.Put(BUNDLE_NAME, GAME_KEY_BOARD, config);
+    cache.Put(BUNDLE_NAME, HOVER_TOUCH_PAD, config);
+    ASSERT_EQ(config, cache.Get(BUNDLE_NAME, GAME_KEY_BOARD));
+
+    cache.Put(BUNDLE_NAME_2, GAME_KEY_BOARD, config);
+    ASSERT_EQ(CACHE_CAPACITY, cache.Size());
+    ASSERT_EQ(nullptr, cache.Get(BUNDLE_NAME, HOVER_TOUCH_PAD));
+    ASSERT_EQ(config, cache.Get(BUNDLE_NAME, GAME_KEY_BOARD));
+    ASSERT_EQ(config, cache.Get(BUNDLE_NAME_2, GAME_KEY_BOARD));
+
+    cache.Erase(BUNDLE_NAME, GAME_KEY_BOARD);
+    ASSERT_EQ(nullptr, cache.Get(BUNDLE_NAME, GAME_KEY_BOARD));
+    ASSERT_EQ(1, cache.Size());
+}
+}
+}
@@ -44,6 +44,11 @@ namespace {
 const int64_t ACTION_TIME = 1111;
 const int32_t DEVICE_ID = 12;
 const int32_t SLEEP_TIME = 50;
+
+/**
+ * The realtime clock and the monotonic clock are not read at the same instant, 1ms in ns.
+ */
+const int64_t DELTA_TIME_TOLERANCE = 1000000;
 }
 
 class WindowInputInterceptTest : public testing::Test {
@@ -542,5 +547,79 @@ HWTEST_F(WindowInputInterceptConsumerTest, OnInputEvent_015, TestSize.Level0)
     TestReceiverEvent(MMI::KeyEvent::KEY_ACTION_CANCEL, 1);
 }
 
+/**
+* @tc.name: OnInputEvent_016
+* @tc.desc: KeyEvent event: The original time and the delivery time are carried to the callback.
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(WindowInputInterceptConsumerTest, OnInputEvent_016, TestSize.Level0)
+{
+    std::shared_ptr<MMI::KeyEvent> keyEvent = CreateNormalKeyEvent();
+    MultiModalInputMgtService::instance_ = multiModalInputMgtServiceMock_;
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = "test";
+    EXPECT_CALL(*(multiModalInputMgtServiceMock_.get()), GetDeviceInfo(keyEvent->GetDeviceId())).WillOnce(
+        Return(deviceInfo));
+    consumer_->OnInputEvent(keyEvent);
+    ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+    ASSERT_EQ(buttonCallback_->result_.originalTime, ACTION_TIME);
+    ASSERT_GT(buttonCallback_->result_.deliveryTime, ACTION_TIME);
+}
+
+/**
+* @tc.name: OnInputEvent_017
+* @tc.desc: PointerEvent event: The original time and the delivery time are carried to the callback.
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(WindowInputInterceptConsumerTest, OnInputEvent_017, TestSize.Level0)
+{
+    std::shared_ptr<MMI::PointerEvent> pointerEvent = CreateNormalPointerEvent();
+    pointerEvent->SetAxisValue(PointerEvent::AxisType::AXIS_TYPE_ABS_X, 1);
+    InputEventClient::RegisterGamePadAxisEventCallback(ApiTypeEnum::CAPI,
+                                                       GamePadAxisSourceTypeEnum::LeftThumbstick,
+                                                       axisCallback_);
+    MultiModalInputMgtService::instance_ = multiModalInputMgtServiceMock_;
+    DeviceInfo deviceInfo;
+    deviceInfo.uniq = "test";
+    EXPECT_CALL(*(multiModalInputMgtServiceMock_.get()), GetDeviceInfo(pointerEvent->GetDeviceId())).WillOnce(
+        Return(deviceInfo));
+    consumer_->OnInputEvent(pointerEvent);
+    ffrt::this_task::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+    ASSERT_EQ(axisCallback_->result_.originalTime, ACTION_TIME);
+    ASSERT_GT(axisCallback_->result_.deliveryTime, ACTION_TIME);
+}
+
+/**
+* @tc.name: GetDeltaTime_001
+* @tc.desc: When the last refresh is older than the refresh interval, the delta time is re-derived.
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(WindowInputInterceptConsumerTest, GetDeltaTime_001, TestSize.Level0)
+{
+    int64_t deltaTime = consumer_->deltaTime_.load();
+    consumer_->deltaTime_.store(0);
+    ASSERT_EQ(consumer_->GetDeltaTime(), 0);
+    consumer_->lastRefreshTime_.store(0);
+    ASSERT_NEAR(consumer_->GetDeltaTime(), deltaTime, DELTA_TIME_TOLERANCE);
+}
+
+/**
+* @tc.name: RefreshDeltaTime_001
+* @tc.desc: After the system time is changed, the delta time is re-derived at once.
+* @tc.type: FUNC
+* @tc.require: issueNumber
+*/
+HWTEST_F(WindowInputInterceptConsumerTest, RefreshDeltaTime_001, TestSize.Level0)
+{
+    int64_t deltaTime = consumer_->deltaTime_.load();
+    consumer_->deltaTime_.store(0);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo;
+    TimeChangeEventListener listener(subscribeInfo, consumer_);
+    listener.OnReceiveEvent(EventFwk::CommonEventData());
+    ASSERT_NEAR(consumer_->GetDeltaTime(), deltaTime, DELTA_TIME_TOLERANCE);
+}
+}
 }
-}
\ No newline at end of file